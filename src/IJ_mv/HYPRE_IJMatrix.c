@@ -47,6 +47,8 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
    hypre_IJMatrixOMPFlag(ijmatrix)        = 0;
+   hypre_IJMatrixBulkAssembly(ijmatrix)   = 0;
+   hypre_IJMatrixPatternPlan(ijmatrix)    = NULL;
 
    hypre_MPI_Comm_size(comm,&num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
@@ -442,6 +444,15 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
    }
    else
 #endif
+   if (hypre_IJMatrixBulkAssembly(ijmatrix) && !hypre_IJMatrixAssembleFlag(ijmatrix))
+   {
+      hypre_IJMatrixSetAddValuesParCSRBulk(ijmatrix, nrows, ncols, rows, row_indexes, cols, values, "set");
+   }
+   else if (hypre_IJMatrixPatternPlan(ijmatrix) && hypre_IJMatrixAssembleFlag(ijmatrix))
+   {
+      hypre_IJMatrixSetAddValuesParCSRFrozen(ijmatrix, nrows, ncols, rows, row_indexes, cols, values, "set");
+   }
+   else
    {
       HYPRE_Int *row_indexes_tmp = (HYPRE_Int *) row_indexes;
       HYPRE_Int *ncols_tmp = ncols;
@@ -649,6 +660,15 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
    }
    else
 #endif
+   if (hypre_IJMatrixBulkAssembly(ijmatrix) && !hypre_IJMatrixAssembleFlag(ijmatrix))
+   {
+      hypre_IJMatrixSetAddValuesParCSRBulk(ijmatrix, nrows, ncols, rows, row_indexes, cols, values, "add");
+   }
+   else if (hypre_IJMatrixPatternPlan(ijmatrix) && hypre_IJMatrixAssembleFlag(ijmatrix))
+   {
+      hypre_IJMatrixSetAddValuesParCSRFrozen(ijmatrix, nrows, ncols, rows, row_indexes, cols, values, "add");
+   }
+   else
    {
       HYPRE_Int *row_indexes_tmp = (HYPRE_Int *) row_indexes;
       HYPRE_Int *ncols_tmp = ncols;
@@ -1204,3 +1224,46 @@ HYPRE_IJMatrixSetOMPFlag( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetBulkAssembly( HYPRE_IJMatrix matrix,
+                               HYPRE_Int      bulk_assembly )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixBulkAssembly(ijmatrix) = bulk_assembly;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetFreezePattern( HYPRE_IJMatrix matrix,
+                                HYPRE_Int      freeze )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return( hypre_IJMatrixFreezePatternParCSR( ijmatrix, freeze ) );
+}
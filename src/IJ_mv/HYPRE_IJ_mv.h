@@ -323,6 +323,49 @@ HYPRE_Int HYPRE_IJMatrixSetPrintLevel(HYPRE_IJMatrix matrix,
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag(HYPRE_IJMatrix matrix,
                                    HYPRE_Int      omp_flag);
 
+/**
+ * (Optional) Switches the host assembly of the matrix to a bulk mode if
+ * \e bulk_assembly is set to a value != 0.  Until the first call to
+ * HYPRE_IJMatrixAssemble, HYPRE_IJMatrixSetValues and
+ * HYPRE_IJMatrixAddToValues then only append the (row, column, value)
+ * triples to a stack, and HYPRE_IJMatrixAssemble sorts the stack and
+ * combines duplicate entries, with the same rules as for a single call:
+ * a set value replaces all previous values of the entry, and added values
+ * are summed.  This is much faster than the default when the entries come
+ * in no particular order or with many duplicates, e.g. from a finite
+ * element assembly, but needs storage for all the triples.
+ *
+ * Every thread has its own stack, so the set and add routines can be
+ * called concurrently from within an OpenMP parallel region, and rows
+ * may be repeated across calls.  This must be called before
+ * HYPRE_IJMatrixInitialize, and has no effect on matrices on the device,
+ * which always assemble in this way.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetBulkAssembly(HYPRE_IJMatrix matrix,
+                                        HYPRE_Int      bulk_assembly);
+
+/**
+ * (Optional) Freezes the sparsity pattern of an assembled matrix if
+ * \e freeze is set to a value != 0, for codes that refill the same
+ * connectivity many times, e.g. once per nonlinear iteration.  After the
+ * freeze, the calls to HYPRE_IJMatrixSetValues and
+ * HYPRE_IJMatrixAddToValues up to the next HYPRE_IJMatrixAssemble are
+ * recorded: the position of every entry in the matrix, and the owners of
+ * the off-processor entries, are looked up once.  Every later refill must
+ * then pass the same entries in the same order; they are put directly at
+ * their recorded positions, and HYPRE_IJMatrixAssemble only exchanges the
+ * off-processor values with a fixed set of neighbors.  Entries that do
+ * not match the recorded ones are an error.
+ *
+ * As for any assembled matrix, only existing entries can be set or added
+ * to, and sets to rows owned by other processors are ignored.  This must
+ * be called by all processors, and \e freeze = 0 goes back to the default
+ * refill.  The refill calls must be made from a single thread, since they
+ * are matched by their order.  Host only.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetFreezePattern(HYPRE_IJMatrix matrix,
+                                         HYPRE_Int      freeze);
+
 /**
  * Read the matrix from file.  This is mainly for debugging purposes.
  **/
@@ -287,10 +287,20 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
          hypre_IJMatrixTranslator(matrix) = aux_matrix;
       }
 
+      /* bulk assembly builds diag and offd from the stacks at assembly */
+      if (memory_location_aux == HYPRE_MEMORY_HOST && hypre_IJMatrixBulkAssembly(matrix))
+      {
+         hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
+      }
+
       hypre_ParCSRMatrixInitialize_v2(par_matrix, memory_location);
       hypre_AuxParCSRMatrixInitialize_v2(aux_matrix, memory_location_aux);
 
-      if (memory_location_aux == HYPRE_MEMORY_HOST)
+      if (memory_location_aux == HYPRE_MEMORY_HOST && hypre_IJMatrixBulkAssembly(matrix))
+      {
+         hypre_AuxParCSRMatrixInitializeBulk(aux_matrix, 2 * hypre_NumThreads());
+      }
+      else if (memory_location_aux == HYPRE_MEMORY_HOST)
       {
          if (hypre_AuxParCSRMatrixDiagSizes(aux_matrix))
          {
@@ -1622,6 +1632,7 @@ hypre_IJMatrixDestroyParCSR(hypre_IJMatrix *matrix)
 {
    hypre_ParCSRMatrixDestroy((hypre_ParCSRMatrix *)hypre_IJMatrixObject(matrix));
    hypre_AuxParCSRMatrixDestroy((hypre_AuxParCSRMatrix*)hypre_IJMatrixTranslator(matrix));
+   hypre_IJPatternPlanDestroy(hypre_IJMatrixPatternPlan(matrix));
 
    return hypre_error_flag;
 }
@@ -1648,8 +1659,8 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 {
    MPI_Comm comm = hypre_IJMatrixComm(matrix);
 
-   HYPRE_Int i, j, k, in_i;
-   HYPRE_Int myid;
+   HYPRE_Int i, j, k;
+   HYPRE_Int myid, num_procs;
 
    HYPRE_Int proc_id, last_proc, prev_id, tmp_id;
    HYPRE_Int max_response_size;
@@ -1668,11 +1679,13 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int counter;
    HYPRE_Int num_real_procs;
    HYPRE_Int /*current_proc,*/ original_proc_indx;
+   HYPRE_Int num_recv_rows, num_recv_elmts;
 
    HYPRE_BigInt *row_list=NULL;
    HYPRE_Int *row_list_num_elements=NULL;
    HYPRE_Int *a_proc_id=NULL, *orig_order=NULL;
-   HYPRE_Int *real_proc_id = NULL, *us_real_proc_id = NULL;
+   HYPRE_Int *real_proc_id = NULL, *proc_indx = NULL;
+   HYPRE_Int *buf_pos = NULL, *elmt_pos = NULL;
    HYPRE_Int *ex_contact_procs = NULL, *ex_contact_vec_starts = NULL;
    HYPRE_BigInt *ex_contact_buf = NULL;
    HYPRE_Int *recv_starts=NULL;
@@ -1680,29 +1693,25 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int *response_buf_starts=NULL;
    HYPRE_Int *num_rows_per_proc = NULL, *num_elements_total = NULL;
    HYPRE_Int *argsort_contact_procs = NULL;
+   HYPRE_BigInt *recv_rows = NULL;
+   HYPRE_Int *recv_ncols = NULL, *recv_row_indexes = NULL;
+   HYPRE_BigInt *recv_j = NULL;
+   HYPRE_Complex *recv_data = NULL;
 
    HYPRE_Int  obj_size_bytes, complex_size;
    HYPRE_BigInt big_int_size;
-   HYPRE_Int  tmp_int;
-   HYPRE_BigInt  tmp_big_int;
-   HYPRE_BigInt *col_ptr;
-   HYPRE_BigInt *big_int_data = NULL;
-   HYPRE_Int big_int_data_size = 0, complex_data_size = 0;
 
    void *void_contact_buf = NULL;
    void *index_ptr;
    void *recv_data_ptr;
 
-   HYPRE_Complex  tmp_complex;
-   HYPRE_Complex *col_data_ptr;
-   HYPRE_Complex *complex_data = NULL;
-
    hypre_DataExchangeResponse  response_obj1, response_obj2;
    hypre_ProcListElements      send_proc_obj;
 
    hypre_IJAssumedPart   *apart;
 
    hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
    global_num_cols = hypre_IJMatrixGlobalNumCols(matrix);
    global_first_col = hypre_IJMatrixGlobalFirstCol(matrix);
    global_first_row = hypre_IJMatrixGlobalFirstRow(matrix);
@@ -1733,13 +1742,7 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
       hypre_TFree(tmp, HYPRE_MEMORY_HOST);
    }
 
-   /* call hypre_IJMatrixAddToValuesParCSR directly inside this function
-    * with one chunk of data */
-   HYPRE_Int      off_proc_nelm_recv_cur = 0;
-   HYPRE_Int      off_proc_nelm_recv_max = 0;
    HYPRE_BigInt  *off_proc_i_recv = NULL;
-   HYPRE_BigInt  *off_proc_j_recv = NULL;
-   HYPRE_Complex *off_proc_data_recv = NULL;
    HYPRE_BigInt  *off_proc_i_recv_d = NULL;
    HYPRE_BigInt  *off_proc_j_recv_d = NULL;
    HYPRE_Complex *off_proc_data_recv_d = NULL;
@@ -1770,6 +1773,9 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    /* get the assumed processor id for each row */
    if (num_rows > 0 )
    {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, row, proc_id) HYPRE_SMP_SCHEDULE
+#endif
       for (i=0; i < num_rows; i++)
       {
          row = off_proc_i[i*2];
@@ -1777,8 +1783,9 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
          row_list[i] = row;
          row_list_num_elements[i] = off_proc_i[i*2+1];
 
-         hypre_GetAssumedPartitionProcFromRow(comm, row, global_first_row,
-                                              global_num_cols, &proc_id);
+         /* no MPI calls inside the threaded loop */
+         hypre_GetAssumedPartitionProcFromRow_v2(num_procs, row, global_first_row,
+                                                 global_num_cols, &proc_id);
          a_proc_id[i] = proc_id;
          orig_order[i] = i;
       }
@@ -1908,6 +1915,10 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    num_rows_per_proc = hypre_CTAlloc(HYPRE_Int,  num_real_procs, HYPRE_MEMORY_HOST);
    num_elements_total  =  hypre_CTAlloc(HYPRE_Int,  num_real_procs, HYPRE_MEMORY_HOST);
 
+   /* proc_indx[i] is the position in ex_contact_procs of the owner of row i
+      (in the original order) */
+   proc_indx = hypre_CTAlloc(HYPRE_Int,  num_rows, HYPRE_MEMORY_HOST);
+
    counter = 0;
 
    if (num_real_procs > 0 )
@@ -1915,6 +1926,7 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
       ex_contact_procs[0] = real_proc_id[0];
       num_rows_per_proc[0] = 1;
       num_elements_total[0] = row_list_num_elements[orig_order[0]];
+      proc_indx[orig_order[0]] = 0;
 
       /* loop through real procs - these are sorted (row_list is sorted also)*/
       for (i=1; i < num_rows; i++)
@@ -1931,9 +1943,12 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
             num_rows_per_proc[counter] = 1;
             num_elements_total[counter] = row_list_num_elements[orig_order[i]];
          }
+         proc_indx[orig_order[i]] = counter;
       }
    }
 
+   hypre_TFree(real_proc_id, HYPRE_MEMORY_HOST);
+
    /* to pack together, we need to use the largest obj. size of
       (HYPRE_Int) and (HYPRE_Complex) - if these are much different, then we are
       wasting some storage, but I do not think that it will be a
@@ -1952,93 +1967,96 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    /* first calculate total storage and make vec_starts arrays */
    storage = 0;
    ex_contact_vec_starts = hypre_CTAlloc(HYPRE_Int,  num_real_procs + 1, HYPRE_MEMORY_HOST);
-   ex_contact_vec_starts[0] = -1;
 
    for (i=0; i < num_real_procs; i++)
    {
+      ex_contact_vec_starts[i] = storage;
       storage += 1 + 2 * num_rows_per_proc[i] + 2* num_elements_total[i];
-      ex_contact_vec_starts[i+1] = -storage-1; /* need negative for next loop */
    }
-
-   hypre_TFree(num_elements_total, HYPRE_MEMORY_HOST);
+   ex_contact_vec_starts[num_real_procs] = storage;
 
    /*void_contact_buf = hypre_MAlloc(storage*obj_size_bytes);*/
    void_contact_buf = hypre_CTAlloc(char, storage*obj_size_bytes, HYPRE_MEMORY_HOST);
-   index_ptr = void_contact_buf; /* step through with this index */
 
    /* for each proc: #rows, row #, no. elements,
       col indicies, col data, row #, no. elements, col indicies, col data, etc. */
 
-   /* un-sort real_proc_id - we want to access data arrays in order, so
-      cheaper to do this*/
-   us_real_proc_id =  hypre_CTAlloc(HYPRE_Int,  num_rows, HYPRE_MEMORY_HOST);
-   for (i=0; i < num_rows; i++)
+   /* the rows of a proc are packed in their original order.  Compute where
+      each row goes in the buffer (buf_pos) and where its elements start in
+      off_proc_j (elmt_pos), so that the rows can be packed in parallel.
+      num_elements_total is reused as the fill pointer of each proc */
+   buf_pos = hypre_CTAlloc(HYPRE_Int,  num_rows, HYPRE_MEMORY_HOST);
+   elmt_pos = hypre_CTAlloc(HYPRE_Int,  num_rows, HYPRE_MEMORY_HOST);
+
+   for (i=0; i < num_real_procs; i++)
    {
-      us_real_proc_id[orig_order[i]] = real_proc_id[i];
+      index_ptr = (void *) ((char *) void_contact_buf + ex_contact_vec_starts[i]*obj_size_bytes);
+      hypre_TMemcpy( index_ptr,  &num_rows_per_proc[i], HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      num_elements_total[i] = ex_contact_vec_starts[i] + 1;
    }
-   hypre_TFree(real_proc_id, HYPRE_MEMORY_HOST);
 
    counter = 0; /* index into data arrays */
-   prev_id = -1;
    for (i=0; i < num_rows; i++)
    {
-      proc_id = us_real_proc_id[i];
+      indx = proc_indx[i];
+      buf_pos[i] = num_elements_total[indx];
+      elmt_pos[i] = counter;
+      num_elements_total[indx] += 2 + 2*row_list_num_elements[i];
+      counter += row_list_num_elements[i];
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, row, num_elements, counter, index_ptr) HYPRE_SMP_SCHEDULE
+#endif
+   for (i=0; i < num_rows; i++)
+   {
       /* can't use row list[i] - you loose the negative signs that differentiate
          add/set values */
       row = off_proc_i[i*2];
       num_elements = row_list_num_elements[i];
-      /* find position of this processor */
-      indx = hypre_BinarySearch(ex_contact_procs, proc_id, num_real_procs);
-      in_i = ex_contact_vec_starts[indx];
-
-      index_ptr = (void *) ((char *) void_contact_buf + in_i*obj_size_bytes);
-
-      /* first time for this processor - add the number of rows to the buffer */
-      if (in_i < 0)
-      {
-         in_i = -in_i - 1;
-         /* re-calc. index_ptr since in_i was negative */
-         index_ptr = (void *) ((char *) void_contact_buf + in_i*obj_size_bytes);
-
-         tmp_int =  num_rows_per_proc[indx];
-         hypre_TMemcpy( index_ptr,  &tmp_int, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
+      counter = elmt_pos[i];
+      index_ptr = (void *) ((char *) void_contact_buf + buf_pos[i]*obj_size_bytes);
 
-         in_i++;
-      }
       /* add row # */
       hypre_TMemcpy( index_ptr,  &row, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
       index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-      in_i++;
 
       /* add number of elements */
       hypre_TMemcpy( index_ptr,  &num_elements, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
       index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-      in_i++;
 
       /* now add col indices  */
-      for (j=0; j< num_elements; j++)
+      if (big_int_size == obj_size_bytes)
       {
-         tmp_big_int = off_proc_j[counter+j]; /* col number */
-
-         hypre_TMemcpy( index_ptr,  &tmp_big_int, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-         in_i ++;
+         hypre_TMemcpy( index_ptr,  &off_proc_j[counter], HYPRE_BigInt, num_elements,
+                        HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         index_ptr = (void *) ((char *) index_ptr + num_elements*obj_size_bytes);
+      }
+      else
+      {
+         for (j=0; j< num_elements; j++)
+         {
+            hypre_TMemcpy( index_ptr,  &off_proc_j[counter+j], HYPRE_BigInt, 1,
+                           HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
+         }
       }
 
       /* now add data */
-      for (j=0; j< num_elements; j++)
+      if (complex_size == obj_size_bytes)
       {
-         tmp_complex = off_proc_data[counter++]; /* value */
-
-         hypre_TMemcpy( index_ptr,  &tmp_complex, HYPRE_Complex, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-         in_i++;
+         hypre_TMemcpy( index_ptr,  &off_proc_data[counter], HYPRE_Complex, num_elements,
+                        HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         for (j=0; j< num_elements; j++)
+         {
+            hypre_TMemcpy( index_ptr,  &off_proc_data[counter+j], HYPRE_Complex, 1,
+                           HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
+         }
       }
-
-      /* increment the indexes to keep track of where we are - we
-       * adjust below to be actual starts*/
-      ex_contact_vec_starts[indx] = in_i;
    }
 
    /* some clean up */
@@ -2046,18 +2064,14 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
    hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
 
-   hypre_TFree(us_real_proc_id, HYPRE_MEMORY_HOST);
+   hypre_TFree(proc_indx, HYPRE_MEMORY_HOST);
+   hypre_TFree(buf_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(elmt_pos, HYPRE_MEMORY_HOST);
    hypre_TFree(orig_order, HYPRE_MEMORY_HOST);
    hypre_TFree(row_list, HYPRE_MEMORY_HOST);
    hypre_TFree(row_list_num_elements, HYPRE_MEMORY_HOST);
    hypre_TFree(num_rows_per_proc, HYPRE_MEMORY_HOST);
-
-   for (i=num_real_procs; i > 0; i--)
-   {
-      ex_contact_vec_starts[i] =   ex_contact_vec_starts[i-1];
-   }
-
-   ex_contact_vec_starts[0] = 0;
+   hypre_TFree(num_elements_total, HYPRE_MEMORY_HOST);
 
    /* now send the data */
 
@@ -2116,146 +2130,248 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
     * argsort_contact_procs */
    hypre_qsort2i( send_proc_obj.id, argsort_contact_procs, 0, num_recvs-1 );
 
-   /* alias */
-   recv_data_ptr = send_proc_obj.v_elements;
    recv_starts = send_proc_obj.vec_starts;
 
+   /* walk through the row headers of the messages, in processor order, and
+      record each row and where its col indices start in the buffer */
+   num_recv_rows = 0;
    for (i=0; i < num_recvs; i++)
    {
+      indx = recv_starts[argsort_contact_procs[i]];
+      recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + indx*obj_size_bytes);
+      hypre_TMemcpy( &num_rows, recv_data_ptr, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      num_recv_rows += num_rows;
+   }
+
+   recv_rows = hypre_CTAlloc(HYPRE_BigInt,  num_recv_rows, HYPRE_MEMORY_HOST);
+   recv_ncols = hypre_CTAlloc(HYPRE_Int,  num_recv_rows, HYPRE_MEMORY_HOST);
+   recv_row_indexes = hypre_CTAlloc(HYPRE_Int,  num_recv_rows, HYPRE_MEMORY_HOST);
+   buf_pos = hypre_CTAlloc(HYPRE_Int,  num_recv_rows, HYPRE_MEMORY_HOST);
 
+   counter = 0;
+   num_recv_elmts = 0;
+   for (i=0; i < num_recvs; i++)
+   {
       /* Find the current processor in order, and reset recv_data_ptr to that processor's message */
       original_proc_indx = argsort_contact_procs[i];
-      /*current_proc = send_proc_obj.id[i];*/
       indx = recv_starts[original_proc_indx];
       recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + indx*obj_size_bytes);
 
       /* get the number of rows for this recv */
       hypre_TMemcpy( &num_rows, recv_data_ptr, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-      recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
       indx++;
 
-
       for (j=0; j < num_rows; j++) /* for each row: unpack info */
       {
+         recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + indx*obj_size_bytes);
+
          /* row # */
-         hypre_TMemcpy( &row,  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy( &recv_rows[counter],  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
          recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-         indx++;
 
          /* num elements for this row */
          hypre_TMemcpy( &num_elements,  recv_data_ptr, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-         indx++;
 
-         /* col indices */ /* Need to check this again !!!! */
-         if (big_int_size == obj_size_bytes)
-         {
-            col_ptr = (HYPRE_BigInt *) recv_data_ptr;
-            recv_data_ptr = (void *) ((char *)recv_data_ptr + num_elements*obj_size_bytes);
-         }
-         else /* copy data */
+         recv_ncols[counter] = num_elements;
+         recv_row_indexes[counter] = num_recv_elmts;
+         buf_pos[counter] = indx + 2;
+         counter++;
+
+         num_recv_elmts += num_elements;
+         indx += 2 + num_elements*2;
+      }
+   }
+
+   /* now unpack the col indices and data of all rows in parallel */
+   recv_j = hypre_TAlloc(HYPRE_BigInt,  num_recv_elmts, HYPRE_MEMORY_HOST);
+   recv_data = hypre_TAlloc(HYPRE_Complex,  num_recv_elmts, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, k, num_elements, counter, recv_data_ptr) HYPRE_SMP_SCHEDULE
+#endif
+   for (i=0; i < num_recv_rows; i++)
+   {
+      num_elements = recv_ncols[i];
+      counter = recv_row_indexes[i];
+      recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + buf_pos[i]*obj_size_bytes);
+
+      /* col indices */
+      if (big_int_size == obj_size_bytes)
+      {
+         hypre_TMemcpy( &recv_j[counter],  recv_data_ptr, HYPRE_BigInt, num_elements,
+                        HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         recv_data_ptr = (void *) ((char *)recv_data_ptr + num_elements*obj_size_bytes);
+      }
+      else /* copy data */
+      {
+         for (k=0; k< num_elements; k++)
          {
-            if (big_int_data_size < num_elements)
-            {
-               big_int_data = hypre_TReAlloc(big_int_data,  HYPRE_BigInt,  num_elements + 10, HYPRE_MEMORY_HOST);
-            }
-            for (k=0; k< num_elements; k++)
-            {
-               hypre_TMemcpy( &big_int_data[k],  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-               recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-            }
-            col_ptr = big_int_data;
+            hypre_TMemcpy( &recv_j[counter+k],  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
          }
+      }
 
-         /* col data */
-         if (complex_size == obj_size_bytes)
+      /* col data */
+      if (complex_size == obj_size_bytes)
+      {
+         hypre_TMemcpy( &recv_data[counter],  recv_data_ptr, HYPRE_Complex, num_elements,
+                        HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+      else /* copy data */
+      {
+         for (k=0; k< num_elements; k++)
          {
-            col_data_ptr = (HYPRE_Complex *) recv_data_ptr;
-            recv_data_ptr = (void *) ((char *)recv_data_ptr + num_elements*obj_size_bytes);
+            hypre_TMemcpy( &recv_data[counter+k],  recv_data_ptr, HYPRE_Complex, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
          }
-         else /* copy data */
-         {
-            if (complex_data_size < num_elements)
-            {
-               complex_data =
-                  hypre_TReAlloc(complex_data,  HYPRE_Complex,  num_elements + 10, HYPRE_MEMORY_HOST);
-            }
-            for (k=0; k< num_elements; k++)
-            {
-               hypre_TMemcpy( &complex_data[k],  recv_data_ptr, HYPRE_Complex, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-               recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-            }
-            col_data_ptr = complex_data;
+      }
+   }
 
-         }
+   hypre_TFree(buf_pos, HYPRE_MEMORY_HOST);
+
+   /* insert the received rows */
+   if (memory_location == HYPRE_MEMORY_HOST && hypre_IJMatrixBulkAssembly(matrix) &&
+       !hypre_IJMatrixAssembleFlag(matrix))
+   {
+      /* each thread pushes a contiguous range of rows on its own stack */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+      {
+         HYPRE_Int ns, ne;
 
-         if (memory_location == HYPRE_MEMORY_HOST)
+         hypre_GetSimpleThreadPartition(&ns, &ne, num_recv_rows);
+
+         hypre_IJMatrixAddRecvValuesParCSRBulk(matrix, ne - ns, recv_ncols + ns, recv_rows + ns,
+                                               recv_row_indexes + ns, recv_j, recv_data);
+      }
+   }
+   else if (memory_location == HYPRE_MEMORY_HOST && hypre_NumThreads() > 1)
+   {
+      /* hypre_IJMatrixAddToValuesOMPParCSR needs distinct rows.  A row received
+         several times is split over rounds: round r gets the r-th
+         occurrence of every row, so the values of a row are still added in
+         processor order */
+      HYPRE_BigInt  first_row = hypre_IJMatrixRowPartitioning(matrix)[0];
+      HYPRE_Int     num_local_rows = (HYPRE_Int)(hypre_IJMatrixRowPartitioning(matrix)[1] - first_row);
+      HYPRE_Int     num_rounds = 0, row_local, round;
+      HYPRE_Int    *row_count, *row_round, *round_starts, *round_fill;
+      HYPRE_BigInt *round_rows;
+      HYPRE_Int    *round_ncols, *round_row_indexes;
+
+      row_count = hypre_CTAlloc(HYPRE_Int,  num_local_rows, HYPRE_MEMORY_HOST);
+      row_round = hypre_CTAlloc(HYPRE_Int,  num_recv_rows, HYPRE_MEMORY_HOST);
+
+      for (i=0; i < num_recv_rows; i++)
+      {
+         row_local = (HYPRE_Int)(recv_rows[i] - first_row);
+         if (row_local >= 0 && row_local < num_local_rows)
          {
-            hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr, col_data_ptr);
+            row_round[i] = row_count[row_local]++;
+            num_rounds = hypre_max(num_rounds, row_round[i] + 1);
          }
          else
          {
-            HYPRE_Int nelm_new = off_proc_nelm_recv_cur + num_elements;
+            row_round[i] = 0;
+            num_rounds = hypre_max(num_rounds, 1);
+         }
+      }
 
-            if (nelm_new > off_proc_nelm_recv_max)
-            {
-               off_proc_nelm_recv_max = nelm_new * 2;
-               off_proc_i_recv    = hypre_TReAlloc(off_proc_i_recv,    HYPRE_BigInt,  off_proc_nelm_recv_max, HYPRE_MEMORY_HOST);
-               off_proc_j_recv    = hypre_TReAlloc(off_proc_j_recv,    HYPRE_BigInt,  off_proc_nelm_recv_max, HYPRE_MEMORY_HOST);
-               off_proc_data_recv = hypre_TReAlloc(off_proc_data_recv, HYPRE_Complex, off_proc_nelm_recv_max, HYPRE_MEMORY_HOST);
-            }
+      round_starts = hypre_CTAlloc(HYPRE_Int,  num_rounds + 1, HYPRE_MEMORY_HOST);
+      for (i=0; i < num_recv_rows; i++)
+      {
+         round_starts[row_round[i] + 1]++;
+      }
+      for (round=0; round < num_rounds; round++)
+      {
+         round_starts[round + 1] += round_starts[round];
+      }
 
-            HYPRE_Int i;
-            for (i = 0; i < num_elements; i++)
-            {
-               off_proc_i_recv[off_proc_nelm_recv_cur + i] = row;
-            }
-            hypre_TMemcpy(off_proc_j_recv + off_proc_nelm_recv_cur, col_ptr, HYPRE_BigInt, num_elements,
-                           HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-            hypre_TMemcpy(off_proc_data_recv + off_proc_nelm_recv_cur, col_data_ptr, HYPRE_Complex, num_elements,
-                           HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      round_rows = hypre_CTAlloc(HYPRE_BigInt,  num_recv_rows, HYPRE_MEMORY_HOST);
+      round_ncols = hypre_CTAlloc(HYPRE_Int,  num_recv_rows, HYPRE_MEMORY_HOST);
+      round_row_indexes = hypre_CTAlloc(HYPRE_Int,  num_recv_rows, HYPRE_MEMORY_HOST);
 
-            off_proc_nelm_recv_cur = nelm_new;
-         }
+      round_fill = hypre_CTAlloc(HYPRE_Int,  num_rounds, HYPRE_MEMORY_HOST);
+      for (round=0; round < num_rounds; round++)
+      {
+         round_fill[round] = round_starts[round];
+      }
+      for (i=0; i < num_recv_rows; i++)
+      {
+         k = round_fill[row_round[i]]++;
+         round_rows[k] = recv_rows[i];
+         round_ncols[k] = recv_ncols[i];
+         round_row_indexes[k] = recv_row_indexes[i];
+      }
 
-         indx += (num_elements*2);
+      for (round=0; round < num_rounds; round++)
+      {
+         k = round_starts[round];
+         hypre_IJMatrixAddToValuesOMPParCSR(matrix, round_starts[round + 1] - k,
+                                            round_ncols + k, round_rows + k,
+                                            round_row_indexes + k, recv_j, recv_data);
       }
-   }
 
-   if (memory_location == HYPRE_MEMORY_DEVICE)
+      hypre_TFree(row_count, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_round, HYPRE_MEMORY_HOST);
+      hypre_TFree(round_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(round_fill, HYPRE_MEMORY_HOST);
+      hypre_TFree(round_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(round_ncols, HYPRE_MEMORY_HOST);
+      hypre_TFree(round_row_indexes, HYPRE_MEMORY_HOST);
+   }
+   else if (memory_location == HYPRE_MEMORY_HOST)
+   {
+      for (i=0; i < num_recv_rows; i++)
+      {
+         hypre_IJMatrixAddToValuesParCSR(matrix, 1, &recv_ncols[i], &recv_rows[i], &row_index,
+                                         &recv_j[recv_row_indexes[i]],
+                                         &recv_data[recv_row_indexes[i]]);
+      }
+   }
+   else
    {
-      off_proc_i_recv_d    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_DEVICE);
-      off_proc_j_recv_d    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_DEVICE);
-      off_proc_data_recv_d = hypre_TAlloc(HYPRE_Complex, off_proc_nelm_recv_cur, HYPRE_MEMORY_DEVICE);
+      off_proc_i_recv = hypre_TAlloc(HYPRE_BigInt,  num_recv_elmts, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+      for (i=0; i < num_recv_rows; i++)
+      {
+         for (k=0; k < recv_ncols[i]; k++)
+         {
+            off_proc_i_recv[recv_row_indexes[i] + k] = recv_rows[i];
+         }
+      }
+
+      off_proc_i_recv_d    = hypre_TAlloc(HYPRE_BigInt,  num_recv_elmts, HYPRE_MEMORY_DEVICE);
+      off_proc_j_recv_d    = hypre_TAlloc(HYPRE_BigInt,  num_recv_elmts, HYPRE_MEMORY_DEVICE);
+      off_proc_data_recv_d = hypre_TAlloc(HYPRE_Complex, num_recv_elmts, HYPRE_MEMORY_DEVICE);
 
-      hypre_TMemcpy(off_proc_i_recv_d,    off_proc_i_recv,    HYPRE_BigInt,  off_proc_nelm_recv_cur,
+      hypre_TMemcpy(off_proc_i_recv_d,    off_proc_i_recv, HYPRE_BigInt,  num_recv_elmts,
                     HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
-      hypre_TMemcpy(off_proc_j_recv_d,    off_proc_j_recv,    HYPRE_BigInt,  off_proc_nelm_recv_cur,
+      hypre_TMemcpy(off_proc_j_recv_d,    recv_j,          HYPRE_BigInt,  num_recv_elmts,
                     HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
-      hypre_TMemcpy(off_proc_data_recv_d, off_proc_data_recv, HYPRE_Complex, off_proc_nelm_recv_cur,
+      hypre_TMemcpy(off_proc_data_recv_d, recv_data,       HYPRE_Complex, num_recv_elmts,
                     HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_CUDA)
-      hypre_IJMatrixSetAddValuesParCSRDevice(matrix, off_proc_nelm_recv_cur, NULL, off_proc_i_recv_d, NULL, off_proc_j_recv_d,
+      hypre_IJMatrixSetAddValuesParCSRDevice(matrix, num_recv_elmts, NULL, off_proc_i_recv_d, NULL, off_proc_j_recv_d,
                                              off_proc_data_recv_d, "add");
 #endif
    }
 
+   hypre_TFree(recv_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_ncols, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_row_indexes, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
+
    hypre_TFree(send_proc_obj.v_elements, HYPRE_MEMORY_HOST);
    hypre_TFree(send_proc_obj.vec_starts, HYPRE_MEMORY_HOST);
    hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
    hypre_TFree(argsort_contact_procs, HYPRE_MEMORY_HOST);
 
-   if (big_int_data)
-   {
-      hypre_TFree(big_int_data, HYPRE_MEMORY_HOST);
-   }
-
-   if (complex_data)
-   {
-      hypre_TFree(complex_data, HYPRE_MEMORY_HOST);
-   }
-
    if (memory_location == HYPRE_MEMORY_DEVICE)
    {
       hypre_TFree(off_proc_i,    HYPRE_MEMORY_HOST);
@@ -2264,8 +2380,6 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    }
 
    hypre_TFree(off_proc_i_recv,    HYPRE_MEMORY_HOST);
-   hypre_TFree(off_proc_j_recv,    HYPRE_MEMORY_HOST);
-   hypre_TFree(off_proc_data_recv, HYPRE_MEMORY_HOST);
 
    hypre_TFree(off_proc_i_recv_d,    HYPRE_MEMORY_DEVICE);
    hypre_TFree(off_proc_j_recv_d,    HYPRE_MEMORY_DEVICE);
@@ -2438,6 +2552,12 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
 
    max_num_threads = hypre_NumThreads();
 
+   /* refill of a matrix with a frozen pattern */
+   if (hypre_IJMatrixPatternPlan(matrix) && hypre_IJMatrixAssembleFlag(matrix))
+   {
+      return hypre_IJMatrixAssembleFrozenParCSR(matrix);
+   }
+
    /* first find out if anyone has an aux_matrix, and create one if you don't
     * have one, but other procs do */
    aux_flag = 0;
@@ -2502,6 +2622,10 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
          hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix) = new_off_proc_i_indx;
          hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = current_num_elmts;
       }*/
+      if (hypre_IJMatrixBulkAssembly(matrix) && hypre_IJMatrixAssembleFlag(matrix) == 0)
+      {
+         hypre_IJMatrixAssembleBulkOffProcParCSR(matrix);
+      }
       off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
       hypre_MPI_Allreduce(&off_proc_i_indx, &offd_proc_elmts, 1, HYPRE_MPI_INT,
                           hypre_MPI_SUM, comm);
@@ -2527,7 +2651,13 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       col_0 = col_partitioning[0];
       col_n = col_partitioning[1]-1;
       /* move data into ParCSRMatrix if not there already */
-      if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
+      if (hypre_IJMatrixBulkAssembly(matrix))
+      {
+         hypre_IJMatrixAssembleBulkParCSR(matrix);
+         big_offd_j = hypre_CSRMatrixBigJ(offd);
+         offd_j = hypre_CSRMatrixJ(offd);
+      }
+      else if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
       {
          HYPRE_Int *diag_array, *offd_array;
          diag_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
@@ -2757,6 +2887,18 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       hypre_IJMatrixAssembleFlag(matrix) = 1;
    }
 
+   /* without an aux matrix, the values of the assembled matrix were set in place */
+   if (aux_matrix)
+   {
+      hypre_CSRMatrixUpdateCompanions(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixUpdateCompanions(hypre_ParCSRMatrixOffd(par_matrix));
+   }
+   else
+   {
+      hypre_CSRMatrixUpdateCompanionValues(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixUpdateCompanionValues(hypre_ParCSRMatrixOffd(par_matrix));
+   }
+
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
 
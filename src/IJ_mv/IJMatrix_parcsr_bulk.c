@@ -0,0 +1,811 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR bulk (COO) assembly on the host
+ *
+ * Before the first assembly, SetValues and AddToValues only push the
+ * (i, j, data) triples onto a stack owned by the calling thread.  At
+ * assembly, the triples are sorted by (i, j) with a stable parallel radix
+ * sort and duplicates are reduced, which is what IJMatrix_parcsr_device.c
+ * does on GPUs.  For a run of equal (i, j), a `set' discards everything
+ * before it, and `adds' are summed.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+
+#define HYPRE_IJ_BULK_RADIX_BITS 8
+#define HYPRE_IJ_BULK_RADIX      (1 << HYPRE_IJ_BULK_RADIX_BITS)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixBulkPush
+ *
+ * Appends the entries to bulk stack number `stack' of aux_matrix.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixBulkPush( hypre_AuxParCSRMatrix *aux_matrix,
+                        HYPRE_Int              stack,
+                        HYPRE_Int              nrows,
+                        HYPRE_Int             *ncols,
+                        const HYPRE_BigInt    *rows,
+                        const HYPRE_Int       *row_indexes,
+                        const HYPRE_BigInt    *cols,
+                        const HYPRE_Complex   *values,
+                        char                   SorA )
+{
+   HYPRE_Int      ii, i, n, indx, nelms, cnt;
+   HYPRE_Int      stack_elmts_max, stack_elmts_current, stack_elmts_required;
+   HYPRE_BigInt  *stack_i;
+   HYPRE_BigInt  *stack_j;
+   HYPRE_Complex *stack_data;
+   char          *stack_sora;
+
+   if (ncols)
+   {
+      nelms = 0;
+      for (ii = 0; ii < nrows; ii++)
+      {
+         nelms += ncols[ii];
+      }
+   }
+   else
+   {
+      nelms = nrows;
+   }
+
+   if (nelms <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   stack_elmts_max      = hypre_AuxParCSRMatrixBulkMaxElmts(aux_matrix)[stack];
+   stack_elmts_current  = hypre_AuxParCSRMatrixBulkCurrentElmts(aux_matrix)[stack];
+   stack_elmts_required = stack_elmts_current + nelms;
+   stack_i              = hypre_AuxParCSRMatrixBulkI(aux_matrix)[stack];
+   stack_j              = hypre_AuxParCSRMatrixBulkJ(aux_matrix)[stack];
+   stack_data           = hypre_AuxParCSRMatrixBulkData(aux_matrix)[stack];
+   stack_sora           = hypre_AuxParCSRMatrixBulkSorA(aux_matrix)[stack];
+
+   if (stack_elmts_max < stack_elmts_required)
+   {
+      HYPRE_Int stack_elmts_max_new = hypre_max(2 * stack_elmts_max,
+                                                hypre_AuxParCSRMatrixLocalNumRows(aux_matrix));
+      stack_elmts_max_new = hypre_max(stack_elmts_required, stack_elmts_max_new);
+
+      stack_i    = hypre_TReAlloc(stack_i,    HYPRE_BigInt,  stack_elmts_max_new, HYPRE_MEMORY_HOST);
+      stack_j    = hypre_TReAlloc(stack_j,    HYPRE_BigInt,  stack_elmts_max_new, HYPRE_MEMORY_HOST);
+      stack_data = hypre_TReAlloc(stack_data, HYPRE_Complex, stack_elmts_max_new, HYPRE_MEMORY_HOST);
+      stack_sora = hypre_TReAlloc(stack_sora, char,          stack_elmts_max_new, HYPRE_MEMORY_HOST);
+
+      hypre_AuxParCSRMatrixBulkI(aux_matrix)[stack]         = stack_i;
+      hypre_AuxParCSRMatrixBulkJ(aux_matrix)[stack]         = stack_j;
+      hypre_AuxParCSRMatrixBulkData(aux_matrix)[stack]      = stack_data;
+      hypre_AuxParCSRMatrixBulkSorA(aux_matrix)[stack]      = stack_sora;
+      hypre_AuxParCSRMatrixBulkMaxElmts(aux_matrix)[stack]  = stack_elmts_max_new;
+   }
+
+   cnt  = stack_elmts_current;
+   indx = 0;
+   for (ii = 0; ii < nrows; ii++)
+   {
+      n = ncols ? ncols[ii] : 1;
+      if (row_indexes)
+      {
+         indx = row_indexes[ii];
+      }
+      for (i = 0; i < n; i++)
+      {
+         stack_i[cnt]    = rows[ii];
+         stack_j[cnt]    = cols[indx];
+         stack_data[cnt] = values[indx++];
+         stack_sora[cnt] = SorA;
+         cnt++;
+      }
+   }
+
+   hypre_AuxParCSRMatrixBulkCurrentElmts(aux_matrix)[stack] = cnt;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixSetAddValuesParCSRBulk
+ *
+ * Same arguments as hypre_IJMatrixSetAddValuesParCSRDevice.  Off-processor
+ * rows are stacked as well and sent at assembly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixSetAddValuesParCSRBulk( hypre_IJMatrix       *matrix,
+                                      HYPRE_Int             nrows,
+                                      HYPRE_Int            *ncols,        /* if NULL, == all ones */
+                                      const HYPRE_BigInt   *rows,
+                                      const HYPRE_Int      *row_indexes,  /* if NULL, == ex_scan of ncols, i.e, no gap */
+                                      const HYPRE_BigInt   *cols,
+                                      const HYPRE_Complex  *values,
+                                      const char           *action )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   const char             SorA       = action[0] == 's' ? 1 : 0;
+   HYPRE_Int              my_thread_num = hypre_GetThreadNum();
+
+   if (!aux_matrix)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "IJMatrix has not been initialized!");
+      return hypre_error_flag;
+   }
+
+   /* the stacks are normally created by HYPRE_IJMatrixInitialize */
+   if (!hypre_AuxParCSRMatrixNumBulkStacks(aux_matrix))
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_IJMatrixBulk)
+#endif
+      hypre_AuxParCSRMatrixInitializeBulk(aux_matrix, 2 * hypre_NumThreads());
+   }
+
+   if (my_thread_num >= hypre_AuxParCSRMatrixNumBulkStacks(aux_matrix) / 2)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Too many threads for IJMatrix bulk assembly!");
+      return hypre_error_flag;
+   }
+
+   return hypre_IJMatrixBulkPush(aux_matrix, my_thread_num, nrows, ncols, rows, row_indexes,
+                                 cols, values, SorA);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAddRecvValuesParCSRBulk
+ *
+ * Adds values received from other processors at assembly.  They go to the
+ * second half of the stacks, so that they come after every local set and
+ * add in the sort, whichever thread made them.  May be called from inside
+ * a parallel region, one call per thread.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAddRecvValuesParCSRBulk( hypre_IJMatrix       *matrix,
+                                       HYPRE_Int             nrows,
+                                       HYPRE_Int            *ncols,
+                                       const HYPRE_BigInt   *rows,
+                                       const HYPRE_Int      *row_indexes,
+                                       const HYPRE_BigInt   *cols,
+                                       const HYPRE_Complex  *values )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int              num_stacks = hypre_AuxParCSRMatrixNumBulkStacks(aux_matrix);
+   HYPRE_Int              my_thread_num = hypre_GetThreadNum();
+
+   if (my_thread_num >= num_stacks / 2)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Too many threads for IJMatrix bulk assembly!");
+      return hypre_error_flag;
+   }
+
+   return hypre_IJMatrixBulkPush(aux_matrix, num_stacks / 2 + my_thread_num, nrows, ncols, rows,
+                                 row_indexes, cols, values, 0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixBulkGather
+ *
+ * Copies the stacked entries whose row is in [row_start, row_end) (on_proc
+ * = 1) or not in it (on_proc = 0) into contiguous arrays, keeping the
+ * order of the stacks.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixBulkGather( hypre_AuxParCSRMatrix  *aux_matrix,
+                          HYPRE_BigInt            row_start,
+                          HYPRE_BigInt            row_end,
+                          HYPRE_Int               on_proc,
+                          HYPRE_Int              *nelms_ptr,
+                          HYPRE_BigInt          **I_ptr,
+                          HYPRE_BigInt          **J_ptr,
+                          HYPRE_Complex         **A_ptr,
+                          char                  **X_ptr )
+{
+   HYPRE_Int       num_stacks      = hypre_AuxParCSRMatrixNumBulkStacks(aux_matrix);
+   HYPRE_Int       max_num_threads = hypre_NumThreads();
+   HYPRE_Int      *stack_starts;
+   HYPRE_Int      *thread_starts;
+   HYPRE_Int       s, total, nelms = 0;
+   HYPRE_BigInt   *I = NULL;
+   HYPRE_BigInt   *J = NULL;
+   HYPRE_Complex  *A = NULL;
+   char           *X = NULL;
+
+   stack_starts  = hypre_CTAlloc(HYPRE_Int, num_stacks + 1,      HYPRE_MEMORY_HOST);
+   thread_starts = hypre_CTAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+
+   for (s = 0; s < num_stacks; s++)
+   {
+      stack_starts[s+1] = stack_starts[s] + hypre_AuxParCSRMatrixBulkCurrentElmts(aux_matrix)[s];
+   }
+   total = stack_starts[num_stacks];
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(s)
+#endif
+   {
+      HYPRE_Int     num_threads   = hypre_NumActiveThreads();
+      HYPRE_Int     my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int     ns, ne, k, k0, k1, cnt, t;
+      HYPRE_BigInt *stack_i;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, total);
+
+      cnt = 0;
+      for (s = 0; s < num_stacks; s++)
+      {
+         k0 = hypre_max(ns, stack_starts[s])   - stack_starts[s];
+         k1 = hypre_min(ne, stack_starts[s+1]) - stack_starts[s];
+         stack_i = hypre_AuxParCSRMatrixBulkI(aux_matrix)[s];
+         for (k = k0; k < k1; k++)
+         {
+            if ((stack_i[k] >= row_start && stack_i[k] < row_end) == on_proc)
+            {
+               cnt++;
+            }
+         }
+      }
+      thread_starts[my_thread_num+1] = cnt;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         for (t = 0; t < num_threads; t++)
+         {
+            thread_starts[t+1] += thread_starts[t];
+         }
+         nelms = thread_starts[num_threads];
+         I = hypre_TAlloc(HYPRE_BigInt,  nelms, HYPRE_MEMORY_HOST);
+         J = hypre_TAlloc(HYPRE_BigInt,  nelms, HYPRE_MEMORY_HOST);
+         A = hypre_TAlloc(HYPRE_Complex, nelms, HYPRE_MEMORY_HOST);
+         X = hypre_TAlloc(char,          nelms, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      cnt = thread_starts[my_thread_num];
+      for (s = 0; s < num_stacks; s++)
+      {
+         k0 = hypre_max(ns, stack_starts[s])   - stack_starts[s];
+         k1 = hypre_min(ne, stack_starts[s+1]) - stack_starts[s];
+         stack_i = hypre_AuxParCSRMatrixBulkI(aux_matrix)[s];
+         for (k = k0; k < k1; k++)
+         {
+            if ((stack_i[k] >= row_start && stack_i[k] < row_end) == on_proc)
+            {
+               I[cnt] = stack_i[k];
+               J[cnt] = hypre_AuxParCSRMatrixBulkJ(aux_matrix)[s][k];
+               A[cnt] = hypre_AuxParCSRMatrixBulkData(aux_matrix)[s][k];
+               X[cnt] = hypre_AuxParCSRMatrixBulkSorA(aux_matrix)[s][k];
+               cnt++;
+            }
+         }
+      }
+   } /* end parallel region */
+
+   *nelms_ptr = nelms;
+   *I_ptr     = I;
+   *J_ptr     = J;
+   *A_ptr     = A;
+   *X_ptr     = X;
+
+   hypre_TFree(stack_starts,  HYPRE_MEMORY_HOST);
+   hypre_TFree(thread_starts, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixBulkRadixSort
+ *
+ * Stable LSD radix sort of the pairs (keys, perm) by keys in [0, max_key].
+ * keys_tmp and perm_tmp are work arrays of the same size; the sorted
+ * arrays are returned in *keys_ptr and *perm_ptr, which may have been
+ * swapped with the work arrays.  Passes over a digit that is the same for
+ * all keys are skipped.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixBulkRadixSort( HYPRE_Int             n,
+                             hypre_ulonglongint    max_key,
+                             hypre_ulonglongint  **keys_ptr,
+                             HYPRE_Int           **perm_ptr,
+                             hypre_ulonglongint  **keys_tmp_ptr,
+                             HYPRE_Int           **perm_tmp_ptr )
+{
+   hypre_ulonglongint *keys     = *keys_ptr;
+   HYPRE_Int          *perm     = *perm_ptr;
+   hypre_ulonglongint *keys_tmp = *keys_tmp_ptr;
+   HYPRE_Int          *perm_tmp = *perm_tmp_ptr;
+   hypre_ulonglongint *keys_swap;
+   HYPRE_Int          *perm_swap;
+   HYPRE_Int          *counts;
+   HYPRE_Int           shift, skip;
+
+   counts = hypre_CTAlloc(HYPRE_Int, hypre_NumThreads() * HYPRE_IJ_BULK_RADIX, HYPRE_MEMORY_HOST);
+
+   for (shift = 0; shift < 64 && (max_key >> shift); shift += HYPRE_IJ_BULK_RADIX_BITS)
+   {
+      skip = 0;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+      {
+         HYPRE_Int  num_threads   = hypre_NumActiveThreads();
+         HYPRE_Int  my_thread_num = hypre_GetThreadNum();
+         HYPRE_Int *my_counts     = counts + my_thread_num * HYPRE_IJ_BULK_RADIX;
+         HYPRE_Int  ns, ne, k, b, t, c, pos, total;
+
+         hypre_GetSimpleThreadPartition(&ns, &ne, n);
+
+         for (b = 0; b < HYPRE_IJ_BULK_RADIX; b++)
+         {
+            my_counts[b] = 0;
+         }
+         for (k = ns; k < ne; k++)
+         {
+            my_counts[(keys[k] >> shift) & (HYPRE_IJ_BULK_RADIX - 1)]++;
+         }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+         /* bucket-major, then thread-major offsets keep the sort stable */
+         if (my_thread_num == 0)
+         {
+            pos = 0;
+            for (b = 0; b < HYPRE_IJ_BULK_RADIX; b++)
+            {
+               total = 0;
+               for (t = 0; t < num_threads; t++)
+               {
+                  c = counts[t * HYPRE_IJ_BULK_RADIX + b];
+                  counts[t * HYPRE_IJ_BULK_RADIX + b] = pos;
+                  pos   += c;
+                  total += c;
+               }
+               if (total == n)
+               {
+                  skip = 1;
+               }
+            }
+         }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+         if (!skip)
+         {
+            for (k = ns; k < ne; k++)
+            {
+               b = (HYPRE_Int) ((keys[k] >> shift) & (HYPRE_IJ_BULK_RADIX - 1));
+               pos = my_counts[b]++;
+               keys_tmp[pos] = keys[k];
+               perm_tmp[pos] = perm[k];
+            }
+         }
+      } /* end parallel region */
+
+      if (!skip)
+      {
+         keys_swap = keys; keys = keys_tmp; keys_tmp = keys_swap;
+         perm_swap = perm; perm = perm_tmp; perm_tmp = perm_swap;
+      }
+   }
+
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+
+   *keys_ptr     = keys;
+   *perm_ptr     = perm;
+   *keys_tmp_ptr = keys_tmp;
+   *perm_tmp_ptr = perm_tmp;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixBulkSort
+ *
+ * Returns in perm the stable order of the triples by (I, J).  Sorts by J
+ * first, and then by I.  On return, keys holds the sorted I - I_base.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixBulkSort( HYPRE_Int             n,
+                        HYPRE_BigInt         *I,
+                        HYPRE_BigInt          I_base,
+                        HYPRE_BigInt          I_size,
+                        HYPRE_BigInt         *J,
+                        HYPRE_BigInt          J_base,
+                        HYPRE_BigInt          J_size,
+                        HYPRE_Int           **perm_ptr,
+                        hypre_ulonglongint  **keys_ptr )
+{
+   HYPRE_Int          *perm     = hypre_TAlloc(HYPRE_Int,          n, HYPRE_MEMORY_HOST);
+   HYPRE_Int          *perm_tmp = hypre_TAlloc(HYPRE_Int,          n, HYPRE_MEMORY_HOST);
+   hypre_ulonglongint *keys     = hypre_TAlloc(hypre_ulonglongint, n, HYPRE_MEMORY_HOST);
+   hypre_ulonglongint *keys_tmp = hypre_TAlloc(hypre_ulonglongint, n, HYPRE_MEMORY_HOST);
+   HYPRE_Int           k;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < n; k++)
+   {
+      perm[k] = k;
+      keys[k] = (hypre_ulonglongint) (J[k] - J_base);
+   }
+
+   hypre_IJMatrixBulkRadixSort(n, (hypre_ulonglongint) (J_size - 1), &keys, &perm, &keys_tmp, &perm_tmp);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < n; k++)
+   {
+      keys[k] = (hypre_ulonglongint) (I[perm[k]] - I_base);
+   }
+
+   hypre_IJMatrixBulkRadixSort(n, (hypre_ulonglongint) (I_size - 1), &keys, &perm, &keys_tmp, &perm_tmp);
+
+   hypre_TFree(perm_tmp, HYPRE_MEMORY_HOST);
+   hypre_TFree(keys_tmp, HYPRE_MEMORY_HOST);
+
+   *perm_ptr = perm;
+   *keys_ptr = keys;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleBulkOffProcParCSR
+ *
+ * Moves the stacked off-processor entries into the off-processor stash of
+ * the aux matrix, so that hypre_IJMatrixAssembleParCSR can send them.  The
+ * entries are sorted and reduced first, which groups them by row and
+ * removes duplicates before any communication.  As on the device, a `set'
+ * of an off-processor entry erases the previous values of the entry on
+ * this processor and is sent as a zero.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleBulkOffProcParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+
+   HYPRE_Int           nelms, k, p, nnz, off_proc_i_indx;
+   HYPRE_BigInt       *I, *J;
+   HYPRE_Complex      *A;
+   char               *X;
+   HYPRE_Int          *perm;
+   hypre_ulonglongint *keys;
+   HYPRE_BigInt       *off_proc_i;
+   HYPRE_BigInt       *off_proc_j;
+   HYPRE_Complex      *off_proc_data;
+
+   hypre_IJMatrixBulkGather(aux_matrix, row_partitioning[0], row_partitioning[1], 0,
+                            &nelms, &I, &J, &A, &X);
+
+   if (nelms == 0)
+   {
+      hypre_TFree(I, HYPRE_MEMORY_HOST);
+      hypre_TFree(J, HYPRE_MEMORY_HOST);
+      hypre_TFree(A, HYPRE_MEMORY_HOST);
+      hypre_TFree(X, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixBulkSort(nelms,
+                          I, hypre_IJMatrixGlobalFirstRow(matrix), hypre_IJMatrixGlobalNumRows(matrix),
+                          J, hypre_IJMatrixGlobalFirstCol(matrix), hypre_IJMatrixGlobalNumCols(matrix),
+                          &perm, &keys);
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+
+   off_proc_i    = hypre_TAlloc(HYPRE_BigInt,  2*nelms, HYPRE_MEMORY_HOST);
+   off_proc_j    = hypre_TAlloc(HYPRE_BigInt,    nelms, HYPRE_MEMORY_HOST);
+   off_proc_data = hypre_TAlloc(HYPRE_Complex,   nelms, HYPRE_MEMORY_HOST);
+
+   nnz = 0;
+   off_proc_i_indx = 0;
+   for (k = 0; k < nelms; k++)
+   {
+      p = perm[k];
+      if (k > 0 && I[p] == I[perm[k-1]] && J[p] == J[perm[k-1]])
+      {
+         off_proc_data[nnz-1] = X[p] ? 0.0 : off_proc_data[nnz-1] + A[p];
+      }
+      else
+      {
+         if (k == 0 || I[p] != I[perm[k-1]])
+         {
+            off_proc_i[off_proc_i_indx++] = I[p];
+            off_proc_i[off_proc_i_indx++] = 0;
+         }
+         off_proc_i[off_proc_i_indx-1]++;
+         off_proc_j[nnz]    = J[p];
+         off_proc_data[nnz] = X[p] ? 0.0 : A[p];
+         nnz++;
+      }
+   }
+
+   hypre_TFree(hypre_AuxParCSRMatrixOffProcI(aux_matrix),    HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(aux_matrix),    HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixOffProcData(aux_matrix), HYPRE_MEMORY_HOST);
+
+   hypre_AuxParCSRMatrixOffProcI(aux_matrix)           = off_proc_i;
+   hypre_AuxParCSRMatrixOffProcJ(aux_matrix)           = off_proc_j;
+   hypre_AuxParCSRMatrixOffProcData(aux_matrix)        = off_proc_data;
+   hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix)       = off_proc_i_indx;
+   hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = nnz;
+   hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix)     = nelms;
+
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(I,    HYPRE_MEMORY_HOST);
+   hypre_TFree(J,    HYPRE_MEMORY_HOST);
+   hypre_TFree(A,    HYPRE_MEMORY_HOST);
+   hypre_TFree(X,    HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleBulkParCSR
+ *
+ * Builds diag and offd of the ParCSR matrix from the stacked on-processor
+ * entries.  The diagonal is put first in each row of diag, and the other
+ * entries are sorted by column.  offd is left with global column indices
+ * in its BigJ array, as after the aux_j path of hypre_IJMatrixAssembleParCSR,
+ * which then computes col_map_offd.  The stacks are freed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleBulkParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *)    hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt          *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt           row_start = row_partitioning[0];
+   HYPRE_BigInt           col_0     = col_partitioning[0];
+   HYPRE_BigInt           col_n     = col_partitioning[1] - 1;
+   HYPRE_Int              num_rows  = (HYPRE_Int) (row_partitioning[1] - row_start);
+
+   hypre_CSRMatrix    *diag   = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd   = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *diag_j = NULL;
+   HYPRE_Complex      *diag_data = NULL;
+   HYPRE_Int          *offd_j = NULL;
+   HYPRE_BigInt       *big_offd_j = NULL;
+   HYPRE_Complex      *offd_data = NULL;
+
+   HYPRE_Int           max_num_threads = hypre_NumThreads();
+   HYPRE_Int           nelms, i, k;
+   HYPRE_BigInt       *I, *J;
+   HYPRE_Complex      *A;
+   char               *X;
+   HYPRE_Int          *perm;
+   hypre_ulonglongint *keys;
+   HYPRE_Int          *row_ptr;
+   HYPRE_Int          *row_work;
+   HYPRE_Int          *part;
+   HYPRE_Int          *diag_array, *offd_array;
+   HYPRE_BigInt       *uniq_j;
+   HYPRE_Complex      *uniq_data;
+
+   hypre_IJMatrixBulkGather(aux_matrix, row_start, row_partitioning[1], 1,
+                            &nelms, &I, &J, &A, &X);
+   hypre_AuxParCSRMatrixDestroyBulk(aux_matrix);
+
+   hypre_IJMatrixBulkSort(nelms, I, row_start, (HYPRE_BigInt) hypre_max(num_rows, 1),
+                          J, hypre_IJMatrixGlobalFirstCol(matrix), hypre_IJMatrixGlobalNumCols(matrix),
+                          &perm, &keys);
+   hypre_TFree(I, HYPRE_MEMORY_HOST);
+
+   /* row pointers of the sorted entries */
+   row_ptr = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k, i) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < nelms; k++)
+   {
+      HYPRE_Int row = (HYPRE_Int) keys[k];
+      HYPRE_Int row_prev = k ? (HYPRE_Int) keys[k-1] : -1;
+      for (i = row_prev + 1; i <= row; i++)
+      {
+         row_ptr[i] = k;
+      }
+   }
+   for (i = nelms ? (HYPRE_Int) keys[nelms-1] + 1 : 0; i <= num_rows; i++)
+   {
+      row_ptr[i] = nelms;
+   }
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+
+   /* balance the reduction over threads by the number of stacked entries */
+   row_work = hypre_TAlloc(HYPRE_Int, num_rows,            HYPRE_MEMORY_HOST);
+   part     = hypre_TAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      row_work[i] = row_ptr[i+1] - row_ptr[i] + 1;
+   }
+   hypre_SpGemmHostPartitionRows(num_rows, row_work, max_num_threads, part);
+   hypre_TFree(row_work, HYPRE_MEMORY_HOST);
+
+   uniq_j     = hypre_TAlloc(HYPRE_BigInt,  nelms,           HYPRE_MEMORY_HOST);
+   uniq_data  = hypre_TAlloc(HYPRE_Complex, nelms,           HYPRE_MEMORY_HOST);
+   diag_array = hypre_CTAlloc(HYPRE_Int,    max_num_threads, HYPRE_MEMORY_HOST);
+   offd_array = hypre_CTAlloc(HYPRE_Int,    max_num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, k)
+#endif
+   {
+      HYPRE_Int     num_threads   = hypre_NumActiveThreads();
+      HYPRE_Int     my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int     ns, ne, p, u, u_end, i_diag, i_offd, cnt_diag, cnt_offd, diag_pos;
+      HYPRE_BigInt  col;
+
+      if (num_threads == max_num_threads)
+      {
+         ns = part[my_thread_num];
+         ne = part[my_thread_num+1];
+      }
+      else
+      {
+         hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+      }
+
+      /* segmented reduction of each row into uniq_j/uniq_data, starting at
+       * row_ptr[i]; the diag/offd counts of row i are kept in diag_i[i] and
+       * offd_i[i] until the offsets are known */
+      i_diag = 0;
+      i_offd = 0;
+      for (i = ns; i < ne; i++)
+      {
+         u = row_ptr[i];
+         cnt_diag = 0;
+         cnt_offd = 0;
+         for (k = row_ptr[i]; k < row_ptr[i+1]; k++)
+         {
+            p = perm[k];
+            if (k > row_ptr[i] && J[p] == uniq_j[u-1])
+            {
+               uniq_data[u-1] = X[p] ? A[p] : uniq_data[u-1] + A[p];
+            }
+            else
+            {
+               uniq_j[u]    = J[p];
+               uniq_data[u] = A[p];
+               u++;
+               if (J[p] < col_0 || J[p] > col_n)
+               {
+                  cnt_offd++;
+               }
+               else
+               {
+                  cnt_diag++;
+               }
+            }
+         }
+         diag_i[i] = cnt_diag;
+         offd_i[i] = cnt_offd;
+         i_diag += cnt_diag;
+         i_offd += cnt_offd;
+      }
+      diag_array[my_thread_num] = i_diag;
+      offd_array[my_thread_num] = i_offd;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         i_diag = 0;
+         i_offd = 0;
+         for (i = 0; i < num_threads; i++)
+         {
+            i_diag += diag_array[i];
+            i_offd += offd_array[i];
+            diag_array[i] = i_diag;
+            offd_array[i] = i_offd;
+         }
+         diag_i[num_rows] = i_diag;
+         offd_i[num_rows] = i_offd;
+
+         hypre_TFree(hypre_CSRMatrixJ(diag),    hypre_CSRMatrixMemoryLocation(diag));
+         hypre_TFree(hypre_CSRMatrixData(diag), hypre_CSRMatrixMemoryLocation(diag));
+         hypre_TFree(hypre_CSRMatrixJ(offd),    hypre_CSRMatrixMemoryLocation(offd));
+         hypre_TFree(hypre_CSRMatrixData(offd), hypre_CSRMatrixMemoryLocation(offd));
+         hypre_TFree(hypre_CSRMatrixBigJ(offd), hypre_CSRMatrixMemoryLocation(offd));
+
+         diag_j    = hypre_TAlloc(HYPRE_Int,     i_diag, hypre_CSRMatrixMemoryLocation(diag));
+         diag_data = hypre_TAlloc(HYPRE_Complex, i_diag, hypre_CSRMatrixMemoryLocation(diag));
+         if (i_offd)
+         {
+            offd_j     = hypre_TAlloc(HYPRE_Int,     i_offd, hypre_CSRMatrixMemoryLocation(offd));
+            offd_data  = hypre_TAlloc(HYPRE_Complex, i_offd, hypre_CSRMatrixMemoryLocation(offd));
+            big_offd_j = hypre_TAlloc(HYPRE_BigInt,  i_offd, hypre_CSRMatrixMemoryLocation(offd));
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      i_diag = my_thread_num ? diag_array[my_thread_num-1] : 0;
+      i_offd = my_thread_num ? offd_array[my_thread_num-1] : 0;
+      for (i = ns; i < ne; i++)
+      {
+         cnt_diag  = diag_i[i];
+         cnt_offd  = offd_i[i];
+         diag_i[i] = i_diag;
+         offd_i[i] = i_offd;
+         u_end     = row_ptr[i] + cnt_diag + cnt_offd;
+
+         diag_pos = -1;
+         for (u = row_ptr[i]; u < u_end; u++)
+         {
+            if (uniq_j[u] - col_0 == (HYPRE_BigInt) i)
+            {
+               diag_pos = u;
+               diag_j[i_diag]      = i;
+               diag_data[i_diag++] = uniq_data[u];
+               break;
+            }
+         }
+         for (u = row_ptr[i]; u < u_end; u++)
+         {
+            col = uniq_j[u];
+            if (col < col_0 || col > col_n)
+            {
+               big_offd_j[i_offd]  = col;
+               offd_data[i_offd++] = uniq_data[u];
+            }
+            else if (u != diag_pos)
+            {
+               diag_j[i_diag]      = (HYPRE_Int) (col - col_0);
+               diag_data[i_diag++] = uniq_data[u];
+            }
+         }
+      }
+   } /* end parallel region */
+
+   hypre_CSRMatrixJ(diag)           = diag_j;
+   hypre_CSRMatrixData(diag)        = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = diag_i[num_rows];
+   hypre_CSRMatrixJ(offd)           = offd_j;
+   hypre_CSRMatrixBigJ(offd)        = big_offd_j;
+   hypre_CSRMatrixData(offd)        = offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = offd_i[num_rows];
+
+   hypre_TFree(diag_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(uniq_j,     HYPRE_MEMORY_HOST);
+   hypre_TFree(uniq_data,  HYPRE_MEMORY_HOST);
+   hypre_TFree(part,       HYPRE_MEMORY_HOST);
+   hypre_TFree(row_ptr,    HYPRE_MEMORY_HOST);
+   hypre_TFree(perm,       HYPRE_MEMORY_HOST);
+   hypre_TFree(J,          HYPRE_MEMORY_HOST);
+   hypre_TFree(A,          HYPRE_MEMORY_HOST);
+   hypre_TFree(X,          HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,650 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR refill of an assembled matrix with a frozen pattern
+ *
+ * Between the freeze and the next assembly, every entry passed to
+ * SetValues and AddToValues is searched as usual, and its slot in the
+ * diag or offd data, or in a send buffer for off-processor rows, is
+ * recorded in call order.  At that assembly, the owners of the
+ * off-processor entries are found once, and persistent requests are set
+ * up between the neighbors.  In all later cycles, the same sequence of
+ * calls scatters the values straight into the recorded slots, and the
+ * assembly is a fixed neighbor exchange followed by a scatter-add.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_IJPatternPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJPatternPlanDestroy( hypre_IJPatternPlan *plan )
+{
+   HYPRE_Int i;
+
+   if (plan)
+   {
+      if (hypre_IJPatternPlanRequests(plan))
+      {
+         for (i = 0; i < hypre_IJPatternPlanNumSends(plan) + hypre_IJPatternPlanNumRecvs(plan); i++)
+         {
+            hypre_MPI_Request_free(&hypre_IJPatternPlanRequests(plan)[i]);
+         }
+      }
+
+      hypre_TFree(hypre_IJPatternPlanSlots(plan),       HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRecOffEntry(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRecOffI(plan),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRecOffJ(plan),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRecOffData(plan),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanSendProcs(plan),   HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanSendStarts(plan),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanSendI(plan),       HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanSendJ(plan),       HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanSendData(plan),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRecvProcs(plan),   HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRecvStarts(plan),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRecvSlots(plan),   HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRecvData(plan),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJPatternPlanRequests(plan),    HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixFreezePatternParCSR
+ *
+ * freeze != 0 (re)starts the recording of the slots on an assembled
+ * matrix; freeze = 0 frees the plan and returns to the default refill.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixFreezePatternParCSR( hypre_IJMatrix *matrix,
+                                   HYPRE_Int       freeze )
+{
+   hypre_ParCSRMatrix  *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_IJPatternPlan *plan;
+
+   hypre_IJPatternPlanDestroy(hypre_IJMatrixPatternPlan(matrix));
+   hypre_IJMatrixPatternPlan(matrix) = NULL;
+
+   if (!freeze)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!par_matrix || !hypre_IJMatrixAssembleFlag(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The pattern can only be frozen after assembly!");
+      return hypre_error_flag;
+   }
+
+   plan = hypre_CTAlloc(hypre_IJPatternPlan, 1, HYPRE_MEMORY_HOST);
+   hypre_IJPatternPlanRecording(plan) = 1;
+   hypre_IJPatternPlanNumDiag(plan)   = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_IJPatternPlanNumOffd(plan)   = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(par_matrix));
+
+   hypre_IJMatrixPatternPlan(matrix) = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJPatternPlanFindSlot
+ *
+ * Returns the diag or offd slot of the entry (row_local, col) of an
+ * assembled matrix, or -1 if it is not in the pattern.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJPatternPlanFindSlot( hypre_IJMatrix *matrix,
+                             HYPRE_Int       row_local,
+                             HYPRE_BigInt    col )
+{
+   hypre_ParCSRMatrix *par_matrix    = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix    *diag          = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd          = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j        = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt       *col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt       *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt        col_0 = col_partitioning[0];
+   HYPRE_BigInt        col_n = col_partitioning[1] - 1;
+   HYPRE_Int           j, j_offd;
+
+   if (col < col_0 || col > col_n)
+   {
+      if (num_cols_offd)
+      {
+         j_offd = hypre_BigBinarySearch(col_map_offd, col - hypre_IJMatrixGlobalFirstCol(matrix),
+                                        num_cols_offd);
+         if (j_offd != -1)
+         {
+            for (j = offd_i[row_local]; j < offd_i[row_local+1]; j++)
+            {
+               if (offd_j[j] == j_offd)
+               {
+                  return hypre_CSRMatrixNumNonzeros(diag) + j;
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      for (j = diag_i[row_local]; j < diag_i[row_local+1]; j++)
+      {
+         if (diag_j[j] == (HYPRE_Int)(col - col_0))
+         {
+            return j;
+         }
+      }
+   }
+
+   return -1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixSetAddValuesParCSRFrozen
+ *
+ * Same arguments as hypre_IJMatrixSetAddValuesParCSRDevice.  While
+ * replaying, every entry is checked against its recorded slot, so calls
+ * that differ from the recorded ones are caught.  As in the default host
+ * path, sets to off-processor rows are dropped.
+ *
+ * The recording and the replay cursor follow the order of the calls, so
+ * they must come from one thread; calls from inside a parallel region are
+ * an error.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixSetAddValuesParCSRFrozen( hypre_IJMatrix       *matrix,
+                                        HYPRE_Int             nrows,
+                                        HYPRE_Int            *ncols,        /* if NULL, == all ones */
+                                        const HYPRE_BigInt   *rows,
+                                        const HYPRE_Int      *row_indexes,  /* if NULL, == ex_scan of ncols, i.e, no gap */
+                                        const HYPRE_BigInt   *cols,
+                                        const HYPRE_Complex  *values,
+                                        const char           *action )
+{
+   hypre_IJPatternPlan *plan       = hypre_IJMatrixPatternPlan(matrix);
+   hypre_ParCSRMatrix  *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix     *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix     *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int           *diag_i     = hypre_CSRMatrixI(diag);
+   HYPRE_Int           *diag_j     = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex       *diag_data  = hypre_CSRMatrixData(diag);
+   HYPRE_Int           *offd_i     = hypre_CSRMatrixI(offd);
+   HYPRE_Int           *offd_j     = hypre_CSRMatrixJ(offd);
+   HYPRE_Complex       *offd_data  = hypre_CSRMatrixData(offd);
+   HYPRE_BigInt        *col_map_offd = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt        *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt        *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt         col_0 = col_partitioning[0];
+   HYPRE_BigInt         col_n = col_partitioning[1] - 1;
+   HYPRE_BigInt         first = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int            num_diag = hypre_IJPatternPlanNumDiag(plan);
+   HYPRE_Int            num_offd = hypre_IJPatternPlanNumOffd(plan);
+   HYPRE_Int            print_level = hypre_IJMatrixPrintLevel(matrix);
+   const HYPRE_Int      add = action[0] == 'a';
+
+   HYPRE_Int            ii, i, k, n, indx, row_local, on_proc, slot, valid;
+   HYPRE_Int            num_entries, max_entries, num_rec_off, max_rec_off;
+   HYPRE_BigInt         row, col;
+
+   if (hypre_NumActiveThreads() > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "A frozen pattern must be refilled from a single thread!");
+      return hypre_error_flag;
+   }
+
+   if (hypre_CSRMatrixNumNonzeros(diag) != num_diag ||
+       hypre_CSRMatrixNumNonzeros(offd) != num_offd)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The pattern of the matrix changed after it was frozen!");
+      return hypre_error_flag;
+   }
+
+   indx = 0;
+   for (ii = 0; ii < nrows; ii++)
+   {
+      row = rows[ii];
+      n = ncols ? ncols[ii] : 1;
+      if (row_indexes)
+      {
+         indx = row_indexes[ii];
+      }
+      on_proc   = row >= row_partitioning[0] && row < row_partitioning[1];
+      row_local = on_proc ? (HYPRE_Int)(row - row_partitioning[0]) : -1;
+
+      for (i = 0; i < n; i++, indx++)
+      {
+         col = cols[indx];
+
+         if (hypre_IJPatternPlanRecording(plan))
+         {
+            slot = -1;
+            if (on_proc)
+            {
+               slot = hypre_IJPatternPlanFindSlot(matrix, row_local, col);
+               if (slot < 0)
+               {
+                  hypre_error(HYPRE_ERROR_GENERIC);
+                  if (print_level)
+                  {
+                     hypre_printf (" Error, element %b %b does not exist\n", row, col);
+                  }
+                  return hypre_error_flag;
+               }
+            }
+            else if (add)
+            {
+               /* the send slot is known after the next assembly */
+               num_rec_off = hypre_IJPatternPlanNumRecOff(plan);
+               max_rec_off = hypre_IJPatternPlanMaxRecOff(plan);
+               if (num_rec_off == max_rec_off)
+               {
+                  max_rec_off = hypre_max(2 * max_rec_off, 1000);
+                  hypre_IJPatternPlanRecOffEntry(plan) =
+                     hypre_TReAlloc(hypre_IJPatternPlanRecOffEntry(plan), HYPRE_Int, max_rec_off, HYPRE_MEMORY_HOST);
+                  hypre_IJPatternPlanRecOffI(plan) =
+                     hypre_TReAlloc(hypre_IJPatternPlanRecOffI(plan), HYPRE_BigInt, max_rec_off, HYPRE_MEMORY_HOST);
+                  hypre_IJPatternPlanRecOffJ(plan) =
+                     hypre_TReAlloc(hypre_IJPatternPlanRecOffJ(plan), HYPRE_BigInt, max_rec_off, HYPRE_MEMORY_HOST);
+                  hypre_IJPatternPlanRecOffData(plan) =
+                     hypre_TReAlloc(hypre_IJPatternPlanRecOffData(plan), HYPRE_Complex, max_rec_off, HYPRE_MEMORY_HOST);
+                  hypre_IJPatternPlanMaxRecOff(plan) = max_rec_off;
+               }
+               hypre_IJPatternPlanRecOffEntry(plan)[num_rec_off] = hypre_IJPatternPlanNumEntries(plan);
+               hypre_IJPatternPlanRecOffI(plan)[num_rec_off]     = row;
+               hypre_IJPatternPlanRecOffJ(plan)[num_rec_off]     = col;
+               hypre_IJPatternPlanRecOffData(plan)[num_rec_off]  = values[indx];
+               hypre_IJPatternPlanNumRecOff(plan) = num_rec_off + 1;
+            }
+
+            num_entries = hypre_IJPatternPlanNumEntries(plan);
+            max_entries = hypre_IJPatternPlanMaxEntries(plan);
+            if (num_entries == max_entries)
+            {
+               max_entries = hypre_max(2 * max_entries, num_diag + num_offd);
+               max_entries = hypre_max(max_entries, num_entries + 1);
+               hypre_IJPatternPlanSlots(plan) =
+                  hypre_TReAlloc(hypre_IJPatternPlanSlots(plan), HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+               hypre_IJPatternPlanMaxEntries(plan) = max_entries;
+            }
+            hypre_IJPatternPlanSlots(plan)[num_entries] = slot;
+            hypre_IJPatternPlanNumEntries(plan) = num_entries + 1;
+
+            if (!on_proc)
+            {
+               continue;
+            }
+         }
+         else
+         {
+            if (hypre_IJPatternPlanCursor(plan) == hypre_IJPatternPlanNumEntries(plan))
+            {
+               hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                                 "More entries were passed than when the pattern was frozen!");
+               return hypre_error_flag;
+            }
+            slot = hypre_IJPatternPlanSlots(plan)[hypre_IJPatternPlanCursor(plan)++];
+
+            if (slot < 0)
+            {
+               valid = !on_proc && !add;
+            }
+            else if (slot < num_diag)
+            {
+               valid = on_proc && col >= col_0 && col <= col_n &&
+                       slot >= diag_i[row_local] && slot < diag_i[row_local+1] &&
+                       diag_j[slot] == (HYPRE_Int)(col - col_0);
+            }
+            else if (slot < num_diag + num_offd)
+            {
+               k = slot - num_diag;
+               valid = on_proc && k >= offd_i[row_local] && k < offd_i[row_local+1] &&
+                       col_map_offd[offd_j[k]] == col - first;
+            }
+            else
+            {
+               k = slot - num_diag - num_offd;
+               valid = !on_proc && add &&
+                       hypre_IJPatternPlanSendI(plan)[k] == row &&
+                       hypre_IJPatternPlanSendJ(plan)[k] == col;
+            }
+
+            if (!valid)
+            {
+               hypre_error(HYPRE_ERROR_GENERIC);
+               if (print_level)
+               {
+                  hypre_printf (" Error, element %b %b does not match the frozen pattern\n", row, col);
+               }
+               return hypre_error_flag;
+            }
+         }
+
+         if (slot < 0)
+         {
+            continue;
+         }
+         else if (slot < num_diag)
+         {
+            diag_data[slot] = add ? diag_data[slot] + values[indx] : values[indx];
+         }
+         else if (slot < num_diag + num_offd)
+         {
+            k = slot - num_diag;
+            offd_data[k] = add ? offd_data[k] + values[indx] : values[indx];
+         }
+         else
+         {
+            hypre_IJPatternPlanSendData(plan)[slot - num_diag - num_offd] += values[indx];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJPatternPlanSetup
+ *
+ * Called by the first assembly after the freeze.  Merges the recorded
+ * off-processor entries into unique (row, col) send slots, finds the
+ * owners of their rows through the assumed partition, sends the (row, col)
+ * lists to the owners, which look up their slots, and creates the
+ * persistent requests of the exchange.  The recorded values are moved
+ * into the send buffer.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJPatternPlanSetup( hypre_IJMatrix *matrix )
+{
+   MPI_Comm             comm = hypre_IJMatrixComm(matrix);
+   hypre_IJPatternPlan *plan = hypre_IJMatrixPatternPlan(matrix);
+   HYPRE_BigInt        *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt         first_row = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_Int            num_rec_off = hypre_IJPatternPlanNumRecOff(plan);
+   HYPRE_Int           *rec_off_entry = hypre_IJPatternPlanRecOffEntry(plan);
+   HYPRE_Int           *slots = hypre_IJPatternPlanSlots(plan);
+   HYPRE_Int            slot_base = hypre_IJPatternPlanNumDiag(plan) + hypre_IJPatternPlanNumOffd(plan);
+   HYPRE_Int            print_level = hypre_IJMatrixPrintLevel(matrix);
+
+   HYPRE_Int            i, k, k0, p, num_pairs, num_rows, num_sends, num_recvs, num_recv_pairs;
+   HYPRE_Int           *perm, *pair_row;
+   HYPRE_BigInt        *sort_i, *sort_j, *rows_off;
+   HYPRE_BigInt        *send_i, *send_j, *send_buf, *recv_buf;
+   HYPRE_Int           *send_procs, *send_row_starts, *send_starts;
+   HYPRE_Int           *recv_procs, *recv_starts, *recv_slots, *recv_counts;
+   HYPRE_Int           *send_map_starts, *send_map_elmts;
+   HYPRE_Complex       *send_data, *recv_data;
+   hypre_MPI_Request   *requests;
+   hypre_IJAssumedPart *apart;
+
+   /* sort the recorded entries by (row, col) */
+   perm   = hypre_TAlloc(HYPRE_Int,    num_rec_off, HYPRE_MEMORY_HOST);
+   sort_i = hypre_TAlloc(HYPRE_BigInt, num_rec_off, HYPRE_MEMORY_HOST);
+   sort_j = hypre_TAlloc(HYPRE_BigInt, num_rec_off, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_rec_off; k++)
+   {
+      perm[k]   = k;
+      sort_i[k] = hypre_IJPatternPlanRecOffI(plan)[k];
+   }
+   hypre_BigQsortbi(sort_i, perm, 0, num_rec_off - 1);
+   for (k = 0; k < num_rec_off; k++)
+   {
+      sort_j[k] = hypre_IJPatternPlanRecOffJ(plan)[perm[k]];
+   }
+   for (k0 = 0; k0 < num_rec_off; k0 = k)
+   {
+      for (k = k0 + 1; k < num_rec_off && sort_i[k] == sort_i[k0]; k++);
+      hypre_BigQsortbi(sort_j, perm, k0, k - 1);
+   }
+
+   /* unique pairs become the send slots, unique rows are passed to the
+    * assumed partition (0-based) */
+   send_i    = hypre_TAlloc(HYPRE_BigInt,  num_rec_off, HYPRE_MEMORY_HOST);
+   send_j    = hypre_TAlloc(HYPRE_BigInt,  num_rec_off, HYPRE_MEMORY_HOST);
+   send_data = hypre_CTAlloc(HYPRE_Complex, num_rec_off, HYPRE_MEMORY_HOST);
+   pair_row  = hypre_TAlloc(HYPRE_Int,     num_rec_off, HYPRE_MEMORY_HOST);
+   rows_off  = hypre_TAlloc(HYPRE_BigInt,  num_rec_off, HYPRE_MEMORY_HOST);
+   num_pairs = 0;
+   num_rows  = 0;
+   for (k = 0; k < num_rec_off; k++)
+   {
+      if (k == 0 || sort_i[k] != sort_i[k-1])
+      {
+         rows_off[num_rows++] = sort_i[k] - first_row;
+      }
+      if (k == 0 || sort_i[k] != sort_i[k-1] || sort_j[k] != sort_j[k-1])
+      {
+         send_i[num_pairs]     = sort_i[k];
+         send_j[num_pairs]     = sort_j[k];
+         pair_row[num_pairs++] = num_rows - 1;
+      }
+      slots[rec_off_entry[perm[k]]] = slot_base + num_pairs - 1;
+      send_data[num_pairs - 1] += hypre_IJPatternPlanRecOffData(plan)[perm[k]];
+   }
+   hypre_TFree(perm,   HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_j, HYPRE_MEMORY_HOST);
+
+   apart = hypre_AssumedPartitionCreate(comm, hypre_IJMatrixGlobalNumRows(matrix),
+                                        row_partitioning[0] - first_row,
+                                        row_partitioning[1] - 1 - first_row);
+   /* in comm_pkg terms, we `receive' the rows we add to from their owners */
+   hypre_ParCSRCommPkgCreateApart_core(comm, rows_off, row_partitioning[0] - first_row, num_rows,
+                                       hypre_IJMatrixGlobalNumRows(matrix),
+                                       &num_sends, &send_procs, &send_row_starts,
+                                       &num_recvs, &recv_procs, &send_map_starts, &send_map_elmts,
+                                       apart);
+   hypre_AssumedPartitionDestroy(apart);
+   hypre_TFree(send_map_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_map_elmts,  HYPRE_MEMORY_HOST);
+   hypre_TFree(rows_off,        HYPRE_MEMORY_HOST);
+
+   send_starts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   k = 0;
+   for (p = 0; p < num_sends; p++)
+   {
+      send_starts[p] = k;
+      while (k < num_pairs && pair_row[k] < send_row_starts[p+1])
+      {
+         k++;
+      }
+   }
+   send_starts[num_sends] = num_pairs;
+   hypre_TFree(send_row_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(pair_row,        HYPRE_MEMORY_HOST);
+
+   /* exchange the number of pairs, then the pairs */
+   requests    = hypre_CTAlloc(hypre_MPI_Request, num_recvs + num_sends, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_CTAlloc(HYPRE_Int,         num_recvs + num_sends, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_recvs; p++)
+   {
+      hypre_MPI_Irecv(&recv_counts[p], 1, HYPRE_MPI_INT, recv_procs[p], 0, comm, &requests[p]);
+   }
+   for (p = 0; p < num_sends; p++)
+   {
+      recv_counts[num_recvs+p] = send_starts[p+1] - send_starts[p];
+      hypre_MPI_Isend(&recv_counts[num_recvs+p], 1, HYPRE_MPI_INT, send_procs[p], 0, comm,
+                      &requests[num_recvs+p]);
+   }
+   hypre_MPI_Waitall(num_recvs + num_sends, requests, hypre_MPI_STATUSES_IGNORE);
+
+   recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   recv_starts[0] = 0;
+   for (p = 0; p < num_recvs; p++)
+   {
+      recv_starts[p+1] = recv_starts[p] + recv_counts[p];
+   }
+   num_recv_pairs = recv_starts[num_recvs];
+   hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+
+   recv_buf = hypre_TAlloc(HYPRE_BigInt, 2 * num_recv_pairs, HYPRE_MEMORY_HOST);
+   send_buf = hypre_TAlloc(HYPRE_BigInt, 2 * num_pairs,      HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_pairs; k++)
+   {
+      send_buf[2*k]   = send_i[k];
+      send_buf[2*k+1] = send_j[k];
+   }
+   for (p = 0; p < num_recvs; p++)
+   {
+      hypre_MPI_Irecv(recv_buf + 2 * recv_starts[p], 2 * (recv_starts[p+1] - recv_starts[p]),
+                      HYPRE_MPI_BIG_INT, recv_procs[p], 0, comm, &requests[p]);
+   }
+   for (p = 0; p < num_sends; p++)
+   {
+      hypre_MPI_Isend(send_buf + 2 * send_starts[p], 2 * (send_starts[p+1] - send_starts[p]),
+                      HYPRE_MPI_BIG_INT, send_procs[p], 0, comm, &requests[num_recvs+p]);
+   }
+   hypre_MPI_Waitall(num_recvs + num_sends, requests, hypre_MPI_STATUSES_IGNORE);
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+
+   /* slots of the entries other processors add to; missing entries are
+    * reported and dropped */
+   recv_slots = hypre_TAlloc(HYPRE_Int, num_recv_pairs, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_recv_pairs; k++)
+   {
+      i = (HYPRE_Int)(recv_buf[2*k] - row_partitioning[0]);
+      recv_slots[k] = hypre_IJPatternPlanFindSlot(matrix, i, recv_buf[2*k+1]);
+      if (recv_slots[k] < 0)
+      {
+         hypre_error(HYPRE_ERROR_GENERIC);
+         if (print_level)
+         {
+            hypre_printf (" Error, element %b %b does not exist\n", recv_buf[2*k], recv_buf[2*k+1]);
+         }
+      }
+   }
+   hypre_TFree(recv_buf, HYPRE_MEMORY_HOST);
+
+   recv_data = hypre_CTAlloc(HYPRE_Complex, num_recv_pairs, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_recvs; p++)
+   {
+      hypre_MPI_Recv_init(recv_data + recv_starts[p], recv_starts[p+1] - recv_starts[p],
+                          HYPRE_MPI_COMPLEX, recv_procs[p], 0, comm, &requests[p]);
+   }
+   for (p = 0; p < num_sends; p++)
+   {
+      hypre_MPI_Send_init(send_data + send_starts[p], send_starts[p+1] - send_starts[p],
+                          HYPRE_MPI_COMPLEX, send_procs[p], 0, comm, &requests[num_recvs+p]);
+   }
+
+   hypre_TFree(hypre_IJPatternPlanRecOffEntry(plan), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_IJPatternPlanRecOffI(plan),     HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_IJPatternPlanRecOffJ(plan),     HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_IJPatternPlanRecOffData(plan),  HYPRE_MEMORY_HOST);
+   hypre_IJPatternPlanNumRecOff(plan) = 0;
+   hypre_IJPatternPlanMaxRecOff(plan) = 0;
+
+   hypre_IJPatternPlanNumSends(plan)   = num_sends;
+   hypre_IJPatternPlanSendProcs(plan)  = send_procs;
+   hypre_IJPatternPlanSendStarts(plan) = send_starts;
+   hypre_IJPatternPlanSendI(plan)      = send_i;
+   hypre_IJPatternPlanSendJ(plan)      = send_j;
+   hypre_IJPatternPlanSendData(plan)   = send_data;
+   hypre_IJPatternPlanNumRecvs(plan)   = num_recvs;
+   hypre_IJPatternPlanRecvProcs(plan)  = recv_procs;
+   hypre_IJPatternPlanRecvStarts(plan) = recv_starts;
+   hypre_IJPatternPlanRecvSlots(plan)  = recv_slots;
+   hypre_IJPatternPlanRecvData(plan)   = recv_data;
+   hypre_IJPatternPlanRequests(plan)   = requests;
+   hypre_IJPatternPlanRecording(plan)  = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleFrozenParCSR
+ *
+ * Sends the off-processor contributions to their owners with the
+ * persistent requests and adds the received ones into their slots.  Only
+ * the first call after the freeze communicates with all processors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleFrozenParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_IJPatternPlan *plan       = hypre_IJMatrixPatternPlan(matrix);
+   hypre_ParCSRMatrix  *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_Complex       *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex       *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int            num_diag   = hypre_IJPatternPlanNumDiag(plan);
+
+   HYPRE_Int            k, slot, num_requests, num_send_pairs, num_recv_pairs;
+   HYPRE_Complex       *send_data, *recv_data;
+   HYPRE_Int           *recv_slots;
+
+   if (hypre_IJPatternPlanRecording(plan))
+   {
+      hypre_IJPatternPlanSetup(matrix);
+   }
+   else if (hypre_IJPatternPlanCursor(plan) != hypre_IJPatternPlanNumEntries(plan))
+   {
+      /* keep going, the neighbors expect our messages */
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Fewer entries were passed than when the pattern was frozen!");
+   }
+   hypre_IJPatternPlanCursor(plan) = 0;
+
+   num_requests   = hypre_IJPatternPlanNumRecvs(plan) + hypre_IJPatternPlanNumSends(plan);
+   num_send_pairs = hypre_IJPatternPlanSendStarts(plan)[hypre_IJPatternPlanNumSends(plan)];
+   num_recv_pairs = hypre_IJPatternPlanRecvStarts(plan)[hypre_IJPatternPlanNumRecvs(plan)];
+   send_data      = hypre_IJPatternPlanSendData(plan);
+   recv_data      = hypre_IJPatternPlanRecvData(plan);
+   recv_slots     = hypre_IJPatternPlanRecvSlots(plan);
+
+   if (num_requests)
+   {
+      hypre_MPI_Startall(num_requests, hypre_IJPatternPlanRequests(plan));
+      hypre_MPI_Waitall(num_requests, hypre_IJPatternPlanRequests(plan), hypre_MPI_STATUSES_IGNORE);
+   }
+
+   for (k = 0; k < num_recv_pairs; k++)
+   {
+      slot = recv_slots[k];
+      if (slot < 0)
+      {
+         continue;
+      }
+      else if (slot < num_diag)
+      {
+         diag_data[slot] += recv_data[k];
+      }
+      else
+      {
+         offd_data[slot - num_diag] += recv_data[k];
+      }
+   }
+
+   for (k = 0; k < num_send_pairs; k++)
+   {
+      send_data[k] = 0.0;
+   }
+
+   /* the values were refilled in place */
+   hypre_CSRMatrixUpdateCompanionValues(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixUpdateCompanionValues(hypre_ParCSRMatrixOffd(par_matrix));
+
+   hypre_AuxParCSRMatrixDestroy((hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix));
+   hypre_IJMatrixTranslator(matrix) = NULL;
+
+   return hypre_error_flag;
+}
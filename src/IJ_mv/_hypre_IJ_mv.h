@@ -78,6 +78,16 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   /* stacks of (i, j, data) triples for host bulk assembly, two per thread:
+    * stacks [0, n/2) hold the local calls, [n/2, n) the received values */
+   HYPRE_Int            num_bulk_stacks;
+   HYPRE_Int           *bulk_max_elmts;
+   HYPRE_Int           *bulk_current_elmts;
+   HYPRE_BigInt       **bulk_i;
+   HYPRE_BigInt       **bulk_j;
+   HYPRE_Complex      **bulk_data;
+   char               **bulk_sora;               /* Set (1) or Add (0) */
+
 #if defined(HYPRE_USING_CUDA)
    HYPRE_Int            max_stack_elmts;
    HYPRE_Int            current_stack_elmts;
@@ -120,6 +130,14 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixNumBulkStacks(matrix)        ((matrix) -> num_bulk_stacks)
+#define hypre_AuxParCSRMatrixBulkMaxElmts(matrix)         ((matrix) -> bulk_max_elmts)
+#define hypre_AuxParCSRMatrixBulkCurrentElmts(matrix)     ((matrix) -> bulk_current_elmts)
+#define hypre_AuxParCSRMatrixBulkI(matrix)                ((matrix) -> bulk_i)
+#define hypre_AuxParCSRMatrixBulkJ(matrix)                ((matrix) -> bulk_j)
+#define hypre_AuxParCSRMatrixBulkData(matrix)             ((matrix) -> bulk_data)
+#define hypre_AuxParCSRMatrixBulkSorA(matrix)             ((matrix) -> bulk_sora)
+
 #if defined(HYPRE_USING_CUDA)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
@@ -219,6 +237,83 @@ typedef struct
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJPatternPlan:
+ *
+ * Slots of the entries set or added to between two assemblies of a matrix
+ * with a frozen pattern, see IJMatrix_parcsr_frozen.c.  A slot s is an
+ * index in the diag data if s < num_diag, in the offd data (shifted by
+ * num_diag) if s < num_diag + num_offd, and in send_data (shifted by
+ * num_diag + num_offd) otherwise.  Dropped entries (off-processor sets)
+ * have slot -1.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int           recording;      /* slots are searched and recorded
+                                          until the next assembly */
+   HYPRE_Int           num_diag;       /* nonzeros of diag and offd when */
+   HYPRE_Int           num_offd;       /* the pattern was frozen */
+
+   HYPRE_Int           num_entries;    /* entries passed per assembly */
+   HYPRE_Int           max_entries;
+   HYPRE_Int           cursor;         /* next entry while replaying */
+   HYPRE_Int          *slots;
+
+   HYPRE_Int           num_rec_off;    /* off-processor entries, only */
+   HYPRE_Int           max_rec_off;    /* while recording */
+   HYPRE_Int          *rec_off_entry;
+   HYPRE_BigInt       *rec_off_i;
+   HYPRE_BigInt       *rec_off_j;
+   HYPRE_Complex      *rec_off_data;
+
+   HYPRE_Int           num_sends;      /* owners of the off-processor rows */
+   HYPRE_Int          *send_procs;
+   HYPRE_Int          *send_starts;
+   HYPRE_BigInt       *send_i;         /* (row, col) of the send slots */
+   HYPRE_BigInt       *send_j;
+   HYPRE_Complex      *send_data;
+
+   HYPRE_Int           num_recvs;      /* processors adding to my rows */
+   HYPRE_Int          *recv_procs;
+   HYPRE_Int          *recv_starts;
+   HYPRE_Int          *recv_slots;     /* diag or offd slot, -1 if dropped */
+   HYPRE_Complex      *recv_data;
+
+   hypre_MPI_Request  *requests;       /* persistent, recvs first */
+
+} hypre_IJPatternPlan;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJPatternPlan
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJPatternPlanRecording(plan)     ((plan) -> recording)
+#define hypre_IJPatternPlanNumDiag(plan)       ((plan) -> num_diag)
+#define hypre_IJPatternPlanNumOffd(plan)       ((plan) -> num_offd)
+#define hypre_IJPatternPlanNumEntries(plan)    ((plan) -> num_entries)
+#define hypre_IJPatternPlanMaxEntries(plan)    ((plan) -> max_entries)
+#define hypre_IJPatternPlanCursor(plan)        ((plan) -> cursor)
+#define hypre_IJPatternPlanSlots(plan)         ((plan) -> slots)
+#define hypre_IJPatternPlanNumRecOff(plan)     ((plan) -> num_rec_off)
+#define hypre_IJPatternPlanMaxRecOff(plan)     ((plan) -> max_rec_off)
+#define hypre_IJPatternPlanRecOffEntry(plan)   ((plan) -> rec_off_entry)
+#define hypre_IJPatternPlanRecOffI(plan)       ((plan) -> rec_off_i)
+#define hypre_IJPatternPlanRecOffJ(plan)       ((plan) -> rec_off_j)
+#define hypre_IJPatternPlanRecOffData(plan)    ((plan) -> rec_off_data)
+#define hypre_IJPatternPlanNumSends(plan)      ((plan) -> num_sends)
+#define hypre_IJPatternPlanSendProcs(plan)     ((plan) -> send_procs)
+#define hypre_IJPatternPlanSendStarts(plan)    ((plan) -> send_starts)
+#define hypre_IJPatternPlanSendI(plan)         ((plan) -> send_i)
+#define hypre_IJPatternPlanSendJ(plan)         ((plan) -> send_j)
+#define hypre_IJPatternPlanSendData(plan)      ((plan) -> send_data)
+#define hypre_IJPatternPlanNumRecvs(plan)      ((plan) -> num_recvs)
+#define hypre_IJPatternPlanRecvProcs(plan)     ((plan) -> recv_procs)
+#define hypre_IJPatternPlanRecvStarts(plan)    ((plan) -> recv_starts)
+#define hypre_IJPatternPlanRecvSlots(plan)     ((plan) -> recv_slots)
+#define hypre_IJPatternPlanRecvData(plan)      ((plan) -> recv_data)
+#define hypre_IJPatternPlanRequests(plan)      ((plan) -> requests)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -243,7 +338,11 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_rows;     /* global partition */
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
+   HYPRE_Int     bulk_assembly;       /* stack (i, j, a) triples and sort them
+                                         at assembly, see IJMatrix_parcsr_bulk.c */
    HYPRE_Int     print_level;
+   hypre_IJPatternPlan *pattern_plan; /* slots of the entries of a matrix
+                                         with a frozen pattern */
 
 } hypre_IJMatrix;
 
@@ -267,7 +366,9 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumRows(matrix)    ((matrix) -> global_num_rows)
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
+#define hypre_IJMatrixBulkAssembly(matrix)     ((matrix) -> bulk_assembly)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixPatternPlan(matrix)      ((matrix) -> pattern_plan)
 
 static inline HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
@@ -384,6 +485,8 @@ HYPRE_Int hypre_AuxParCSRMatrixCreate ( hypre_AuxParCSRMatrix **aux_matrix , HYP
 HYPRE_Int hypre_AuxParCSRMatrixDestroy ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix, HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_AuxParCSRMatrixInitializeBulk ( hypre_AuxParCSRMatrix *matrix , HYPRE_Int num_stacks );
+HYPRE_Int hypre_AuxParCSRMatrixDestroyBulk ( hypre_AuxParCSRMatrix *matrix );
 
 /* aux_par_vector.c */
 HYPRE_Int hypre_AuxParVectorCreate ( hypre_AuxParVector **aux_vector );
@@ -440,6 +543,18 @@ HYPRE_Int hypre_IJMatrixAssembleParCSRDevice(hypre_IJMatrix *matrix);
 HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix, HYPRE_Complex value );
 
+/* IJMatrix_parcsr_bulk.c */
+HYPRE_Int hypre_IJMatrixSetAddValuesParCSRBulk ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values , const char *action );
+HYPRE_Int hypre_IJMatrixAddRecvValuesParCSRBulk ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixAssembleBulkOffProcParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleBulkParCSR ( hypre_IJMatrix *matrix );
+
+/* IJMatrix_parcsr_frozen.c */
+HYPRE_Int hypre_IJPatternPlanDestroy ( hypre_IJPatternPlan *plan );
+HYPRE_Int hypre_IJMatrixFreezePatternParCSR ( hypre_IJMatrix *matrix , HYPRE_Int freeze );
+HYPRE_Int hypre_IJMatrixSetAddValuesParCSRFrozen ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values , const char *action );
+HYPRE_Int hypre_IJMatrixAssembleFrozenParCSR ( hypre_IJMatrix *matrix );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix , HYPRE_Int local_m , HYPRE_Int local_n );
 HYPRE_Int hypre_IJMatrixCreatePETSc ( hypre_IJMatrix *matrix );
@@ -498,6 +613,8 @@ HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix , HYPRE_Int m
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename , MPI_Comm comm , HYPRE_Int type , HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix , const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix , HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetBulkAssembly ( HYPRE_IJMatrix matrix , HYPRE_Int bulk_assembly );
+HYPRE_Int HYPRE_IJMatrixSetFreezePattern ( HYPRE_IJMatrix matrix , HYPRE_Int freeze );
 
 /* HYPRE_IJVector.c */
 HYPRE_Int HYPRE_IJVectorCreate ( MPI_Comm comm , HYPRE_BigInt jlower , HYPRE_BigInt jupper , HYPRE_IJVector *vector );
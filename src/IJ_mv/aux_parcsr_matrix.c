@@ -50,6 +50,14 @@ hypre_AuxParCSRMatrixCreate( hypre_AuxParCSRMatrix **aux_matrix,
    hypre_AuxParCSRMatrixOffProcJ(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcData(matrix) = NULL;
    hypre_AuxParCSRMatrixMemoryLocation(matrix) = HYPRE_MEMORY_HOST;
+   /* stacks for host bulk assembly */
+   hypre_AuxParCSRMatrixNumBulkStacks(matrix) = 0;
+   hypre_AuxParCSRMatrixBulkMaxElmts(matrix) = NULL;
+   hypre_AuxParCSRMatrixBulkCurrentElmts(matrix) = NULL;
+   hypre_AuxParCSRMatrixBulkI(matrix) = NULL;
+   hypre_AuxParCSRMatrixBulkJ(matrix) = NULL;
+   hypre_AuxParCSRMatrixBulkData(matrix) = NULL;
+   hypre_AuxParCSRMatrixBulkSorA(matrix) = NULL;
 #if defined(HYPRE_USING_CUDA)
    hypre_AuxParCSRMatrixMaxStackElmts(matrix) = 0;
    hypre_AuxParCSRMatrixCurrentStackElmts(matrix) = 0;
@@ -112,6 +120,8 @@ hypre_AuxParCSRMatrixDestroy( hypre_AuxParCSRMatrix *matrix )
       hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(matrix),    HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_AuxParCSRMatrixOffProcData(matrix), HYPRE_MEMORY_HOST);
 
+      hypre_AuxParCSRMatrixDestroyBulk(matrix);
+
 #if defined(HYPRE_USING_CUDA)
       hypre_TFree(hypre_AuxParCSRMatrixStackI(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
       hypre_TFree(hypre_AuxParCSRMatrixStackJ(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
@@ -206,6 +216,60 @@ hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix, HYPRE_MemoryL
    return 0;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRMatrixInitializeBulk
+ *
+ * Creates num_stacks empty stacks for host bulk assembly.  The stacks grow
+ * as entries are added, see hypre_IJMatrixSetAddValuesParCSRBulk.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRMatrixInitializeBulk( hypre_AuxParCSRMatrix *matrix,
+                                     HYPRE_Int              num_stacks )
+{
+   if (hypre_AuxParCSRMatrixNumBulkStacks(matrix))
+   {
+      return 0;
+   }
+
+   hypre_AuxParCSRMatrixBulkMaxElmts(matrix)     = hypre_CTAlloc(HYPRE_Int,       num_stacks, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixBulkCurrentElmts(matrix) = hypre_CTAlloc(HYPRE_Int,       num_stacks, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixBulkI(matrix)            = hypre_CTAlloc(HYPRE_BigInt *,  num_stacks, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixBulkJ(matrix)            = hypre_CTAlloc(HYPRE_BigInt *,  num_stacks, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixBulkData(matrix)         = hypre_CTAlloc(HYPRE_Complex *, num_stacks, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixBulkSorA(matrix)         = hypre_CTAlloc(char *,          num_stacks, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixNumBulkStacks(matrix)    = num_stacks;
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRMatrixDestroyBulk
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRMatrixDestroyBulk( hypre_AuxParCSRMatrix *matrix )
+{
+   HYPRE_Int i;
+
+   for (i = 0; i < hypre_AuxParCSRMatrixNumBulkStacks(matrix); i++)
+   {
+      hypre_TFree(hypre_AuxParCSRMatrixBulkI(matrix)[i],    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixBulkJ(matrix)[i],    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixBulkData(matrix)[i], HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixBulkSorA(matrix)[i], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(hypre_AuxParCSRMatrixBulkMaxElmts(matrix),     HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixBulkCurrentElmts(matrix), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixBulkI(matrix),            HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixBulkJ(matrix),            HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixBulkData(matrix),         HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixBulkSorA(matrix),         HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixNumBulkStacks(matrix) = 0;
+
+   return 0;
+}
+
 HYPRE_Int
 hypre_AuxParCSRMatrixInitialize(hypre_AuxParCSRMatrix *matrix)
 {
@@ -63,6 +63,16 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   /* stacks of (i, j, data) triples for host bulk assembly, two per thread:
+    * stacks [0, n/2) hold the local calls, [n/2, n) the received values */
+   HYPRE_Int            num_bulk_stacks;
+   HYPRE_Int           *bulk_max_elmts;
+   HYPRE_Int           *bulk_current_elmts;
+   HYPRE_BigInt       **bulk_i;
+   HYPRE_BigInt       **bulk_j;
+   HYPRE_Complex      **bulk_data;
+   char               **bulk_sora;               /* Set (1) or Add (0) */
+
 #if defined(HYPRE_USING_CUDA)
    HYPRE_Int            max_stack_elmts;
    HYPRE_Int            current_stack_elmts;
@@ -105,6 +115,14 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixNumBulkStacks(matrix)        ((matrix) -> num_bulk_stacks)
+#define hypre_AuxParCSRMatrixBulkMaxElmts(matrix)         ((matrix) -> bulk_max_elmts)
+#define hypre_AuxParCSRMatrixBulkCurrentElmts(matrix)     ((matrix) -> bulk_current_elmts)
+#define hypre_AuxParCSRMatrixBulkI(matrix)                ((matrix) -> bulk_i)
+#define hypre_AuxParCSRMatrixBulkJ(matrix)                ((matrix) -> bulk_j)
+#define hypre_AuxParCSRMatrixBulkData(matrix)             ((matrix) -> bulk_data)
+#define hypre_AuxParCSRMatrixBulkSorA(matrix)             ((matrix) -> bulk_sora)
+
 #if defined(HYPRE_USING_CUDA)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
@@ -10,6 +10,8 @@ HYPRE_Int hypre_AuxParCSRMatrixCreate ( hypre_AuxParCSRMatrix **aux_matrix , HYP
 HYPRE_Int hypre_AuxParCSRMatrixDestroy ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix, HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_AuxParCSRMatrixInitializeBulk ( hypre_AuxParCSRMatrix *matrix , HYPRE_Int num_stacks );
+HYPRE_Int hypre_AuxParCSRMatrixDestroyBulk ( hypre_AuxParCSRMatrix *matrix );
 
 /* aux_par_vector.c */
 HYPRE_Int hypre_AuxParVectorCreate ( hypre_AuxParVector **aux_vector );
@@ -66,6 +68,18 @@ HYPRE_Int hypre_IJMatrixAssembleParCSRDevice(hypre_IJMatrix *matrix);
 HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix, HYPRE_Complex value );
 
+/* IJMatrix_parcsr_bulk.c */
+HYPRE_Int hypre_IJMatrixSetAddValuesParCSRBulk ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values , const char *action );
+HYPRE_Int hypre_IJMatrixAddRecvValuesParCSRBulk ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixAssembleBulkOffProcParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleBulkParCSR ( hypre_IJMatrix *matrix );
+
+/* IJMatrix_parcsr_frozen.c */
+HYPRE_Int hypre_IJPatternPlanDestroy ( hypre_IJPatternPlan *plan );
+HYPRE_Int hypre_IJMatrixFreezePatternParCSR ( hypre_IJMatrix *matrix , HYPRE_Int freeze );
+HYPRE_Int hypre_IJMatrixSetAddValuesParCSRFrozen ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values , const char *action );
+HYPRE_Int hypre_IJMatrixAssembleFrozenParCSR ( hypre_IJMatrix *matrix );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix , HYPRE_Int local_m , HYPRE_Int local_n );
 HYPRE_Int hypre_IJMatrixCreatePETSc ( hypre_IJMatrix *matrix );
@@ -124,6 +138,8 @@ HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix , HYPRE_Int m
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename , MPI_Comm comm , HYPRE_Int type , HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix , const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix , HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetBulkAssembly ( HYPRE_IJMatrix matrix , HYPRE_Int bulk_assembly );
+HYPRE_Int HYPRE_IJMatrixSetFreezePattern ( HYPRE_IJMatrix matrix , HYPRE_Int freeze );
 
 /* HYPRE_IJVector.c */
 HYPRE_Int HYPRE_IJVectorCreate ( MPI_Comm comm , HYPRE_BigInt jlower , HYPRE_BigInt jupper , HYPRE_IJVector *vector );
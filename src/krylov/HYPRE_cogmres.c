@@ -110,6 +110,42 @@ HYPRE_COGMRESGetCGS( HYPRE_Solver solver,
    return( hypre_COGMRESGetCGS( (void *) solver, cgs ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_COGMRESSetSStep, HYPRE_COGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_COGMRESSetSStep( HYPRE_Solver solver,
+                       HYPRE_Int    s_step )
+{
+   return( hypre_COGMRESSetSStep( (void *) solver, s_step ) );
+}
+
+HYPRE_Int
+HYPRE_COGMRESGetSStep( HYPRE_Solver solver,
+                       HYPRE_Int  * s_step )
+{
+   return( hypre_COGMRESGetSStep( (void *) solver, s_step ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_COGMRESSetSStepBasis, HYPRE_COGMRESGetSStepBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_COGMRESSetSStepBasis( HYPRE_Solver solver,
+                            HYPRE_Int    s_basis )
+{
+   return( hypre_COGMRESSetSStepBasis( (void *) solver, s_basis ) );
+}
+
+HYPRE_Int
+HYPRE_COGMRESGetSStepBasis( HYPRE_Solver solver,
+                            HYPRE_Int  * s_basis )
+{
+   return( hypre_COGMRESGetSStepBasis( (void *) solver, s_basis ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_COGMRESSetTol, HYPRE_COGMRESGetTol
  *--------------------------------------------------------------------------*/
@@ -178,6 +178,19 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Choose the CG recurrences.  The default 0 is the standard
+ * algorithm with two global reductions per iteration.  With 1, the
+ * Chronopoulos-Gear variant does a single reduction per iteration.  With 2,
+ * the pipelined (Ghysels-Vanroose) variant also overlaps that reduction with
+ * the preconditioner and the matrix-vector product, at the cost of six
+ * more vectors and slightly less stable recurrences.  The overlap needs a
+ * nonblocking reduction, which the ParCSR, Struct and SStruct interfaces
+ * provide.
+ **/
+HYPRE_Int HYPRE_PCGSetVariant(HYPRE_Solver solver,
+                              HYPRE_Int    variant);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -259,6 +272,11 @@ HYPRE_Int HYPRE_PCGGetTwoNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetRelChange(HYPRE_Solver  solver,
                                 HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetVariant(HYPRE_Solver  solver,
+                              HYPRE_Int    *variant);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
@@ -896,6 +914,33 @@ HYPRE_Int HYPRE_COGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_COGMRESSetCGS(HYPRE_Solver solver,
                               HYPRE_Int    cgs);
 
+/**
+ * (Optional) Use s-step (communication-avoiding) Arnoldi with blocks of
+ * {\tt s\_step} basis vectors when {\tt s\_step} > 1.  Each block is
+ * generated by {\tt s\_step} consecutive preconditioner and matvec
+ * applications and orthogonalized with a single global reduction (block
+ * Gram-Schmidt followed by a Cholesky QR), which is repeated if CGS is 2.
+ * Default: 1 (standard COGMRES).
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
+/**
+ * (Optional) Set the polynomial basis of the s-step blocks:
+ *
+ * \begin{tabular}{|c|l|} \hline
+ * 0 & monomial \\
+ * 1 & Newton, with Leja-ordered Ritz value estimates as shifts (default) \\
+ * 2 & Chebyshev, on the interval spanned by the Ritz value estimates \\
+ * \hline
+ * \end{tabular}
+ *
+ * The Newton and Chebyshev bases take their estimates from a standard
+ * Arnoldi first restart cycle.
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStepBasis(HYPRE_Solver solver,
+                                     HYPRE_Int    s_basis);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -977,6 +1022,16 @@ HYPRE_Int HYPRE_COGMRESGetUnroll(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_COGMRESGetCGS(HYPRE_Solver  solver,
                               HYPRE_Int    *cgs);
 
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetSStep(HYPRE_Solver  solver,
+                                HYPRE_Int    *s_step);
+
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetSStepBasis(HYPRE_Solver  solver,
+                                     HYPRE_Int    *s_basis);
+
 /**
  **/
 HYPRE_Int HYPRE_COGMRESGetPrecond(HYPRE_Solver  solver,
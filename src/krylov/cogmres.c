@@ -13,6 +13,7 @@
 
 #include "krylov.h"
 #include "_hypre_utilities.h"
+#include "_hypre_lapack.h"
 
 /*--------------------------------------------------------------------------
  * hypre_COGMRESFunctionsCreate
@@ -64,6 +65,7 @@ hypre_COGMRESFunctionsCreate(
    cogmres_functions->ScaleVector       = ScaleVector;
    cogmres_functions->Axpy              = Axpy;
    cogmres_functions->MassAxpy          = MassAxpy;
+   cogmres_functions->MassInnerProdMult = NULL;
    /* default preconditioner must be set here but can be changed later... */
    cogmres_functions->precond_setup     = PrecondSetup;
    cogmres_functions->precond           = Precond;
@@ -71,6 +73,25 @@ hypre_COGMRESFunctionsCreate(
    return cogmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESFunctionsSetMassInnerProdMult
+ *
+ * MassInnerProdMult computes the s*k products <x[j],p[i]> with a single
+ * global reduction.  Without it, the s-step blocks use s MassInnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetMassInnerProdMult(
+   hypre_COGMRESFunctions *cogmres_functions,
+   HYPRE_Int    (*MassInnerProdMult) ( void **x, HYPRE_Int s, void **p, HYPRE_Int k,
+                                       HYPRE_Int unroll, void *result )
+   )
+{
+   cogmres_functions->MassInnerProdMult = MassInnerProdMult;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -88,6 +109,8 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    /* set defaults */
    (cogmres_data -> k_dim)          = 5;
    (cogmres_data -> cgs)            = 1; /* if 2 performs reorthogonalization */
+   (cogmres_data -> s_step)         = 1;
+   (cogmres_data -> s_basis)        = 1;
    (cogmres_data -> tol)            = 1.0e-06; /* relative residual tol */
    (cogmres_data -> cf_tol)         = 0.0;
    (cogmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -241,6 +264,674 @@ hypre_COGMRESSetup( void *cogmres_vdata,
 
    return hypre_error_flag;
 }
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSStepShifts
+ *
+ * Estimates the spectrum of the preconditioned operator from the m x m
+ * Hessenberg matrix hh of a standard Arnoldi cycle (stored with leading
+ * dimension ld) and returns the Newton shifts theta[0..s-1], Leja ordered,
+ * or the center c0 and half width d0 of the Chebyshev interval.  The
+ * estimates are the eigenvalues of the symmetric part of hh.  Returns 0
+ * if no estimate is available.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESSStepShifts( hypre_COGMRESFunctions *cogmres_functions,
+                          HYPRE_Real             *hh,
+                          HYPRE_Int               ld,
+                          HYPRE_Int               m,
+                          HYPRE_Int               s,
+                          HYPRE_Real             *theta,
+                          HYPRE_Real             *c0,
+                          HYPRE_Real             *d0 )
+{
+   HYPRE_Real *sym, *ev, *work, *dist;
+   HYPRE_Real  emin, emax, d;
+   HYPRE_Int   lwork = 3*m, info;
+   HYPRE_Int   i, j, k, kbest;
+
+   if (m < 1)
+   {
+      return 0;
+   }
+
+   sym  = hypre_CTAllocF(HYPRE_Real, m*m, cogmres_functions, HYPRE_MEMORY_HOST);
+   ev   = hypre_CTAllocF(HYPRE_Real, m, cogmres_functions, HYPRE_MEMORY_HOST);
+   work = hypre_CTAllocF(HYPRE_Real, lwork, cogmres_functions, HYPRE_MEMORY_HOST);
+   dist = hypre_CTAllocF(HYPRE_Real, m, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < m; j++)
+   {
+      for (i = 0; i < m; i++)
+      {
+         sym[j*m+i] = 0.5*(hh[j*ld+i] + hh[i*ld+j]);
+      }
+   }
+   hypre_dsyev("N", "U", &m, sym, &m, ev, work, &lwork, &info);
+
+   if (info == 0)
+   {
+      emin = ev[0];
+      emax = ev[m-1];
+
+      /* Chebyshev interval */
+      *c0 = 0.5*(emax + emin);
+      d   = 0.5*(emax - emin);
+      if (d <= 1.0e-8*fabs(*c0))
+      {
+         d = (*c0 != 0.0) ? fabs(*c0) : 1.0;
+      }
+      *d0 = d;
+
+      /* Leja ordering of the estimates: start with the largest one in
+         magnitude, then maximize the (log of the) product of distances */
+      for (k = 0; k < m; k++)
+      {
+         dist[k] = 0.0;
+      }
+      for (j = 0; j < s; j++)
+      {
+         if (j % m == 0)
+         {
+            /* all estimates used, cycle through them again */
+            for (k = 0; k < m; k++)
+            {
+               dist[k] = log(fabs(ev[k]) + HYPRE_REAL_MIN);
+            }
+         }
+         kbest = 0;
+         for (k = 1; k < m; k++)
+         {
+            if (dist[k] > dist[kbest])
+            {
+               kbest = k;
+            }
+         }
+         theta[j] = ev[kbest];
+         for (k = 0; k < m; k++)
+         {
+            dist[k] += log(fabs(ev[k] - theta[j]) + HYPRE_REAL_MIN);
+         }
+         dist[kbest] = -HYPRE_REAL_MAX;
+      }
+   }
+
+   hypre_TFreeF(sym, cogmres_functions);
+   hypre_TFreeF(ev, cogmres_functions);
+   hypre_TFreeF(work, cogmres_functions);
+   hypre_TFreeF(dist, cogmres_functions);
+
+   return (info == 0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSStepOrthogonalize
+ *
+ * Orthogonalizes the s vectors v = p[m+1..m+s] against q = p[0..m] and
+ * among themselves with one global reduction: the products [q v]^T v give
+ * c = q^T v and the Gram matrix of v - q c, whose Cholesky factor r yields
+ * the new orthonormal vectors (v - q c) r^{-1}, so that v = q c + p r.
+ * c is (m+1) x s and r is s x s with leading dimension ldr, both
+ * column-major.  Cholesky breakdown (a numerically dependent block)
+ * truncates the block; the number of vectors kept is returned.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESSStepOrthogonalize( hypre_COGMRESFunctions *cogmres_functions,
+                                 void                  **p,
+                                 HYPRE_Int               m,
+                                 HYPRE_Int               s,
+                                 HYPRE_Int               unroll,
+                                 HYPRE_Real             *c,
+                                 HYPRE_Real             *r,
+                                 HYPRE_Int               ldr,
+                                 HYPRE_Real             *gram )
+{
+   HYPRE_Int   k = m + 1 + s;
+   HYPRE_Int   i, j, l, s_eff;
+   HYPRE_Real  pivot, t;
+
+   /* gram[j*k+i] = <p[m+1+j],p[i]>, a single reduction */
+   if (cogmres_functions -> MassInnerProdMult)
+   {
+      (*(cogmres_functions->MassInnerProdMult))(&p[m+1], s, p, k, unroll, gram);
+   }
+   else
+   {
+      for (j = 0; j < s; j++)
+      {
+         (*(cogmres_functions->MassInnerProd))(p[m+1+j], p, k, unroll, &gram[j*k]);
+      }
+   }
+
+   /* c = q^T v, and v = v - q c */
+   for (j = 0; j < s; j++)
+   {
+      for (i = 0; i <= m; i++)
+      {
+         c[j*(m+1)+i] = -gram[j*k+i];
+      }
+      (*(cogmres_functions->MassAxpy))(&c[j*(m+1)], p, p[m+1+j], m+1, unroll);
+      for (i = 0; i <= m; i++)
+      {
+         c[j*(m+1)+i] = -c[j*(m+1)+i];
+      }
+   }
+
+   /* Cholesky factor of v^T v - c^T c */
+   s_eff = s;
+   for (j = 0; j < s && s_eff == s; j++)
+   {
+      for (i = 0; i <= j; i++)
+      {
+         t = gram[j*k+m+1+i];
+         for (l = 0; l <= m; l++)
+         {
+            t -= c[i*(m+1)+l]*c[j*(m+1)+l];
+         }
+         for (l = 0; l < i; l++)
+         {
+            t -= r[i*ldr+l]*r[j*ldr+l];
+         }
+         if (i < j)
+         {
+            r[j*ldr+i] = t/r[i*ldr+i];
+         }
+         else
+         {
+            pivot = t;
+            if ( !(pivot > 1.0e-10*gram[j*k+m+1+j]) )
+            {
+               s_eff = j;
+            }
+            else
+            {
+               r[j*ldr+j] = sqrt(pivot);
+            }
+         }
+      }
+   }
+
+   /* p[m+1..m+s_eff] = (v - q c) r^{-1} */
+   for (j = 0; j < s_eff; j++)
+   {
+      for (i = 0; i < j; i++)
+      {
+         gram[i] = -r[j*ldr+i];
+      }
+      if (j)
+      {
+         (*(cogmres_functions->MassAxpy))(gram, &p[m+1], p[m+1+j], j, unroll);
+      }
+      (*(cogmres_functions->ScaleVector))(1.0/r[j*ldr+j], p[m+1+j]);
+   }
+
+   return s_eff;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSolveSStep
+ *
+ * s-step (communication-avoiding) version of hypre_COGMRESSolve.  Each
+ * block of s basis vectors v_j = P_j(A M^{-1}) q_m is generated with s
+ * consecutive preconditioner and matvec applications, where P_j is a
+ * monomial, Newton or Chebyshev polynomial, so that
+ *
+ *   A M^{-1} [v_0 .. v_{s-1}] = [v_0 .. v_s] B
+ *
+ * with a small (s+1) x s change of basis matrix B.  The block is then
+ * orthogonalized with a single reduction (twice if cgs > 1), and the
+ * Hessenberg columns are recovered from B and the orthogonalization
+ * coefficients.  The residual is recomputed at each restart.  Called by
+ * hypre_COGMRESSolve when s_step > 1 and rel_change is off.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESSolveSStep(void  *cogmres_vdata,
+                        void  *A,
+                        void  *b,
+                        void  *x)
+{
+   hypre_COGMRESData      *cogmres_data      = (hypre_COGMRESData *)cogmres_vdata;
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data->functions;
+   HYPRE_Int     k_dim             = (cogmres_data -> k_dim);
+   HYPRE_Int     unroll            = (cogmres_data -> unroll);
+   HYPRE_Int     cgs               = (cogmres_data -> cgs);
+   HYPRE_Int     s_step            = (cogmres_data -> s_step);
+   HYPRE_Int     s_basis           = (cogmres_data -> s_basis);
+   HYPRE_Int     min_iter          = (cogmres_data -> min_iter);
+   HYPRE_Int     max_iter          = (cogmres_data -> max_iter);
+   HYPRE_Real    r_tol             = (cogmres_data -> tol);
+   HYPRE_Real    cf_tol            = (cogmres_data -> cf_tol);
+   HYPRE_Real    a_tol             = (cogmres_data -> a_tol);
+   void         *matvec_data       = (cogmres_data -> matvec_data);
+
+   void         *r                 = (cogmres_data -> r);
+   void         *w                 = (cogmres_data -> w);
+   void        **p                 = (cogmres_data -> p);
+
+   HYPRE_Int (*precond)(void*,void*,void*,void*) = (cogmres_functions -> precond);
+   HYPRE_Int  *precond_data       = (HYPRE_Int*)(cogmres_data -> precond_data);
+
+   HYPRE_Int print_level = (cogmres_data -> print_level);
+   HYPRE_Int logging     = (cogmres_data -> logging);
+
+   HYPRE_Real     *norms          = (cogmres_data -> norms);
+
+   HYPRE_Int  ld = k_dim+1;
+   HYPRE_Int  i, j, k, l, m, s, s_eff, pass, n_rows;
+   HYPRE_Int  iter, my_id, num_procs;
+   HYPRE_Int  basis, breakdown, cycle_done, break_value = 0;
+   /* hh: Hessenberg matrix, hr: its rotated (triangular) copy */
+   HYPRE_Real *hh, *hr, *rs, *c, *sn;
+   HYPRE_Real *theta, *bb, *cc, *rr, *cc2, *rr2, *gram, *rhat, *hnew;
+   HYPRE_Real  c0 = 0.0, d0 = 1.0;
+   HYPRE_Real  epsilon, gamma, t, r_norm, b_norm, den_norm;
+   HYPRE_Real  r_norm_0, real_r_norm_old;
+   HYPRE_Real  epsmac = 1.e-16;
+   HYPRE_Real  ieee_check = 0.;
+   HYPRE_Real  cf_ave_0 = 0.0;
+   HYPRE_Real  cf_ave_1 = 0.0;
+   HYPRE_Real  weight;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (cogmres_data -> converged) = 0;
+
+   (*(cogmres_functions->CommInfo))(A,&my_id,&num_procs);
+
+   /* initialize work arrays */
+   hh    = hypre_CTAllocF(HYPRE_Real, ld*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   hr    = hypre_CTAllocF(HYPRE_Real, ld*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   rs    = hypre_CTAllocF(HYPRE_Real, ld, cogmres_functions, HYPRE_MEMORY_HOST);
+   c     = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   sn    = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   theta = hypre_CTAllocF(HYPRE_Real, s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   bb    = hypre_CTAllocF(HYPRE_Real, (s_step+1)*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   cc    = hypre_CTAllocF(HYPRE_Real, ld*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   rr    = hypre_CTAllocF(HYPRE_Real, s_step*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   cc2   = hypre_CTAllocF(HYPRE_Real, ld*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   rr2   = hypre_CTAllocF(HYPRE_Real, s_step*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   gram  = hypre_CTAllocF(HYPRE_Real, (ld+s_step)*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   rhat  = hypre_CTAllocF(HYPRE_Real, (ld+s_step)*(s_step+1), cogmres_functions, HYPRE_MEMORY_HOST);
+   hnew  = hypre_CTAllocF(HYPRE_Real, (ld+s_step)*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   /* the Newton and Chebyshev bases need spectral estimates, which are taken
+      from a first cycle of standard (one vector per block) Arnoldi */
+   basis = (s_basis > 0) ? -1 : 0;
+
+   /* compute initial residual */
+   (*(cogmres_functions->CopyVector))(b,p[0]);
+   (*(cogmres_functions->Matvec))(matvec_data,-1.0, A, x, 1.0, p[0]);
+
+   b_norm = sqrt((*(cogmres_functions->InnerProd))(b,b));
+   r_norm = sqrt((*(cogmres_functions->InnerProd))(p[0],p[0]));
+   r_norm_0 = r_norm;
+   real_r_norm_old = r_norm;
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (r_norm != 0.) ieee_check = r_norm/r_norm; /* INF -> NaN conversion */
+   if (b_norm != 0.) ieee_check += b_norm/b_norm;
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_COGMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      r_norm = 0.0;
+      iter = 0;
+      break_value = 1;
+   }
+
+   if ( logging>0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+      if ( print_level>1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   /* convergence criterion |r_i| <= max(a_tol, r_tol*den_norm), with
+      den_norm = |b| if |b| > 0 and |r_0| otherwise */
+   den_norm = (b_norm > 0.0) ? b_norm : r_norm;
+   epsilon = hypre_max(a_tol,r_tol*den_norm);
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      if (b_norm > 0.0)
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+      }
+      else
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      };
+   }
+
+   while (iter < max_iter && !break_value)
+   {
+      if (r_norm == 0.0 || (r_norm <= epsilon && iter >= min_iter))
+      {
+         (cogmres_data -> converged) = 1;
+         break;
+      }
+
+      rs[0] = r_norm;
+      (*(cogmres_functions->ScaleVector))(1.0/r_norm, p[0]);
+
+      /*** RESTART CYCLE (right-preconditioning) ***/
+      i = 0;           /* number of Hessenberg columns */
+      m = 0;           /* p[0..m] is orthonormal */
+      cycle_done = 0;
+      while (!cycle_done)
+      {
+         s = (basis < 0) ? 1 : s_step;
+         s = hypre_min(s, k_dim - m);
+         s = hypre_min(s, max_iter - iter);
+
+         /* generate the block, AM [v_0..v_{s-1}] = [v_0..v_s] bb */
+         for (k = 0; k < (s_step+1)*s_step; k++)
+         {
+            bb[k] = 0.0;
+         }
+         for (j = 0; j < s; j++)
+         {
+            (*(cogmres_functions->ClearVector))(r);
+            precond(precond_data, A, p[m+j], r);
+            (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[m+j+1]);
+
+            if (basis == 1)
+            {
+               (*(cogmres_functions->Axpy))(-theta[j], p[m+j], p[m+j+1]);
+               bb[j*(s_step+1)+j]   = theta[j];
+               bb[j*(s_step+1)+j+1] = 1.0;
+            }
+            else if (basis == 2)
+            {
+               (*(cogmres_functions->Axpy))(-c0, p[m+j], p[m+j+1]);
+               bb[j*(s_step+1)+j] = c0;
+               if (j == 0)
+               {
+                  (*(cogmres_functions->ScaleVector))(1.0/d0, p[m+j+1]);
+                  bb[j*(s_step+1)+j+1] = d0;
+               }
+               else
+               {
+                  (*(cogmres_functions->ScaleVector))(2.0/d0, p[m+j+1]);
+                  (*(cogmres_functions->Axpy))(-1.0, p[m+j-1], p[m+j+1]);
+                  bb[j*(s_step+1)+j+1] = 0.5*d0;
+                  bb[j*(s_step+1)+j-1] = 0.5*d0;
+               }
+            }
+            else
+            {
+               bb[j*(s_step+1)+j+1] = 1.0;
+            }
+         }
+
+         /* orthogonalize, v = q cc + p[m+1..m+s] rr */
+         s_eff = hypre_COGMRESSStepOrthogonalize(cogmres_functions, p, m, s, unroll,
+                                                 cc, rr, s_step, gram);
+         for (pass = 1; pass < cgs && s_eff > 0; pass++)
+         {
+            /* repeat: cc += cc2 rr, rr = rr2 rr */
+            s_eff = hypre_COGMRESSStepOrthogonalize(cogmres_functions, p, m, s_eff, unroll,
+                                                    cc2, rr2, s_step, gram);
+            for (j = 0; j < s_eff; j++)
+            {
+               for (k = 0; k <= m; k++)
+               {
+                  for (l = 0; l <= j; l++)
+                  {
+                     cc[j*(m+1)+k] += cc2[l*(m+1)+k]*rr[j*s_step+l];
+                  }
+               }
+               for (k = 0; k <= j; k++)
+               {
+                  t = 0.0;
+                  for (l = k; l <= j; l++)
+                  {
+                     t += rr2[l*s_step+k]*rr[j*s_step+l];
+                  }
+                  rr[j*s_step+k] = t;
+               }
+            }
+         }
+
+         /* a dependent block: keep the first column, whose new Hessenberg
+            entry is zero, and end the cycle (lucky breakdown) */
+         breakdown = (s_eff < s);
+         if (s_eff == 0)
+         {
+            rr[0] = 0.0;
+            s_eff = 1;
+         }
+         s = s_eff;
+         n_rows = m+1+s;
+
+         /* rhat: [v_0..v_s] = p[0..m+s] rhat */
+         for (k = 0; k < n_rows*(s+1); k++)
+         {
+            rhat[k] = 0.0;
+         }
+         rhat[m] = 1.0;
+         for (j = 1; j <= s; j++)
+         {
+            for (k = 0; k <= m; k++)
+            {
+               rhat[j*n_rows+k] = cc[(j-1)*(m+1)+k];
+            }
+            for (k = 0; k < j; k++)
+            {
+               rhat[j*n_rows+m+1+k] = rr[(j-1)*s_step+k];
+            }
+         }
+
+         /* hnew = (rhat bb - hh rhat(0:m-1,:)) rhat(m:m+s-1,:)^{-1} */
+         for (j = 0; j < s; j++)
+         {
+            for (k = 0; k < n_rows; k++)
+            {
+               t = 0.0;
+               for (l = 0; l <= s; l++)
+               {
+                  t += rhat[l*n_rows+k]*bb[j*(s_step+1)+l];
+               }
+               if (k <= m)
+               {
+                  for (l = 0; l < m; l++)
+                  {
+                     t -= hh[l*ld+k]*rhat[j*n_rows+l];
+                  }
+               }
+               for (l = 0; l < j; l++)
+               {
+                  t -= hnew[l*n_rows+k]*rhat[j*n_rows+m+l];
+               }
+               hnew[j*n_rows+k] = t/rhat[j*n_rows+m+j];
+            }
+         }
+
+         /* add the columns to the Hessenberg system */
+         for (j = 0; j < s && !cycle_done; j++)
+         {
+            for (k = 0; k < ld; k++)
+            {
+               hh[i*ld+k] = (k <= i+1) ? hnew[j*n_rows+k] : 0.0;
+               hr[i*ld+k] = hh[i*ld+k];
+            }
+            i++;
+            iter++;
+
+            for (k = 1; k < i; k++)
+            {
+               t = hr[(i-1)*ld+k-1];
+               hr[(i-1)*ld+k-1] = sn[k-1]*hr[(i-1)*ld+k] + c[k-1]*t;
+               hr[(i-1)*ld+k] = -sn[k-1]*t + c[k-1]*hr[(i-1)*ld+k];
+            }
+            t = hr[(i-1)*ld+i]*hr[(i-1)*ld+i];
+            t += hr[(i-1)*ld+i-1]*hr[(i-1)*ld+i-1];
+            gamma = sqrt(t);
+            if (gamma == 0.0) gamma = epsmac;
+            c[i-1] = hr[(i-1)*ld+i-1]/gamma;
+            sn[i-1] = hr[(i-1)*ld+i]/gamma;
+            rs[i] = -hr[(i-1)*ld+i]*rs[i-1];
+            rs[i] /= gamma;
+            rs[i-1] = c[i-1]*rs[i-1];
+            hr[(i-1)*ld+i-1] = sn[i-1]*hr[(i-1)*ld+i] + c[i-1]*hr[(i-1)*ld+i-1];
+            r_norm = fabs(rs[i]);
+
+            if ( print_level>0 )
+            {
+               norms[iter] = r_norm;
+               if ( print_level>1 && my_id == 0 )
+               {
+                  if (b_norm > 0.0)
+                     hypre_printf("% 5d    %e    %f   %e\n", iter,
+                        norms[iter],norms[iter]/norms[iter-1],
+                        norms[iter]/b_norm);
+                  else
+                     hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                        norms[iter]/norms[iter-1]);
+               }
+            }
+            /*convergence factor tolerance */
+            if (cf_tol > 0.0)
+            {
+               cf_ave_0 = cf_ave_1;
+               cf_ave_1 = pow( r_norm / r_norm_0, 1.0/(2.0*iter));
+
+               weight = fabs(cf_ave_1 - cf_ave_0);
+               weight = weight / hypre_max(cf_ave_1, cf_ave_0);
+
+               weight = 1.0 - weight;
+               if (weight * cf_ave_1 > cf_tol)
+               {
+                  break_value = 1;
+                  cycle_done = 1;
+               }
+            }
+            if (r_norm <= epsilon && iter >= min_iter)
+            {
+               cycle_done = 1;
+            }
+         }
+
+         m += s;
+         if (breakdown || m >= k_dim || iter >= max_iter)
+         {
+            cycle_done = 1;
+         }
+      } /*** end of restart cycle ***/
+
+      /* spectral estimates for the s-step basis of the next cycles */
+      if (basis < 0)
+      {
+         basis = 0;
+         if (hypre_COGMRESSStepShifts(cogmres_functions, hh, ld, i, s_step,
+                                      theta, &c0, &d0))
+         {
+            basis = s_basis;
+         }
+      }
+
+      /* solve the upper triangular system and update x */
+      rs[i-1] = rs[i-1]/hr[(i-1)*ld+i-1];
+      for (k = i-2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (j = k+1; j < i; j++)
+         {
+            t -= hr[j*ld+k]*rs[j];
+         }
+         t+= rs[k];
+         rs[k] = t/hr[k*ld+k];
+      }
+
+      (*(cogmres_functions->ClearVector))(w);
+      (*(cogmres_functions->MassAxpy))(rs, p, w, i, unroll);
+
+      (*(cogmres_functions->ClearVector))(r);
+      /* find correction (in r) */
+      precond(precond_data, A, w, r);
+
+      /* update current solution x (in x) */
+      (*(cogmres_functions->Axpy))(1.0,r,x);
+
+      /* restart from the actual residual */
+      (*(cogmres_functions->CopyVector))(b,p[0]);
+      (*(cogmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,p[0]);
+      t = r_norm;
+      r_norm = sqrt( (*(cogmres_functions->InnerProd))(p[0],p[0]) );
+
+      if (t <= epsilon && iter >= min_iter && !break_value)
+      {
+         if (r_norm <= epsilon)
+         {
+            (cogmres_data -> converged) = 1;
+            break;
+         }
+         /* exit if the real residual norm has not decreased */
+         if (r_norm >= real_r_norm_old)
+         {
+            (cogmres_data -> converged) = 1;
+            break;
+         }
+         if ( print_level>0 && my_id == 0)
+            hypre_printf("false convergence 2, L2 norm of residual: %e\n", r_norm);
+      }
+      real_r_norm_old = r_norm;
+   } /* END of iteration while loop */
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+   }
+
+   (cogmres_data -> num_iterations) = iter;
+   if (b_norm > 0.0)
+      (cogmres_data -> rel_residual_norm) = r_norm/b_norm;
+   if (b_norm == 0.0)
+      (cogmres_data -> rel_residual_norm) = r_norm;
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0) hypre_error(HYPRE_ERROR_CONV);
+
+   hypre_TFreeF(hh,cogmres_functions);
+   hypre_TFreeF(hr,cogmres_functions);
+   hypre_TFreeF(rs,cogmres_functions);
+   hypre_TFreeF(c,cogmres_functions);
+   hypre_TFreeF(sn,cogmres_functions);
+   hypre_TFreeF(theta,cogmres_functions);
+   hypre_TFreeF(bb,cogmres_functions);
+   hypre_TFreeF(cc,cogmres_functions);
+   hypre_TFreeF(rr,cogmres_functions);
+   hypre_TFreeF(cc2,cogmres_functions);
+   hypre_TFreeF(rr2,cogmres_functions);
+   hypre_TFreeF(gram,cogmres_functions);
+   hypre_TFreeF(rhat,cogmres_functions);
+   hypre_TFreeF(hnew,cogmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSolve
  *-------------------------------------------------------------------------*/
@@ -308,6 +999,11 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   if ((cogmres_data -> s_step) > 1 && !rel_change)
+   {
+      return hypre_COGMRESSolveSStep(cogmres_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (cogmres_data -> converged) = 0;
@@ -924,6 +1620,60 @@ hypre_COGMRESGetCGS( void   *cogmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStep, hypre_COGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStep( void   *cogmres_vdata,
+                       HYPRE_Int   s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   if (s_step < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (cogmres_data -> s_step) = s_step;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStep( void   *cogmres_vdata,
+                       HYPRE_Int * s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step = (cogmres_data -> s_step);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStepBasis, hypre_COGMRESGetSStepBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStepBasis( void   *cogmres_vdata,
+                            HYPRE_Int   s_basis )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   if (s_basis < 0 || s_basis > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (cogmres_data -> s_basis) = s_basis;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStepBasis( void   *cogmres_vdata,
+                            HYPRE_Int * s_basis )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_basis = (cogmres_data -> s_basis);
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSetTol, hypre_COGMRESGetTol
  *--------------------------------------------------------------------------*/
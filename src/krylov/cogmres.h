@@ -65,6 +65,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
+
+   /* optional single-reduction block product result[j*k+i] = <x[j],p[i]>,
+      see hypre_COGMRESFunctionsSetMassInnerProdMult */
+   HYPRE_Int    (*MassInnerProdMult) ( void **x, HYPRE_Int s, void **p, HYPRE_Int k,
+                                       HYPRE_Int unroll, void *result );
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
 
@@ -81,6 +86,8 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      s_step;   /* s-step (block) Arnoldi when s_step > 1 */
+   HYPRE_Int      s_basis;  /* 0 monomial, 1 Newton, 2 Chebyshev */
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -163,6 +170,19 @@ hypre_COGMRESFunctionsCreate(
 void *
 hypre_COGMRESCreate( hypre_COGMRESFunctions *gmres_functions );
 
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetMassInnerProdMult(
+   hypre_COGMRESFunctions *cogmres_functions,
+   HYPRE_Int    (*MassInnerProdMult) ( void **x, HYPRE_Int s, void **p, HYPRE_Int k,
+                                       HYPRE_Int unroll, void *result )
+   );
+
 #ifdef __cplusplus
 }
 #endif
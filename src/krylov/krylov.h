@@ -575,6 +575,11 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
     HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex * alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
+
+    /* optional single-reduction block product result[j*k+i] = <x[j],p[i]>,
+       see hypre_COGMRESFunctionsSetMassInnerProdMult */
+    HYPRE_Int    (*MassInnerProdMult) ( void **x, HYPRE_Int s, void **p, HYPRE_Int k,
+        HYPRE_Int unroll, void *result );
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
 
@@ -592,6 +597,8 @@ extern "C" {
     HYPRE_Int      k_dim;
     HYPRE_Int      unroll;
     HYPRE_Int      cgs;
+    HYPRE_Int      s_step;   /* s-step (block) Arnoldi when s_step > 1 */
+    HYPRE_Int      s_basis;  /* 0 monomial, 1 Newton, 2 Chebyshev */
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -674,6 +681,19 @@ extern "C" {
     void *
       hypre_COGMRESCreate( hypre_COGMRESFunctions *gmres_functions );
 
+    /**
+     * Description...
+     *
+     * @param param [IN] ...
+     **/
+
+    HYPRE_Int
+      hypre_COGMRESFunctionsSetMassInnerProdMult(
+          hypre_COGMRESFunctions *cogmres_functions,
+          HYPRE_Int    (*MassInnerProdMult) ( void **x, HYPRE_Int s, void **p, HYPRE_Int k,
+            HYPRE_Int unroll, void *result )
+          );
+
 #ifdef __cplusplus
   }
 #endif
@@ -1062,6 +1082,12 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional nonblocking reduction of n inner products <x[k],y[k]> into
+       result[k], see hypre_PCGFunctionsSetInnerProdNonblocking */
+    HYPRE_Int    (*InnerProdStart) ( HYPRE_Int n, void **x, void **y,
+        HYPRE_Real *result, void **request );
+    HYPRE_Int    (*InnerProdWait)  ( void *request );
+
     HYPRE_Int    (*precond)(void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup)(void *vdata , void *A , void *b , void *x);
 
@@ -1100,6 +1126,9 @@ extern "C" {
      every "recompute_residual_p" iterations.  This can be expensive and degrade the
      convergence. Use it only if you have seen a problem with the regular residual
      computation.
+     - variant selects the recurrences: 0 is the standard algorithm, 1 the
+     single-reduction (Chronopoulos-Gear) one and 2 the pipelined (Ghysels-Vanroose)
+     one, which overlaps the reduction with the preconditioner and the matvec.
      */
 
   typedef struct
@@ -1117,6 +1146,7 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      variant;
 
     void    *A;
     void    *p;
@@ -1124,6 +1154,15 @@ extern "C" {
     void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
 
+    /* used by variants 1 and 2: u = C*r and w = A*u; variant 2 also keeps
+       m = C*w, n = A*m, q = C*s and z = A*q */
+    void    *u;
+    void    *w;
+    void    *m;
+    void    *n;
+    void    *q;
+    void    *z;
+
     HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
     void    *matvec_data;
     void    *precond_data;
@@ -1191,6 +1230,20 @@ extern "C" {
     void *
       hypre_PCGCreate( hypre_PCGFunctions *pcg_functions );
 
+    /**
+     * Description...
+     *
+     * @param param [IN] ...
+     **/
+
+    HYPRE_Int
+      hypre_PCGFunctionsSetInnerProdNonblocking(
+          hypre_PCGFunctions *pcg_functions,
+          HYPRE_Int    (*InnerProdStart) ( HYPRE_Int n, void **x, void **y,
+            HYPRE_Real *result, void **request ),
+          HYPRE_Int    (*InnerProdWait)  ( void *request )
+          );
+
 #ifdef __cplusplus
   }
 #endif
@@ -1280,6 +1333,10 @@ extern "C" {
   HYPRE_Int hypre_COGMRESGetUnroll ( void *gmres_vdata , HYPRE_Int *unroll );
   HYPRE_Int hypre_COGMRESSetCGS ( void *gmres_vdata , HYPRE_Int cgs );
   HYPRE_Int hypre_COGMRESGetCGS ( void *gmres_vdata , HYPRE_Int *cgs );
+  HYPRE_Int hypre_COGMRESSetSStep ( void *gmres_vdata , HYPRE_Int s_step );
+  HYPRE_Int hypre_COGMRESGetSStep ( void *gmres_vdata , HYPRE_Int *s_step );
+  HYPRE_Int hypre_COGMRESSetSStepBasis ( void *gmres_vdata , HYPRE_Int s_basis );
+  HYPRE_Int hypre_COGMRESGetSStepBasis ( void *gmres_vdata , HYPRE_Int *s_basis );
   HYPRE_Int hypre_COGMRESSetTol ( void *gmres_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_COGMRESGetTol ( void *gmres_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_COGMRESSetAbsoluteTol ( void *gmres_vdata , HYPRE_Real a_tol );
@@ -1444,6 +1501,10 @@ extern "C" {
   HYPRE_Int HYPRE_COGMRESGetUnroll ( HYPRE_Solver solver , HYPRE_Int *unroll );
   HYPRE_Int HYPRE_COGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
   HYPRE_Int HYPRE_COGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
+  HYPRE_Int HYPRE_COGMRESSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
+  HYPRE_Int HYPRE_COGMRESGetSStep ( HYPRE_Solver solver , HYPRE_Int *s_step );
+  HYPRE_Int HYPRE_COGMRESSetSStepBasis ( HYPRE_Solver solver , HYPRE_Int s_basis );
+  HYPRE_Int HYPRE_COGMRESGetSStepBasis ( HYPRE_Solver solver , HYPRE_Int *s_basis );
   HYPRE_Int HYPRE_COGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
   HYPRE_Int HYPRE_COGMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
   HYPRE_Int HYPRE_COGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1549,6 +1610,8 @@ extern "C" {
   HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver , HYPRE_Int *recompute_residual );
   HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int recompute_residual_p );
   HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int HYPRE_PCGSetVariant ( HYPRE_Solver solver , HYPRE_Int variant );
+  HYPRE_Int HYPRE_PCGGetVariant ( HYPRE_Solver solver , HYPRE_Int *variant );
   HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_PCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1586,6 +1649,8 @@ extern "C" {
   HYPRE_Int hypre_PCGGetRecomputeResidual ( void *pcg_vdata , HYPRE_Int *recompute_residual );
   HYPRE_Int hypre_PCGSetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int recompute_residual_p );
   HYPRE_Int hypre_PCGGetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int hypre_PCGSetVariant ( void *pcg_vdata , HYPRE_Int variant );
+  HYPRE_Int hypre_PCGGetVariant ( void *pcg_vdata , HYPRE_Int *variant );
   HYPRE_Int hypre_PCGSetStopCrit ( void *pcg_vdata , HYPRE_Int stop_crit );
   HYPRE_Int hypre_PCGGetStopCrit ( void *pcg_vdata , HYPRE_Int *stop_crit );
   HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata , HYPRE_Solver *precond_data_ptr );
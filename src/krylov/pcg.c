@@ -65,6 +65,8 @@ hypre_PCGFunctionsCreate(
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->InnerProdStart = NULL;
+   pcg_functions->InnerProdWait = NULL;
    /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -72,6 +74,28 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetInnerProdNonblocking
+ *
+ * InnerProdStart computes the local parts of <x[k],y[k]>, k < n, and starts
+ * their reduction into result[k]; InnerProdWait(request) completes it.
+ * Without them, the variants use InnerProd for each product.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetInnerProdNonblocking(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*InnerProdStart) ( HYPRE_Int n, void **x, void **y,
+                                    HYPRE_Real *result, void **request ),
+   HYPRE_Int    (*InnerProdWait)  ( void *request )
+   )
+{
+   pcg_functions->InnerProdStart = InnerProdStart;
+   pcg_functions->InnerProdWait  = InnerProdWait;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -101,6 +125,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> variant)      = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -111,12 +136,75 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> q)            = NULL;
+   (pcg_data -> z)            = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
    return (void *) pcg_data;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGCreateVariantVectors
+ *
+ * Creates the work vectors of the variant that are still missing, so that
+ * the variant may also be changed between setup and solve.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGCreateVariantVectors( hypre_PCGData *pcg_data,
+                               void          *b,
+                               void          *x )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           variant       = (pcg_data -> variant);
+
+   if ( variant > 0 && (pcg_data -> u) == NULL )
+   {
+      (pcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> w) = (*(pcg_functions->CreateVector))(b);
+   }
+   if ( variant > 1 && (pcg_data -> m) == NULL )
+   {
+      (pcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> n) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> z) = (*(pcg_functions->CreateVector))(b);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGDestroyVariantVectors
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGDestroyVariantVectors( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void              **vecs[6];
+   HYPRE_Int           k;
+
+   vecs[0] = &(pcg_data -> u);
+   vecs[1] = &(pcg_data -> w);
+   vecs[2] = &(pcg_data -> m);
+   vecs[3] = &(pcg_data -> n);
+   vecs[4] = &(pcg_data -> q);
+   vecs[5] = &(pcg_data -> z);
+
+   for (k = 0; k < 6; k++)
+   {
+      if ( *vecs[k] != NULL )
+      {
+         (*(pcg_functions->DestroyVector))(*vecs[k]);
+         *vecs[k] = NULL;
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGDestroy
  *--------------------------------------------------------------------------*/
@@ -161,6 +249,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGDestroyVariantVectors(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -221,6 +310,9 @@ hypre_PCGSetup( void *pcg_vdata,
       (*(pcg_functions->DestroyVector))(pcg_data -> r);
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   hypre_PCGDestroyVariantVectors(pcg_data);
+   hypre_PCGCreateVariantVectors(pcg_data, b, x);
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
    (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
@@ -249,6 +341,472 @@ hypre_PCGSetup( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGInnerProdStart, hypre_PCGInnerProdWait
+ *
+ * Use the nonblocking reduction when the interface provides it, and
+ * InnerProd otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGInnerProdStart( hypre_PCGFunctions *pcg_functions,
+                         HYPRE_Int           n,
+                         void              **x,
+                         void              **y,
+                         HYPRE_Real         *result,
+                         void              **request )
+{
+   HYPRE_Int k;
+
+   if (pcg_functions -> InnerProdStart)
+   {
+      return (*(pcg_functions->InnerProdStart))(n, x, y, result, request);
+   }
+
+   for (k = 0; k < n; k++)
+   {
+      result[k] = (*(pcg_functions->InnerProd))(x[k], y[k]);
+   }
+   *request = NULL;
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+hypre_PCGInnerProdWait( hypre_PCGFunctions *pcg_functions,
+                        void               *request )
+{
+   if (request)
+   {
+      (*(pcg_functions->InnerProdWait))(request);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolveSingleReduction
+ *
+ * PCG with one global reduction per iteration (variant 1, Chronopoulos and
+ * Gear), optionally pipelined (variant 2, Ghysels and Vanroose) so that the
+ * reduction overlaps the next preconditioner application and matvec:
+ *
+ *   gamma = <r,u>, delta = <w,u>        (one reduction, started)
+ *   m = C*w, n = A*m                    (variant 2 only, overlapped)
+ *   beta  = gamma/gamma_old
+ *   alpha = gamma/(delta - beta*gamma/alpha_old)
+ *   p = u + beta*p, s = w + beta*s      (s = A*p)
+ *   q = m + beta*q, z = n + beta*z      (variant 2: q = C*s, z = A*q)
+ *   x = x + alpha*p, r = r - alpha*s
+ *   u = u - alpha*q, w = w - alpha*z    (variant 2)
+ *   u = C*r, w = A*u                    (variant 1)
+ *
+ * The norm for the stopping test, and <s,s> when needed, are added to the
+ * same reduction.  Called by hypre_PCGSolve once bi_prod and eps are known.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGSolveSingleReduction( hypre_PCGData *pcg_data,
+                               void          *A,
+                               void          *b,
+                               void          *x,
+                               HYPRE_Real     bi_prod,
+                               HYPRE_Real     eps,
+                               HYPRE_Int      my_id )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      cf_tol       = (pcg_data -> cf_tol);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Real      rtol         = (pcg_data -> rtol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       rel_change   = (pcg_data -> rel_change);
+   HYPRE_Int       recompute_residual   = (pcg_data -> recompute_residual);
+   HYPRE_Int       recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   HYPRE_Int       pipelined    = (pcg_data -> variant) > 1;
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *u            = (pcg_data -> u);
+   void           *w            = (pcg_data -> w);
+   void           *m            = (pcg_data -> m);
+   void           *n            = (pcg_data -> n);
+   void           *q            = (pcg_data -> q);
+   void           *z            = (pcg_data -> z);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void           *ip_x[4], *ip_y[4];
+   HYPRE_Real      ip[4];
+   HYPRE_Int       num_ip, ip_rr = -1, ip_ss = -1;
+   void           *request;
+
+   HYPRE_Real      alpha = 0.0, beta, denom;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta;
+   HYPRE_Real      pi_prod, xi_prod, ratio;
+   HYPRE_Real      ieee_check = 0.;
+
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      i_prod_0 = 0.0;
+   HYPRE_Real      cf_ave_0 = 0.0;
+   HYPRE_Real      cf_ave_1 = 0.0;
+   HYPRE_Real      weight;
+
+   HYPRE_Real      guard_zero_residual = 0.0;
+   HYPRE_Int       tentatively_converged;
+   HYPRE_Int       recompute_true_residual;
+
+   HYPRE_Int       i = 0;
+
+   /* r = b - Ax, u = C*r, w = A*u */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   while (1)
+   {
+      /* gamma = <r,u>, delta = <w,u>, and <r,r>, <s,s> if needed */
+      ip_x[0] = r; ip_y[0] = u;
+      ip_x[1] = w; ip_y[1] = u;
+      num_ip = 2;
+      if (two_norm)
+      {
+         ip_rr = num_ip;
+         ip_x[num_ip] = r; ip_y[num_ip] = r;
+         num_ip++;
+      }
+      if (rtol && two_norm && i > 0)
+      {
+         ip_ss = num_ip;
+         ip_x[num_ip] = s; ip_y[num_ip] = s;
+         num_ip++;
+      }
+      hypre_PCGInnerProdStart(pcg_functions, num_ip, ip_x, ip_y, ip, &request);
+
+      if (pipelined)
+      {
+         /* m = C*w, n = A*m */
+         (*(pcg_functions->ClearVector))(m);
+         precond(precond_data, A, w, m);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+      }
+
+      hypre_PCGInnerProdWait(pcg_functions, request);
+
+      gamma  = ip[0];
+      delta  = ip[1];
+      i_prod = two_norm ? ip[ip_rr] : gamma;
+
+      if (i == 0)
+      {
+         /* Since it is does not diminish performance, attempt to return an error flag
+            and notify users when they supply bad input. */
+         if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+              hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+              hypre_printf("ERROR -- hypre_PCGSolve: INFs and/or NaNs detected in input.\n");
+              hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+              hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+              hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+
+            return hypre_error_flag;
+         }
+
+         /* Set initial residual norm */
+         i_prod_0 = i_prod;
+         if ( logging>0 || print_level>0 ) norms[0] = sqrt(i_prod_0);
+
+         if ( print_level > 1 && my_id==0 )
+         {
+            hypre_printf("\n\n");
+            if (two_norm)
+            {
+               if ( stop_crit && !rel_change && atolf==0 )  /* pure absolute tolerance */
+               {
+                  hypre_printf("Iters       ||r||_2     conv.rate\n");
+                  hypre_printf("-----    ------------   ---------\n");
+               }
+               else
+               {
+                  hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+                  hypre_printf("-----    ------------   ---------  ------------ \n");
+               }
+            }
+            else  /* !two_norm */
+            {
+               hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+               hypre_printf("-----    ------------    ---------  ------------ \n");
+            }
+         }
+      }
+      else
+      {
+         /* residual-based stopping criteria: ||r_new-r_old|| < rtol ||b|| */
+         if (rtol && two_norm)
+         {
+            /* use that r_new-r_old = alpha * s */
+            HYPRE_Real drob2 = alpha*alpha*ip[ip_ss]/bi_prod;
+            if ( drob2 < rtol*rtol )
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("\n\n||r_old-r_new||/||b||: %e\n", sqrt(drob2));
+               }
+               break;
+            }
+         }
+         else if (rtol)
+         {
+            /* use that ||r_new-r_old||_C^2 = (r_new ,C r_new) + (r_old, C r_old) */
+            HYPRE_Real r2ob2 = (gamma + gamma_old)/bi_prod;
+            if ( r2ob2 < rtol*rtol)
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("\n\n||r_old-r_new||_C/||b||_C: %e\n", sqrt(r2ob2));
+               }
+               break;
+            }
+         }
+
+         /* print norm info */
+         if ( logging>0 || print_level>0 )
+         {
+            norms[i]     = sqrt(i_prod);
+            rel_norms[i] = bi_prod ? sqrt(i_prod/bi_prod) : 0;
+         }
+         if ( print_level > 1 && my_id==0 )
+         {
+            if (two_norm && stop_crit && !rel_change && atolf==0)
+            {
+               hypre_printf("% 5d    %e    %f\n", i, norms[i],
+                            norms[i]/norms[i-1] );
+            }
+            else
+            {
+               hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                            norms[i]/norms[i-1], rel_norms[i] );
+            }
+         }
+
+         /*--------------------------------------------------------------------
+          * check for convergence, as in hypre_PCGSolve
+          *--------------------------------------------------------------------*/
+         tentatively_converged = (i_prod / bi_prod < eps);
+         if ( tentatively_converged && recompute_residual )
+         {
+            /* r = b - Ax, and the vectors that depend on it */
+            (*(pcg_functions->CopyVector))(b, r);
+            (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+            (*(pcg_functions->ClearVector))(u);
+            precond(precond_data, A, r, u);
+            (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+            ip_x[0] = r; ip_y[0] = u;
+            ip_x[1] = w; ip_y[1] = u;
+            ip_x[2] = r; ip_y[2] = r;
+            hypre_PCGInnerProdStart(pcg_functions, 3, ip_x, ip_y, ip, &request);
+            hypre_PCGInnerProdWait(pcg_functions, request);
+            gamma  = ip[0];
+            delta  = ip[1];
+            i_prod = two_norm ? ip[2] : gamma;
+
+            if (i_prod / bi_prod >= eps)
+            {
+               tentatively_converged = 0;
+               if (pipelined)
+               {
+                  (*(pcg_functions->ClearVector))(m);
+                  precond(precond_data, A, w, m);
+                  (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+               }
+            }
+         }
+         if ( tentatively_converged && rel_change && (i_prod > guard_zero_residual ))
+         {
+            ip_x[0] = p; ip_y[0] = p;
+            ip_x[1] = x; ip_y[1] = x;
+            hypre_PCGInnerProdStart(pcg_functions, 2, ip_x, ip_y, ip, &request);
+            hypre_PCGInnerProdWait(pcg_functions, request);
+            pi_prod = ip[0];
+            xi_prod = ip[1];
+            ratio = alpha*alpha*pi_prod/xi_prod;
+            if (ratio >= eps) tentatively_converged = 0;
+         }
+         if ( tentatively_converged )
+         {
+            (pcg_data -> converged) = 1;
+            break;
+         }
+
+         if (! (gamma > HYPRE_REAL_MIN) )
+         {
+            hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+
+            break;
+         }
+
+         if (cf_tol > 0.0)
+         {
+            cf_ave_0 = cf_ave_1;
+            if (! (i_prod_0 > HYPRE_REAL_MIN) )
+            {
+               hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal i_prod value in PCG");
+
+               break;
+            }
+            cf_ave_1 = pow( i_prod / i_prod_0, 1.0/(2.0*i) );
+
+            weight   = fabs(cf_ave_1 - cf_ave_0);
+            weight   = weight / hypre_max(cf_ave_1, cf_ave_0);
+            weight   = 1.0 - weight;
+            if (weight * cf_ave_1 > cf_tol) break;
+         }
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      /*--------------------------------------------------------------------
+       * the core CG calculations
+       *--------------------------------------------------------------------*/
+
+      if (i == 0)
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha;
+      }
+      if ( denom == 0.0 )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp value in PCG");
+         break;
+      }
+      alpha = gamma / denom;
+      if (! (alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal alpha value in PCG");
+         break;
+      }
+      gamma_old = gamma;
+
+      i++;
+
+      /* At user request, periodically recompute the residual from the formula
+         r = b - A x (instead of using the recursive definition). */
+      recompute_true_residual = recompute_residual_p && !(i%recompute_residual_p);
+
+      /* p = u + beta*p, s = w + beta*s */
+      if (i == 1)
+      {
+         (*(pcg_functions->CopyVector))(u, p);
+         (*(pcg_functions->CopyVector))(w, s);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+      }
+
+      /* q = m + beta*q, z = n + beta*z */
+      if (pipelined && i == 1)
+      {
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(n, z);
+      }
+      else if (pipelined)
+      {
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+      }
+
+      /* x = x + alpha*p */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+
+      if ( !recompute_true_residual )
+      {
+         /* r = r - alpha*s */
+         (*(pcg_functions->Axpy))(-alpha, s, r);
+
+         if (pipelined)
+         {
+            /* u = u - alpha*q, w = w - alpha*z */
+            (*(pcg_functions->Axpy))(-alpha, q, u);
+            (*(pcg_functions->Axpy))(-alpha, z, w);
+         }
+         else
+         {
+            /* u = C*r, w = A*u */
+            (*(pcg_functions->ClearVector))(u);
+            precond(precond_data, A, r, u);
+            (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+         }
+      }
+      else
+      {
+         /* replace every recursively updated vector by its definition */
+         if (print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Recomputing the residual...\n");
+         }
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
+         if (pipelined)
+         {
+            (*(pcg_functions->ClearVector))(q);
+            precond(precond_data, A, s, q);
+            (*(pcg_functions->Matvec))(matvec_data, 1.0, A, q, 0.0, z);
+         }
+      }
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   if (i >= max_iter && (i_prod/bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSolve
  *--------------------------------------------------------------------------
@@ -424,6 +982,15 @@ hypre_PCGSolve( void *pcg_vdata,
          action to force iterations even though the exact value was known. */
    };
 
+   if ( (pcg_data -> variant) > 0 )
+   {
+      hypre_PCGCreateVariantVectors(pcg_data, b, x);
+      hypre_PCGSolveSingleReduction(pcg_data, A, b, x, bi_prod, eps, my_id);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
    /* r = b - Ax */
    (*(pcg_functions->CopyVector))(b, r);
 
@@ -1028,6 +1595,38 @@ hypre_PCGGetRecomputeResidualP( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetVariant, hypre_PCGGetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetVariant( void *pcg_vdata,
+                     HYPRE_Int   variant  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   if (variant < 0 || variant > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (pcg_data -> variant) = variant;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetVariant( void *pcg_vdata,
+                     HYPRE_Int * variant  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *variant = (pcg_data -> variant);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetStopCrit, hypre_PCGGetStopCrit
  *--------------------------------------------------------------------------*/
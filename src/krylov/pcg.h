@@ -64,6 +64,12 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional nonblocking reduction of n inner products <x[k],y[k]> into
+      result[k], see hypre_PCGFunctionsSetInnerProdNonblocking */
+   HYPRE_Int    (*InnerProdStart) ( HYPRE_Int n, void **x, void **y,
+                                    HYPRE_Real *result, void **request );
+   HYPRE_Int    (*InnerProdWait)  ( void *request );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -102,6 +108,9 @@ typedef struct
  every "recompute_residual_p" iterations.  This can be expensive and degrade the
  convergence. Use it only if you have seen a problem with the regular residual
  computation.
+ - variant selects the recurrences: 0 is the standard algorithm, 1 the
+ single-reduction (Chronopoulos-Gear) one and 2 the pipelined (Ghysels-Vanroose)
+ one, which overlaps the reduction with the preconditioner and the matvec.
 */
 
 typedef struct
@@ -119,6 +128,7 @@ typedef struct
    HYPRE_Int    stop_crit;
    HYPRE_Int    converged;
    HYPRE_Int    hybrid;
+   HYPRE_Int    variant;
 
    void    *A;
    void    *p;
@@ -126,6 +136,15 @@ typedef struct
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
 
+   /* used by variants 1 and 2: u = C*r and w = A*u; variant 2 also keeps
+      m = C*w, n = A*m, q = C*s and z = A*q */
+   void    *u;
+   void    *w;
+   void    *m;
+   void    *n;
+   void    *q;
+   void    *z;
+
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
    void      *precond_data;
@@ -192,6 +211,20 @@ hypre_PCGFunctionsCreate(
 void *
 hypre_PCGCreate( hypre_PCGFunctions *pcg_functions );
 
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+HYPRE_Int
+hypre_PCGFunctionsSetInnerProdNonblocking(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*InnerProdStart) ( HYPRE_Int n, void **x, void **y,
+                                    HYPRE_Real *result, void **request ),
+   HYPRE_Int    (*InnerProdWait)  ( void *request )
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -1917,6 +1917,39 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetReuseSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetReuseSetup (HYPRE_Solver solver,
+                              HYPRE_Int    reuse_setup)
+{
+   return (hypre_BoomerAMGSetReuseSetup ( (void *) solver, reuse_setup ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecision (HYPRE_Solver solver,
+                                  HYPRE_Int    mixed_precision)
+{
+   return (hypre_BoomerAMGSetMixedPrecision ( (void *) solver, mixed_precision ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAsyncRelaxTime
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAsyncRelaxTime (HYPRE_Solver solver,
+                                  HYPRE_Real   async_relax_time)
+{
+   return (hypre_BoomerAMGSetAsyncRelaxTime ( (void *) solver, async_relax_time ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -0,0 +1,161 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESCreate( MPI_Comm      comm,
+                              HYPRE_Solver *solver )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   *solver = ( (HYPRE_Solver) hypre_ParCSRBlockGMRESCreate( comm ) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESDestroy( HYPRE_Solver solver )
+{
+   return( hypre_ParCSRBlockGMRESDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESSetup( HYPRE_Solver       solver,
+                             HYPRE_ParCSRMatrix A,
+                             HYPRE_ParVector    b,
+                             HYPRE_ParVector    x )
+{
+   return( hypre_ParCSRBlockGMRESSetup( (void *) solver,
+                                        (hypre_ParCSRMatrix *) A,
+                                        (hypre_ParVector *) b,
+                                        (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESSolve( HYPRE_Solver       solver,
+                             HYPRE_ParCSRMatrix A,
+                             HYPRE_ParVector    b,
+                             HYPRE_ParVector    x )
+{
+   return( hypre_ParCSRBlockGMRESSolve( (void *) solver,
+                                        (hypre_ParCSRMatrix *) A,
+                                        (hypre_ParVector *) b,
+                                        (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESSetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESSetKDim( HYPRE_Solver solver,
+                               HYPRE_Int    k_dim )
+{
+   return( hypre_ParCSRBlockGMRESSetKDim( (void *) solver, k_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESSetTol( HYPRE_Solver solver,
+                              HYPRE_Real   tol )
+{
+   return( hypre_ParCSRBlockGMRESSetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESSetMaxIter( HYPRE_Solver solver,
+                                  HYPRE_Int    max_iter )
+{
+   return( hypre_ParCSRBlockGMRESSetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESSetPrecond( HYPRE_Solver            solver,
+                                  HYPRE_PtrToParSolverFcn precond,
+                                  HYPRE_PtrToParSolverFcn precond_setup,
+                                  HYPRE_Solver            precond_solver )
+{
+   return( hypre_ParCSRBlockGMRESSetPrecond( (void *) solver,
+                                             (HYPRE_Int(*)(void*, void*, void*, void*)) precond,
+                                             (HYPRE_Int(*)(void*, void*, void*, void*)) precond_setup,
+                                             (void *) precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESSetPrintLevel( HYPRE_Solver solver,
+                                     HYPRE_Int    print_level )
+{
+   return( hypre_ParCSRBlockGMRESSetPrintLevel( (void *) solver, print_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESSetLogging( HYPRE_Solver solver,
+                                  HYPRE_Int    logging )
+{
+   return( hypre_ParCSRBlockGMRESSetLogging( (void *) solver, logging ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESGetNumIterations( HYPRE_Solver  solver,
+                                        HYPRE_Int    *num_iterations )
+{
+   return( hypre_ParCSRBlockGMRESGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockGMRESGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                                    HYPRE_Real   *norm )
+{
+   return( hypre_ParCSRBlockGMRESGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
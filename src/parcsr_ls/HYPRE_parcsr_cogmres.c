@@ -34,6 +34,8 @@ HYPRE_ParCSRCOGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,hypre_ParKrylovMassAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_COGMRESFunctionsSetMassInnerProdMult( cogmres_functions,
+                                               hypre_ParKrylovMassInnerProdMult );
    *solver = ( (HYPRE_Solver) hypre_COGMRESCreate( cogmres_functions ) );
 
    return hypre_error_flag;
@@ -114,6 +116,28 @@ HYPRE_ParCSRCOGMRESSetCGS( HYPRE_Solver solver,
    return( HYPRE_COGMRESSetCGS( solver, cgs ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCOGMRESSetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCOGMRESSetSStep( HYPRE_Solver solver,
+                             HYPRE_Int    s_step )
+{
+   return( HYPRE_COGMRESSetSStep( solver, s_step ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCOGMRESSetSStepBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCOGMRESSetSStepBasis( HYPRE_Solver solver,
+                                  HYPRE_Int    s_basis )
+{
+   return( HYPRE_COGMRESSetSStepBasis( solver, s_basis ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRCOGMRESSetTol
  *--------------------------------------------------------------------------*/
@@ -737,6 +737,13 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 16 : Chebyshev
  *    - 17 : FCF-Jacobi
  *    - 18 : \f$\ell_1\f$-scaled jacobi
+ *    - 30 : asynchronous \f$\ell_1\f$ hybrid Gauss-Seidel (see
+ *           HYPRE_BoomerAMGSetAsyncRelaxTime)
+ *    - 31 : multicolor Gauss-Seidel, with a coloring of the local rows
+ *           computed in the setup. The colors are relaxed in reverse order
+ *           on the up cycle, so that the V-cycle is symmetric (e.g., for
+ *           PCG). The results do not depend on the number of threads.
+ *    - 32 : multicolor symmetric Gauss-Seidel
  **/
 HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
                                       HYPRE_Int     relax_type);
@@ -1203,6 +1210,86 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                       HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) Defines what a repeated call to HYPRE_BoomerAMGSetup does
+ * with the hierarchy of the previous setup. There are the following
+ * options for \e reuse_setup:
+ *
+ *    - 0 : rebuild the whole hierarchy
+ *    - 1 : keep the C/F splittings and the interpolation (and restriction)
+ *          operators, and only recompute the coarse-grid operators and
+ *          the smoothers
+ *
+ * The default is 0.
+ *
+ * Option 1 is meant for sequences of matrices with the same row
+ * distribution whose values change slowly, e.g., in time stepping.
+ * The interpolation weights are not recomputed from the new A: P and R
+ * stay those of the last full setup, and only the coarse-grid operators
+ * are rebuilt from them.  As A drifts away from that matrix, the
+ * stale interpolation can increase the number of iterations; a setup
+ * with option 0 then refreshes the whole hierarchy.
+ * Coarse-grid operators whose sparsity pattern is unchanged are
+ * updated in place and keep their communication packages. If the
+ * row distribution of A differs from the previous setup, or the
+ * previous setup used block, additive or non-Galerkin options, a full
+ * setup is done.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetReuseSetup(HYPRE_Solver solver,
+                                       HYPRE_Int    reuse_setup);
+
+/**
+ * (Optional) Stores parts of the AMG hierarchy in single precision, which
+ * reduces the memory traffic of the cycle. The outer iteration (and any
+ * Krylov method that uses AMG as preconditioner) stays in double precision.
+ * There are the following options for \e mixed_precision:
+ *
+ *    - 0 : store the whole hierarchy in double precision
+ *    - 1 : store the interpolation and restriction operators and the
+ *          coarse-grid operators in single precision
+ *    - 2 : as 1, and use single precision values of the fine-grid matrix
+ *          inside the cycle (the user's matrix is not changed; the float
+ *          values add 4 bytes per nonzero);
+ *          when BoomerAMG is the solver, the cycles after the first one
+ *          are applied to the double precision residual
+ *
+ * The default is 0.
+ *
+ * A grid operator is only stored in single precision if all smoothers
+ * used on its level access it through matrix-vector products, i.e.,
+ * relaxation types 7, 16 and 18 (the latter without C/F ordering and
+ * without user-defined relaxation points), and 9, 99 and 199 on the
+ * coarsest level. Vectors, l1 norms and Chebyshev scalings stay in double
+ * precision, and the products accumulate in double precision. The option
+ * is ignored with block, additive or complex smoothers, and in complex or
+ * GPU builds. The double precision values of the converted operators are
+ * freed. HYPRE_BoomerAMGSolveT and a new setup widen the single precision
+ * values back to double precision first, i.e., they see the rounded
+ * operators.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision(HYPRE_Solver solver,
+                                           HYPRE_Int    mixed_precision);
+
+/**
+ * (Optional) Sets the time budget, in seconds, of the asynchronous
+ * relaxation (relaxation type 30). On each level, every thread sweeps its
+ * block of rows with the values of the other threads that are current at the
+ * time, and the values of the neighbor processors are refreshed with
+ * nonblocking exchanges between the sweeps, so that there is no barrier
+ * between the sweeps of a smoothing step. The number of sweeps of a smoothing
+ * step is set with HYPRE_BoomerAMGSetNumSweeps (or
+ * HYPRE_BoomerAMGSetCycleNumSweeps); a thread stops earlier if its sweeps take
+ * more than \e async_relax_time seconds. The default is 0, i.e., no time
+ * budget.
+ *
+ * The order in which the points are updated, and hence the iteration counts,
+ * vary from run to run. MPI must provide at least MPI_THREAD_FUNNELED.
+ * Relaxation type 30 is not available when hypre is built with complex
+ * values, the solve returns an error.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetAsyncRelaxTime(HYPRE_Solver solver,
+                                           HYPRE_Real   async_relax_time);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2609,6 +2696,12 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS(HYPRE_Solver solver,
                                    HYPRE_Int    cgs);
 
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep(HYPRE_Solver solver,
+                                      HYPRE_Int    s_step);
+
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStepBasis(HYPRE_Solver solver,
+                                           HYPRE_Int    s_basis);
+
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol(HYPRE_Solver solver,
                                   HYPRE_Real   tol);
 
@@ -2887,6 +2980,159 @@ HYPRE_Int HYPRE_ParCSRBiCGSTABGetResidual(HYPRE_Solver     solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR Block PCG Solver
+ *
+ * Solves \f$AX = B\f$ for several right-hand sides at once.  The vectors
+ * \f$B\f$ and \f$X\f$ are multivectors with the same storage layout, and
+ * each column runs its own conjugate gradient recurrence.  The columns share one matrix-multivector product, one
+ * preconditioner application, and fused global reductions per iteration.
+ * Columns that have converged are left unchanged.  The preconditioner must
+ * accept multivectors, e.g., BoomerAMG.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGCreate(MPI_Comm      comm,
+                                     HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRBlockPCGSetup(HYPRE_Solver       solver,
+                                    HYPRE_ParCSRMatrix A,
+                                    HYPRE_ParVector    b,
+                                    HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRBlockPCGSolve(HYPRE_Solver       solver,
+                                    HYPRE_ParCSRMatrix A,
+                                    HYPRE_ParVector    b,
+                                    HYPRE_ParVector    x);
+
+/**
+ * (Optional) Set the relative convergence tolerance, applied to every
+ * column.  The default is 1.e-6.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetTol(HYPRE_Solver solver,
+                                     HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the maximum number of iterations.  The default is 1000.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetMaxIter(HYPRE_Solver solver,
+                                         HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrecond(HYPRE_Solver            solver,
+                                         HYPRE_PtrToParSolverFcn precond,
+                                         HYPRE_PtrToParSolverFcn precond_setup,
+                                         HYPRE_Solver            precond_solver);
+
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrintLevel(HYPRE_Solver solver,
+                                            HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRBlockPCGSetLogging(HYPRE_Solver solver,
+                                         HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRBlockPCGGetNumIterations(HYPRE_Solver  solver,
+                                               HYPRE_Int    *num_iterations);
+
+/**
+ * Return the largest final relative residual norm over all columns.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                           HYPRE_Real   *norm);
+
+/**@}*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR Block GMRES Solver
+ *
+ * Solves \f$AX = B\f$ for several right-hand sides at once with restarted,
+ * right-preconditioned GMRES.  As for block PCG, \f$B\f$ and \f$X\f$ are
+ * multivectors with the same storage layout and each column builds its own
+ * Krylov basis, while the columns share one matrix-multivector product, one
+ * preconditioner application and two fused global reductions per iteration.
+ * A column whose residual estimate drops below the tolerance stops
+ * extending its basis until the next restart.  The preconditioner must
+ * accept multivectors, e.g., BoomerAMG.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockGMRESCreate(MPI_Comm      comm,
+                                       HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockGMRESDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetup(HYPRE_Solver       solver,
+                                      HYPRE_ParCSRMatrix A,
+                                      HYPRE_ParVector    b,
+                                      HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRBlockGMRESSolve(HYPRE_Solver       solver,
+                                      HYPRE_ParCSRMatrix A,
+                                      HYPRE_ParVector    b,
+                                      HYPRE_ParVector    x);
+
+/**
+ * (Optional) Set the maximum size of the Krylov space before a restart.
+ * The default is 5.  Call it before the setup.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetKDim(HYPRE_Solver solver,
+                                        HYPRE_Int    k_dim);
+
+/**
+ * (Optional) Set the relative convergence tolerance, applied to every
+ * column.  The default is 1.e-6.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetTol(HYPRE_Solver solver,
+                                       HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the maximum number of iterations.  The default is 1000.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetMaxIter(HYPRE_Solver solver,
+                                           HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetPrecond(HYPRE_Solver            solver,
+                                           HYPRE_PtrToParSolverFcn precond,
+                                           HYPRE_PtrToParSolverFcn precond_setup,
+                                           HYPRE_Solver            precond_solver);
+
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetPrintLevel(HYPRE_Solver solver,
+                                              HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetLogging(HYPRE_Solver solver,
+                                           HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRBlockGMRESGetNumIterations(HYPRE_Solver  solver,
+                                                 HYPRE_Int    *num_iterations);
+
+/**
+ * Return the largest final relative residual norm over all columns.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockGMRESGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                             HYPRE_Real   *norm);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -461,6 +461,16 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataKeepTranspose(amg_data)     = 0;
    hypre_ParAMGDataModularizedMatMat(amg_data) = 0;
 #endif
+   hypre_ParAMGDataReuseSetup(amg_data)        = 0;
+   hypre_ParAMGDataRAPPlans(amg_data)          = NULL;
+   hypre_ParAMGDataMixedPrecision(amg_data)    = 0;
+   hypre_ParAMGDataAFineSingle(amg_data)       = 0;
+   hypre_ParAMGDataAFineSingleData(amg_data)[0] = NULL;
+   hypre_ParAMGDataAFineSingleData(amg_data)[1] = NULL;
+   hypre_ParAMGDataAsyncRelaxTime(amg_data)    = 0.0;
+   hypre_ParAMGDataNumColors(amg_data)         = NULL;
+   hypre_ParAMGDataColorStarts(amg_data)       = NULL;
+   hypre_ParAMGDataColorPerm(amg_data)         = NULL;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -567,6 +577,13 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataGridRelaxPoints(amg_data), HYPRE_MEMORY_HOST);
       hypre_ParAMGDataGridRelaxPoints(amg_data) = NULL;
    }
+   if (hypre_ParAMGDataRAPPlans(amg_data))
+   {
+      for (i=0; i < num_levels-1; i++)
+         hypre_ParCSRRAPPlanDestroy(hypre_ParAMGDataRAPPlans(amg_data)[i]);
+      hypre_TFree(hypre_ParAMGDataRAPPlans(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlans(amg_data) = NULL;
+   }
    for (i=1; i < num_levels; i++)
    {
       hypre_ParVectorDestroy(hypre_ParAMGDataFArray(amg_data)[i]);
@@ -632,6 +649,7 @@ hypre_BoomerAMGDestroy( void *data )
       }
       hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
    }
+   hypre_BoomerAMGMulticolorDestroy(amg_data, num_levels);
 
    if (hypre_ParAMGDataChebyCoefs(amg_data))
    {
@@ -664,6 +682,9 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataCFMarkerArray(amg_data)[0], HYPRE_MEMORY_HOST);
    }
    hypre_ParVectorDestroy(hypre_ParAMGDataVtemp(amg_data));
+   hypre_BoomerAMGMultiVectorDataDestroy(amg_data);
+   hypre_TFree(hypre_ParAMGDataAFineSingleData(amg_data)[0], HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataAFineSingleData(amg_data)[1], HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataFArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataUArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataAArray(amg_data), HYPRE_MEMORY_HOST);
@@ -4569,6 +4590,69 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
   return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetReuseSetup( void       *data,
+                              HYPRE_Int   reuse_setup)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+  if (reuse_setup < 0 || reuse_setup > 1)
+  {
+     hypre_error_in_arg(2);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataReuseSetup(amg_data) = reuse_setup;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecision( void       *data,
+                                  HYPRE_Int   mixed_precision)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+  if (mixed_precision < 0 || mixed_precision > 2)
+  {
+     hypre_error_in_arg(2);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataMixedPrecision(amg_data) = mixed_precision;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetAsyncRelaxTime( void       *data,
+                                  HYPRE_Real  async_relax_time)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+  if (async_relax_time < 0.0)
+  {
+     hypre_error_in_arg(2);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataAsyncRelaxTime(amg_data) = async_relax_time;
+  return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
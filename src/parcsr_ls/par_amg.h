@@ -168,6 +168,15 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* multivector solve: per-level work vectors for mv_num_vectors vectors
+    * and the single-column vectors used by the column-wise paths */
+   HYPRE_Int          mv_num_vectors;
+   hypre_ParVector  **F_mv_array;
+   hypre_ParVector  **U_mv_array;
+   hypre_ParVector  **Vtemp_mv_array;
+   hypre_ParVector   *f_column;
+   hypre_ParVector   *u_column;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -240,6 +249,24 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* keep the splittings and interpolation of the previous setup */
+   HYPRE_Int reuse_setup;
+   hypre_ParCSRRAPPlan **rap_plans;
+
+   /* store the hierarchy in single precision; with A_fine_single set, the
+      cycle attaches float diag and offd values to the fine grid matrix */
+   HYPRE_Int mixed_precision;
+   HYPRE_Int A_fine_single;
+   float *A_fine_single_data[2];
+
+   /* time budget of the asynchronous relaxation (relax type 30) */
+   HYPRE_Real async_relax_time;
+
+   /* coloring of the diag blocks for multicolor relaxation (31, 32) */
+   HYPRE_Int  *num_colors;
+   HYPRE_Int **color_starts;
+   HYPRE_Int **color_perm;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -411,6 +438,14 @@ typedef struct
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
 
+/* multivector solve */
+#define hypre_ParAMGDataMVNumVectors(amg_data) ((amg_data)->mv_num_vectors)
+#define hypre_ParAMGDataFMVArray(amg_data) ((amg_data)->F_mv_array)
+#define hypre_ParAMGDataUMVArray(amg_data) ((amg_data)->U_mv_array)
+#define hypre_ParAMGDataVtempMVArray(amg_data) ((amg_data)->Vtemp_mv_array)
+#define hypre_ParAMGDataFColumn(amg_data) ((amg_data)->f_column)
+#define hypre_ParAMGDataUColumn(amg_data) ((amg_data)->u_column)
+
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
 #define hypre_ParAMGDataNumSamples(amg_data) ((amg_data)->num_samples)
@@ -488,6 +523,15 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataReuseSetup(amg_data) ((amg_data)->reuse_setup)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataAFineSingle(amg_data) ((amg_data)->A_fine_single)
+#define hypre_ParAMGDataAFineSingleData(amg_data) ((amg_data)->A_fine_single_data)
+#define hypre_ParAMGDataAsyncRelaxTime(amg_data) ((amg_data)->async_relax_time)
+#define hypre_ParAMGDataNumColors(amg_data) ((amg_data)->num_colors)
+#define hypre_ParAMGDataColorStarts(amg_data) ((amg_data)->color_starts)
+#define hypre_ParAMGDataColorPerm(amg_data) ((amg_data)->color_perm)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
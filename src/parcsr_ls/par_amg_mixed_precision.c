@@ -0,0 +1,263 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single precision storage of the AMG hierarchy
+ *
+ * The values of P, R and of the coarse grid operators are converted to float
+ * at the end of the setup (see hypre_CSRMatrixConvertToSingle), which frees
+ * their double precision values.  Only operators that the cycle accesses
+ * through matvecs are converted; the cycle itself, the vectors and the
+ * smoother data (l1 norms, Chebyshev scalings, dense coarse matrices) stay in
+ * HYPRE_Real.  The transpose solve and a new setup widen the values back
+ * first.
+ *
+ * The fine grid matrix belongs to the user and keeps its values.  With mixed
+ * precision 2, float copies of its diag and offd values are kept here and
+ * attached to it for the duration of each cycle.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionRelaxSupported
+ *
+ * Returns 1 if relaxation with relax_type on a level accesses the grid
+ * operator through matvecs only
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMixedPrecisionRelaxSupported( hypre_ParAMGData *amg_data,
+                                             HYPRE_Int         relax_type,
+                                             HYPRE_Int         coarsest )
+{
+   switch (relax_type)
+   {
+      case 7:  /* Jacobi (uses ParMatvec) */
+      case 16: /* Chebyshev */
+         return 1;
+
+      case 18: /* l1 Jacobi, which uses ParMatvec without C/F relaxation */
+         return (hypre_ParAMGDataRelaxOrder(amg_data) == 0 &&
+                 hypre_ParAMGDataGridRelaxPoints(amg_data) == NULL);
+
+      case 9: case 99: case 199: /* dense solve with the matrix of the setup */
+         return (coarsest && hypre_ParAMGDataGSSetup(amg_data));
+
+      default:
+         return 0;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionLevelSupported
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMixedPrecisionLevelSupported( hypre_ParAMGData *amg_data,
+                                             HYPRE_Int         level )
+{
+   HYPRE_Int  num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+
+   if (level == num_levels - 1)
+   {
+      return hypre_BoomerAMGMixedPrecisionRelaxSupported(amg_data, grid_relax_type[3], 1);
+   }
+
+   return (hypre_BoomerAMGMixedPrecisionRelaxSupported(amg_data, grid_relax_type[1], 0) &&
+           hypre_BoomerAMGMixedPrecisionRelaxSupported(amg_data, grid_relax_type[2], 0));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionSetup
+ *
+ * Called at the end of hypre_BoomerAMGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMixedPrecisionSetup( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            mixed_precision = hypre_ParAMGDataMixedPrecision(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array         = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int            restri_type     = hypre_ParAMGDataRestriction(amg_data);
+   float              **A_fine_single_data = hypre_ParAMGDataAFineSingleData(amg_data);
+   hypre_CSRMatrix     *A_fine_part;
+   HYPRE_Int            level, k, i, num_nonzeros;
+
+   if (mixed_precision == 0 || num_levels < 2)
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_COMPLEX)
+   return hypre_error_flag;
+#else
+   /* these options use other cycles or smoothers that read the values */
+   if (hypre_ParAMGDataBlockMode(amg_data)           ||
+       hypre_ParAMGDataAdditive(amg_data)      > -1  ||
+       hypre_ParAMGDataMultAdditive(amg_data)  > -1  ||
+       hypre_ParAMGDataSimple(amg_data)        > -1  ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixDiag(A_array[0])))
+       != hypre_MEMORY_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      hypre_ParCSRMatrixConvertToSingle(P_array[level]);
+      if (restri_type && R_array[level])
+      {
+         hypre_ParCSRMatrixConvertToSingle(R_array[level]);
+      }
+   }
+
+   for (level = 1; level < num_levels; level++)
+   {
+      if (A_array[level] && hypre_BoomerAMGMixedPrecisionLevelSupported(amg_data, level))
+      {
+         hypre_ParCSRMatrixConvertToSingle(A_array[level]);
+      }
+   }
+
+   /* the fine grid matrix belongs to the user: only its values are copied */
+   if (mixed_precision == 2 && hypre_BoomerAMGMixedPrecisionLevelSupported(amg_data, 0))
+   {
+      for (k = 0; k < 2; k++)
+      {
+         A_fine_part  = k ? hypre_ParCSRMatrixOffd(A_array[0]) : hypre_ParCSRMatrixDiag(A_array[0]);
+         num_nonzeros = hypre_CSRMatrixNumNonzeros(A_fine_part);
+         if (num_nonzeros == 0)
+         {
+            continue;
+         }
+
+         A_fine_single_data[k] = hypre_TAlloc(float, num_nonzeros, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_nonzeros; i++)
+         {
+            A_fine_single_data[k][i] = (float) hypre_CSRMatrixData(A_fine_part)[i];
+         }
+      }
+      hypre_ParAMGDataAFineSingle(amg_data) = 1;
+   }
+
+   return hypre_error_flag;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionRestore
+ *
+ * Converts the hierarchy back to double precision, e.g., before the setup
+ * reuses it or frees it
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMixedPrecisionRestore( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array    = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array    = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int            level;
+
+   hypre_TFree(hypre_ParAMGDataAFineSingleData(amg_data)[0], HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataAFineSingleData(amg_data)[1], HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataAFineSingle(amg_data) = 0;
+
+   if (!A_array)
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = 0; level < num_levels; level++)
+   {
+      if (level > 0 && A_array[level])
+      {
+         hypre_ParCSRMatrixConvertFromSingle(A_array[level]);
+      }
+      if (level < num_levels - 1)
+      {
+         if (P_array && P_array[level])
+         {
+            hypre_ParCSRMatrixConvertFromSingle(P_array[level]);
+         }
+         if (R_array && R_array[level])
+         {
+            hypre_ParCSRMatrixConvertFromSingle(R_array[level]);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionAttachFine
+ *
+ * Lets the matvecs of the cycle on the fine grid use the single precision
+ * values of the setup.  The values are detached again with
+ * hypre_BoomerAMGMixedPrecisionDetachFine before the cycle returns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMixedPrecisionAttachFine( void *amg_vdata )
+{
+   hypre_ParAMGData  *amg_data           = (hypre_ParAMGData*) amg_vdata;
+   float            **A_fine_single_data = hypre_ParAMGDataAFineSingleData(amg_data);
+   hypre_ParCSRMatrix *A_fine;
+
+   if (!hypre_ParAMGDataAFineSingle(amg_data))
+   {
+      return hypre_error_flag;
+   }
+
+   A_fine = hypre_ParAMGDataAArray(amg_data)[0];
+   hypre_CSRMatrixSingleData(hypre_ParCSRMatrixDiag(A_fine)) = A_fine_single_data[0];
+   hypre_CSRMatrixSingleData(hypre_ParCSRMatrixOffd(A_fine)) = A_fine_single_data[1];
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionDetachFine
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMixedPrecisionDetachFine( void *amg_vdata )
+{
+   hypre_ParAMGData   *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix *A_fine;
+
+   if (!hypre_ParAMGDataAFineSingle(amg_data))
+   {
+      return hypre_error_flag;
+   }
+
+   A_fine = hypre_ParAMGDataAArray(amg_data)[0];
+   hypre_CSRMatrixSingleData(hypre_ParCSRMatrixDiag(A_fine)) = NULL;
+   hypre_CSRMatrixSingleData(hypre_ParCSRMatrixOffd(A_fine)) = NULL;
+
+   return hypre_error_flag;
+}
@@ -19,6 +19,120 @@
  *
  *****************************************************************************/
 
+/*****************************************************************************
+ * hypre_BoomerAMGSetupSamePattern
+ *
+ * Returns 1 if the local parts of A and B have the same sparsity pattern
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_BoomerAMGSetupSamePattern( hypre_ParCSRMatrix *A,
+                                 hypre_ParCSRMatrix *B )
+{
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *B_diag = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix *B_offd = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+       hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(B)) != hypre_MEMORY_HOST)
+   {
+      return 0;
+   }
+
+   if (num_rows != hypre_CSRMatrixNumRows(B_diag) ||
+       num_cols_offd != hypre_CSRMatrixNumCols(B_offd) ||
+       hypre_CSRMatrixNumNonzeros(A_diag) != hypre_CSRMatrixNumNonzeros(B_diag) ||
+       hypre_CSRMatrixNumNonzeros(A_offd) != hypre_CSRMatrixNumNonzeros(B_offd))
+   {
+      return 0;
+   }
+
+   if (memcmp(hypre_CSRMatrixI(A_diag), hypre_CSRMatrixI(B_diag), (num_rows + 1) * sizeof(HYPRE_Int)) ||
+       memcmp(hypre_CSRMatrixI(A_offd), hypre_CSRMatrixI(B_offd), (num_rows + 1) * sizeof(HYPRE_Int)) ||
+       memcmp(hypre_CSRMatrixJ(A_diag), hypre_CSRMatrixJ(B_diag),
+              hypre_CSRMatrixNumNonzeros(A_diag) * sizeof(HYPRE_Int)) ||
+       memcmp(hypre_CSRMatrixJ(A_offd), hypre_CSRMatrixJ(B_offd),
+              hypre_CSRMatrixNumNonzeros(A_offd) * sizeof(HYPRE_Int)) ||
+       memcmp(hypre_ParCSRMatrixColMapOffd(A), hypre_ParCSRMatrixColMapOffd(B),
+              num_cols_offd * sizeof(HYPRE_BigInt)))
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*****************************************************************************
+ * hypre_BoomerAMGSetupResetBlockDiag
+ *
+ * Frees the block diagonal inverses of A, which depend on its values.
+ *****************************************************************************/
+
+static void
+hypre_BoomerAMGSetupResetBlockDiag( hypre_ParCSRMatrix *A )
+{
+   hypre_TFree(A->bdiaginv, HYPRE_MEMORY_HOST);
+   A->bdiaginv = NULL;
+   A->bdiag_size = -1;
+   if (A->bdiaginv_comm_pkg)
+   {
+      hypre_MatvecCommPkgDestroy(A->bdiaginv_comm_pkg);
+      A->bdiaginv_comm_pkg = NULL;
+   }
+}
+
+/*****************************************************************************
+ * hypre_BoomerAMGSetupReuseCoarseOperator
+ *
+ * Moves the values of the new coarse-grid operator A_H into A_old if all
+ * processes find the same sparsity pattern in both, so that A_old keeps its
+ * communication package.  Otherwise A_old is replaced by A_H.  Both matrices
+ * are built from the same P, and share the coarse partitioning owned by A_old.
+ *****************************************************************************/
+
+static hypre_ParCSRMatrix *
+hypre_BoomerAMGSetupReuseCoarseOperator( hypre_ParCSRMatrix *A_old,
+                                         hypre_ParCSRMatrix *A_H )
+{
+   MPI_Comm              comm = hypre_ParCSRMatrixComm(A_H);
+   hypre_CSRMatrix      *A_diag = hypre_ParCSRMatrixDiag(A_old);
+   hypre_CSRMatrix      *A_offd = hypre_ParCSRMatrixOffd(A_old);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A_old);
+   HYPRE_Int             same_pattern;
+
+   same_pattern = hypre_BoomerAMGSetupSamePattern(A_old, A_H);
+   hypre_MPI_Allreduce(hypre_MPI_IN_PLACE, &same_pattern, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   if (!same_pattern)
+   {
+      hypre_ParCSRMatrixOwnsRowStarts(A_H) = hypre_ParCSRMatrixOwnsRowStarts(A_old);
+      hypre_ParCSRMatrixOwnsColStarts(A_H) = hypre_ParCSRMatrixOwnsColStarts(A_old);
+      hypre_ParCSRMatrixOwnsRowStarts(A_old) = 0;
+      hypre_ParCSRMatrixOwnsColStarts(A_old) = 0;
+      hypre_ParCSRMatrixDestroy(A_old);
+
+      return A_H;
+   }
+
+   hypre_TMemcpy(hypre_CSRMatrixData(A_diag), hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A_H)),
+                 HYPRE_Complex, hypre_CSRMatrixNumNonzeros(A_diag),
+                 memory_location, memory_location);
+   hypre_TMemcpy(hypre_CSRMatrixData(A_offd), hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(A_H)),
+                 HYPRE_Complex, hypre_CSRMatrixNumNonzeros(A_offd),
+                 memory_location, memory_location);
+
+   hypre_BoomerAMGSetupResetBlockDiag(A_old);
+
+   hypre_ParCSRMatrixOwnsRowStarts(A_H) = 0;
+   hypre_ParCSRMatrixOwnsColStarts(A_H) = 0;
+   hypre_ParCSRMatrixDestroy(A_H);
+
+   return A_old;
+}
+
 /*****************************************************************************
  * hypre_BoomerAMGSetup
  *****************************************************************************/
@@ -190,6 +304,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_ParCSRBlockMatrix *A_H_block;
 
    HYPRE_Int       block_mode = 0;
+   HYPRE_Int       reuse_setup = 0;
+   hypre_ParCSRRAPPlan **rap_plans = hypre_ParAMGDataRAPPlans(amg_data);
+   HYPRE_Int       use_rap_plan, rap_plan_matches;
 
    HYPRE_Int       mult_addlvl = hypre_max(mult_additive, simple);
    HYPRE_Int       addlvl = hypre_max(mult_addlvl, additive);
@@ -287,6 +404,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   /* the multivector work vectors are sized for the previous hierarchy */
+   hypre_BoomerAMGMultiVectorDataDestroy(amg_data);
+
+   /* the previous hierarchy is reused or freed in double precision */
+   hypre_BoomerAMGMixedPrecisionRestore(amg_data);
+
    /* change in definition of standard and multipass interpolation, by
       eliminating interp_type 9 and 5 and setting sep_weight instead
       when using separation of weights option */
@@ -320,7 +443,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    /* probably should disable stuff like smooth num levels at some point */
 
 
-   if (grid_relax_type[0] >= 20) /* block relaxation choosen */
+   /* block relaxation choosen (the nodal relaxation types are 20-29) */
+   if (grid_relax_type[0] >= 20 && grid_relax_type[0] < 30)
    {
 
       if (!((interp_type >= 20 && interp_type != 100) || interp_type == 11 || interp_type == 10 ) )
@@ -331,13 +455,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       for (i=1; i < 3; i++)
       {
-         if (grid_relax_type[i] < 20)
+         if (grid_relax_type[i] < 20 || (grid_relax_type[i] >= 30 && grid_relax_type[i] <= 32))
          {
             grid_relax_type[i] = 23;
          }
 
       }
-      if (grid_relax_type[3] < 20) grid_relax_type[3] = 29;  /* GE */
+      if (grid_relax_type[3] < 20 || (grid_relax_type[3] >= 30 && grid_relax_type[3] <= 32)) grid_relax_type[3] = 29;  /* GE */
 
       block_mode = 1;
    }
@@ -351,11 +475,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
       for (i=0; i < 3; i++)
       {
-         if (grid_relax_type[i] < 20)
+         if (grid_relax_type[i] < 20 || (grid_relax_type[i] >= 30 && grid_relax_type[i] <= 32))
             grid_relax_type[i] = 23;
       }
 
-      if (grid_relax_type[3] < 20) grid_relax_type[3] = 29; /* GE */
+      if (grid_relax_type[3] < 20 || (grid_relax_type[3] >= 30 && grid_relax_type[3] <= 32)) grid_relax_type[3] = 29; /* GE */
 
       block_mode = 1;
 
@@ -366,11 +490,63 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* end of systems checks */
 
+   /* keep the splittings and interpolation of the previous setup if they
+      apply to A, and the previous setup used none of the options that
+      modify them outside of the coarsening loop */
+   if (hypre_ParAMGDataReuseSetup(amg_data) &&
+       old_num_levels > 1 && old_num_levels <= max_levels &&
+       A_array && P_array && CF_marker_array && dof_func_array &&
+       !block_mode && addlvl == -1 && interp_vec_variant == 0 &&
+       nongalerk_num_tol == 0 && nongal_tol_array == NULL &&
+       (!restri_type || R_array))
+   {
+      reuse_setup = 1;
+      for (j = 0; j < old_num_levels - 1; j++)
+      {
+         if (!A_array[j+1] || !P_array[j] || !CF_marker_array[j] ||
+             (restri_type && !R_array[j]))
+         {
+            reuse_setup = 0;
+         }
+      }
+      if (reuse_setup &&
+          (hypre_ParCSRMatrixGlobalNumRows(P_array[0]) != hypre_ParCSRMatrixGlobalNumRows(A) ||
+           hypre_ParCSRMatrixFirstRowIndex(P_array[0]) != first_local_row ||
+           hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(P_array[0])) != local_size))
+      {
+         reuse_setup = 0;
+      }
+      hypre_MPI_Allreduce(hypre_MPI_IN_PLACE, &reuse_setup, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   }
+
    /* free up storage in case of new setup without previous destroy */
 
-   if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
-       dof_func_array || R_array || R_block_array)
+   if (reuse_setup)
+   {
+      /* the fine-grid partitioning of P may belong to the previous A */
+      if (!hypre_ParCSRMatrixOwnsRowStarts(P_array[0]))
+      {
+         hypre_ParCSRMatrixRowStarts(P_array[0]) = hypre_ParCSRMatrixRowStarts(A);
+      }
+      if (restri_type && !hypre_ParCSRMatrixOwnsColStarts(R_array[0]))
+      {
+         hypre_ParCSRMatrixColStarts(R_array[0]) = hypre_ParCSRMatrixRowStarts(A);
+      }
+   }
+   else if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
+            dof_func_array || R_array || R_block_array)
    {
+      if (rap_plans)
+      {
+         for (j = 0; j < old_num_levels-1; j++)
+         {
+            hypre_ParCSRRAPPlanDestroy(rap_plans[j]);
+         }
+         hypre_TFree(rap_plans, HYPRE_MEMORY_HOST);
+         rap_plans = NULL;
+         hypre_ParAMGDataRAPPlans(amg_data) = NULL;
+      }
+
       for (j = 1; j < old_num_levels; j++)
       {
          if (A_array[j])
@@ -529,6 +705,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+      hypre_BoomerAMGMulticolorDestroy(amg_data, old_num_levels);
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > old_num_levels-1)
@@ -851,6 +1028,142 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /*-----------------------------------------------------
+    *  Re-setup with the splittings and interpolation of the
+    *  previous setup: only the coarse-grid operators change
+    *-----------------------------------------------------*/
+
+   if (reuse_setup)
+   {
+      for (level = 0; level < old_num_levels - 1; level++)
+      {
+         if (level > 0)
+         {
+            F_array[level] =
+               hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                     hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                     hypre_ParCSRMatrixRowStarts(A_array[level]));
+            hypre_ParVectorInitialize_v2(F_array[level], memory_location);
+            hypre_ParVectorSetPartitioningOwner(F_array[level],0);
+
+            U_array[level] =
+               hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                     hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                     hypre_ParCSRMatrixRowStarts(A_array[level]));
+            hypre_ParVectorInitialize_v2(U_array[level], memory_location);
+            hypre_ParVectorSetPartitioningOwner(U_array[level],0);
+         }
+
+         if (debug_flag==1) wall_time = time_getWallclockSeconds();
+
+         /* Galerkin operators P^T A P without dropping are recomputed from
+            the symbolic product of the previous re-setup when A_array[level]
+            kept its pattern, which all processes must agree on */
+         use_rap_plan = !restri_type && hypre_ParAMGDataADropTol(amg_data) <= 0.0 &&
+                        hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST;
+         rap_plan_matches = 0;
+         if (use_rap_plan)
+         {
+            if (!rap_plans)
+            {
+               rap_plans = hypre_CTAlloc(hypre_ParCSRRAPPlan *, old_num_levels-1, HYPRE_MEMORY_HOST);
+               hypre_ParAMGDataRAPPlans(amg_data) = rap_plans;
+            }
+            rap_plan_matches = hypre_ParCSRRAPPlanMatches(rap_plans[level], A_array[level],
+                                                          P_array[level]);
+            hypre_MPI_Allreduce(hypre_MPI_IN_PLACE, &rap_plan_matches, 1, HYPRE_MPI_INT,
+                                hypre_MPI_MIN, comm);
+         }
+
+         if (rap_plan_matches)
+         {
+            hypre_ParCSRMatrixRAPNumeric(rap_plans[level], A_array[level], P_array[level],
+                                         A_array[level+1]);
+            hypre_BoomerAMGSetupResetBlockDiag(A_array[level+1]);
+         }
+         else
+         {
+            if (use_rap_plan)
+            {
+               hypre_ParCSRRAPPlanDestroy(rap_plans[level]);
+               A_H = hypre_ParCSRMatrixRAPSymbolic(P_array[level], A_array[level], P_array[level],
+                                                   &rap_plans[level]);
+            }
+            else if (restri_type)
+            {
+               hypre_ParCSRMatrix *AP = NULL;
+               if (hypre_ParAMGDataModularizedMatMat(amg_data))
+               {
+                  AP  = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+                  A_H = hypre_ParCSRMatMat(R_array[level], AP);
+               }
+               else
+               {
+                  AP  = hypre_ParMatmul(A_array[level], P_array[level]);
+                  A_H = hypre_ParMatmul(R_array[level], AP);
+               }
+               hypre_ParCSRMatrixDestroy(AP);
+            }
+            else if (rap2)
+            {
+               hypre_ParCSRMatrix *Q = NULL;
+               if (hypre_ParAMGDataModularizedMatMat(amg_data))
+               {
+                  Q = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+                  A_H = hypre_ParCSRTMatMatKT(P_array[level], Q, keepTranspose);
+               }
+               else
+               {
+                  Q = hypre_ParMatmul(A_array[level], P_array[level]);
+                  A_H = hypre_ParTMatmul(P_array[level], Q);
+               }
+               hypre_ParCSRMatrixDestroy(Q);
+            }
+            else
+            {
+               if (hypre_ParAMGDataModularizedMatMat(amg_data))
+               {
+                  A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
+                                                P_array[level], keepTranspose);
+               }
+               else
+               {
+                  hypre_BoomerAMGBuildCoarseOperatorKT(P_array[level], A_array[level],
+                                                       P_array[level], keepTranspose, &A_H);
+               }
+            }
+
+            hypre_ParCSRMatrixDropSmallEntries(A_H, hypre_ParAMGDataADropTol(amg_data),
+                                               hypre_ParAMGDataADropType(amg_data));
+            if (num_procs > 1 && hypre_ParCSRMatrixCommPkg(A_H) == NULL)
+            {
+               hypre_MatvecCommPkgCreate(A_H);
+            }
+            if (hypre_ParAMGDataADropTol(amg_data) <= 0.0)
+            {
+               hypre_ParCSRMatrixSetNumNonzeros(A_H);
+               hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+            }
+            A_array[level+1] = hypre_BoomerAMGSetupReuseCoarseOperator(A_array[level+1], A_H);
+         }
+
+         if (debug_flag==1)
+         {
+            wall_time = time_getWallclockSeconds() - wall_time;
+            hypre_printf("Proc = %d    Level = %d    Rebuild Coarse Operator Time = %f\n",
+                          my_id,level, wall_time);
+            fflush(NULL);
+         }
+
+         HYPRE_ANNOTATE_MGLEVEL_END(level);
+         HYPRE_ANNOTATE_MGLEVEL_BEGIN(level+1);
+      }
+
+      coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      HYPRE_ANNOTATE_MGLEVEL_END(level);
+      not_finished_coarsening = 0;
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
@@ -2935,7 +3248,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        grid_relax_type[1] ==  8 || grid_relax_type[2] ==  8 || grid_relax_type[3] ==  8 ||
        grid_relax_type[1] == 13 || grid_relax_type[2] == 13 || grid_relax_type[3] == 13 ||
        grid_relax_type[1] == 14 || grid_relax_type[2] == 14 || grid_relax_type[3] == 14 ||
-       grid_relax_type[1] == 18 || grid_relax_type[2] == 18 || grid_relax_type[3] == 18)
+       grid_relax_type[1] == 18 || grid_relax_type[2] == 18 || grid_relax_type[3] == 18 ||
+       grid_relax_type[1] == 30 || grid_relax_type[2] == 30 || grid_relax_type[3] == 30)
    {
       l1_norms = hypre_CTAlloc(hypre_Vector*, num_levels, HYPRE_MEMORY_HOST);
       hypre_ParAMGDataL1Norms(amg_data) = l1_norms;
@@ -2955,6 +3269,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
    }
 
+   /* multicolor G-S */
+   hypre_BoomerAMGMulticolorSetup(amg_data);
+
    /* CG */
    if (grid_relax_type[0] == 15 || grid_relax_type[1] == 15 ||
        grid_relax_type[2] == 15 || grid_relax_type[3] == 15)
@@ -2973,8 +3290,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       HYPRE_Real *l1_norm_data = NULL;
 
       if (j < num_levels-1 &&
-          (grid_relax_type[1] == 8 || grid_relax_type[1] == 13 || grid_relax_type[1] == 14 ||
-           grid_relax_type[2] == 8 || grid_relax_type[2] == 13 || grid_relax_type[2] == 14))
+          (grid_relax_type[1] == 8 || grid_relax_type[1] == 13 || grid_relax_type[1] == 14 || grid_relax_type[1] == 30 ||
+           grid_relax_type[2] == 8 || grid_relax_type[2] == 13 || grid_relax_type[2] == 14 || grid_relax_type[2] == 30))
       {
          if (relax_order)
          {
@@ -2986,7 +3303,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
       else if (j == num_levels-1 &&
-               (grid_relax_type[3] == 8 || grid_relax_type[3] == 13 || grid_relax_type[3] == 14))
+               (grid_relax_type[3] == 8 || grid_relax_type[3] == 13 || grid_relax_type[3] == 14 ||
+                grid_relax_type[3] == 30))
       {
          hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
       }
@@ -3034,7 +3352,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       HYPRE_Real *l1_norm_data = NULL;
 
       if (j < num_levels-1 && (grid_relax_type[1] == 8 || grid_relax_type[1] == 13 || grid_relax_type[1] == 14 ||
-                               grid_relax_type[2] == 8 || grid_relax_type[2] == 13 || grid_relax_type[2] == 14))
+                               grid_relax_type[1] == 30 ||
+                               grid_relax_type[2] == 8 || grid_relax_type[2] == 13 || grid_relax_type[2] == 14 ||
+                               grid_relax_type[2] == 30))
       {
          if (relax_order)
          {
@@ -3045,7 +3365,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
          }
       }
-      else if ((grid_relax_type[3] == 8 || grid_relax_type[3] == 13 || grid_relax_type[3] == 14) && j == num_levels-1)
+      else if ((grid_relax_type[3] == 8 || grid_relax_type[3] == 13 || grid_relax_type[3] == 14 ||
+                grid_relax_type[3] == 30) && j == num_levels-1)
       {
          hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
       }
@@ -3461,6 +3782,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 }
 #endif
 
+   /* store the operators that the cycle only multiplies with in single precision */
+   hypre_BoomerAMGMixedPrecisionSetup(amg_data);
+
+   /* release the host memory pool slabs emptied by the setup temporaries */
+   hypre_HostPoolTrim();
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return(hypre_error_flag);
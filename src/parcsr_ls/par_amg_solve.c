@@ -79,6 +79,13 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    hypre_ParVector  *Vtemp;
    hypre_ParVector  *Residual;
+   hypre_ParVector  *F_correct = NULL;
+   hypre_ParVector  *U_correct = NULL;
+
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_BoomerAMGSolveMultiVector(amg_vdata, A, f, u);
+   }
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -120,6 +127,23 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
         */
    Vtemp = hypre_ParAMGDataVtemp(amg_data);
 
+   /* A cycle with the single precision fine grid matrix converges to the
+      solution of the rounded system, so later cycles are applied to the
+      double precision residual instead (iterative refinement) */
+   if (hypre_ParAMGDataAFineSingle(amg_data) && max_iter > 1)
+   {
+      F_correct = hypre_ParVectorCreate(comm,
+                                        hypre_ParCSRMatrixGlobalNumRows(A),
+                                        hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize_v2(F_correct, hypre_ParCSRMatrixMemoryLocation(A));
+      hypre_ParVectorSetPartitioningOwner(F_correct, 0);
+      U_correct = hypre_ParVectorCreate(comm,
+                                        hypre_ParCSRMatrixGlobalNumRows(A),
+                                        hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize_v2(U_correct, hypre_ParCSRMatrixMemoryLocation(A));
+      hypre_ParVectorSetPartitioningOwner(U_correct, 0);
+   }
+
    /*-----------------------------------------------------------------------
     *    Write the solver parameters
     *-----------------------------------------------------------------------*/
@@ -248,7 +272,23 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
            (mult_additive < 0 || mult_additive >= num_levels) &&
            (simple        < 0 || simple        >= num_levels) )
       {
-         hypre_BoomerAMGCycle(amg_data, F_array, U_array);
+         if (F_correct && cycle_count > 0)
+         {
+            hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, F_correct);
+            hypre_ParVectorSetConstantValues(U_correct, 0.0);
+            F_array[0] = F_correct;
+            U_array[0] = U_correct;
+
+            hypre_BoomerAMGCycle(amg_data, F_array, U_array);
+
+            F_array[0] = f;
+            U_array[0] = u;
+            hypre_ParVectorAxpy(1.0, U_correct, u);
+         }
+         else
+         {
+            hypre_BoomerAMGCycle(amg_data, F_array, U_array);
+         }
       }
       else
       {
@@ -393,6 +433,10 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
       hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
    }
+
+   hypre_ParVectorDestroy(F_correct);
+   hypre_ParVectorDestroy(U_correct);
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -97,6 +97,9 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
    F_array[0] = f;
    U_array[0] = u;
 
+   /* the transpose relaxations read the double precision values */
+   hypre_BoomerAMGMixedPrecisionRestore(amg_data);
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
 /*   Vtemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
@@ -283,6 +286,9 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
    hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
    hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
 
+   /* converting the widened values again gives the same single precision ones */
+   hypre_BoomerAMGMixedPrecisionSetup(amg_data);
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return(Solve_err_flag);
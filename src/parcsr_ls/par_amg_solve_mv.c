@@ -0,0 +1,849 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * AMG solve and cycle for multivectors (several right-hand sides at once)
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorDataDestroy
+ *
+ * Frees the work vectors of the multivector solve. They are sized for the
+ * current hierarchy, so setup frees them as well.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiVectorDataDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData  *amg_data       = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParVector  **F_mv_array     = hypre_ParAMGDataFMVArray(amg_data);
+   hypre_ParVector  **U_mv_array     = hypre_ParAMGDataUMVArray(amg_data);
+   hypre_ParVector  **Vtemp_mv_array = hypre_ParAMGDataVtempMVArray(amg_data);
+   HYPRE_Int          level;
+
+   /* Vtemp_mv_array has an entry on every level and is NULL-terminated */
+   if (Vtemp_mv_array)
+   {
+      for (level = 0; Vtemp_mv_array[level]; level++)
+      {
+         if (level > 0)
+         {
+            hypre_ParVectorDestroy(F_mv_array[level]);
+            hypre_ParVectorDestroy(U_mv_array[level]);
+         }
+         hypre_ParVectorDestroy(Vtemp_mv_array[level]);
+      }
+   }
+   hypre_TFree(F_mv_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(U_mv_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vtemp_mv_array, HYPRE_MEMORY_HOST);
+   hypre_ParVectorDestroy(hypre_ParAMGDataFColumn(amg_data));
+   hypre_ParVectorDestroy(hypre_ParAMGDataUColumn(amg_data));
+
+   hypre_ParAMGDataFMVArray(amg_data)     = NULL;
+   hypre_ParAMGDataUMVArray(amg_data)     = NULL;
+   hypre_ParAMGDataVtempMVArray(amg_data) = NULL;
+   hypre_ParAMGDataFColumn(amg_data)      = NULL;
+   hypre_ParAMGDataUColumn(amg_data)      = NULL;
+   hypre_ParAMGDataMVNumVectors(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorDataCreate
+ *
+ * Creates (or reuses) the work vectors for num_vectors vectors. The coarse
+ * levels store the vectors interleaved, so that a row of A, P or R is read
+ * once for all of them; Vtemp on level 0 uses the storage of f, as the
+ * residual computation requires.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiVectorDataCreate( hypre_ParAMGData *amg_data,
+                                      hypre_ParVector  *f )
+{
+   hypre_ParCSRMatrix **A_array     = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int            num_levels  = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            num_vectors = hypre_ParVectorNumVectors(f);
+   HYPRE_Int            storage     = hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(f));
+   hypre_ParVector    **F_mv_array;
+   hypre_ParVector    **U_mv_array;
+   hypre_ParVector    **Vtemp_mv_array;
+   hypre_ParVector     *vector;
+   HYPRE_Int            level;
+
+   Vtemp_mv_array = hypre_ParAMGDataVtempMVArray(amg_data);
+   if (Vtemp_mv_array &&
+       hypre_ParAMGDataMVNumVectors(amg_data) == num_vectors &&
+       hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(Vtemp_mv_array[0])) == storage)
+   {
+      return hypre_error_flag;
+   }
+   hypre_BoomerAMGMultiVectorDataDestroy(amg_data);
+
+   F_mv_array     = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   U_mv_array     = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   Vtemp_mv_array = hypre_CTAlloc(hypre_ParVector*, num_levels + 1, HYPRE_MEMORY_HOST);
+
+   for (level = 0; level < num_levels; level++)
+   {
+      HYPRE_Int k, nk = level > 0 ? 3 : 1;
+
+      for (k = 0; k < nk; k++)
+      {
+         vector = hypre_ParMultiVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                             hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                             hypre_ParCSRMatrixRowStarts(A_array[level]),
+                                             num_vectors);
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(vector)) = level > 0 ? 1 : storage;
+         hypre_ParVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+         hypre_ParVectorSetPartitioningOwner(vector, 0);
+
+         if (k == 0)
+         {
+            Vtemp_mv_array[level] = vector;
+         }
+         else if (k == 1)
+         {
+            F_mv_array[level] = vector;
+         }
+         else
+         {
+            U_mv_array[level] = vector;
+         }
+      }
+   }
+
+   hypre_ParAMGDataFMVArray(amg_data)     = F_mv_array;
+   hypre_ParAMGDataUMVArray(amg_data)     = U_mv_array;
+   hypre_ParAMGDataVtempMVArray(amg_data) = Vtemp_mv_array;
+   hypre_ParAMGDataMVNumVectors(amg_data) = num_vectors;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorColumnsCreate
+ *
+ * Creates the single vectors that hold one vector of f and u on level 0.
+ * They live in the memory location of f, so the column copies stay there.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiVectorColumnsCreate( hypre_ParAMGData   *amg_data,
+                                         hypre_ParCSRMatrix *A,
+                                         hypre_ParVector    *f )
+{
+   HYPRE_MemoryLocation  memory_location = hypre_ParVectorMemoryLocation(f);
+   hypre_ParVector      *vector;
+   HYPRE_Int             k;
+
+   for (k = 0; k < 2; k++)
+   {
+      vector = (k == 0) ? hypre_ParAMGDataFColumn(amg_data) : hypre_ParAMGDataUColumn(amg_data);
+      if (vector != NULL)
+      {
+         if (hypre_ParVectorMemoryLocation(vector) == memory_location)
+         {
+            continue;
+         }
+         hypre_ParVectorDestroy(vector);
+      }
+
+      vector = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                     hypre_ParCSRMatrixGlobalNumRows(A),
+                                     hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize_v2(vector, memory_location);
+      hypre_ParVectorSetPartitioningOwner(vector, 0);
+
+      if (k == 0)
+      {
+         hypre_ParAMGDataFColumn(amg_data) = vector;
+      }
+      else
+      {
+         hypre_ParAMGDataUColumn(amg_data) = vector;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorGetColumn / SetColumn
+ *
+ * Copy vector jv of the multivector x to/from the single vector column.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGMultiVectorGetColumn( hypre_ParVector *x,
+                                     HYPRE_Int        jv,
+                                     hypre_ParVector *column )
+{
+   hypre_SeqMultiVectorGetColumn(hypre_ParVectorLocalVector(x), jv,
+                                 hypre_ParVectorLocalVector(column));
+}
+
+static void
+hypre_BoomerAMGMultiVectorSetColumn( hypre_ParVector *x,
+                                     HYPRE_Int        jv,
+                                     hypre_ParVector *column )
+{
+   hypre_SeqMultiVectorSetColumn(hypre_ParVectorLocalVector(x), jv,
+                                 hypre_ParVectorLocalVector(column));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorColumnNorms
+ *
+ * 2-norms of the vectors of x, with a single reduction for all of them.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGMultiVectorColumnNorms( hypre_ParVector *x,
+                                       HYPRE_Real      *norms )
+{
+   hypre_Vector  *x_local     = hypre_ParVectorLocalVector(x);
+   HYPRE_Complex *x_data      = hypre_VectorData(x_local);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Int      vecstride   = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      idxstride   = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      size        = hypre_VectorSize(x_local);
+   HYPRE_Real    *local_norms = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   HYPRE_Int      i, jv;
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      HYPRE_Real sum = 0.0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) reduction(+:sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         HYPRE_Complex xi = x_data[jv * vecstride + i * idxstride];
+         sum += hypre_creal(hypre_conj(xi) * xi);
+      }
+      local_norms[jv] = sum;
+   }
+
+   hypre_MPI_Allreduce(local_norms, norms, num_vectors, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_ParVectorComm(x));
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      norms[jv] = sqrt(norms[jv]);
+   }
+
+   hypre_TFree(local_norms, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorRelaxColumns
+ *
+ * Smoothing on one level for relaxation types without a multivector
+ * implementation: each vector is copied into the single-vector work
+ * vectors of the hierarchy and relaxed as in hypre_BoomerAMGCycle.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiVectorRelaxColumns( hypre_ParAMGData *amg_data,
+                                        HYPRE_Int         level,
+                                        HYPRE_Int         cycle_param,
+                                        HYPRE_Int         relax_type,
+                                        HYPRE_Int         num_sweep,
+                                        hypre_ParVector  *F_mv,
+                                        hypre_ParVector  *U_mv )
+{
+   hypre_ParCSRMatrix  *A            = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_ParVector     *F            = hypre_ParAMGDataFArray(amg_data)[level];
+   hypre_ParVector     *U            = hypre_ParAMGDataUArray(amg_data)[level];
+   hypre_ParVector     *Vtemp        = hypre_ParAMGDataVtemp(amg_data);
+   hypre_ParVector     *Ztemp        = hypre_ParAMGDataZtemp(amg_data);
+   HYPRE_Int           *cf_marker    = hypre_ParAMGDataCFMarkerArray(amg_data)[level];
+   HYPRE_Int          **grid_relax_points = hypre_ParAMGDataGridRelaxPoints(amg_data);
+   HYPRE_Int            relax_order  = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Real           relax_weight = hypre_ParAMGDataRelaxWeight(amg_data)[level];
+   HYPRE_Real           omega        = hypre_ParAMGDataOmega(amg_data)[level];
+   HYPRE_Int            num_levels   = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            max_levels   = hypre_ParAMGDataMaxLevels(amg_data);
+   hypre_Vector       **l1_norms     = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real          *l1_norms_data = (l1_norms && l1_norms[level]) ?
+                                        hypre_VectorData(l1_norms[level]) : NULL;
+   HYPRE_Int            num_vectors  = hypre_ParVectorNumVectors(F_mv);
+   HYPRE_Int            relax_points = 0, relax_local;
+   HYPRE_Int            Solve_err_flag = 0;
+   HYPRE_Int            jv, j;
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      hypre_BoomerAMGMultiVectorGetColumn(F_mv, jv, F);
+      hypre_BoomerAMGMultiVectorGetColumn(U_mv, jv, U);
+
+      for (j = 0; j < num_sweep; j++)
+      {
+         if (num_levels == 1 && max_levels > 1)
+         {
+            relax_points = 0;
+            relax_local = 0;
+         }
+         else
+         {
+            if (grid_relax_points)
+            {
+               relax_points = grid_relax_points[cycle_param][j];
+            }
+            relax_local = relax_order;
+         }
+
+         if (relax_type == 9 || relax_type == 99 || relax_type == 199)
+         {
+            hypre_GaussElimSolve(amg_data, level, relax_type);
+         }
+         else if (relax_type == 15)
+         {
+            if (j == 0)
+            {
+               hypre_ParCSRRelax_CG(hypre_ParAMGDataSmoother(amg_data)[level], A, F, U, num_sweep);
+            }
+         }
+         else if (relax_type == 16)
+         {
+            hypre_ParCSRRelax_Cheby_Solve(A, F,
+                                          hypre_ParAMGDataChebyDS(amg_data)[level],
+                                          hypre_ParAMGDataChebyCoefs(amg_data)[level],
+                                          hypre_ParAMGDataChebyOrder(amg_data),
+                                          hypre_ParAMGDataChebyScale(amg_data),
+                                          hypre_ParAMGDataChebyVariant(amg_data),
+                                          U, Vtemp, Ztemp);
+         }
+         else if (relax_type == 17)
+         {
+            if (level == num_levels - 1)
+            {
+               hypre_BoomerAMGRelax(A, F, cf_marker, 0, 0, relax_weight, 0.0, NULL, U, Vtemp, NULL);
+            }
+            else
+            {
+               hypre_BoomerAMGRelax_FCFJacobi(A, F, cf_marker, relax_weight, U, Vtemp);
+            }
+         }
+         else if (grid_relax_points && relax_type != 18)
+         {
+            Solve_err_flag = hypre_BoomerAMGRelax(A, F, cf_marker, relax_type, relax_points,
+                                                  relax_weight, omega, l1_norms_data, U, Vtemp, Ztemp);
+         }
+         else
+         {
+            Solve_err_flag = hypre_BoomerAMGRelaxIF(A, F, cf_marker, relax_type,
+                                                    relax_type == 18 ? relax_order : relax_local,
+                                                    cycle_param, relax_weight, omega, l1_norms_data,
+                                                    U, Vtemp, Ztemp);
+         }
+
+         if (Solve_err_flag != 0)
+         {
+            return Solve_err_flag;
+         }
+      }
+
+      hypre_BoomerAMGMultiVectorSetColumn(U_mv, jv, U);
+   }
+
+   return Solve_err_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCycleMultiVector
+ *
+ * One cycle of hypre_BoomerAMGCycle applied to all the vectors of the
+ * multivectors F_mv_array[0] and U_mv_array[0] together. Residuals,
+ * restriction and interpolation are multivector matvecs, and the smoothers
+ * of hypre_BoomerAMGRelaxMultiVector relax all the vectors in one sweep.
+ * Other smoothers are applied vector by vector.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCycleMultiVector( void              *amg_vdata,
+                                 hypre_ParVector  **F_mv_array,
+                                 hypre_ParVector  **U_mv_array )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   hypre_ParCSRMatrix **A_array           = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array           = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array           = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParVector    **Vtemp_mv_array    = hypre_ParAMGDataVtempMVArray(amg_data);
+   hypre_ParVector     *Vtemp             = hypre_ParAMGDataVtemp(amg_data);
+   HYPRE_Int          **CF_marker_array   = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels        = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            max_levels        = hypre_ParAMGDataMaxLevels(amg_data);
+   HYPRE_Int            cycle_type        = hypre_ParAMGDataCycleType(amg_data);
+   HYPRE_Int            fcycle            = hypre_ParAMGDataFCycle(amg_data);
+   HYPRE_Int           *num_grid_sweeps   = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int           *grid_relax_type   = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int          **grid_relax_points = hypre_ParAMGDataGridRelaxPoints(amg_data);
+   HYPRE_Int            relax_order       = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Real          *relax_weight      = hypre_ParAMGDataRelaxWeight(amg_data);
+   HYPRE_Real          *omega             = hypre_ParAMGDataOmega(amg_data);
+   hypre_Vector       **l1_norms          = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Int            restri_type       = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Int            partial_cycle_coarsest_level = hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data);
+   HYPRE_Int            partial_cycle_control        = hypre_ParAMGDataPartialCycleControl(amg_data);
+   HYPRE_Real           cycle_op_count    = hypre_ParAMGDataCycleOpCount(amg_data);
+
+   HYPRE_Int           *lev_counter;
+   HYPRE_Real          *num_coeffs;
+   HYPRE_Real          *l1_norms_level;
+   HYPRE_Int            Solve_err_flag = 0;
+   HYPRE_Int            old_version = grid_relax_points ? 1 : 0;
+   HYPRE_Int            k, j, level, cycle_param, fcycle_lev;
+   HYPRE_Int            fine_grid, coarse_grid, Not_Finished;
+   HYPRE_Int            num_sweep, relax_type, relax_points = 0, relax_local;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   num_coeffs  = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_levels; j++)
+   {
+      num_coeffs[j] = hypre_ParCSRMatrixDNumNonzeros(A_array[j]);
+   }
+
+   /* cycling control: see hypre_BoomerAMGCycle */
+   Not_Finished = 1;
+   lev_counter[0] = 1;
+   for (k = 1; k < num_levels; ++k)
+   {
+      lev_counter[k] = fcycle ? 1 : cycle_type;
+   }
+   fcycle_lev = num_levels - 2;
+   level = 0;
+   cycle_param = 1;
+
+   if (partial_cycle_coarsest_level >= 0 && partial_cycle_control != 0)
+   {
+      level = partial_cycle_coarsest_level;
+      cycle_param = level == num_levels - 1 ? 3 : 2;
+      for (k = 0; k < num_levels; ++k)
+      {
+         lev_counter[k] = 0;
+      }
+   }
+
+   HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+   while (Not_Finished)
+   {
+      if (num_levels > 1)
+      {
+         num_sweep  = num_grid_sweeps[cycle_param];
+         relax_type = grid_relax_type[cycle_param];
+      }
+      else
+      {
+         /* If no coarsening occurred, apply a simple smoother once */
+         num_sweep  = 1;
+         relax_type = hypre_ParAMGDataUserRelaxType(amg_data);
+         if (relax_type == -1)
+         {
+            relax_type = 6;
+         }
+      }
+
+      l1_norms_level = (l1_norms && l1_norms[level]) ? hypre_VectorData(l1_norms[level]) : NULL;
+
+      /* the multivector smoothers read the double precision values */
+      if (hypre_BoomerAMGRelaxMultiVectorSupported(relax_type) &&
+          !hypre_CSRMatrixSingleData(hypre_ParCSRMatrixDiag(A_array[level])))
+      {
+         for (j = 0; j < num_sweep; j++)
+         {
+            if (num_levels == 1 && max_levels > 1)
+            {
+               relax_points = 0;
+               relax_local = 0;
+            }
+            else
+            {
+               if (old_version)
+               {
+                  relax_points = grid_relax_points[cycle_param][j];
+               }
+               relax_local = relax_order;
+            }
+            cycle_op_count += num_coeffs[level];
+
+            if (old_version && relax_type != 18)
+            {
+               hypre_BoomerAMGRelaxMultiVector(A_array[level], F_mv_array[level], CF_marker_array[level],
+                                               relax_type, relax_points, relax_weight[level], omega[level],
+                                               l1_norms_level, U_mv_array[level], Vtemp_mv_array[level]);
+            }
+            else
+            {
+               hypre_BoomerAMGRelaxMultiVectorIF(A_array[level], F_mv_array[level], CF_marker_array[level],
+                                                 relax_type, relax_type == 18 ? relax_order : relax_local,
+                                                 cycle_param, relax_weight[level], omega[level],
+                                                 l1_norms_level, U_mv_array[level], Vtemp_mv_array[level]);
+            }
+         }
+      }
+      else
+      {
+         hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) =
+            hypre_VectorSize(hypre_ParVectorLocalVector(hypre_ParAMGDataFArray(amg_data)[level]));
+         cycle_op_count += num_sweep * num_coeffs[level];
+
+         Solve_err_flag = hypre_BoomerAMGMultiVectorRelaxColumns(amg_data, level, cycle_param, relax_type,
+                                                                 num_sweep, F_mv_array[level],
+                                                                 U_mv_array[level]);
+         if (Solve_err_flag != 0)
+         {
+            break;
+         }
+      }
+
+      /*------------------------------------------------------------------
+       * Decrement the control counter and determine which grid to visit next
+       *-----------------------------------------------------------------*/
+
+      --lev_counter[level];
+
+      if (lev_counter[level] >= 0 && level != num_levels - 1)
+      {
+         /* restrict the residual of all the vectors */
+         fine_grid = level;
+         coarse_grid = level + 1;
+
+         hypre_ParVectorSetConstantValues(U_mv_array[coarse_grid], 0.0);
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A_array[fine_grid], U_mv_array[fine_grid],
+                                            1.0, F_mv_array[fine_grid], Vtemp_mv_array[fine_grid]);
+         if (restri_type)
+         {
+            hypre_ParCSRMatrixMatvec(1.0, R_array[fine_grid], Vtemp_mv_array[fine_grid],
+                                     0.0, F_mv_array[coarse_grid]);
+         }
+         else
+         {
+            hypre_ParCSRMatrixMatvecT(1.0, R_array[fine_grid], Vtemp_mv_array[fine_grid],
+                                      0.0, F_mv_array[coarse_grid]);
+         }
+
+         HYPRE_ANNOTATE_MGLEVEL_END(level);
+
+         ++level;
+         lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
+         cycle_param = level == num_levels - 1 ? 3 : 1;
+         if (partial_cycle_coarsest_level >= 0 && level == partial_cycle_coarsest_level + 1)
+         {
+            Not_Finished = 0;
+         }
+
+         HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+      }
+      else if (level != 0)
+      {
+         /* interpolate and add the corrections of all the vectors */
+         fine_grid = level - 1;
+         coarse_grid = level;
+
+         hypre_ParCSRMatrixMatvec(1.0, P_array[fine_grid], U_mv_array[coarse_grid],
+                                  1.0, U_mv_array[fine_grid]);
+
+         HYPRE_ANNOTATE_MGLEVEL_END(level);
+
+         --level;
+         cycle_param = 2;
+         if (fcycle && fcycle_lev == level)
+         {
+            lev_counter[level] = hypre_max(lev_counter[level], 1);
+            fcycle_lev--;
+         }
+
+         HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+      }
+      else
+      {
+         Not_Finished = 0;
+      }
+   } /* main loop: while (Not_Finished) */
+
+   HYPRE_ANNOTATE_MGLEVEL_END(level);
+
+   /* the single-vector Vtemp is resized by the column-wise smoothers */
+   hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) = hypre_ParVectorActualLocalSize(Vtemp);
+
+   hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
+
+   hypre_TFree(lev_counter, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return Solve_err_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSolveMultiVector
+ *
+ * Solves A u = f for all the vectors of the multivectors f and u, cycling
+ * on all of them at once. Convergence is tested per vector, with the norms
+ * of all the vectors computed in one reduction, and the iteration stops
+ * when the largest relative residual is below tol; the printed residual is
+ * the largest one. Configurations the multivector cycle does not cover
+ * (block, additive and smoothed-level variants, redundant or SuperLU coarse
+ * solves, device memory) are solved one vector at a time.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSolveMultiVector( void               *amg_vdata,
+                                 hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *f,
+                                 hypre_ParVector    *u )
+{
+   MPI_Comm             comm         = hypre_ParCSRMatrixComm(A);
+   hypre_ParAMGData    *amg_data     = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            amg_print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   HYPRE_Int            num_levels   = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            converge_type = hypre_ParAMGDataConvergeType(amg_data);
+   HYPRE_Real           tol          = hypre_ParAMGDataTol(amg_data);
+   HYPRE_Int            min_iter     = hypre_ParAMGDataMinIter(amg_data);
+   HYPRE_Int            max_iter     = hypre_ParAMGDataMaxIter(amg_data);
+   HYPRE_Int            additive     = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int            mult_additive = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int            simple       = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int            num_vectors  = hypre_ParVectorNumVectors(f);
+   hypre_Vector        *f_local      = hypre_ParVectorLocalVector(f);
+   hypre_Vector        *u_local      = hypre_ParVectorLocalVector(u);
+   hypre_ParCSRMatrix **A_array      = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParVector    **F_mv_array;
+   hypre_ParVector    **U_mv_array;
+   hypre_ParVector     *F_array0, *U_array0;
+   hypre_ParVector     *Vtemp;
+   HYPRE_Real          *resid_nrm, *resid_nrm_init, *rhs_norm;
+   HYPRE_Real           max_resid = 1.0, max_resid_init = 0.0, old_resid;
+   HYPRE_Real           relative_resid, conv_factor = 0.0;
+   HYPRE_Int            cycle_count = 0, Solve_err_flag = 0;
+   HYPRE_Int            my_id, jv, column_wise = 0;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (hypre_ParVectorNumVectors(u) != num_vectors ||
+       hypre_VectorVectorStride(f_local) != hypre_VectorVectorStride(u_local) ||
+       hypre_VectorIndexStride(f_local) != hypre_VectorIndexStride(u_local))
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   column_wise = 1;
+#endif
+   if ( hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+        hypre_ParAMGDataParticipate(amg_data) ||
+        (additive      >= 0 && additive      < num_levels) ||
+        (mult_additive >= 0 && mult_additive < num_levels) ||
+        (simple        >= 0 && simple        < num_levels) )
+   {
+      column_wise = 1;
+   }
+#ifdef HYPRE_USING_DSUPERLU
+   if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
+   {
+      column_wise = 1;
+   }
+#endif
+
+   A_array[0] = A;
+
+   if (column_wise)
+   {
+      hypre_ParVector *f_column, *u_column;
+      HYPRE_Real       max_relres = 0.0;
+      HYPRE_Int        max_count = 0;
+
+      hypre_BoomerAMGMultiVectorColumnsCreate(amg_data, A, f);
+      f_column = hypre_ParAMGDataFColumn(amg_data);
+      u_column = hypre_ParAMGDataUColumn(amg_data);
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         hypre_BoomerAMGMultiVectorGetColumn(f, jv, f_column);
+         hypre_BoomerAMGMultiVectorGetColumn(u, jv, u_column);
+         hypre_BoomerAMGSolve(amg_data, A, f_column, u_column);
+         hypre_BoomerAMGMultiVectorSetColumn(u, jv, u_column);
+
+         max_count  = hypre_max(max_count, hypre_ParAMGDataNumIterations(amg_data));
+         max_relres = hypre_max(max_relres, hypre_ParAMGDataRelativeResidualNorm(amg_data));
+      }
+      hypre_ParAMGDataNumIterations(amg_data) = max_count;
+      hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_relres;
+
+      return hypre_error_flag;
+   }
+
+   hypre_BoomerAMGMultiVectorDataCreate(amg_data, f);
+   hypre_BoomerAMGMultiVectorColumnsCreate(amg_data, A, f);
+   F_mv_array = hypre_ParAMGDataFMVArray(amg_data);
+   U_mv_array = hypre_ParAMGDataUMVArray(amg_data);
+   Vtemp      = hypre_ParAMGDataVtempMVArray(amg_data)[0];
+
+   /* the single-vector level-0 work vectors, used by the column-wise smoothers;
+    * the single-vector solve's f and u are put back before returning */
+   F_array0 = hypre_ParAMGDataFArray(amg_data)[0];
+   U_array0 = hypre_ParAMGDataUArray(amg_data)[0];
+   hypre_ParAMGDataFArray(amg_data)[0] = hypre_ParAMGDataFColumn(amg_data);
+   hypre_ParAMGDataUArray(amg_data)[0] = hypre_ParAMGDataUColumn(amg_data);
+   F_mv_array[0] = f;
+   U_mv_array[0] = u;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (my_id == 0 && amg_print_level > 1)
+   {
+      hypre_BoomerAMGWriteSolverParams(amg_data);
+   }
+
+   resid_nrm      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   resid_nrm_init = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   rhs_norm       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    *    Compute initial fine-grid residuals
+    *-----------------------------------------------------------------------*/
+
+   relative_resid = 1.0;
+   if (amg_print_level > 1 || tol > 0.)
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, Vtemp);
+      hypre_BoomerAMGMultiVectorColumnNorms(Vtemp, resid_nrm_init);
+
+      max_resid_init = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         HYPRE_Real ieee_check = resid_nrm_init[jv] != 0. ? resid_nrm_init[jv] / resid_nrm_init[jv] : 0.;
+         if (ieee_check != ieee_check)
+         {
+            if (amg_print_level > 0)
+            {
+               hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+               hypre_printf("ERROR -- hypre_BoomerAMGSolveMultiVector: INFs and/or NaNs detected in input.\n");
+               hypre_printf("User probably placed non-numerics in supplied A, x_0, or b.\n");
+               hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            F_mv_array[0] = NULL;
+            U_mv_array[0] = NULL;
+            hypre_ParAMGDataFArray(amg_data)[0] = F_array0;
+            hypre_ParAMGDataUArray(amg_data)[0] = U_array0;
+            hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+            hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+            hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+            HYPRE_ANNOTATE_FUNC_END;
+
+            return hypre_error_flag;
+         }
+         max_resid_init = hypre_max(max_resid_init, resid_nrm_init[jv]);
+      }
+      max_resid = max_resid_init;
+
+      if (0 == converge_type)
+      {
+         hypre_BoomerAMGMultiVectorColumnNorms(f, rhs_norm);
+         relative_resid = 0.0;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            relative_resid = hypre_max(relative_resid, rhs_norm[jv] ?
+                                       resid_nrm_init[jv] / rhs_norm[jv] : resid_nrm_init[jv]);
+         }
+      }
+   }
+
+   if (my_id == 0 && amg_print_level > 1)
+   {
+      hypre_printf("\n\nAMG SOLUTION INFO (%d vectors, largest residual):\n", num_vectors);
+      hypre_printf("                                            relative\n");
+      hypre_printf("               residual        factor       residual\n");
+      hypre_printf("               --------        ------       --------\n");
+      hypre_printf("    Initial    %e                 %e\n", max_resid_init, relative_resid);
+   }
+
+   /*-----------------------------------------------------------------------
+    *    Main cycle loop
+    *-----------------------------------------------------------------------*/
+
+   while ( (relative_resid >= tol || cycle_count < min_iter) && cycle_count < max_iter )
+   {
+      hypre_ParAMGDataCycleOpCount(amg_data) = 0;
+      Solve_err_flag = hypre_BoomerAMGCycleMultiVector(amg_data, F_mv_array, U_mv_array);
+      if (Solve_err_flag)
+      {
+         break;
+      }
+
+      if (amg_print_level > 1 || tol > 0.)
+      {
+         old_resid = max_resid;
+
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, Vtemp);
+         hypre_BoomerAMGMultiVectorColumnNorms(Vtemp, resid_nrm);
+
+         max_resid = 0.0;
+         relative_resid = 0.0;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            HYPRE_Real denom = converge_type == 0 ? rhs_norm[jv] : resid_nrm_init[jv];
+
+            max_resid = hypre_max(max_resid, resid_nrm[jv]);
+            relative_resid = hypre_max(relative_resid, denom ? resid_nrm[jv] / denom : resid_nrm[jv]);
+         }
+         conv_factor = old_resid ? max_resid / old_resid : max_resid;
+
+         hypre_ParAMGDataRelativeResidualNorm(amg_data) = relative_resid;
+      }
+
+      ++cycle_count;
+      hypre_ParAMGDataNumIterations(amg_data) = cycle_count;
+
+      if (my_id == 0 && amg_print_level > 1)
+      {
+         hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
+                      max_resid, conv_factor, relative_resid);
+      }
+   }
+
+   if (cycle_count == max_iter && tol > 0.)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+      if (my_id == 0 && amg_print_level > 1)
+      {
+         hypre_printf("\n\n==============================================");
+         hypre_printf("\n NOTE: Convergence tolerance was not achieved\n");
+         hypre_printf("      within the allowed %d V-cycles\n", max_iter);
+         hypre_printf("==============================================\n\n");
+      }
+   }
+
+   F_mv_array[0] = NULL;
+   U_mv_array[0] = NULL;
+   hypre_ParAMGDataFArray(amg_data)[0] = F_array0;
+   hypre_ParAMGDataUArray(amg_data)[0] = U_array0;
+
+   hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+   hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,635 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Restarted, right-preconditioned GMRES for several right-hand sides at once.
+ *
+ * As in the block PCG solver, each vector of the multivectors b and x has
+ * its own recurrence (its own Krylov basis and Hessenberg matrix), but the
+ * vectors share every matvec, every preconditioner application and every
+ * reduction. The basis is orthogonalized with classical Gram-Schmidt and
+ * one reorthogonalization pass, which needs two reductions per iteration
+ * for all the vectors. A vector whose residual estimate drops below tol
+ * stops extending its basis for the rest of the restart cycle.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESData
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm              comm;
+   HYPRE_Real            tol;
+   HYPRE_Int             max_iter;
+   HYPRE_Int             k_dim;
+
+   HYPRE_Int           (*precond)(void*,void*,void*,void*);
+   HYPRE_Int           (*precond_setup)(void*,void*,void*,void*);
+   void                 *precond_data;
+
+   hypre_ParCSRMatrix   *A;
+   hypre_ParVector      *w;
+   hypre_ParVector     **v;
+
+   /* log info */
+   HYPRE_Int             num_iterations;
+   HYPRE_Real            rel_residual_norm;
+   HYPRE_Int             print_level;
+   HYPRE_Int             logging;
+} hypre_ParCSRBlockGMRESData;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ParCSRBlockGMRESCreate( MPI_Comm comm )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data;
+
+   gmres_data = hypre_CTAlloc(hypre_ParCSRBlockGMRESData, 1, HYPRE_MEMORY_HOST);
+
+   /* set defaults */
+   (gmres_data -> comm)              = comm;
+   (gmres_data -> tol)               = 1.0e-06;
+   (gmres_data -> max_iter)          = 1000;
+   (gmres_data -> k_dim)             = 5;
+   (gmres_data -> precond)           = NULL;
+   (gmres_data -> precond_setup)     = NULL;
+   (gmres_data -> precond_data)      = NULL;
+   (gmres_data -> w)                 = NULL;
+   (gmres_data -> v)                 = NULL;
+   (gmres_data -> print_level)       = 0;
+   (gmres_data -> logging)           = 0;
+   (gmres_data -> num_iterations)    = 0;
+   (gmres_data -> rel_residual_norm) = 0.0;
+
+   return (void *) gmres_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESFreeVectors
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRBlockGMRESFreeVectors( hypre_ParCSRBlockGMRESData *gmres_data )
+{
+   HYPRE_Int i;
+
+   if (gmres_data -> v)
+   {
+      for (i = 0; i < (gmres_data -> k_dim) + 1; i++)
+      {
+         hypre_ParVectorDestroy((gmres_data -> v)[i]);
+      }
+      hypre_TFree(gmres_data -> v, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParVectorDestroy(gmres_data -> w);
+   (gmres_data -> w) = NULL;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESDestroy( void *gmres_vdata )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (gmres_data)
+   {
+      hypre_ParCSRBlockGMRESFreeVectors(gmres_data);
+      hypre_TFree(gmres_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESSetup( void               *gmres_vdata,
+                             hypre_ParCSRMatrix *A,
+                             hypre_ParVector    *b,
+                             hypre_ParVector    *x )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+   HYPRE_Int                   k_dim;
+   HYPRE_Int                   i;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   k_dim = (gmres_data -> k_dim);
+
+   (gmres_data -> A) = A;
+
+   hypre_ParCSRBlockGMRESFreeVectors(gmres_data);
+   (gmres_data -> w) = hypre_ParCSRBlockKrylovWorkVector(b);
+   (gmres_data -> v) = hypre_CTAlloc(hypre_ParVector *, k_dim + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < k_dim + 1; i++)
+   {
+      (gmres_data -> v)[i] = hypre_ParCSRBlockKrylovWorkVector(b);
+   }
+
+   if (gmres_data -> precond_setup)
+   {
+      (gmres_data -> precond_setup)(gmres_data -> precond_data, A, b, x);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESSolve
+ *
+ * Each iteration has one preconditioner application and one matvec on the
+ * multivector basis, and two reductions for all the vectors: the first
+ * Gram-Schmidt pass, then the second pass together with <w,w>, from which
+ * the norm of the new basis vector follows. The Hessenberg matrices are
+ * small and are reduced on every rank. The stopping test is the relative
+ * residual ||r||/||b|| of every vector; the restart recomputes the true
+ * residuals.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESSolve( void               *gmres_vdata,
+                             hypre_ParCSRMatrix *A,
+                             hypre_ParVector    *b,
+                             hypre_ParVector    *x )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   MPI_Comm           comm         = (gmres_data -> comm);
+   HYPRE_Real         tol          = (gmres_data -> tol);
+   HYPRE_Int          max_iter     = (gmres_data -> max_iter);
+   HYPRE_Int          k_dim        = (gmres_data -> k_dim);
+   HYPRE_Int          print_level  = (gmres_data -> print_level);
+   void              *precond_data = (gmres_data -> precond_data);
+   HYPRE_Int        (*precond)(void*,void*,void*,void*) = (gmres_data -> precond);
+   hypre_ParVector   *w            = (gmres_data -> w);
+   hypre_ParVector  **v            = (gmres_data -> v);
+   HYPRE_Int          num_vectors  = hypre_ParVectorNumVectors(b);
+
+   /* hh[(i * (k_dim + 1) + l) * num_vectors + jv] is entry (l,i) of the
+    * Hessenberg matrix of vector jv; rs is the rotated right-hand side */
+   HYPRE_Real        *hh, *c, *s, *rs;
+   HYPRE_Real        *local_dots, *dots, *bnorm, *coef, *zero;
+   HYPRE_Int         *num_steps, *active;
+   HYPRE_Real         max_relres = 0.0, relres, hnext, gam, t;
+   HYPRE_Int          num_active, iter, first, i, l, m, jv, my_id;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (!v || hypre_ParVectorNumVectors(w) != num_vectors ||
+       hypre_ParVectorNumVectors(x) != num_vectors ||
+       hypre_VectorVectorStride(hypre_ParVectorLocalVector(x)) !=
+       hypre_VectorVectorStride(hypre_ParVectorLocalVector(b)))
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hh         = hypre_CTAlloc(HYPRE_Real, (k_dim + 1) * k_dim * num_vectors, HYPRE_MEMORY_HOST);
+   c          = hypre_CTAlloc(HYPRE_Real, k_dim * num_vectors, HYPRE_MEMORY_HOST);
+   s          = hypre_CTAlloc(HYPRE_Real, k_dim * num_vectors, HYPRE_MEMORY_HOST);
+   rs         = hypre_CTAlloc(HYPRE_Real, (k_dim + 1) * num_vectors, HYPRE_MEMORY_HOST);
+   local_dots = hypre_CTAlloc(HYPRE_Real, (k_dim + 2) * num_vectors, HYPRE_MEMORY_HOST);
+   dots       = hypre_CTAlloc(HYPRE_Real, (k_dim + 2) * num_vectors, HYPRE_MEMORY_HOST);
+   bnorm      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   coef       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   zero       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   num_steps  = hypre_CTAlloc(HYPRE_Int, num_vectors, HYPRE_MEMORY_HOST);
+   active     = hypre_CTAlloc(HYPRE_Int, num_vectors, HYPRE_MEMORY_HOST);
+
+   /* ||b|| */
+   hypre_ParCSRBlockKrylovLocalDots(b, b, local_dots);
+   hypre_MPI_Allreduce(local_dots, bnorm, num_vectors, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      bnorm[jv] = sqrt(bnorm[jv]);
+
+      /* a zero right-hand side has the solution zero */
+      coef[jv] = bnorm[jv] == 0.0 ? 0.0 : 1.0;
+   }
+   hypre_ParCSRBlockKrylovAxpby(zero, b, coef, x);
+
+   iter  = 0;
+   first = 1;
+   while (1)
+   {
+      /* v_0 = b - A x and its norm, the true residual of every vector */
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, x, 1.0, b, v[0]);
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         local_dots[jv] = 0.0;
+      }
+      hypre_ParCSRBlockKrylovLocalDots(v[0], v[0], local_dots);
+      hypre_MPI_Allreduce(local_dots, dots, num_vectors, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+      num_active = 0;
+      max_relres = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         dots[jv]      = sqrt(dots[jv]);
+         relres        = bnorm[jv] > 0.0 ? dots[jv] / bnorm[jv] : 0.0;
+         active[jv]    = relres >= tol && dots[jv] > 0.0;
+         num_active   += active[jv];
+         max_relres    = hypre_max(max_relres, relres);
+         num_steps[jv] = 0;
+         rs[jv]        = active[jv] ? dots[jv] : 0.0;
+         coef[jv]      = active[jv] ? 1.0 / dots[jv] : 0.0;
+      }
+
+      if (my_id == 0 && print_level > 1)
+      {
+         if (first)
+         {
+            hypre_printf("\n\nBlock GMRES with %d right-hand sides (largest relative residual)\n",
+                         num_vectors);
+            hypre_printf("Iters   active    max ||r||_2/||b||_2\n");
+            hypre_printf("-----   ------    -------------------\n");
+         }
+         hypre_printf("% 5d   % 6d    %e\n", iter, num_active, max_relres);
+      }
+      first = 0;
+
+      if (num_active == 0 || iter >= max_iter)
+      {
+         break;
+      }
+
+      /* v_0 = r / ||r||; vectors that are not iterating are zero */
+      hypre_ParCSRBlockKrylovAxpby(coef, v[0], zero, v[0]);
+
+      for (i = 0; i < k_dim && num_active > 0 && iter < max_iter; i++)
+      {
+         iter++;
+
+         /* v_{i+1} = A C v_i */
+         if (precond)
+         {
+            hypre_ParVectorSetConstantValues(w, 0.0);
+            precond(precond_data, A, v[i], w);
+         }
+         else
+         {
+            hypre_ParVectorCopy(v[i], w);
+         }
+         hypre_ParCSRMatrixMatvec(1.0, A, w, 0.0, v[i + 1]);
+
+         /* classical Gram-Schmidt, twice; the second pass also computes
+          * <v_{i+1}, v_{i+1}> so that the new norm needs no extra reduction */
+         for (m = 0; m < 2; m++)
+         {
+            for (l = 0; l < (i + 2) * num_vectors; l++)
+            {
+               local_dots[l] = 0.0;
+            }
+            for (l = 0; l <= i; l++)
+            {
+               hypre_ParCSRBlockKrylovLocalDots(v[i + 1], v[l], local_dots + l * num_vectors);
+            }
+            if (m == 1)
+            {
+               hypre_ParCSRBlockKrylovLocalDots(v[i + 1], v[i + 1], local_dots + (i + 1) * num_vectors);
+            }
+            hypre_MPI_Allreduce(local_dots, dots, (i + 1 + m) * num_vectors,
+                                HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+            for (l = 0; l <= i; l++)
+            {
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  hh[(i * (k_dim + 1) + l) * num_vectors + jv] =
+                     (m == 0 ? 0.0 : hh[(i * (k_dim + 1) + l) * num_vectors + jv]) +
+                     dots[l * num_vectors + jv];
+                  coef[jv] = -dots[l * num_vectors + jv];
+               }
+               hypre_ParCSRBlockKrylovAxpby(coef, v[l], NULL, v[i + 1]);
+            }
+         }
+
+         /* ||v_{i+1}||^2 = <w,w> - sum_l <w,v_l>^2 for the second-pass w */
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            t = dots[(i + 1) * num_vectors + jv];
+            for (l = 0; l <= i; l++)
+            {
+               t -= dots[l * num_vectors + jv] * dots[l * num_vectors + jv];
+            }
+            hnext = t > 0.0 ? sqrt(t) : 0.0;
+            hh[(i * (k_dim + 1) + i + 1) * num_vectors + jv] = hnext;
+            coef[jv] = (active[jv] && hnext > 0.0) ? 1.0 / hnext : 0.0;
+         }
+         hypre_ParCSRBlockKrylovAxpby(coef, v[i + 1], zero, v[i + 1]);
+
+         /* Givens rotations and residual estimates */
+         num_active = 0;
+         max_relres = 0.0;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            HYPRE_Real *h = hh + i * (k_dim + 1) * num_vectors + jv;
+
+            if (!active[jv])
+            {
+               max_relres = hypre_max(max_relres, bnorm[jv] > 0.0 ?
+                                      hypre_abs(rs[num_steps[jv] * num_vectors + jv]) / bnorm[jv] : 0.0);
+               continue;
+            }
+
+            for (l = 0; l < i; l++)
+            {
+               t = c[l * num_vectors + jv] * h[l * num_vectors] +
+                   s[l * num_vectors + jv] * h[(l + 1) * num_vectors];
+               h[(l + 1) * num_vectors] = -s[l * num_vectors + jv] * h[l * num_vectors] +
+                                          c[l * num_vectors + jv] * h[(l + 1) * num_vectors];
+               h[l * num_vectors] = t;
+            }
+            hnext = h[(i + 1) * num_vectors];
+            gam   = sqrt(h[i * num_vectors] * h[i * num_vectors] + hnext * hnext);
+            if (gam == 0.0)
+            {
+               gam = HYPRE_REAL_EPSILON;
+            }
+            c[i * num_vectors + jv] = h[i * num_vectors] / gam;
+            s[i * num_vectors + jv] = hnext / gam;
+            rs[(i + 1) * num_vectors + jv] = -s[i * num_vectors + jv] * rs[i * num_vectors + jv];
+            rs[i * num_vectors + jv]       =  c[i * num_vectors + jv] * rs[i * num_vectors + jv];
+            h[i * num_vectors] = gam;
+            num_steps[jv] = i + 1;
+
+            relres = hypre_abs(rs[(i + 1) * num_vectors + jv]) / bnorm[jv];
+            max_relres = hypre_max(max_relres, relres);
+            if (relres < tol || hnext == 0.0)
+            {
+               active[jv] = 0;
+            }
+            num_active += active[jv];
+         }
+
+         if (my_id == 0 && print_level > 1)
+         {
+            hypre_printf("% 5d   % 6d    %e\n", iter, num_active, max_relres);
+         }
+      }
+
+      /* x += C (V y), with H y = rs solved separately for every vector */
+      m = 0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         for (l = num_steps[jv] - 1; l >= 0; l--)
+         {
+            t = rs[l * num_vectors + jv];
+            for (i = l + 1; i < num_steps[jv]; i++)
+            {
+               t -= hh[(i * (k_dim + 1) + l) * num_vectors + jv] * rs[i * num_vectors + jv];
+            }
+            rs[l * num_vectors + jv] = t / hh[(l * (k_dim + 1) + l) * num_vectors + jv];
+         }
+         m = hypre_max(m, num_steps[jv]);
+      }
+
+      hypre_ParVectorSetConstantValues(w, 0.0);
+      for (l = 0; l < m; l++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            coef[jv] = l < num_steps[jv] ? rs[l * num_vectors + jv] : 0.0;
+         }
+         hypre_ParCSRBlockKrylovAxpby(coef, v[l], NULL, w);
+      }
+      if (precond)
+      {
+         hypre_ParVectorSetConstantValues(v[0], 0.0);
+         precond(precond_data, A, w, v[0]);
+         hypre_ParVectorAxpy(1.0, v[0], x);
+      }
+      else
+      {
+         hypre_ParVectorAxpy(1.0, w, x);
+      }
+   }
+
+   (gmres_data -> num_iterations)    = iter;
+   (gmres_data -> rel_residual_norm) = max_relres;
+
+   if (my_id == 0 && print_level > 0)
+   {
+      hypre_printf("Block GMRES: %d iterations, largest relative residual %e\n", iter, max_relres);
+   }
+
+   if (num_active > 0)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_TFree(hh, HYPRE_MEMORY_HOST);
+   hypre_TFree(c, HYPRE_MEMORY_HOST);
+   hypre_TFree(s, HYPRE_MEMORY_HOST);
+   hypre_TFree(rs, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_dots, HYPRE_MEMORY_HOST);
+   hypre_TFree(dots, HYPRE_MEMORY_HOST);
+   hypre_TFree(bnorm, HYPRE_MEMORY_HOST);
+   hypre_TFree(coef, HYPRE_MEMORY_HOST);
+   hypre_TFree(zero, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_steps, HYPRE_MEMORY_HOST);
+   hypre_TFree(active, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESSetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESSetKDim( void      *gmres_vdata,
+                               HYPRE_Int  k_dim )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (k_dim < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   /* the basis is sized for k_dim; it is reallocated by the next setup */
+   hypre_ParCSRBlockGMRESFreeVectors(gmres_data);
+   (gmres_data -> k_dim) = k_dim;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESSetTol( void       *gmres_vdata,
+                              HYPRE_Real  tol )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (tol < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (gmres_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESSetMaxIter( void      *gmres_vdata,
+                                  HYPRE_Int  max_iter )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (max_iter < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (gmres_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESSetPrecond( void  *gmres_vdata,
+                                  HYPRE_Int (*precond)(void*,void*,void*,void*),
+                                  HYPRE_Int (*precond_setup)(void*,void*,void*,void*),
+                                  void  *precond_data )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   (gmres_data -> precond)       = precond;
+   (gmres_data -> precond_setup) = precond_setup;
+   (gmres_data -> precond_data)  = precond_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESSetPrintLevel( void      *gmres_vdata,
+                                     HYPRE_Int  print_level )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   (gmres_data -> print_level) = print_level;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESSetLogging( void      *gmres_vdata,
+                                  HYPRE_Int  logging )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   (gmres_data -> logging) = logging;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESGetNumIterations( void      *gmres_vdata,
+                                        HYPRE_Int *num_iterations )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *num_iterations = (gmres_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockGMRESGetFinalRelativeResidualNorm( void       *gmres_vdata,
+                                                    HYPRE_Real *relative_residual_norm )
+{
+   hypre_ParCSRBlockGMRESData *gmres_data = (hypre_ParCSRBlockGMRESData *) gmres_vdata;
+
+   if (!gmres_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *relative_residual_norm = (gmres_data -> rel_residual_norm);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,590 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Preconditioned conjugate gradient for several right-hand sides at once.
+ *
+ * The right-hand sides and solutions are multivectors. Each vector has its
+ * own CG recurrence, but the recurrences share every matvec, every
+ * preconditioner application and every reduction: the inner products of
+ * all the vectors are computed in one MPI_Allreduce. Vectors that have
+ * converged are frozen (their step lengths are zero) while the others
+ * continue.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGData
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm              comm;
+   HYPRE_Real            tol;
+   HYPRE_Int             max_iter;
+
+   HYPRE_Int           (*precond)(void*,void*,void*,void*);
+   HYPRE_Int           (*precond_setup)(void*,void*,void*,void*);
+   void                 *precond_data;
+
+   hypre_ParCSRMatrix   *A;
+   hypre_ParVector      *r;
+   hypre_ParVector      *z;
+   hypre_ParVector      *p;
+   hypre_ParVector      *s;
+
+   /* log info */
+   HYPRE_Int             num_iterations;
+   HYPRE_Real            rel_residual_norm;
+   HYPRE_Int             print_level;
+   HYPRE_Int             logging;
+} hypre_ParCSRBlockPCGData;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ParCSRBlockPCGCreate( MPI_Comm comm )
+{
+   hypre_ParCSRBlockPCGData *pcg_data;
+
+   pcg_data = hypre_CTAlloc(hypre_ParCSRBlockPCGData, 1, HYPRE_MEMORY_HOST);
+
+   /* set defaults */
+   (pcg_data -> comm)              = comm;
+   (pcg_data -> tol)               = 1.0e-06;
+   (pcg_data -> max_iter)          = 1000;
+   (pcg_data -> precond)           = NULL;
+   (pcg_data -> precond_setup)     = NULL;
+   (pcg_data -> precond_data)      = NULL;
+   (pcg_data -> print_level)       = 0;
+   (pcg_data -> logging)           = 0;
+   (pcg_data -> num_iterations)    = 0;
+   (pcg_data -> rel_residual_norm) = 0.0;
+
+   return (void *) pcg_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGDestroy( void *pcg_vdata )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (pcg_data)
+   {
+      hypre_ParVectorDestroy(pcg_data -> r);
+      hypre_ParVectorDestroy(pcg_data -> z);
+      hypre_ParVectorDestroy(pcg_data -> p);
+      hypre_ParVectorDestroy(pcg_data -> s);
+      hypre_TFree(pcg_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockKrylovWorkVector
+ *
+ * Work multivector with the shape and storage of b. This and the two
+ * helpers below are shared with the block GMRES solver.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVector *
+hypre_ParCSRBlockKrylovWorkVector( hypre_ParVector *b )
+{
+   hypre_ParVector *vector;
+
+   vector = hypre_ParMultiVectorCreate(hypre_ParVectorComm(b),
+                                       hypre_ParVectorGlobalSize(b),
+                                       hypre_ParVectorPartitioning(b),
+                                       hypre_ParVectorNumVectors(b));
+   hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(vector)) =
+      hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(b));
+   hypre_ParVectorInitialize_v2(vector, hypre_ParVectorMemoryLocation(b));
+   hypre_ParVectorSetPartitioningOwner(vector, 0);
+
+   return vector;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGSetup( void               *pcg_vdata,
+                           hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *b,
+                           hypre_ParVector    *x )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (!pcg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   (pcg_data -> A) = A;
+
+   hypre_ParVectorDestroy(pcg_data -> r);
+   hypre_ParVectorDestroy(pcg_data -> z);
+   hypre_ParVectorDestroy(pcg_data -> p);
+   hypre_ParVectorDestroy(pcg_data -> s);
+   (pcg_data -> r) = hypre_ParCSRBlockKrylovWorkVector(b);
+   (pcg_data -> z) = hypre_ParCSRBlockKrylovWorkVector(b);
+   (pcg_data -> p) = hypre_ParCSRBlockKrylovWorkVector(b);
+   (pcg_data -> s) = hypre_ParCSRBlockKrylovWorkVector(b);
+
+   if (pcg_data -> precond_setup)
+   {
+      (pcg_data -> precond_setup)(pcg_data -> precond_data, A, b, x);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockKrylovLocalDots
+ *
+ * dots[jv] += <x_jv, y_jv> over the local rows (no reduction).
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParCSRBlockKrylovLocalDots( hypre_ParVector *x,
+                                  hypre_ParVector *y,
+                                  HYPRE_Real      *dots )
+{
+   hypre_Vector  *x_local     = hypre_ParVectorLocalVector(x);
+   HYPRE_Complex *x_data      = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data      = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Int      vecstride   = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      idxstride   = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      size        = hypre_VectorSize(x_local);
+   HYPRE_Int      i, jv;
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      HYPRE_Real sum = 0.0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) reduction(+:sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         const HYPRE_Int k = jv * vecstride + i * idxstride;
+         sum += hypre_creal(hypre_conj(y_data[k]) * x_data[k]);
+      }
+      dots[jv] += sum;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockKrylovAxpby
+ *
+ * y_jv = alpha[jv] * x_jv + beta[jv] * y_jv (beta == NULL means 1).
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParCSRBlockKrylovAxpby( HYPRE_Real      *alpha,
+                              hypre_ParVector *x,
+                              HYPRE_Real      *beta,
+                              hypre_ParVector *y )
+{
+   hypre_Vector  *x_local     = hypre_ParVectorLocalVector(x);
+   HYPRE_Complex *x_data      = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data      = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Int      vecstride   = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      idxstride   = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      size        = hypre_VectorSize(x_local);
+   HYPRE_Int      i, jv;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         const HYPRE_Int k = jv * vecstride + i * idxstride;
+         y_data[k] = alpha[jv] * x_data[k] + (beta ? beta[jv] * y_data[k] : y_data[k]);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGSolve
+ *
+ * Runs one preconditioned CG recurrence per vector of b and x. Each
+ * iteration has one multivector matvec, one preconditioner application on
+ * the multivector residual and two reductions for all the vectors: <p,Ap>,
+ * and <r,z> together with <r,r>. A vector whose relative residual
+ * ||r||/||b|| drops below tol is frozen; the iteration stops when all are.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGSolve( void               *pcg_vdata,
+                           hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *b,
+                           hypre_ParVector    *x )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   MPI_Comm          comm        = (pcg_data -> comm);
+   HYPRE_Real        tol         = (pcg_data -> tol);
+   HYPRE_Int         max_iter    = (pcg_data -> max_iter);
+   HYPRE_Int         print_level = (pcg_data -> print_level);
+   void             *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       (*precond)(void*,void*,void*,void*) = (pcg_data -> precond);
+   hypre_ParVector  *r           = (pcg_data -> r);
+   hypre_ParVector  *z           = (pcg_data -> z);
+   hypre_ParVector  *p           = (pcg_data -> p);
+   hypre_ParVector  *s           = (pcg_data -> s);
+   HYPRE_Int         num_vectors = hypre_ParVectorNumVectors(b);
+
+   HYPRE_Real       *local_dots, *dots, *bb, *gamma, *alpha, *beta;
+   HYPRE_Int        *active;
+   HYPRE_Real        max_relres, relres;
+   HYPRE_Int         num_active, iter, jv, my_id;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (!r || hypre_ParVectorNumVectors(r) != num_vectors ||
+       hypre_ParVectorNumVectors(x) != num_vectors ||
+       hypre_VectorVectorStride(hypre_ParVectorLocalVector(x)) !=
+       hypre_VectorVectorStride(hypre_ParVectorLocalVector(b)))
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   local_dots = hypre_CTAlloc(HYPRE_Real, 3 * num_vectors, HYPRE_MEMORY_HOST);
+   dots       = hypre_CTAlloc(HYPRE_Real, 3 * num_vectors, HYPRE_MEMORY_HOST);
+   bb         = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   gamma      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   alpha      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   beta       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   active     = hypre_CTAlloc(HYPRE_Int, num_vectors, HYPRE_MEMORY_HOST);
+
+   /* r = b - A x, z = C r; <b,b>, <r,z> and <r,r> in one reduction */
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, x, 1.0, b, r);
+   if (precond)
+   {
+      hypre_ParVectorSetConstantValues(z, 0.0);
+      precond(precond_data, A, r, z);
+   }
+   else
+   {
+      hypre_ParVectorCopy(r, z);
+   }
+   hypre_ParVectorCopy(z, p);
+
+   hypre_ParCSRBlockKrylovLocalDots(b, b, local_dots);
+   hypre_ParCSRBlockKrylovLocalDots(r, z, local_dots + num_vectors);
+   hypre_ParCSRBlockKrylovLocalDots(r, r, local_dots + 2 * num_vectors);
+   hypre_MPI_Allreduce(local_dots, dots, 3 * num_vectors, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   num_active = 0;
+   max_relres = 0.0;
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      bb[jv]    = dots[jv];
+      gamma[jv] = dots[num_vectors + jv];
+      relres    = bb[jv] > 0.0 ? sqrt(dots[2 * num_vectors + jv] / bb[jv]) : 0.0;
+      active[jv]  = relres >= tol && gamma[jv] != 0.0;
+      num_active += active[jv];
+      max_relres  = hypre_max(max_relres, relres);
+   }
+   if (num_active < num_vectors)
+   {
+      /* a zero right-hand side has the solution zero */
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         alpha[jv] = 0.0;
+         beta[jv]  = bb[jv] == 0.0 ? 0.0 : 1.0;
+      }
+      hypre_ParCSRBlockKrylovAxpby(alpha, b, beta, x);
+   }
+
+   if (my_id == 0 && print_level > 1)
+   {
+      hypre_printf("\n\nBlock PCG with %d right-hand sides (largest relative residual)\n", num_vectors);
+      hypre_printf("Iters   active    max ||r||_2/||b||_2\n");
+      hypre_printf("-----   ------    -------------------\n");
+      hypre_printf("% 5d   % 6d    %e\n", 0, num_active, max_relres);
+   }
+
+   iter = 0;
+   while (num_active > 0 && iter < max_iter)
+   {
+      iter++;
+
+      /* s = A p, alpha = <r,z> / <p,s> */
+      hypre_ParCSRMatrixMatvec(1.0, A, p, 0.0, s);
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         local_dots[jv] = 0.0;
+      }
+      hypre_ParCSRBlockKrylovLocalDots(p, s, local_dots);
+      hypre_MPI_Allreduce(local_dots, dots, num_vectors, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         alpha[jv] = (active[jv] && dots[jv] > 0.0) ? gamma[jv] / dots[jv] : 0.0;
+         if (active[jv] && dots[jv] <= 0.0)
+         {
+            /* A or the preconditioner is not SPD for this vector */
+            active[jv] = 0;
+            hypre_error(HYPRE_ERROR_GENERIC);
+         }
+      }
+
+      /* x += alpha p, r -= alpha s */
+      hypre_ParCSRBlockKrylovAxpby(alpha, p, NULL, x);
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         alpha[jv] = -alpha[jv];
+      }
+      hypre_ParCSRBlockKrylovAxpby(alpha, s, NULL, r);
+
+      /* z = C r */
+      if (precond)
+      {
+         hypre_ParVectorSetConstantValues(z, 0.0);
+         precond(precond_data, A, r, z);
+      }
+      else
+      {
+         hypre_ParVectorCopy(r, z);
+      }
+
+      /* <r,z> and <r,r> in one reduction */
+      for (jv = 0; jv < 2 * num_vectors; jv++)
+      {
+         local_dots[jv] = 0.0;
+      }
+      hypre_ParCSRBlockKrylovLocalDots(r, z, local_dots);
+      hypre_ParCSRBlockKrylovLocalDots(r, r, local_dots + num_vectors);
+      hypre_MPI_Allreduce(local_dots, dots, 2 * num_vectors, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+      num_active = 0;
+      max_relres = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         relres = bb[jv] > 0.0 ? sqrt(dots[num_vectors + jv] / bb[jv]) : 0.0;
+         max_relres = hypre_max(max_relres, relres);
+
+         if (active[jv] && relres >= tol && dots[jv] != 0.0)
+         {
+            /* p = z + beta p */
+            alpha[jv] = 1.0;
+            beta[jv]  = dots[jv] / gamma[jv];
+            gamma[jv] = dots[jv];
+            num_active++;
+         }
+         else
+         {
+            /* frozen: p is left unchanged and no longer used */
+            alpha[jv]  = 0.0;
+            beta[jv]   = 1.0;
+            active[jv] = 0;
+         }
+      }
+      hypre_ParCSRBlockKrylovAxpby(alpha, z, beta, p);
+
+      if (my_id == 0 && print_level > 1)
+      {
+         hypre_printf("% 5d   % 6d    %e\n", iter, num_active, max_relres);
+      }
+   }
+
+   (pcg_data -> num_iterations)    = iter;
+   (pcg_data -> rel_residual_norm) = max_relres;
+
+   if (my_id == 0 && print_level > 0)
+   {
+      hypre_printf("Block PCG: %d iterations, largest relative residual %e\n", iter, max_relres);
+   }
+
+   if (num_active > 0)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_TFree(local_dots, HYPRE_MEMORY_HOST);
+   hypre_TFree(dots, HYPRE_MEMORY_HOST);
+   hypre_TFree(bb, HYPRE_MEMORY_HOST);
+   hypre_TFree(gamma, HYPRE_MEMORY_HOST);
+   hypre_TFree(alpha, HYPRE_MEMORY_HOST);
+   hypre_TFree(beta, HYPRE_MEMORY_HOST);
+   hypre_TFree(active, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGSetTol( void       *pcg_vdata,
+                            HYPRE_Real  tol )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (!pcg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (tol < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (pcg_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGSetMaxIter( void      *pcg_vdata,
+                                HYPRE_Int  max_iter )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (!pcg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (max_iter < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (pcg_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGSetPrecond( void  *pcg_vdata,
+                                HYPRE_Int (*precond)(void*,void*,void*,void*),
+                                HYPRE_Int (*precond_setup)(void*,void*,void*,void*),
+                                void  *precond_data )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (!pcg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   (pcg_data -> precond)       = precond;
+   (pcg_data -> precond_setup) = precond_setup;
+   (pcg_data -> precond_data)  = precond_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGSetPrintLevel( void      *pcg_vdata,
+                                   HYPRE_Int  print_level )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (!pcg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   (pcg_data -> print_level) = print_level;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGSetLogging( void      *pcg_vdata,
+                                HYPRE_Int  logging )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (!pcg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   (pcg_data -> logging) = logging;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGGetNumIterations( void      *pcg_vdata,
+                                      HYPRE_Int *num_iterations )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (!pcg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *num_iterations = (pcg_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBlockPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBlockPCGGetFinalRelativeResidualNorm( void       *pcg_vdata,
+                                                  HYPRE_Real *relative_residual_norm )
+{
+   hypre_ParCSRBlockPCGData *pcg_data = (hypre_ParCSRBlockPCGData *) pcg_vdata;
+
+   if (!pcg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *relative_residual_norm = (pcg_data -> rel_residual_norm);
+
+   return hypre_error_flag;
+}
@@ -62,6 +62,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Int     **grid_relax_points;
    HYPRE_Int       block_mode;
    HYPRE_Int       cheby_order;
+   HYPRE_Real      async_relax_time;
 
    /* Local variables  */
    HYPRE_Int      *lev_counter;
@@ -146,9 +147,13 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    min_eig_est = hypre_ParAMGDataMinEigEst(amg_data);
    cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);*/
    cheby_order = hypre_ParAMGDataChebyOrder(amg_data);
+   async_relax_time = hypre_ParAMGDataAsyncRelaxTime(amg_data);
 
    cycle_op_count = hypre_ParAMGDataCycleOpCount(amg_data);
 
+   /* use the single precision values of the fine grid matrix, if any */
+   hypre_BoomerAMGMixedPrecisionAttachFine(amg_data);
+
    lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
 
    if (hypre_ParAMGDataParticipate(amg_data))
@@ -474,6 +479,70 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                           Vtemp,
                                                           Ztemp);
                }
+               else if (relax_type == 30)
+               {
+                  /* asynchronous hybrid G-S: the num_sweep sweeps are done in
+                     one call, without synchronization between them */
+                  if (j == 0)
+                  {
+                     HYPRE_Real *l1_data = l1_norms_level ? hypre_VectorData(l1_norms_level) : NULL;
+
+                     if (relax_local == 1 && cycle_param < 3)
+                     {
+                        /* C/F on the down cycle, F/C on the up cycle */
+                        HYPRE_Int first_points = cycle_param < 2 ? 1 : -1;
+
+                        hypre_BoomerAMGRelax30AsyncHybridGaussSeidel(A_array[level], Aux_F, CF_marker_array[level],
+                                                                     first_points, l1_data, Aux_U,
+                                                                     num_sweep, async_relax_time);
+                        hypre_BoomerAMGRelax30AsyncHybridGaussSeidel(A_array[level], Aux_F, CF_marker_array[level],
+                                                                     -first_points, l1_data, Aux_U,
+                                                                     num_sweep, async_relax_time);
+                     }
+                     else
+                     {
+                        hypre_BoomerAMGRelax30AsyncHybridGaussSeidel(A_array[level], Aux_F, CF_marker_array[level],
+                                                                     0, l1_data, Aux_U,
+                                                                     num_sweep, async_relax_time);
+                     }
+                  }
+               }
+               else if (relax_type == 31 || relax_type == 32)
+               {
+                  /* multicolor G-S with the coloring of the setup: the colors
+                     are run backward on the up cycle, so that the V-cycle
+                     stays symmetric */
+                  HYPRE_Int   color_order  = relax_type == 32 ? 0 : (cycle_param == 2 ? -1 : 1);
+                  HYPRE_Int   num_colors   = 0;
+                  HYPRE_Int  *color_starts = NULL;
+                  HYPRE_Int  *color_perm   = NULL;
+
+                  if (hypre_ParAMGDataColorStarts(amg_data))
+                  {
+                     num_colors   = hypre_ParAMGDataNumColors(amg_data)[level];
+                     color_starts = hypre_ParAMGDataColorStarts(amg_data)[level];
+                     color_perm   = hypre_ParAMGDataColorPerm(amg_data)[level];
+                  }
+
+                  if (relax_local == 1 && cycle_param < 3)
+                  {
+                     /* C/F on the down cycle, F/C on the up cycle */
+                     HYPRE_Int first_points = cycle_param < 2 ? 1 : -1;
+
+                     hypre_BoomerAMGRelaxMulticolorGaussSeidel(A_array[level], Aux_F, CF_marker_array[level],
+                                                               first_points, num_colors, color_starts,
+                                                               color_perm, color_order, Aux_U, Vtemp, Ztemp);
+                     hypre_BoomerAMGRelaxMulticolorGaussSeidel(A_array[level], Aux_F, CF_marker_array[level],
+                                                               -first_points, num_colors, color_starts,
+                                                               color_perm, color_order, Aux_U, Vtemp, Ztemp);
+                  }
+                  else
+                  {
+                     hypre_BoomerAMGRelaxMulticolorGaussSeidel(A_array[level], Aux_F, CF_marker_array[level],
+                                                               0, num_colors, color_starts,
+                                                               color_perm, color_order, Aux_U, Vtemp, Ztemp);
+                  }
+               }
                else if (relax_type == 15)
                {
                   /* CG */
@@ -560,6 +629,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
                if (Solve_err_flag != 0)
                {
+                  hypre_BoomerAMGMixedPrecisionDetachFine(amg_data);
+
                   HYPRE_ANNOTATE_MGLEVEL_END(level);
                   HYPRE_ANNOTATE_FUNC_END;
 
@@ -727,6 +798,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       }
    }
 
+   hypre_BoomerAMGMixedPrecisionDetachFine(amg_data);
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return(Solve_err_flag);
@@ -178,6 +178,55 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdStart
+ *
+ * Computes the n local products <x[k],y[k]> into result and starts their
+ * global sum.  The sum is only available after hypre_ParKrylovInnerProdWait.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdStart( HYPRE_Int    n,
+                               void       **x,
+                               void       **y,
+                               HYPRE_Real  *result,
+                               void       **request )
+{
+   MPI_Comm           comm = hypre_ParVectorComm((hypre_ParVector *) x[0]);
+   hypre_MPI_Request *req;
+   HYPRE_Int          k;
+
+   for (k = 0; k < n; k++)
+   {
+      result[k] = hypre_SeqVectorInnerProd(
+                     hypre_ParVectorLocalVector((hypre_ParVector *) x[k]),
+                     hypre_ParVectorLocalVector((hypre_ParVector *) y[k]) );
+   }
+
+   req = hypre_CTAlloc(hypre_MPI_Request, 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, req);
+   *request = (void *) req;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdWait
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdWait( void *request )
+{
+   hypre_MPI_Request *req = (hypre_MPI_Request *) request;
+   hypre_MPI_Status   status;
+
+   hypre_MPI_Wait(req, &status);
+   hypre_TFree(req, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -188,6 +237,17 @@ hypre_ParKrylovMassInnerProd( void *x,
    return ( hypre_ParVectorMassInnerProd( (hypre_ParVector *) x,(hypre_ParVector **) y, k, unroll, (HYPRE_Real*)result ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMassInnerProdMult
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_ParKrylovMassInnerProdMult( void **x, HYPRE_Int s,
+                                  void **y, HYPRE_Int k, HYPRE_Int unroll, void *result )
+{
+   return ( hypre_ParVectorMassInnerProdMult( (hypre_ParVector **) x, s, (hypre_ParVector **) y, k,
+                                              unroll, (HYPRE_Real *) result ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassDotpTwo
  *--------------------------------------------------------------------------*/
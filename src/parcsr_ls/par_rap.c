@@ -9,6 +9,47 @@
 #include "_hypre_utilities.h"
 #include "hypre_hopscotch_hash.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCoarseOperatorRowPartition
+ *
+ * Splits the num_rows rows of R_diag (the local rows of RAP) into
+ * num_threads blocks of roughly equal work.  The work of row ic is
+ * estimated by the number of entries of A reached through R_diag.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int *
+hypre_BoomerAMGCoarseOperatorRowPartition( HYPRE_Int  num_rows,
+                                           HYPRE_Int *R_diag_i,
+                                           HYPRE_Int *R_diag_j,
+                                           HYPRE_Int *A_diag_i,
+                                           HYPRE_Int *A_offd_i,
+                                           HYPRE_Int  num_threads )
+{
+   HYPRE_Int *row_work = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   HYPRE_Int *part     = hypre_TAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+   HYPRE_Int  ic;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ic) HYPRE_SMP_SCHEDULE
+#endif
+   for (ic = 0; ic < num_rows; ic++)
+   {
+      HYPRE_Int jj1, i1, work = 1;
+
+      for (jj1 = R_diag_i[ic]; jj1 < R_diag_i[ic+1]; jj1++)
+      {
+         i1 = R_diag_j[jj1];
+         work += 1 + A_diag_i[i1+1] - A_diag_i[i1] + A_offd_i[i1+1] - A_offd_i[i1];
+      }
+      row_work[ic] = work;
+   }
+
+   hypre_SpGemmHostPartitionRows(num_rows, row_work, num_threads, part);
+   hypre_TFree(row_work, HYPRE_MEMORY_HOST);
+
+   return part;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGBuildCoarseOperator
  *--------------------------------------------------------------------------*/
@@ -174,6 +215,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    HYPRE_Int              jj1, jj2, jj3, jcol;
 
    HYPRE_Int             *jj_count, *jj_cnt_diag, *jj_cnt_offd;
+   HYPRE_Int             *row_part;
    HYPRE_Int              jj_counter, jj_count_diag, jj_count_offd;
    HYPRE_Int              jj_row_begining, jj_row_begin_diag, jj_row_begin_offd;
    HYPRE_Int              start_indexing = 0; /* start indexing for RAP_data at 0 */
@@ -1160,24 +1202,16 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *-----------------------------------------------------------------------*/
    jj_cnt_diag = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
    jj_cnt_offd = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
+   row_part = hypre_BoomerAMGCoarseOperatorRowPartition(num_cols_diag_RT, R_diag_i, R_diag_j,
+                                                        A_diag_i, A_offd_i, num_threads);
 
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker) HYPRE_SMP_SCHEDULE
 #endif
    for (ii = 0; ii < num_threads; ii++)
    {
-      size = num_cols_diag_RT/num_threads;
-      rest = num_cols_diag_RT - size*num_threads;
-      if (ii < rest)
-      {
-         ns = ii*size+ii;
-         ne = (ii+1)*size+ii+1;
-      }
-      else
-      {
-         ns = ii*size+rest;
-         ne = (ii+1)*size+rest;
-      }
+      ns = row_part[ii];
+      ne = row_part[ii+1];
 
       P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_cols_diag_P+num_cols_offd_RAP, HYPRE_MEMORY_HOST);
       A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_nz_cols_A, HYPRE_MEMORY_HOST);
@@ -1477,22 +1511,12 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *-----------------------------------------------------------------------*/
 
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
 #endif
    for (ii = 0; ii < num_threads; ii++)
    {
-      size = num_cols_diag_RT/num_threads;
-      rest = num_cols_diag_RT - size*num_threads;
-      if (ii < rest)
-      {
-         ns = ii*size+ii;
-         ne = (ii+1)*size+ii+1;
-      }
-      else
-      {
-         ns = ii*size+rest;
-         ne = (ii+1)*size+rest;
-      }
+      ns = row_part[ii];
+      ne = row_part[ii+1];
 
       /*-----------------------------------------------------------------------
        *  Initialize some stuff.
@@ -1986,6 +2010,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    hypre_TFree(P_ext_diag_i, HYPRE_MEMORY_HOST);
    hypre_TFree(P_ext_offd_i, HYPRE_MEMORY_HOST);
    hypre_TFree(jj_cnt_diag, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_part, HYPRE_MEMORY_HOST);
    hypre_TFree(jj_cnt_offd, HYPRE_MEMORY_HOST);
    if (num_cols_offd_P)
    {
@@ -67,6 +67,10 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 20 -> Kaczmarz
     *     relax_type = 29 -> Direct solve: use gaussian elimination & BLAS
     *                        (with pivoting) (old version)
+    *     relax_type = 30 -> asynchronous l1 hybrid Gauss-Seidel, no
+    *                        synchronization between threads or sweeps
+    *     relax_type = 31 -> multicolor Gauss-Seidel
+    *     relax_type = 32 -> multicolor symmetric Gauss-Seidel
     *     relax_type = 98 -> Direct solve, Gaussian elimination
     *     relax_type = 99 -> Direct solve, Gaussian elimination
     *     relax_type = 199-> Direct solve, Gaussian elimination
@@ -144,6 +148,16 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          hypre_BoomerAMGRelaxKaczmarz(A, f, omega, l1_norms, u);
          break;
 
+      case 30: /* Asynchronous l1 hybrid Gauss-Seidel, one sweep per thread */
+         hypre_BoomerAMGRelax30AsyncHybridGaussSeidel(A, f, cf_marker, relax_points, l1_norms, u, 1, 0.0);
+         break;
+
+      case 31: /* Multicolor Gauss-Seidel, colors computed here */
+      case 32: /* Multicolor symmetric Gauss-Seidel, colors computed here */
+         hypre_BoomerAMGRelax31MulticolorGaussSeidel(A, f, cf_marker, relax_points, relax_type == 32,
+                                                     u, Vtemp, Ztemp);
+         break;
+
       case 98: /* Direct solve: use gaussian elimination & BLAS (with pivoting) */
          relax_error = hypre_BoomerAMGRelax98GaussElimPivot(A, f, u);
          break;
@@ -184,6 +198,9 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Complex       *v_ext_data    = NULL;
    HYPRE_Complex       *v_buf_data    = NULL;
 
+   hypre_CSRMatrixShortJ *diag_short_j   = NULL;
+   hypre_CSRMatrixShortJ *offd_short_j   = NULL;
+
    HYPRE_Complex        zero             = 0.0;
    HYPRE_Real           one_minus_weight = 1.0 - relax_weight;
    HYPRE_Complex        res;
@@ -230,6 +247,15 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
       comm_handle = NULL;
    }
 
+   if (hypre_CSRMatrixSpMVUseShortJ(A_diag))
+   {
+      diag_short_j = hypre_CSRMatrixShortJSetup(A_diag);
+   }
+   if (num_cols_offd && hypre_CSRMatrixSpMVUseShortJ(A_offd))
+   {
+      offd_short_j = hypre_CSRMatrixShortJSetup(A_offd);
+   }
+
    /*-----------------------------------------------------------------
     * Relax all points.
     *-----------------------------------------------------------------*/
@@ -248,15 +274,31 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
       if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
       {
          res = f_data[i];
-         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         if (diag_short_j)
          {
-            ii = A_diag_j[jj];
-            res -= A_diag_data[jj] * Vtemp_data[ii];
+            res -= hypre_CSRMatrixShortJRowDot(diag_short_j, A_diag_data, i,
+                                               A_diag_i[i] + Skip_diag, A_diag_i[i+1], Vtemp_data);
          }
-         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         else
          {
-            ii = A_offd_j[jj];
-            res -= A_offd_data[jj] * v_ext_data[ii];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+         }
+         if (offd_short_j)
+         {
+            res -= hypre_CSRMatrixShortJRowDot(offd_short_j, A_offd_data, i,
+                                               A_offd_i[i], A_offd_i[i+1], v_ext_data);
+         }
+         else
+         {
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= A_offd_data[jj] * v_ext_data[ii];
+            }
          }
 
          if (Skip_diag)
@@ -647,6 +689,8 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    HYPRE_Complex       *v_ext_data    = NULL;
    HYPRE_Complex       *v_buf_data    = NULL;
    HYPRE_Int           *proc_ordering = NULL;
+   hypre_CSRMatrixShortJ *diag_short_j = NULL;
+   hypre_CSRMatrixShortJ *offd_short_j = NULL;
 
    const HYPRE_Real     one_minus_omega  = 1.0 - omega;
    HYPRE_Int            num_procs, my_id, num_threads, j, num_sends;
@@ -805,6 +849,17 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    else /* if (num_threads > 1) */
    {
       HYPRE_Int sweep;
+
+      /* the sequential non-scaled sweeps can read the short column indices */
+      if (non_scale && !Topo_order && hypre_CSRMatrixSpMVUseShortJ(A_diag))
+      {
+         diag_short_j = hypre_CSRMatrixShortJSetup(A_diag);
+         if (num_cols_offd && hypre_CSRMatrixSpMVUseShortJ(A_offd))
+         {
+            offd_short_j = hypre_CSRMatrixShortJSetup(A_offd);
+         }
+      }
+
       for (sweep = 0; sweep < num_sweeps; sweep++)
       {
          const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
@@ -819,7 +874,13 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          }
          else
          {
-            if (non_scale)
+            if (non_scale && diag_short_j)
+            {
+               hypre_HybridGaussSeidelNSShortJ(A_diag_i, diag_short_j, A_diag_data, A_offd_i, A_offd_j, offd_short_j,
+                                               A_offd_data, f_data, cf_marker, relax_points, l1_norms, u_data,
+                                               v_ext_data, ibegin, iend, iorder, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNS(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                          f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
@@ -1017,6 +1078,172 @@ hypre_BoomerAMGRelax5ChaoticHybridGaussSeidel( hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelax30AsyncHybridGaussSeidel
+ *
+ * Asynchronous (l1) hybrid Gauss-Seidel. Every thread sweeps its block of
+ * rows up to max_sweeps times, or until max_time seconds (if positive) have
+ * passed since the call, without synchronizing with the other threads: it
+ * reads the values of u that are current at that time. Between its sweeps,
+ * thread 0 refreshes the halo with nonblocking exchanges that are only
+ * tested, so the sweeps go on with the old halo values while an exchange is
+ * in flight. Each rank posts max_sweeps - 1 exchanges per call, the ones that
+ * are not posted during the sweeps are completed at the end.
+ *
+ * Thread 0 is the master thread, so MPI_THREAD_FUNNELED is sufficient.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelax30AsyncHybridGaussSeidel( hypre_ParCSRMatrix *A,
+                                              hypre_ParVector    *f,
+                                              HYPRE_Int          *cf_marker,
+                                              HYPRE_Int           relax_points,
+                                              HYPRE_Real         *l1_norms,
+                                              hypre_ParVector    *u,
+                                              HYPRE_Int           max_sweeps,
+                                              HYPRE_Real          max_time )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   hypre_Vector        *f_local       = hypre_ParVectorLocalVector(f);
+   HYPRE_Complex       *f_data        = hypre_VectorData(f_local);
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_recv_data   = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+   HYPRE_Int            num_exchanges = 0;
+   HYPRE_Int            num_posted    = 0;
+   HYPRE_Real           start_time    = 0.0;
+
+   HYPRE_Int num_procs, i, j, num_sends = 0, num_threads;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+
+#if defined(HYPRE_COMPLEX)
+   /* the values are shared between the threads with atomic reads and writes,
+      which OpenMP does not provide for complex types */
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                     "Asynchronous relaxation (type 30) is not supported with complex values\n");
+   return hypre_error_flag;
+#endif
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+   max_sweeps  = hypre_max(max_sweeps, 1);
+
+   if (max_time > 0.0)
+   {
+      start_time = hypre_MPI_Wtime();
+   }
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      num_sends   = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      v_buf_data  = hypre_CTAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                  HYPRE_MEMORY_HOST);
+      v_ext_data  = hypre_CTAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+      v_recv_data = hypre_CTAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+
+      /* the first sweep starts from an up-to-date halo */
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+      {
+         v_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      comm_handle = NULL;
+
+      num_exchanges = max_sweeps - 1;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j) num_threads(num_threads)
+#endif
+   {
+      HYPRE_Int my_thread = hypre_GetThreadNum();
+      HYPRE_Int ns, ne, sweep, flag;
+
+      hypre_partition1D(num_rows, num_threads, my_thread, &ns, &ne);
+
+      for (sweep = 0; sweep < max_sweeps; sweep++)
+      {
+         if (sweep > 0 && max_time > 0.0 && hypre_MPI_Wtime() - start_time > max_time)
+         {
+            break;
+         }
+
+         hypre_HybridGaussSeidelAsync(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                      f_data, cf_marker, relax_points, l1_norms, u_data, v_ext_data, ns, ne);
+
+         if (my_thread == 0 && num_exchanges > 0)
+         {
+            /* publish a completed exchange, and post the next one */
+            if (comm_handle)
+            {
+               hypre_ParCSRCommHandleTest(comm_handle, &flag);
+               if (flag)
+               {
+                  hypre_ParCSRCommHandleDestroy(comm_handle);
+                  comm_handle = NULL;
+                  for (i = 0; i < num_cols_offd; i++)
+                  {
+                     hypre_AsyncRelaxWrite(&v_ext_data[i], v_recv_data[i]);
+                  }
+               }
+            }
+
+            if (!comm_handle && num_posted < num_exchanges)
+            {
+               for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+               {
+                  j = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i);
+                  v_buf_data[i] = hypre_AsyncRelaxRead(&u_data[j]);
+               }
+               comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_recv_data);
+               num_posted++;
+            }
+         }
+      }
+   }
+
+   /* every rank posts the same number of exchanges */
+   if (num_exchanges > 0)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      for (; num_posted < num_exchanges; num_posted++)
+      {
+         for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+         {
+            v_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+         }
+         comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_recv_data);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+      }
+   }
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_recv_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /* symmetric hybrid G-S */
 HYPRE_Int
 hypre_BoomerAMGRelax6HybridSSOR( hypre_ParCSRMatrix *A,
@@ -1600,3 +1827,389 @@ hypre_BoomerAMGRelax12TwoStageGaussSeidel( hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVectorSupported
+ *
+ * Returns 1 if hypre_BoomerAMGRelaxMultiVector implements relax_type.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVectorSupported( HYPRE_Int relax_type )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return 0;
+#else
+   switch (relax_type)
+   {
+      case 0: case 3: case 4: case 6: case 7: case 8: case 13: case 14: case 18:
+         return 1;
+   }
+
+   return 0;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVectorHalo
+ *
+ * Returns the off-processor values of all the vectors of u, index-major
+ * (num_cols_offd x num_vectors), exchanged in one message per neighbor.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Complex *
+hypre_BoomerAMGRelaxMultiVectorHalo( hypre_ParCSRMatrix *A,
+                                     hypre_ParVector    *u )
+{
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   hypre_Vector           *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex          *u_data        = hypre_VectorData(u_local);
+   HYPRE_Int               num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Int               vecstride     = hypre_VectorVectorStride(u_local);
+   HYPRE_Int               idxstride     = hypre_VectorIndexStride(u_local);
+   HYPRE_Complex          *v_buf_data, *v_ext_data;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               num_sends, begin, end, j, jv;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   begin     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+   end       = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   v_buf_data = hypre_TAlloc(HYPRE_Complex, (end - begin) * num_vectors, HYPRE_MEMORY_HOST);
+   v_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j, jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = begin; j < end; j++)
+   {
+      const HYPRE_Complex *uj = u_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j) * idxstride;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         v_buf_data[(j - begin) * num_vectors + jv] = uj[jv * vecstride];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVector(1, comm_pkg, num_vectors, v_buf_data, v_ext_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return v_ext_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVectorJacobi
+ *
+ * (l1-)Jacobi on all the vectors of u. With relax_points = 0 and l1_norms
+ * this is relax type 7, Vtemp = w(f - Au) with one multivector matvec;
+ * otherwise it is the point-wise loop of hypre_BoomerAMGRelaxWeightedJacobi_core.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRelaxMultiVectorJacobi( hypre_ParCSRMatrix *A,
+                                       hypre_ParVector    *f,
+                                       HYPRE_Int          *cf_marker,
+                                       HYPRE_Int           relax_points,
+                                       HYPRE_Real          relax_weight,
+                                       HYPRE_Real         *l1_norms,
+                                       hypre_ParVector    *u,
+                                       hypre_ParVector    *Vtemp,
+                                       HYPRE_Int           Skip_diag )
+{
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *Vtemp_data    = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Int            vecstride     = hypre_VectorVectorStride(u_local);
+   HYPRE_Int            idxstride     = hypre_VectorIndexStride(u_local);
+   HYPRE_Complex       *v_ext_data;
+   HYPRE_Complex        zero          = 0.0;
+   HYPRE_Real           one_minus_weight = 1.0 - relax_weight;
+   HYPRE_Int            i, jv;
+
+   if (relax_points == 0 && l1_norms)
+   {
+      hypre_ParVectorCopy(f, Vtemp);
+      hypre_ParCSRMatrixMatvec(-relax_weight, A, u, relax_weight, Vtemp);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, jv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            u_data[jv * vecstride + i * idxstride] += Vtemp_data[jv * vecstride + i * idxstride] / l1_norms[i];
+         }
+      }
+
+      return hypre_error_flag;
+   }
+
+   v_ext_data = hypre_BoomerAMGRelaxMultiVectorHalo(A, u);
+
+   hypre_ParVectorCopy(u, Vtemp);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, jv)
+#endif
+   {
+      HYPRE_Complex *res = hypre_TAlloc(HYPRE_Complex, num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+         HYPRE_Int jj;
+
+         if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+         {
+            for (jv = 0; jv < num_vectors; jv++)
+            {
+               res[jv] = f_data[jv * vecstride + i * idxstride];
+            }
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+            {
+               const HYPRE_Int     ii = A_diag_j[jj];
+               const HYPRE_Complex a  = A_diag_data[jj];
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  res[jv] -= a * Vtemp_data[jv * vecstride + ii * idxstride];
+               }
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               const HYPRE_Int     ii = A_offd_j[jj];
+               const HYPRE_Complex a  = A_offd_data[jj];
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  res[jv] -= a * v_ext_data[ii * num_vectors + jv];
+               }
+            }
+            for (jv = 0; jv < num_vectors; jv++)
+            {
+               HYPRE_Complex *ui = u_data + jv * vecstride + i * idxstride;
+               if (Skip_diag)
+               {
+                  *ui *= one_minus_weight;
+               }
+               *ui += relax_weight * res[jv] / di;
+            }
+         }
+      }
+
+      hypre_TFree(res, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVectorHybridGaussSeidel
+ *
+ * Multivector counterpart of hypre_BoomerAMGRelaxHybridGaussSeidel_core
+ * (without topological ordering).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRelaxMultiVectorHybridGaussSeidel( hypre_ParCSRMatrix *A,
+                                                  hypre_ParVector    *f,
+                                                  HYPRE_Int          *cf_marker,
+                                                  HYPRE_Int           relax_points,
+                                                  HYPRE_Real          relax_weight,
+                                                  HYPRE_Real          omega,
+                                                  HYPRE_Real         *l1_norms,
+                                                  hypre_ParVector    *u,
+                                                  hypre_ParVector    *Vtemp,
+                                                  HYPRE_Int           GS_order,
+                                                  HYPRE_Int           Symm,
+                                                  HYPRE_Int           Skip_diag )
+{
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *Vtemp_data    = u_data;
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Int            vecstride     = hypre_VectorVectorStride(u_local);
+   HYPRE_Int            idxstride     = hypre_VectorIndexStride(u_local);
+   HYPRE_Complex       *v_ext_data;
+
+   const HYPRE_Int      num_threads     = hypre_NumThreads();
+   const HYPRE_Int      gs_order        = GS_order > 0 ? 1 : -1;
+   const HYPRE_Int      num_sweeps      = Symm ? 2 : 1;
+   const HYPRE_Int      non_scale       = relax_weight == 1.0 && omega == 1.0;
+   const HYPRE_Real     one_minus_omega = 1.0 - omega;
+   const HYPRE_Real     prod            = 1.0 - relax_weight * omega;
+   HYPRE_Int            j;
+
+   v_ext_data = hypre_BoomerAMGRelaxMultiVectorHalo(A, u);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   /* the old values are only read outside a thread's own rows, or when
+    * scaled; otherwise u itself is passed (and multiplied by zero) */
+   if (num_threads > 1 || !non_scale)
+   {
+      hypre_ParVectorCopy(u, Vtemp);
+      Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_threads; j++)
+   {
+      HYPRE_Int      ns, ne, sweep;
+      HYPRE_Complex *res = hypre_TAlloc(HYPRE_Complex, 3 * num_vectors, HYPRE_MEMORY_HOST);
+
+      hypre_partition1D(num_rows, num_threads, j, &ns, &ne);
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+         const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+         const HYPRE_Int iend   = iorder > 0 ? ne : ns - 1;
+
+         hypre_HybridGaussSeidelMultiVector(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                            f_data, cf_marker, relax_points, relax_weight, omega, one_minus_omega,
+                                            prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                            num_vectors, vecstride, idxstride, ns, ne, ibegin, iend, iorder,
+                                            Skip_diag, res);
+      }
+
+      hypre_TFree(res, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVector
+ *
+ * Relaxes all the vectors of the multivector u at once: one halo exchange
+ * per sweep for all the vectors and one pass over the rows of A. u, f and
+ * Vtemp must have the same number of vectors and the same storage. Only
+ * the relax types for which hypre_BoomerAMGRelaxMultiVectorSupported
+ * returns 1 are implemented.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVector( hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *f,
+                                 HYPRE_Int          *cf_marker,
+                                 HYPRE_Int           relax_type,
+                                 HYPRE_Int           relax_points,
+                                 HYPRE_Real          relax_weight,
+                                 HYPRE_Real          omega,
+                                 HYPRE_Real         *l1_norms,
+                                 hypre_ParVector    *u,
+                                 hypre_ParVector    *Vtemp )
+{
+   const HYPRE_Int skip_diag = relax_weight == 1.0 && omega == 1.0 ? 0 : 1;
+
+   if (!hypre_BoomerAMGRelaxMultiVectorSupported(relax_type))
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   switch (relax_type)
+   {
+      case 0: /* Weighted Jacobi */
+         hypre_BoomerAMGRelaxMultiVectorJacobi(A, f, cf_marker, relax_points, relax_weight, NULL, u, Vtemp, 1);
+         break;
+
+      case 3: /* hybrid G-S forward */
+         hypre_BoomerAMGRelaxMultiVectorHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight, omega, NULL,
+                                                          u, Vtemp, 1, 0, 1);
+         break;
+
+      case 4: /* hybrid G-S backward */
+         hypre_BoomerAMGRelaxMultiVectorHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight, omega, NULL,
+                                                          u, Vtemp, -1, 0, 1);
+         break;
+
+      case 6: /* hybrid SSOR */
+         hypre_BoomerAMGRelaxMultiVectorHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight, omega, NULL,
+                                                          u, Vtemp, 1, 1, 1);
+         break;
+
+      case 7: /* Jacobi (uses ParMatvec) */
+         hypre_BoomerAMGRelaxMultiVectorJacobi(A, f, cf_marker, 0, relax_weight, l1_norms, u, Vtemp, 0);
+         break;
+
+      case 8: /* hybrid L1 Symm. Gauss-Seidel */
+         hypre_BoomerAMGRelaxMultiVectorHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight, omega, l1_norms,
+                                                          u, Vtemp, 1, 1, skip_diag);
+         break;
+
+      case 13: /* hybrid L1 Gauss-Seidel forward */
+         hypre_BoomerAMGRelaxMultiVectorHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight, omega, l1_norms,
+                                                          u, Vtemp, 1, 0, skip_diag);
+         break;
+
+      case 14: /* hybrid L1 Gauss-Seidel backward */
+         hypre_BoomerAMGRelaxMultiVectorHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight, omega, l1_norms,
+                                                          u, Vtemp, -1, 0, skip_diag);
+         break;
+
+      case 18: /* weighted L1 Jacobi */
+         hypre_BoomerAMGRelaxMultiVectorJacobi(A, f, cf_marker, relax_points, relax_weight, l1_norms, u, Vtemp, 0);
+         break;
+   }
+
+   return hypre_error_flag;
+}
@@ -102,6 +102,67 @@ hypre_HybridGaussSeidelNS( HYPRE_Int     *A_diag_i,
    }
 }
 
+/* Non-Scale version with the short column indices of A_diag (and A_offd, if
+ * offd_short_j is not NULL) */
+static inline void
+hypre_HybridGaussSeidelNSShortJ( HYPRE_Int             *A_diag_i,
+                                 hypre_CSRMatrixShortJ *diag_short_j,
+                                 HYPRE_Complex         *A_diag_data,
+                                 HYPRE_Int             *A_offd_i,
+                                 HYPRE_Int             *A_offd_j,
+                                 hypre_CSRMatrixShortJ *offd_short_j,
+                                 HYPRE_Complex         *A_offd_data,
+                                 HYPRE_Complex         *f_data,
+                                 HYPRE_Int             *cf_marker,
+                                 HYPRE_Int              relax_points,
+                                 HYPRE_Complex         *l1_norms,
+                                 HYPRE_Complex         *u_data,
+                                 HYPRE_Complex         *v_ext_data,
+                                 HYPRE_Int              ibegin,
+                                 HYPRE_Int              iend,
+                                 HYPRE_Int              iorder,
+                                 HYPRE_Int              Skip_diag )
+{
+   HYPRE_Int i;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+
+         res -= hypre_CSRMatrixShortJRowDot(diag_short_j, A_diag_data, i,
+                                            A_diag_i[i] + Skip_diag, A_diag_i[i+1], u_data);
+
+         if (offd_short_j)
+         {
+            res -= hypre_CSRMatrixShortJRowDot(offd_short_j, A_offd_data, i,
+                                               A_offd_i[i], A_offd_i[i+1], v_ext_data);
+         }
+         else
+         {
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               res -= A_offd_data[jj] * v_ext_data[A_offd_j[jj]];
+            }
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] = res / di;
+         }
+         else
+         {
+            u_data[i] += res / di;
+         }
+      }
+   }
+}
+
 /* Non-Scale Threaded version */
 static inline void
 hypre_HybridGaussSeidelNSThreads( HYPRE_Int     *A_diag_i,
@@ -448,6 +509,102 @@ hypre_HybridGaussSeidelThreads( HYPRE_Int     *A_diag_i,
 }
 
 
+/* Multivector version: rows in [ns, ne) are updated with the latest values
+ * (Gauss-Seidel), the rest with the old values v_tmp_data (Jacobi). Each row
+ * of A is read once for all the vectors; res is work space of 3*num_vectors */
+static inline void
+hypre_HybridGaussSeidelMultiVector( HYPRE_Int     *A_diag_i,
+                                    HYPRE_Int     *A_diag_j,
+                                    HYPRE_Complex *A_diag_data,
+                                    HYPRE_Int     *A_offd_i,
+                                    HYPRE_Int     *A_offd_j,
+                                    HYPRE_Complex *A_offd_data,
+                                    HYPRE_Complex *f_data,
+                                    HYPRE_Int     *cf_marker,
+                                    HYPRE_Int      relax_points,
+                                    HYPRE_Real     relax_weight,
+                                    HYPRE_Real     omega,
+                                    HYPRE_Real     one_minus_omega,
+                                    HYPRE_Real     prod,
+                                    HYPRE_Complex *l1_norms,
+                                    HYPRE_Complex *u_data,
+                                    HYPRE_Complex *v_tmp_data,
+                                    HYPRE_Complex *v_ext_data,
+                                    HYPRE_Int      num_vectors,
+                                    HYPRE_Int      vecstride,
+                                    HYPRE_Int      idxstride,
+                                    HYPRE_Int      ns,
+                                    HYPRE_Int      ne,
+                                    HYPRE_Int      ibegin,
+                                    HYPRE_Int      iend,
+                                    HYPRE_Int      iorder,
+                                    HYPRE_Int      Skip_diag,
+                                    HYPRE_Complex *res )
+{
+   HYPRE_Int i, jv;
+   const HYPRE_Complex zero = 0.0;
+   HYPRE_Complex *res0 = res + num_vectors;
+   HYPRE_Complex *res2 = res + 2 * num_vectors;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Int jj;
+
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            res[jv]  = f_data[jv * vecstride + i * idxstride];
+            res0[jv] = 0.0;
+            res2[jv] = 0.0;
+         }
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         {
+            const HYPRE_Int     ii = A_diag_j[jj];
+            const HYPRE_Complex a  = A_diag_data[jj];
+            if (ii >= ns && ii < ne)
+            {
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  res0[jv] -= a * u_data[jv * vecstride + ii * idxstride];
+                  res2[jv] += a * v_tmp_data[jv * vecstride + ii * idxstride];
+               }
+            }
+            else
+            {
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  res[jv] -= a * v_tmp_data[jv * vecstride + ii * idxstride];
+               }
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            const HYPRE_Int     ii = A_offd_j[jj];
+            const HYPRE_Complex a  = A_offd_data[jj];
+            for (jv = 0; jv < num_vectors; jv++)
+            {
+               res[jv] -= a * v_ext_data[ii * num_vectors + jv];
+            }
+         }
+
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            HYPRE_Complex *ui = u_data + jv * vecstride + i * idxstride;
+            if (Skip_diag)
+            {
+               *ui *= prod;
+            }
+            *ui += relax_weight * (omega * res[jv] + res0[jv] + one_minus_omega * res2[jv]) / di;
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 /* Ordered Version */
 static inline void
 hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
@@ -500,5 +657,73 @@ hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
    } /* for ( i = ...) */
 }
 
+/* Asynchronous version: one row block [ns, ne) is swept with the values of u
+ * and of the halo that are current when they are read, other threads update
+ * theirs at the same time */
+static inline HYPRE_Complex
+hypre_AsyncRelaxRead( HYPRE_Complex *ptr )
+{
+   HYPRE_Complex val;
+#if defined(HYPRE_USING_OPENMP) && !defined(HYPRE_COMPLEX)
+#pragma omp atomic read
+#endif
+   val = *ptr;
+
+   return val;
+}
+
+static inline void
+hypre_AsyncRelaxWrite( HYPRE_Complex *ptr,
+                       HYPRE_Complex  val )
+{
+#if defined(HYPRE_USING_OPENMP) && !defined(HYPRE_COMPLEX)
+#pragma omp atomic write
+#endif
+   *ptr = val;
+
+   /* gcc does not count the operand of an atomic write as a use */
+   (void) val;
+}
+
+static inline void
+hypre_HybridGaussSeidelAsync( HYPRE_Int     *A_diag_i,
+                              HYPRE_Int     *A_diag_j,
+                              HYPRE_Complex *A_diag_data,
+                              HYPRE_Int     *A_offd_i,
+                              HYPRE_Int     *A_offd_j,
+                              HYPRE_Complex *A_offd_data,
+                              HYPRE_Complex *f_data,
+                              HYPRE_Int     *cf_marker,
+                              HYPRE_Int      relax_points,
+                              HYPRE_Real    *l1_norms,
+                              HYPRE_Complex *u_data,
+                              HYPRE_Complex *v_ext_data,
+                              HYPRE_Int      ns,
+                              HYPRE_Int      ne )
+{
+   HYPRE_Int i, jj;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ns; i < ne; i++)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Complex res = f_data[i];
+
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            res -= A_diag_data[jj] * hypre_AsyncRelaxRead(&u_data[A_diag_j[jj]]);
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            res -= A_offd_data[jj] * hypre_AsyncRelaxRead(&v_ext_data[A_offd_j[jj]]);
+         }
+         hypre_AsyncRelaxWrite(&u_data[i], u_data[i] + res / di);
+      }
+   }
+}
+
 #endif /* #ifndef HYPRE_PAR_RELAX_HEADER */
 
@@ -63,6 +63,48 @@ hypre_BoomerAMGRelaxIF( hypre_ParCSRMatrix *A,
    return Solve_err_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVectorIF
+ *
+ * CF-ordering wrapper of hypre_BoomerAMGRelaxMultiVector, as
+ * hypre_BoomerAMGRelaxIF is for hypre_BoomerAMGRelax.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVectorIF( hypre_ParCSRMatrix *A,
+                                   hypre_ParVector    *f,
+                                   HYPRE_Int          *cf_marker,
+                                   HYPRE_Int           relax_type,
+                                   HYPRE_Int           relax_order,
+                                   HYPRE_Int           cycle_param,
+                                   HYPRE_Real          relax_weight,
+                                   HYPRE_Real          omega,
+                                   HYPRE_Real         *l1_norms,
+                                   hypre_ParVector    *u,
+                                   hypre_ParVector    *Vtemp )
+{
+   HYPRE_Int i;
+   HYPRE_Int relax_points[2];
+
+   if (relax_order == 1 && cycle_param < 3)
+   {
+      relax_points[0] = cycle_param < 2 ?  1 : -1;
+      relax_points[1] = cycle_param < 2 ? -1 :  1;
+
+      for (i = 0; i < 2; i++)
+      {
+         hypre_BoomerAMGRelaxMultiVector(A, f, cf_marker, relax_type, relax_points[i],
+                                         relax_weight, omega, l1_norms, u, Vtemp);
+      }
+   }
+   else
+   {
+      hypre_BoomerAMGRelaxMultiVector(A, f, cf_marker, relax_type, 0, relax_weight, omega,
+                                      l1_norms, u, Vtemp);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRRelax_L1_Jacobi (same as the one in AMS, but this allows CF)
  * u_new = u_old + w D^{-1}(f - A u), where D_ii = ||A(i,:)||_1
@@ -0,0 +1,440 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Multicolor Gauss-Seidel relaxation (relax types 31 and 32)
+ *
+ * The rows of the diag block are colored such that no two rows of a color are
+ * coupled in either direction. The rows of a color are then relaxed in
+ * parallel, and the colors one after the other, which gives the same result
+ * for any number of threads. As in the hybrid Gauss-Seidel relaxations, the
+ * off-processor values are the ones at the beginning of the relaxation.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ColorWeight
+ *
+ * Pseudo-random weight of a global row index for the Jones-Plassmann
+ * coloring, so that the coloring does not depend on the number of threads
+ *--------------------------------------------------------------------------*/
+
+static inline unsigned long long
+hypre_ColorWeight( HYPRE_BigInt row )
+{
+   unsigned long long w = (unsigned long long) row + 0x9E3779B97F4A7C15ULL;
+
+   w = (w ^ (w >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   w = (w ^ (w >> 27)) * 0x94D049BB133111EBULL;
+
+   return w ^ (w >> 31);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixColorDiag
+ *
+ * Jones-Plassmann distance-1 coloring of the graph of A_diag + A_diag^T.
+ * In each round, the uncolored rows whose weight is larger than the weights
+ * of all their uncolored neighbors take the smallest color that none of
+ * their neighbors has. On return, the rows of color c are
+ * color_perm[color_starts[c]:color_starts[c+1]-1], in increasing order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixColorDiag( hypre_ParCSRMatrix  *A,
+                             HYPRE_Int           *num_colors_ptr,
+                             HYPRE_Int          **color_starts_ptr,
+                             HYPRE_Int          **color_perm_ptr )
+{
+   hypre_CSRMatrix    *A_diag       = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int          *A_diag_i     = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int          *A_diag_j     = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int           num_rows     = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_BigInt        first_row    = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_Int           num_threads  = hypre_NumThreads();
+   hypre_CSRMatrix    *AT_diag;
+   HYPRE_Int          *AT_diag_i, *AT_diag_j;
+   unsigned long long *weight;
+   HYPRE_Int          *color, *forbidden, *color_starts, *color_perm;
+   char               *selected;
+   HYPRE_Int           num_colored, num_colors, max_degree;
+   HYPRE_Int           i, jj, c;
+
+   *num_colors_ptr   = 0;
+   *color_starts_ptr = NULL;
+   *color_perm_ptr   = NULL;
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A_diag)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multicolor relaxation needs a host matrix\n");
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixTranspose(A_diag, &AT_diag, 0);
+   AT_diag_i = hypre_CSRMatrixI(AT_diag);
+   AT_diag_j = hypre_CSRMatrixJ(AT_diag);
+
+   weight   = hypre_TAlloc(unsigned long long, num_rows, HYPRE_MEMORY_HOST);
+   color    = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   selected = hypre_CTAlloc(char, num_rows, HYPRE_MEMORY_HOST);
+
+   max_degree = 0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) reduction(max:max_degree) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      weight[i]  = hypre_ColorWeight(first_row + (HYPRE_BigInt) i);
+      color[i]   = -1;
+      max_degree = hypre_max(max_degree, A_diag_i[i+1] - A_diag_i[i] + AT_diag_i[i+1] - AT_diag_i[i]);
+   }
+
+   /* forbidden[c] == i if a neighbor of row i has color c */
+   forbidden = hypre_TAlloc(HYPRE_Int, num_threads * (max_degree + 1), HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_threads * (max_degree + 1); i++)
+   {
+      forbidden[i] = -1;
+   }
+
+   num_colored = 0;
+   while (num_colored < num_rows)
+   {
+      HYPRE_Int num_selected = 0;
+
+      /* select the rows that are local maxima among the uncolored rows */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, jj) reduction(+:num_selected) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Int is_max = (color[i] < 0);
+
+         for (jj = A_diag_i[i]; is_max && jj < A_diag_i[i+1]; jj++)
+         {
+            HYPRE_Int j = A_diag_j[jj];
+            if (j != i && color[j] < 0 && (weight[j] > weight[i] || (weight[j] == weight[i] && j > i)))
+            {
+               is_max = 0;
+            }
+         }
+         for (jj = AT_diag_i[i]; is_max && jj < AT_diag_i[i+1]; jj++)
+         {
+            HYPRE_Int j = AT_diag_j[jj];
+            if (j != i && color[j] < 0 && (weight[j] > weight[i] || (weight[j] == weight[i] && j > i)))
+            {
+               is_max = 0;
+            }
+         }
+
+         selected[i]   = (char) is_max;
+         num_selected += is_max;
+      }
+
+      /* the selected rows are not neighbors of each other, so each one can
+         read the colors of its neighbors while the others are colored */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, jj, c)
+#endif
+      {
+         HYPRE_Int *my_forbidden = forbidden + hypre_GetThreadNum() * (max_degree + 1);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            if (!selected[i])
+            {
+               continue;
+            }
+
+            for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+            {
+               c = color[A_diag_j[jj]];
+               if (c >= 0 && c <= max_degree)
+               {
+                  my_forbidden[c] = i;
+               }
+            }
+            for (jj = AT_diag_i[i]; jj < AT_diag_i[i+1]; jj++)
+            {
+               c = color[AT_diag_j[jj]];
+               if (c >= 0 && c <= max_degree)
+               {
+                  my_forbidden[c] = i;
+               }
+            }
+
+            for (c = 0; my_forbidden[c] == i; c++);
+            color[i]    = c;
+            selected[i] = 0;
+         }
+      }
+
+      num_colored += num_selected;
+   }
+
+   /* rows sorted by color */
+   num_colors = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      num_colors = hypre_max(num_colors, color[i] + 1);
+   }
+
+   color_starts = hypre_CTAlloc(HYPRE_Int, num_colors + 1, HYPRE_MEMORY_HOST);
+   color_perm   = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      color_starts[color[i] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      color_starts[c + 1] += color_starts[c];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      color_perm[color_starts[color[i]]++] = i;
+   }
+   for (c = num_colors; c > 0; c--)
+   {
+      color_starts[c] = color_starts[c - 1];
+   }
+   color_starts[0] = 0;
+
+   hypre_CSRMatrixDestroy(AT_diag);
+   hypre_TFree(weight, HYPRE_MEMORY_HOST);
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(selected, HYPRE_MEMORY_HOST);
+   hypre_TFree(forbidden, HYPRE_MEMORY_HOST);
+
+   *num_colors_ptr   = num_colors;
+   *color_starts_ptr = color_starts;
+   *color_perm_ptr   = color_perm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorGaussSeidel
+ *
+ * Gauss-Seidel over the colors in increasing (color_order = 1) or decreasing
+ * (color_order = -1) order, or symmetric Gauss-Seidel (color_order = 0).
+ * Without a coloring, falls back to hybrid Gauss-Seidel.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorGaussSeidel( hypre_ParCSRMatrix *A,
+                                           hypre_ParVector    *f,
+                                           HYPRE_Int          *cf_marker,
+                                           HYPRE_Int           relax_points,
+                                           HYPRE_Int           num_colors,
+                                           HYPRE_Int          *color_starts,
+                                           HYPRE_Int          *color_perm,
+                                           HYPRE_Int           color_order,
+                                           hypre_ParVector    *u,
+                                           hypre_ParVector    *Vtemp,
+                                           hypre_ParVector    *Ztemp )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Complex       *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+   const HYPRE_Complex  zero          = 0.0;
+
+   HYPRE_Int num_procs, i, ii, jj, k, c, sweep, num_sends;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   if (!color_starts)
+   {
+      if (color_order > 0)
+      {
+         return hypre_BoomerAMGRelax3HybridGaussSeidel(A, f, cf_marker, relax_points, 1.0, 1.0, u, Vtemp, Ztemp);
+      }
+      else if (color_order < 0)
+      {
+         return hypre_BoomerAMGRelax4HybridGaussSeidel(A, f, cf_marker, relax_points, 1.0, 1.0, u, Vtemp, Ztemp);
+      }
+      return hypre_BoomerAMGRelax6HybridSSOR(A, f, cf_marker, relax_points, 1.0, 1.0, u, Vtemp, Ztemp);
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      v_buf_data = hypre_CTAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                 HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_CTAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+      {
+         v_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   for (sweep = 0; sweep < (color_order == 0 ? 2 : 1); sweep++)
+   {
+      const HYPRE_Int forward = color_order == 0 ? (sweep == 0) : (color_order > 0);
+
+      for (k = 0; k < num_colors; k++)
+      {
+         c = forward ? k : num_colors - 1 - k;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, ii, jj) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = color_starts[c]; ii < color_starts[c+1]; ii++)
+         {
+            i = color_perm[ii];
+
+            if ( (relax_points == 0 || cf_marker[i] == relax_points) && A_diag_data[A_diag_i[i]] != zero )
+            {
+               HYPRE_Complex res = f_data[i];
+
+               for (jj = A_diag_i[i] + 1; jj < A_diag_i[i+1]; jj++)
+               {
+                  res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+               {
+                  res -= A_offd_data[jj] * v_ext_data[A_offd_j[jj]];
+               }
+               u_data[i] = res / A_diag_data[A_diag_i[i]];
+            }
+         }
+      }
+   }
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelax31MulticolorGaussSeidel
+ *
+ * Multicolor (symmetric, if symm) Gauss-Seidel without a coloring from the
+ * setup: the coloring is computed for this relaxation only
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelax31MulticolorGaussSeidel( hypre_ParCSRMatrix *A,
+                                             hypre_ParVector    *f,
+                                             HYPRE_Int          *cf_marker,
+                                             HYPRE_Int           relax_points,
+                                             HYPRE_Int           symm,
+                                             hypre_ParVector    *u,
+                                             hypre_ParVector    *Vtemp,
+                                             hypre_ParVector    *Ztemp )
+{
+   HYPRE_Int  num_colors;
+   HYPRE_Int *color_starts, *color_perm;
+
+   hypre_ParCSRMatrixColorDiag(A, &num_colors, &color_starts, &color_perm);
+   hypre_BoomerAMGRelaxMulticolorGaussSeidel(A, f, cf_marker, relax_points, num_colors, color_starts,
+                                             color_perm, symm ? 0 : 1, u, Vtemp, Ztemp);
+
+   hypre_TFree(color_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(color_perm, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMulticolorSetup
+ *
+ * Colors the levels that are relaxed with relax types 31 or 32
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMulticolorSetup( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int            smooth_levels, smooth_coarsest, level;
+
+   smooth_levels   = (grid_relax_type[1] == 31 || grid_relax_type[1] == 32 ||
+                      grid_relax_type[2] == 31 || grid_relax_type[2] == 32);
+   smooth_coarsest = (grid_relax_type[3] == 31 || grid_relax_type[3] == 32);
+
+   if (!smooth_levels && !smooth_coarsest)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNumColors(amg_data)   = hypre_CTAlloc(HYPRE_Int,   num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataColorStarts(amg_data) = hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataColorPerm(amg_data)   = hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+
+   for (level = 0; level < num_levels; level++)
+   {
+      if (level < num_levels - 1 ? smooth_levels : smooth_coarsest)
+      {
+         hypre_ParCSRMatrixColorDiag(A_array[level],
+                                     &hypre_ParAMGDataNumColors(amg_data)[level],
+                                     &hypre_ParAMGDataColorStarts(amg_data)[level],
+                                     &hypre_ParAMGDataColorPerm(amg_data)[level]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMulticolorDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMulticolorDestroy( void      *amg_vdata,
+                                  HYPRE_Int  num_levels )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int         level;
+
+   if (hypre_ParAMGDataColorStarts(amg_data))
+   {
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_TFree(hypre_ParAMGDataColorStarts(amg_data)[level], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorPerm(amg_data)[level], HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_TFree(hypre_ParAMGDataNumColors(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataColorStarts(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataColorPerm(amg_data), HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
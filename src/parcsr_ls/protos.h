@@ -438,6 +438,9 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver , HYPRE_Int nonga
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver , HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver , HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver , HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetReuseSetup ( HYPRE_Solver solver , HYPRE_Int reuse_setup );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision ( HYPRE_Solver solver , HYPRE_Int mixed_precision );
+HYPRE_Int HYPRE_BoomerAMGSetAsyncRelaxTime ( HYPRE_Solver solver , HYPRE_Real async_relax_time );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver , HYPRE_Int slu_threshold );
 #endif
@@ -497,6 +500,33 @@ HYPRE_Int HYPRE_BlockTridiagSetAMGNumSweeps ( HYPRE_Solver solver , HYPRE_Int nu
 HYPRE_Int HYPRE_BlockTridiagSetAMGRelaxType ( HYPRE_Solver solver , HYPRE_Int relax_type );
 HYPRE_Int HYPRE_BlockTridiagSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
 
+/* HYPRE_parcsr_block_gmres.c */
+HYPRE_Int HYPRE_ParCSRBlockGMRESCreate ( MPI_Comm comm , HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRBlockGMRESDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRBlockGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
+HYPRE_Int HYPRE_ParCSRBlockGMRESSetLogging ( HYPRE_Solver solver , HYPRE_Int logging );
+HYPRE_Int HYPRE_ParCSRBlockGMRESGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_ParCSRBlockGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+
+/* HYPRE_parcsr_block_pcg.c */
+HYPRE_Int HYPRE_ParCSRBlockPCGCreate ( MPI_Comm comm , HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRBlockPCGDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRBlockPCGSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetLogging ( HYPRE_Solver solver , HYPRE_Int logging );
+HYPRE_Int HYPRE_ParCSRBlockPCGGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_ParCSRBlockPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+
 /* HYPRE_parcsr_cgnr.c */
 HYPRE_Int HYPRE_ParCSRCGNRCreate ( MPI_Comm comm , HYPRE_Solver *solver );
 HYPRE_Int HYPRE_ParCSRCGNRDestroy ( HYPRE_Solver solver );
@@ -948,6 +978,9 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data , HYPRE_Int nongalerk_num_
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data , HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data , HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data , HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetReuseSetup ( void *data , HYPRE_Int reuse_setup );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecision ( void *data , HYPRE_Int mixed_precision );
+HYPRE_Int hypre_BoomerAMGSetAsyncRelaxTime ( void *data , HYPRE_Real async_relax_time );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data , HYPRE_Int slu_threshold );
 #endif
@@ -960,6 +993,17 @@ HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
+/* par_amg_mixed_precision.c */
+HYPRE_Int hypre_BoomerAMGMixedPrecisionSetup ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMixedPrecisionRestore ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMixedPrecisionAttachFine ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMixedPrecisionDetachFine ( void *amg_vdata );
+
+/* par_amg_solve_mv.c */
+HYPRE_Int hypre_BoomerAMGMultiVectorDataDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGCycleMultiVector ( void *amg_vdata , hypre_ParVector **F_mv_array , hypre_ParVector **U_mv_array );
+HYPRE_Int hypre_BoomerAMGSolveMultiVector ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+
 /* par_amg_solveT.c */
 HYPRE_Int hypre_BoomerAMGSolveT ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 HYPRE_Int hypre_BoomerAMGCycleT ( void *amg_vdata , hypre_ParVector **F_array , hypre_ParVector **U_array );
@@ -974,6 +1018,36 @@ HYPRE_Int hypre_AmgCGCGraphAssemble ( hypre_ParCSRMatrix *S , HYPRE_Int *vertexr
 HYPRE_Int hypre_AmgCGCChoose ( hypre_CSRMatrix *G , HYPRE_Int *vertexrange , HYPRE_Int mpisize , HYPRE_Int **coarse );
 HYPRE_Int hypre_AmgCGCBoundaryFix ( hypre_ParCSRMatrix *S , HYPRE_Int *CF_marker , HYPRE_Int *CF_marker_offd );
 
+/* par_block_gmres.c */
+void *hypre_ParCSRBlockGMRESCreate ( MPI_Comm comm );
+HYPRE_Int hypre_ParCSRBlockGMRESDestroy ( void *gmres_vdata );
+HYPRE_Int hypre_ParCSRBlockGMRESSetup ( void *gmres_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
+HYPRE_Int hypre_ParCSRBlockGMRESSolve ( void *gmres_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
+HYPRE_Int hypre_ParCSRBlockGMRESSetKDim ( void *gmres_vdata , HYPRE_Int k_dim );
+HYPRE_Int hypre_ParCSRBlockGMRESSetTol ( void *gmres_vdata , HYPRE_Real tol );
+HYPRE_Int hypre_ParCSRBlockGMRESSetMaxIter ( void *gmres_vdata , HYPRE_Int max_iter );
+HYPRE_Int hypre_ParCSRBlockGMRESSetPrecond ( void *gmres_vdata , HYPRE_Int (*precond )(void*, void*, void*, void*), HYPRE_Int (*precond_setup )(void*, void*, void*, void*), void *precond_data );
+HYPRE_Int hypre_ParCSRBlockGMRESSetPrintLevel ( void *gmres_vdata , HYPRE_Int print_level );
+HYPRE_Int hypre_ParCSRBlockGMRESSetLogging ( void *gmres_vdata , HYPRE_Int logging );
+HYPRE_Int hypre_ParCSRBlockGMRESGetNumIterations ( void *gmres_vdata , HYPRE_Int *num_iterations );
+HYPRE_Int hypre_ParCSRBlockGMRESGetFinalRelativeResidualNorm ( void *gmres_vdata , HYPRE_Real *relative_residual_norm );
+
+/* par_block_pcg.c */
+void *hypre_ParCSRBlockPCGCreate ( MPI_Comm comm );
+HYPRE_Int hypre_ParCSRBlockPCGDestroy ( void *pcg_vdata );
+HYPRE_Int hypre_ParCSRBlockPCGSetup ( void *pcg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
+HYPRE_Int hypre_ParCSRBlockPCGSolve ( void *pcg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
+HYPRE_Int hypre_ParCSRBlockPCGSetTol ( void *pcg_vdata , HYPRE_Real tol );
+HYPRE_Int hypre_ParCSRBlockPCGSetMaxIter ( void *pcg_vdata , HYPRE_Int max_iter );
+HYPRE_Int hypre_ParCSRBlockPCGSetPrecond ( void *pcg_vdata , HYPRE_Int (*precond )(void*, void*, void*, void*), HYPRE_Int (*precond_setup )(void*, void*, void*, void*), void *precond_data );
+HYPRE_Int hypre_ParCSRBlockPCGSetPrintLevel ( void *pcg_vdata , HYPRE_Int print_level );
+HYPRE_Int hypre_ParCSRBlockPCGSetLogging ( void *pcg_vdata , HYPRE_Int logging );
+HYPRE_Int hypre_ParCSRBlockPCGGetNumIterations ( void *pcg_vdata , HYPRE_Int *num_iterations );
+HYPRE_Int hypre_ParCSRBlockPCGGetFinalRelativeResidualNorm ( void *pcg_vdata , HYPRE_Real *relative_residual_norm );
+hypre_ParVector *hypre_ParCSRBlockKrylovWorkVector ( hypre_ParVector *b );
+void hypre_ParCSRBlockKrylovLocalDots ( hypre_ParVector *x , hypre_ParVector *y , HYPRE_Real *dots );
+void hypre_ParCSRBlockKrylovAxpby ( HYPRE_Real *alpha , hypre_ParVector *x , HYPRE_Real *beta , hypre_ParVector *y );
+
 /* par_cg_relax_wt.c */
 HYPRE_Int hypre_BoomerAMGCGRelaxWt ( void *amg_vdata , HYPRE_Int level , HYPRE_Int num_cg_sweeps , HYPRE_Real *rlx_wt_ptr );
 HYPRE_Int hypre_Bisection ( HYPRE_Int n , HYPRE_Real *diag , HYPRE_Real *offd , HYPRE_Real y , HYPRE_Real z , HYPRE_Real tol , HYPRE_Int k , HYPRE_Real *ev_ptr );
@@ -1149,6 +1223,7 @@ HYPRE_Int hypre_BoomerAMGRelax1GaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVect
 HYPRE_Int hypre_BoomerAMGRelax2GaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, hypre_ParVector *u );
 
 HYPRE_Int hypre_BoomerAMGRelax5ChaoticHybridGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGRelax30AsyncHybridGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real *l1_norms, hypre_ParVector *u, HYPRE_Int max_sweeps, HYPRE_Real max_time );
 
 HYPRE_Int hypre_BoomerAMGRelax3HybridGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
 
@@ -1179,12 +1254,22 @@ HYPRE_Int hypre_BoomerAMGRelaxTwoStageGaussSeidelDevice ( hypre_ParCSRMatrix *A,
 HYPRE_Int hypre_BoomerAMGRelax11TwoStageGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
 
 HYPRE_Int hypre_BoomerAMGRelax12TwoStageGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVectorSupported( HYPRE_Int relax_type );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVector( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp );
 
 /* par_realx_device.c */
 HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidelDevice( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp, HYPRE_Int GS_order, HYPRE_Int Symm );
 
 /* par_relax_interface.c */
 HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVectorIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_param , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp );
+
+/* par_relax_multicolor.c */
+HYPRE_Int hypre_ParCSRMatrixColorDiag ( hypre_ParCSRMatrix *A , HYPRE_Int *num_colors_ptr , HYPRE_Int **color_starts_ptr , HYPRE_Int **color_perm_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorGaussSeidel ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Int num_colors , HYPRE_Int *color_starts , HYPRE_Int *color_perm , HYPRE_Int color_order , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelax31MulticolorGaussSeidel ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Int symm , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGMulticolorSetup ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMulticolorDestroy ( void *amg_vdata , HYPRE_Int num_levels );
 
 /* par_relax_more.c */
 HYPRE_Int hypre_ParCSRMaxEigEstimate ( hypre_ParCSRMatrix *A , HYPRE_Int scale , HYPRE_Real *max_eig );
@@ -1287,7 +1372,10 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_ParKrylovInnerProdStart ( HYPRE_Int n , void **x , void **y , HYPRE_Real *result , void **request );
+HYPRE_Int hypre_ParKrylovInnerProdWait ( void *request );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x , void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
+HYPRE_Int hypre_ParKrylovMassInnerProdMult ( void **x , HYPRE_Int s , void **y , HYPRE_Int k , HYPRE_Int unroll , void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x , void *y , void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x , void *y );
@@ -93,6 +93,36 @@ HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixReadBinary( MPI_Comm            comm,
+                              const char         *file_name,
+                              HYPRE_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *matrix = (HYPRE_ParCSRMatrix) hypre_ParCSRMatrixReadBinary( comm, file_name );
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixPrintBinary( HYPRE_ParCSRMatrix  matrix,
+                               const char         *file_name )
+{
+   return ( hypre_ParCSRMatrixPrintBinary( (hypre_ParCSRMatrix *) matrix,
+                                           file_name ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRMatrixGetComm
  *--------------------------------------------------------------------------*/
@@ -404,3 +434,84 @@ HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex      alpha,
                alpha, (hypre_ParCSRMatrix *) A,
                (hypre_ParVector *) x, beta, (hypre_ParVector *) y) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetSpMVFormat
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetSpMVFormat( HYPRE_ParCSRMatrix matrix,
+                                 HYPRE_Int          format )
+{
+   return ( hypre_ParCSRMatrixSetSpMVFormat( (hypre_ParCSRMatrix *) matrix,
+                                             format ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetParCSRMatvecOverlap
+ *
+ * Global switch for all host ParCSR matvecs: the interior rows (no offd
+ * entries) are computed in blocks of progress_rows rows while the halo
+ * exchange is in flight, and the exchange is tested for completion between
+ * blocks; the boundary rows are computed after it (0: off (default)).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetParCSRMatvecOverlap( HYPRE_Int progress_rows )
+{
+   if (progress_rows < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleParMatvecOverlap(hypre_handle()) = progress_rows;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetParCSRCommNeighborColl
+ *
+ * Global switch: exchanges the halo data of ParCSR comm packages with one
+ * MPI-3 neighborhood all-to-all on a distributed graph communicator, instead
+ * of one point-to-point message per neighbor (0: off (default), 1: on).
+ * The graph communicators are built on the first matvec with a matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetParCSRCommNeighborColl( HYPRE_Int use_neighbor_coll )
+{
+   if (use_neighbor_coll < 0 || use_neighbor_coll > 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleCommNeighborColl(hypre_handle()) = use_neighbor_coll;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetParMatmulFused
+ *
+ * Global switch for host hypre_ParMatmul: form the diag and offd blocks of
+ * the product with the fused two-pass marker kernel (1), instead of one
+ * hypre_CSRMatrixMultiplyHost call on the concatenated blocks (0, default).
+ * Both give the same matrices; the fused kernel is kept for comparison.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetParMatmulFused( HYPRE_Int use_fused )
+{
+   if (use_fused < 0 || use_fused > 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleParMatmulFused(hypre_handle()) = use_fused;
+
+   return hypre_error_flag;
+}
@@ -40,6 +40,8 @@ HYPRE_Int HYPRE_ParCSRMatrixDestroy( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixInitialize( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead( MPI_Comm comm , const char *file_name , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix matrix , const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixReadBinary( MPI_Comm comm , const char *file_name , HYPRE_ParCSRMatrix *matrix );
+HYPRE_Int HYPRE_ParCSRMatrixPrintBinary( HYPRE_ParCSRMatrix matrix , const char *file_name );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm( HYPRE_ParCSRMatrix matrix , MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims( HYPRE_ParCSRMatrix matrix , HYPRE_BigInt *M , HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning( HYPRE_ParCSRMatrix matrix , HYPRE_BigInt **row_partitioning_ptr );
@@ -50,6 +52,10 @@ HYPRE_Int HYPRE_ParCSRMatrixRestoreRow( HYPRE_ParCSRMatrix matrix , HYPRE_BigInt
 HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix( MPI_Comm comm , HYPRE_CSRMatrix A_CSR , HYPRE_BigInt *row_partitioning , HYPRE_BigInt *col_partitioning , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixMatvec( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetSpMVFormat( HYPRE_ParCSRMatrix matrix , HYPRE_Int format );
+HYPRE_Int HYPRE_SetParCSRMatvecOverlap( HYPRE_Int progress_rows );
+HYPRE_Int HYPRE_SetParCSRCommNeighborColl( HYPRE_Int use_neighbor_coll );
+HYPRE_Int HYPRE_SetParMatmulFused( HYPRE_Int use_fused );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate( MPI_Comm comm , HYPRE_BigInt global_size , HYPRE_BigInt *partitioning , HYPRE_ParVector *vector );
@@ -57,6 +63,8 @@ HYPRE_Int HYPRE_ParVectorDestroy( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorInitialize( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead( MPI_Comm comm , const char *file_name , HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint( HYPRE_ParVector vector , const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadBinary( MPI_Comm comm , const char *file_name , HYPRE_ParVector *vector );
+HYPRE_Int HYPRE_ParVectorPrintBinary( HYPRE_ParVector vector , const char *file_name );
 HYPRE_Int HYPRE_ParVectorSetConstantValues( HYPRE_ParVector vector , HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues( HYPRE_ParVector vector , HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy( HYPRE_ParVector x , HYPRE_ParVector y );
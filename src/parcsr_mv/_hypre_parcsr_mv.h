@@ -63,6 +63,22 @@ typedef struct
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNeighborComm:
+ *   distributed graph communicators of a comm package for exchanging
+ *   data with neighborhood collectives
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_MPI_Comm        comm;          /* receive from recv_procs, send to send_procs */
+   hypre_MPI_Comm        comm_T;        /* receive from send_procs, send to recv_procs */
+   hypre_int            *send_counts;   /* per send proc, in entries */
+   hypre_int            *send_displs;
+   hypre_int            *recv_counts;   /* per recv proc, in entries */
+   hypre_int            *recv_displs;
+} hypre_ParCSRNeighborComm;
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                     comm;
@@ -81,6 +97,9 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
+   /* graph communicators, if the neighborhood collective backend is used */
+   hypre_ParCSRNeighborComm    *neighbor_comm;
+
 #ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
@@ -116,6 +135,7 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -156,6 +176,17 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_ParCSRNeighborComm
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRNeighborCommComm(neighbor_comm)               (neighbor_comm -> comm)
+#define hypre_ParCSRNeighborCommCommT(neighbor_comm)              (neighbor_comm -> comm_T)
+#define hypre_ParCSRNeighborCommSendCounts(neighbor_comm)         (neighbor_comm -> send_counts)
+#define hypre_ParCSRNeighborCommSendDispls(neighbor_comm)         (neighbor_comm -> send_displs)
+#define hypre_ParCSRNeighborCommRecvCounts(neighbor_comm)         (neighbor_comm -> recv_counts)
+#define hypre_ParCSRNeighborCommRecvDispls(neighbor_comm)         (neighbor_comm -> recv_displs)
+
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 
 /******************************************************************************
@@ -484,6 +515,147 @@ typedef struct
 
 #endif
 
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header info for the symbolic/numeric ParCSR matrix-matrix products
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PAR_CSR_MATMAT_PLAN_HEADER
+#define hypre_PAR_CSR_MATMAT_PLAN_HEADER
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPattern
+ *
+ * Copy of the local pattern of an operand of the symbolic phase, with its
+ * hash.  The hash rejects most changed patterns cheaply; a matching hash is
+ * confirmed by comparing the arrays.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ulonglongint    hash;
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int            *diag_i;
+   HYPRE_Int            *diag_j;
+   HYPRE_Int            *offd_i;
+   HYPRE_Int            *offd_j;
+   HYPRE_BigInt         *col_map_offd;
+
+} hypre_ParCSRMatMatPattern;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlan
+ *
+ * Output of the symbolic phase of C = A * B that the numeric phase needs
+ * besides A, B and C: the exchange of the external rows of B and their
+ * pattern, the column maps of B and C, and the thread workspace.
+ *
+ * Columns of C are numbered in a combined space: the num_cols_diag_B local
+ * columns first, followed by the num_cols_full offd columns of B and B_ext.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* exchange of the external rows of B (the offd columns of A) */
+   HYPRE_Int             num_rows_send;
+   HYPRE_Int            *send_rows;
+   HYPRE_Int            *send_offsets;
+   hypre_ParCSRCommPkg  *comm_pkg_j;
+   HYPRE_Complex        *send_data;
+
+   /* external rows of B in the combined column space */
+   HYPRE_Int             num_rows_ext;
+   HYPRE_Int            *B_ext_i;
+   HYPRE_Int            *B_ext_j;
+   HYPRE_Complex        *B_ext_data;
+
+   /* column maps */
+   HYPRE_Int             num_cols_diag_B;
+   HYPRE_Int             num_cols_full;
+   HYPRE_Int            *map_B_to_full;
+   HYPRE_Int            *map_C_to_full;
+
+   /* patterns of A and B in the symbolic phase */
+   hypre_ParCSRMatMatPattern  pattern_A;
+   hypre_ParCSRMatMatPattern  pattern_B;
+
+   /* per-thread accumulator positions, num_cols_diag_B + num_cols_full each */
+   HYPRE_Int             num_threads;
+   HYPRE_Int           **workspace;
+
+} hypre_ParCSRMatMatPlan;
+
+#define hypre_ParCSRMatMatPlanNumRowsSend(plan)   ((plan) -> num_rows_send)
+#define hypre_ParCSRMatMatPlanSendRows(plan)      ((plan) -> send_rows)
+#define hypre_ParCSRMatMatPlanSendOffsets(plan)   ((plan) -> send_offsets)
+#define hypre_ParCSRMatMatPlanCommPkgJ(plan)      ((plan) -> comm_pkg_j)
+#define hypre_ParCSRMatMatPlanSendData(plan)      ((plan) -> send_data)
+#define hypre_ParCSRMatMatPlanNumRowsExt(plan)    ((plan) -> num_rows_ext)
+#define hypre_ParCSRMatMatPlanBExtI(plan)         ((plan) -> B_ext_i)
+#define hypre_ParCSRMatMatPlanBExtJ(plan)         ((plan) -> B_ext_j)
+#define hypre_ParCSRMatMatPlanBExtData(plan)      ((plan) -> B_ext_data)
+#define hypre_ParCSRMatMatPlanNumColsDiagB(plan)  ((plan) -> num_cols_diag_B)
+#define hypre_ParCSRMatMatPlanNumColsFull(plan)   ((plan) -> num_cols_full)
+#define hypre_ParCSRMatMatPlanMapBToFull(plan)    ((plan) -> map_B_to_full)
+#define hypre_ParCSRMatMatPlanMapCToFull(plan)    ((plan) -> map_C_to_full)
+#define hypre_ParCSRMatMatPlanPatternA(plan)      ((plan) -> pattern_A)
+#define hypre_ParCSRMatMatPlanPatternB(plan)      ((plan) -> pattern_B)
+#define hypre_ParCSRMatMatPlanNumThreads(plan)    ((plan) -> num_threads)
+#define hypre_ParCSRMatMatPlanWorkspace(plan)     ((plan) -> workspace)
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlan
+ *
+ * Symbolic phase of RAP = RT^T * A * P, computed as RT^T * (A * P).  The
+ * transpose of RT and the intermediate product A * P are kept.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix      *R;
+   hypre_ParCSRMatrix      *AP;
+   hypre_ParCSRMatMatPlan  *AP_plan;
+   hypre_ParCSRMatMatPlan  *RAP_plan;
+
+} hypre_ParCSRRAPPlan;
+
+#define hypre_ParCSRRAPPlanR(plan)        ((plan) -> R)
+#define hypre_ParCSRRAPPlanAP(plan)       ((plan) -> AP)
+#define hypre_ParCSRRAPPlanAPPlan(plan)   ((plan) -> AP_plan)
+#define hypre_ParCSRRAPPlanRAPPlan(plan)  ((plan) -> RAP_plan)
+
+#endif
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#ifndef hypre_PAR_BINARY_IO
+#define hypre_PAR_BINARY_IO
+
+/*--------------------------------------------------------------------------
+ * Binary checkpoint files written by hypre_ParCSRMatrixPrintBinary and
+ * hypre_ParVectorPrintBinary.  The file layout is described in
+ * par_binary_io.c; all header entries are hypre_ulonglongint.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BINARY_IO_MATRIX_MAGIC  0x6879707265435352ULL  /* "hypreCSR" */
+#define hypre_BINARY_IO_VECTOR_MAGIC  0x6879707265564543ULL  /* "hypreVEC" */
+#define hypre_BINARY_IO_VERSION       1
+#define hypre_BINARY_IO_HEADER_SIZE   8
+
+#endif /* hypre_PAR_BINARY_IO */
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -676,6 +848,8 @@ HYPRE_Int HYPRE_ParCSRMatrixInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixBigInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead ( MPI_Comm comm , const char *file_name , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint ( HYPRE_ParCSRMatrix matrix , const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixReadBinary ( MPI_Comm comm , const char *file_name , HYPRE_ParCSRMatrix *matrix );
+HYPRE_Int HYPRE_ParCSRMatrixPrintBinary ( HYPRE_ParCSRMatrix matrix , const char *file_name );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm ( HYPRE_ParCSRMatrix matrix , MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims ( HYPRE_ParCSRMatrix matrix , HYPRE_BigInt *M , HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning ( HYPRE_ParCSRMatrix matrix , HYPRE_BigInt **row_partitioning_ptr );
@@ -688,6 +862,10 @@ HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix ( MPI_Comm comm , HYPRE_CSRMatrix A_CSR
 HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix_WithNewPartitioning ( MPI_Comm comm , HYPRE_CSRMatrix A_CSR , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetSpMVFormat ( HYPRE_ParCSRMatrix matrix , HYPRE_Int format );
+HYPRE_Int HYPRE_SetParCSRMatvecOverlap ( HYPRE_Int progress_rows );
+HYPRE_Int HYPRE_SetParCSRCommNeighborColl ( HYPRE_Int use_neighbor_coll );
+HYPRE_Int HYPRE_SetParMatmulFused ( HYPRE_Int use_fused );
 HYPRE_Int hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int max_row_elmts, HYPRE_Int rescale, HYPRE_Int nrm_type);
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate ( MPI_Comm comm , HYPRE_BigInt global_size , HYPRE_BigInt *partitioning , HYPRE_ParVector *vector );
@@ -696,6 +874,8 @@ HYPRE_Int HYPRE_ParVectorDestroy ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorInitialize ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead ( MPI_Comm comm , const char *file_name , HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint ( HYPRE_ParVector vector , const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadBinary ( MPI_Comm comm , const char *file_name , HYPRE_ParVector *vector );
+HYPRE_Int HYPRE_ParVectorPrintBinary ( HYPRE_ParVector vector , const char *file_name );
 HYPRE_Int HYPRE_ParVectorSetConstantValues ( HYPRE_ParVector vector , HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues ( HYPRE_ParVector vector , HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy ( HYPRE_ParVector x , HYPRE_ParVector y );
@@ -736,6 +916,12 @@ void hypre_ParChordMatrix_RowStarts ( hypre_ParChordMatrix *Ac , MPI_Comm comm ,
 HYPRE_Int hypre_ParChordMatrixToParCSRMatrix ( hypre_ParChordMatrix *Ac , MPI_Comm comm , hypre_ParCSRMatrix **pAp );
 HYPRE_Int hypre_ParCSRMatrixToParChordMatrix ( hypre_ParCSRMatrix *Ap , MPI_Comm comm , hypre_ParChordMatrix **pAc );
 
+/* par_binary_io.c */
+HYPRE_Int hypre_ParCSRMatrixPrintBinary ( hypre_ParCSRMatrix *matrix , const char *file_name );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixReadBinary ( MPI_Comm comm , const char *file_name );
+HYPRE_Int hypre_ParVectorPrintBinary ( hypre_ParVector *vector , const char *file_name );
+hypre_ParVector *hypre_ParVectorReadBinary ( MPI_Comm comm , const char *file_name , HYPRE_BigInt *partitioning );
+
 /* par_csr_aat.c */
 void hypre_ParAat_RowSizes ( HYPRE_Int **C_diag_i , HYPRE_Int **C_offd_i , HYPRE_Int *B_marker , HYPRE_Int *A_diag_i , HYPRE_Int *A_diag_j , HYPRE_Int *A_offd_i , HYPRE_Int *A_offd_j , HYPRE_BigInt *A_col_map_offd , HYPRE_Int *A_ext_i , HYPRE_BigInt *A_ext_j , HYPRE_BigInt *A_ext_row_map , HYPRE_Int *C_diag_size , HYPRE_Int *C_offd_size , HYPRE_Int num_rows_diag_A , HYPRE_Int num_cols_offd_A , HYPRE_Int num_rows_A_ext , HYPRE_BigInt first_col_diag_A , HYPRE_BigInt first_row_index_A );
 hypre_ParCSRMatrix *hypre_ParCSRAAt ( hypre_ParCSRMatrix *A );
@@ -747,6 +933,7 @@ hypre_IJAssumedPart *hypre_AssumedPartitionCreate ( MPI_Comm comm , HYPRE_BigInt
 HYPRE_Int hypre_ParCSRMatrixCreateAssumedPartition ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_AssumedPartitionDestroy ( hypre_IJAssumedPart *apart );
 HYPRE_Int hypre_GetAssumedPartitionProcFromRow ( MPI_Comm comm , HYPRE_BigInt row , HYPRE_BigInt global_first_row , HYPRE_BigInt global_num_rows , HYPRE_Int *proc_id );
+HYPRE_Int hypre_GetAssumedPartitionProcFromRow_v2 ( HYPRE_Int num_procs , HYPRE_BigInt row , HYPRE_BigInt global_first_row , HYPRE_BigInt global_num_rows , HYPRE_Int *proc_id );
 HYPRE_Int hypre_GetAssumedPartitionRowRange ( MPI_Comm comm , HYPRE_Int proc_id , HYPRE_BigInt global_first_row , HYPRE_BigInt global_num_rows , HYPRE_BigInt *row_start , HYPRE_BigInt *row_end );
 HYPRE_Int hypre_ParVectorCreateAssumedPartition ( hypre_ParVector *vector );
 
@@ -787,7 +974,11 @@ HYPRE_Int hypre_BooleanGenerateDiagAndOffd ( hypre_CSRBooleanMatrix *A , hypre_P
 /* par_csr_communication.c */
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_MemoryLocation send_memory_location, void *send_data_in, HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateMultiVector ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int num_vectors , void *send_data , void *recv_data );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
+HYPRE_Int hypre_ParCSRCommHandleTest ( hypre_ParCSRCommHandle *comm_handle , HYPRE_Int *flag );
+HYPRE_Int hypre_ParCSRCommPkgCreateNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm , HYPRE_BigInt *col_map_offd , HYPRE_BigInt first_col_diag , HYPRE_BigInt *col_starts , HYPRE_Int num_cols_diag , HYPRE_Int num_cols_offd , HYPRE_Int *p_num_recvs , HYPRE_Int **p_recv_procs , HYPRE_Int **p_recv_vec_starts , HYPRE_Int *p_num_sends , HYPRE_Int **p_send_procs , HYPRE_Int **p_send_map_starts , HYPRE_Int **p_send_map_elmts );
 HYPRE_Int
 hypre_ParCSRCommPkgCreate(MPI_Comm comm, HYPRE_BigInt *col_map_offd, HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag, HYPRE_Int num_cols_offd, hypre_ParCSRCommPkg *comm_pkg);
@@ -796,6 +987,16 @@ HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros , HYPRE_Int num_rows , HYPRE_Complex *a_data , HYPRE_Int *a_i , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_matrix_datatype );
 HYPRE_Int hypre_BuildCSRJDataType ( HYPRE_Int num_nonzeros , HYPRE_Complex *a_data , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_jdata_datatype );
 HYPRE_Int hypre_ParCSRFindExtendCommPkg(MPI_Comm comm, HYPRE_BigInt global_num_cols, HYPRE_BigInt first_col_diag, HYPRE_Int num_cols_diag, HYPRE_BigInt *col_starts, hypre_IJAssumedPart *apart, HYPRE_Int indices_len, HYPRE_BigInt *indices, hypre_ParCSRCommPkg **extend_comm_pkg);
+/* par_csr_matmat_plan.c */
+HYPRE_Int hypre_ParCSRMatMatPlanDestroy ( hypre_ParCSRMatMatPlan *plan );
+HYPRE_Int hypre_ParCSRMatMatPlanMatches ( hypre_ParCSRMatMatPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatSymbolic ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatMatPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatMatNumeric ( hypre_ParCSRMatMatPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+HYPRE_Int hypre_ParCSRRAPPlanMatches ( hypre_ParCSRRAPPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPSymbolic ( hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRRAPPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatrixRAPNumeric ( hypre_ParCSRRAPPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *RAP );
+
 /* par_csr_matop.c */
 void hypre_ParMatmul_RowSizes (HYPRE_MemoryLocation memory_location, HYPRE_Int **C_diag_i , HYPRE_Int **C_offd_i , HYPRE_Int *A_diag_i , HYPRE_Int *A_diag_j , HYPRE_Int *A_offd_i , HYPRE_Int *A_offd_j , HYPRE_Int *B_diag_i , HYPRE_Int *B_diag_j , HYPRE_Int *B_offd_i , HYPRE_Int *B_offd_j , HYPRE_Int *B_ext_diag_i , HYPRE_Int *B_ext_diag_j , HYPRE_Int *B_ext_offd_i , HYPRE_Int *B_ext_offd_j , HYPRE_Int *map_B_to_C , HYPRE_Int *C_diag_size , HYPRE_Int *C_offd_size , HYPRE_Int num_rows_diag_A , HYPRE_Int num_cols_offd_A , HYPRE_Int allsquare , HYPRE_Int num_cols_diag_B , HYPRE_Int num_cols_offd_B , HYPRE_Int num_cols_offd_C );
 hypre_ParCSRMatrix *hypre_ParMatmul ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B );
@@ -865,6 +1066,7 @@ HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetRowStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_row_starts );
 HYPRE_Int hypre_ParCSRMatrixSetColStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_col_starts );
+HYPRE_Int hypre_ParCSRMatrixSetSpMVFormat ( hypre_ParCSRMatrix *matrix , HYPRE_Int format );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm , const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix , const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix , const HYPRE_Int base_i , const HYPRE_Int base_j , const char *filename );
@@ -884,6 +1086,8 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixClone ( hypre_ParCSRMatrix *A, HYPRE_Int c
 #define hypre_ParCSRMatrixCompleteClone(A) hypre_ParCSRMatrixClone(A,0)
 hypre_ParCSRMatrix* hypre_ParCSRMatrixClone_v2 ( hypre_ParCSRMatrix *A, HYPRE_Int copy_data, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location);
+HYPRE_Int hypre_ParCSRMatrixConvertToSingle ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRMatrixConvertFromSingle ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int type);
 
 /* par_csr_matvec.c */
@@ -934,6 +1138,7 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha , hypre_ParVector *x , hypre
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x , hypre_ParVector **y , HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod );
+HYPRE_Int hypre_ParVectorMassInnerProdMult ( hypre_ParVector **x , HYPRE_Int s , hypre_ParVector **y , HYPRE_Int k , HYPRE_Int unroll , HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector **z, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x , HYPRE_Real *prod_y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm , hypre_Vector *v , HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
@@ -584,6 +584,8 @@ hypre_ParCSRCommPkgCreateApart
    hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts;
    hypre_ParCSRCommPkgSendMapElmts (comm_pkg) = send_map_elmts;
 
+   hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+
    return hypre_error_flag;
 
 
@@ -627,6 +629,8 @@ hypre_NewCommPkgDestroy(hypre_ParCSRMatrix *parcsr_A)
       hypre_TFree(hypre_ParCSRCommPkgRecvVecStarts(comm_pkg), HYPRE_MEMORY_HOST);
    }
 
+   hypre_ParCSRCommPkgDestroyNeighborComm(comm_pkg);
+
    hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    hypre_ParCSRMatrixCommPkg(parcsr_A) = NULL;  /*this gets freed again in destroy
                                                   parscr since there are two comm
@@ -0,0 +1,676 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Binary checkpoint files for hypre_ParCSRMatrix and hypre_ParVector.
+ *
+ * Each object is written by all ranks into ONE file with collective MPI-IO
+ * (plain stdio in sequential builds).  The file stores the global object, so
+ * it can be read back on any number of ranks.  Integers are stored as 64-bit
+ * unsigned values and values as HYPRE_Complex, both in native byte order.
+ *
+ * Matrix file layout:
+ *
+ *    header       8 x uint64: magic, version, global_num_rows,
+ *                 global_num_cols, global_num_nonzeros, sizeof(HYPRE_Complex),
+ *                 num_procs of the writer, 0
+ *    row_starts   (num_procs+1) x uint64, partitioning of the writer
+ *    col_starts   (num_procs+1) x uint64, partitioning of the writer
+ *    row_ptr      (global_num_rows+1) x uint64, global CSR row pointer
+ *    col_ind      global_num_nonzeros x uint64, global column indices
+ *    values       global_num_nonzeros x HYPRE_Complex
+ *
+ * Within a row the diag entries come first, followed by the offd ones.
+ *
+ * Vector file layout:
+ *
+ *    header       8 x uint64: magic, version, global_size, num_vectors,
+ *                 sizeof(HYPRE_Complex), num_procs of the writer, 0, 0
+ *    partitioning (num_procs+1) x uint64, partitioning of the writer
+ *    values       global_size x HYPRE_Complex
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/* MPI-IO counts are ints, so large transfers are split into chunks */
+#define hypre_BINARY_IO_CHUNK_SIZE    (1L << 30)
+
+typedef hypre_MPI_File hypre_BinaryFile;
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileOpen
+ *
+ * Collectively opens file_name for reading (write = 0) or for writing
+ * (write = 1); an existing file is truncated.  Returns 0 on success.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryFileOpen( MPI_Comm          comm,
+                      const char       *file_name,
+                      HYPRE_Int         write,
+                      hypre_BinaryFile *fh_ptr )
+{
+   HYPRE_Int amode = write ? (hypre_MPI_MODE_CREATE | hypre_MPI_MODE_WRONLY) : hypre_MPI_MODE_RDONLY;
+
+   if (hypre_MPI_File_open(comm, file_name, amode, hypre_MPI_INFO_NULL, fh_ptr) != hypre_MPI_SUCCESS)
+   {
+      return 1;
+   }
+   if (write && hypre_MPI_File_set_size(*fh_ptr, 0) != hypre_MPI_SUCCESS)
+   {
+      hypre_MPI_File_close(fh_ptr);
+      return 1;
+   }
+
+   return 0;
+}
+
+static void
+hypre_BinaryFileClose( hypre_BinaryFile *fh )
+{
+   hypre_MPI_File_close(fh);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileAccess
+ *
+ * Collectively writes (write = 1) or reads (write = 0) nbytes bytes at byte
+ * offset of the file.  Every rank of comm must call this, possibly with
+ * nbytes = 0.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryFileAccess( MPI_Comm          comm,
+                        hypre_BinaryFile  fh,
+                        HYPRE_Int         write,
+                        hypre_longint     offset,
+                        void             *buf,
+                        hypre_longint     nbytes )
+{
+   char             *cbuf = (char *) buf;
+   hypre_longint     num_chunks, max_num_chunks, chunk, len;
+   hypre_MPI_Status  status;
+   HYPRE_Int         count;
+   HYPRE_Int         ierr = 0;
+
+   num_chunks = (nbytes + hypre_BINARY_IO_CHUNK_SIZE - 1) / hypre_BINARY_IO_CHUNK_SIZE;
+   hypre_MPI_Allreduce(&num_chunks, &max_num_chunks, 1, hypre_MPI_LONG, hypre_MPI_MAX, comm);
+
+   for (chunk = 0; chunk < max_num_chunks; chunk++)
+   {
+      len = hypre_min(hypre_BINARY_IO_CHUNK_SIZE, nbytes);
+      len = hypre_max(len, 0);
+
+      if (write)
+      {
+         ierr |= (hypre_MPI_File_write_at_all(fh, (hypre_MPI_Offset) offset, cbuf, (HYPRE_Int) len,
+                                              hypre_MPI_BYTE, &status) != hypre_MPI_SUCCESS);
+      }
+      else
+      {
+         ierr |= (hypre_MPI_File_read_at_all(fh, (hypre_MPI_Offset) offset, cbuf, (HYPRE_Int) len,
+                                             hypre_MPI_BYTE, &status) != hypre_MPI_SUCCESS);
+      }
+      /* the sequential stubs report short transfers in their return code
+         and leave count alone */
+      count = (HYPRE_Int) len;
+      hypre_MPI_Get_count(&status, hypre_MPI_BYTE, &count);
+      ierr |= (count != (HYPRE_Int) len);
+
+      offset += len;
+      cbuf   += len;
+      nbytes -= len;
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileAccessStarts
+ *
+ * Writes or reads the entries my_id and my_id+1 of a (num_procs+1)-long
+ * partitioning array stored at offset.  Entry my_id+1 is only written by the
+ * last rank.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryFileAccessStarts( MPI_Comm            comm,
+                              hypre_BinaryFile    fh,
+                              HYPRE_Int           write,
+                              hypre_longint       offset,
+                              hypre_ulonglongint *starts )
+{
+   HYPRE_Int     my_id, num_procs;
+   hypre_longint count;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   count = (write && my_id < num_procs-1) ? 1 : 2;
+
+   return hypre_BinaryFileAccess(comm, fh, write,
+                                 offset + (hypre_longint) my_id * sizeof(hypre_ulonglongint),
+                                 starts, count * sizeof(hypre_ulonglongint));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileReadStarts
+ *
+ * Sets up the local [start, end) range for reading an object of the given
+ * global size: the writer's partitioning if it was written on the same
+ * number of ranks, an even split otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryFileReadStarts( MPI_Comm             comm,
+                            hypre_BinaryFile     fh,
+                            hypre_longint        offset,
+                            hypre_ulonglongint   file_num_procs,
+                            HYPRE_BigInt         global_size,
+                            HYPRE_BigInt       **starts_ptr )
+{
+   HYPRE_Int           my_id, num_procs, ierr = 0;
+   hypre_ulonglongint  file_starts[2];
+   HYPRE_BigInt       *starts;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if ((hypre_ulonglongint) num_procs == file_num_procs)
+   {
+      ierr = hypre_BinaryFileAccessStarts(comm, fh, 0, offset, file_starts);
+      starts = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+      starts[0] = (HYPRE_BigInt) file_starts[0];
+      starts[1] = (HYPRE_BigInt) file_starts[1];
+   }
+   else
+   {
+      hypre_GenerateLocalPartitioning(global_size, num_procs, my_id, &starts);
+   }
+
+   *starts_ptr = starts;
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintBinary( hypre_ParCSRMatrix *matrix,
+                               const char         *file_name )
+{
+   MPI_Comm             comm;
+   hypre_CSRMatrix     *diag, *offd;
+   HYPRE_Complex       *diag_data, *offd_data;
+   HYPRE_Int           *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_BigInt        *col_map_offd;
+   HYPRE_BigInt         first_row_index, first_col_diag, global_num_rows;
+   HYPRE_Int            num_rows, i, j, my_id, num_procs, ierr = 0;
+   hypre_longint        local_nnz, nnz_end, global_nnz, nnz_start, k;
+   hypre_longint        starts_offset, row_ptr_offset, col_offset, value_offset;
+   hypre_ulonglongint   header[hypre_BINARY_IO_HEADER_SIZE];
+   hypre_ulonglongint   starts[2];
+   hypre_ulonglongint  *row_ptr, *col_ind;
+   HYPRE_Complex       *values;
+   hypre_BinaryFile     fh;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   comm            = hypre_ParCSRMatrixComm(matrix);
+   diag            = hypre_ParCSRMatrixDiag(matrix);
+   offd            = hypre_ParCSRMatrixOffd(matrix);
+   diag_data       = hypre_CSRMatrixData(diag);
+   diag_i          = hypre_CSRMatrixI(diag);
+   diag_j          = hypre_CSRMatrixJ(diag);
+   offd_data       = hypre_CSRMatrixData(offd);
+   offd_i          = hypre_CSRMatrixI(offd);
+   offd_j          = hypre_CSRMatrixJ(offd);
+   col_map_offd    = hypre_ParCSRMatrixColMapOffd(matrix);
+   first_row_index = hypre_ParCSRMatrixFirstRowIndex(matrix);
+   first_col_diag  = hypre_ParCSRMatrixFirstColDiag(matrix);
+   global_num_rows = hypre_ParCSRMatrixGlobalNumRows(matrix);
+   num_rows        = hypre_CSRMatrixNumRows(diag);
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* position of the local entries in the global arrays */
+   local_nnz = (hypre_longint) diag_i[num_rows] + (hypre_longint) offd_i[num_rows];
+   hypre_MPI_Scan(&local_nnz, &nnz_end, 1, hypre_MPI_LONG, hypre_MPI_SUM, comm);
+   nnz_start  = nnz_end - local_nnz;
+   global_nnz = nnz_end;
+   hypre_MPI_Bcast(&global_nnz, 1, hypre_MPI_LONG, num_procs-1, comm);
+
+   starts_offset  = hypre_BINARY_IO_HEADER_SIZE * sizeof(hypre_ulonglongint);
+   row_ptr_offset = starts_offset + 2 * (num_procs+1) * sizeof(hypre_ulonglongint);
+   col_offset     = row_ptr_offset + (global_num_rows+1) * sizeof(hypre_ulonglongint);
+   value_offset   = col_offset + global_nnz * sizeof(hypre_ulonglongint);
+
+   row_ptr = hypre_TAlloc(hypre_ulonglongint, num_rows+1, HYPRE_MEMORY_HOST);
+   col_ind = hypre_TAlloc(hypre_ulonglongint, local_nnz, HYPRE_MEMORY_HOST);
+   values  = hypre_TAlloc(HYPRE_Complex, local_nnz, HYPRE_MEMORY_HOST);
+
+   k = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row_ptr[i] = (hypre_ulonglongint) (nnz_start + k);
+      for (j = diag_i[i]; j < diag_i[i+1]; j++)
+      {
+         col_ind[k]  = (hypre_ulonglongint) (first_col_diag + (HYPRE_BigInt) diag_j[j]);
+         values[k++] = diag_data[j];
+      }
+      for (j = offd_i[i]; j < offd_i[i+1]; j++)
+      {
+         col_ind[k]  = (hypre_ulonglongint) col_map_offd[offd_j[j]];
+         values[k++] = offd_data[j];
+      }
+   }
+   row_ptr[num_rows] = (hypre_ulonglongint) nnz_end;
+
+   if (hypre_BinaryFileOpen(comm, file_name, 1, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_ind, HYPRE_MEMORY_HOST);
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   header[0] = hypre_BINARY_IO_MATRIX_MAGIC;
+   header[1] = hypre_BINARY_IO_VERSION;
+   header[2] = (hypre_ulonglongint) global_num_rows;
+   header[3] = (hypre_ulonglongint) hypre_ParCSRMatrixGlobalNumCols(matrix);
+   header[4] = (hypre_ulonglongint) global_nnz;
+   header[5] = sizeof(HYPRE_Complex);
+   header[6] = (hypre_ulonglongint) num_procs;
+   header[7] = 0;
+   ierr |= hypre_BinaryFileAccess(comm, fh, 1, 0, header,
+                                  my_id ? 0 : sizeof(header));
+
+   starts[0] = (hypre_ulonglongint) hypre_ParCSRMatrixRowStarts(matrix)[0];
+   starts[1] = (hypre_ulonglongint) hypre_ParCSRMatrixRowStarts(matrix)[1];
+   ierr |= hypre_BinaryFileAccessStarts(comm, fh, 1, starts_offset, starts);
+   starts[0] = (hypre_ulonglongint) hypre_ParCSRMatrixColStarts(matrix)[0];
+   starts[1] = (hypre_ulonglongint) hypre_ParCSRMatrixColStarts(matrix)[1];
+   ierr |= hypre_BinaryFileAccessStarts(comm, fh, 1,
+                                        starts_offset + (num_procs+1) * sizeof(hypre_ulonglongint),
+                                        starts);
+
+   /* the last rank also writes the closing entry of row_ptr */
+   ierr |= hypre_BinaryFileAccess(comm, fh, 1,
+                                  row_ptr_offset + first_row_index * sizeof(hypre_ulonglongint),
+                                  row_ptr, (num_rows + (my_id == num_procs-1)) *
+                                  sizeof(hypre_ulonglongint));
+   ierr |= hypre_BinaryFileAccess(comm, fh, 1,
+                                  col_offset + nnz_start * sizeof(hypre_ulonglongint),
+                                  col_ind, local_nnz * sizeof(hypre_ulonglongint));
+   ierr |= hypre_BinaryFileAccess(comm, fh, 1,
+                                  value_offset + nnz_start * sizeof(HYPRE_Complex),
+                                  values, local_nnz * sizeof(HYPRE_Complex));
+
+   hypre_BinaryFileClose(&fh);
+
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(col_ind, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: incomplete write of binary matrix file\n");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinary
+ *
+ * Reads a file written by hypre_ParCSRMatrixPrintBinary.  If the file was
+ * written on the same number of ranks, the rows and columns are distributed
+ * as they were when written; otherwise they are split evenly.  For a square
+ * diag block the diagonal entry is stored first in each row.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRMatrixReadBinary( MPI_Comm    comm,
+                              const char *file_name )
+{
+   hypre_ParCSRMatrix  *matrix;
+   hypre_CSRMatrix     *diag, *offd;
+   HYPRE_Complex       *diag_data, *offd_data;
+   HYPRE_Int           *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_BigInt        *col_map_offd;
+   HYPRE_BigInt        *row_starts, *col_starts;
+   HYPRE_BigInt        *offd_cols = NULL;
+   HYPRE_BigInt         global_num_rows, global_num_cols, col, row;
+   HYPRE_BigInt         first_col_diag, last_col_diag;
+   HYPRE_Int            num_procs, num_rows, num_cols_offd, diag_first;
+   HYPRE_Int            i, ierr = 0;
+   hypre_longint        j, k, k_begin, k_end, local_nnz, nnz_diag, nnz_offd;
+   hypre_longint        starts_offset, row_ptr_offset, col_offset, value_offset;
+   hypre_ulonglongint   header[hypre_BINARY_IO_HEADER_SIZE];
+   hypre_ulonglongint  *row_ptr, *col_ind;
+   HYPRE_Complex       *values;
+   hypre_BinaryFile     fh;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (hypre_BinaryFileOpen(comm, file_name, 0, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open input file\n");
+      return NULL;
+   }
+
+   ierr = hypre_BinaryFileAccess(comm, fh, 0, 0, header, sizeof(header));
+   if (ierr || header[0] != hypre_BINARY_IO_MATRIX_MAGIC ||
+       header[1] != hypre_BINARY_IO_VERSION || header[5] != sizeof(HYPRE_Complex))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: not a compatible binary matrix file\n");
+      hypre_BinaryFileClose(&fh);
+      return NULL;
+   }
+
+   global_num_rows = (HYPRE_BigInt) header[2];
+   global_num_cols = (HYPRE_BigInt) header[3];
+
+   starts_offset  = hypre_BINARY_IO_HEADER_SIZE * sizeof(hypre_ulonglongint);
+   row_ptr_offset = starts_offset + 2 * (header[6]+1) * sizeof(hypre_ulonglongint);
+   col_offset     = row_ptr_offset + (header[2]+1) * sizeof(hypre_ulonglongint);
+   value_offset   = col_offset + header[4] * sizeof(hypre_ulonglongint);
+
+   ierr |= hypre_BinaryFileReadStarts(comm, fh, starts_offset, header[6],
+                                      global_num_rows, &row_starts);
+   ierr |= hypre_BinaryFileReadStarts(comm, fh,
+                                      starts_offset + (header[6]+1) * sizeof(hypre_ulonglongint),
+                                      header[6], global_num_cols, &col_starts);
+   if (row_starts[0] == col_starts[0] && row_starts[1] == col_starts[1])
+   {
+      hypre_TFree(col_starts, HYPRE_MEMORY_HOST);
+      col_starts = row_starts;
+   }
+   num_rows       = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+   first_col_diag = col_starts[0];
+   last_col_diag  = col_starts[1] - 1;
+   diag_first     = (row_starts[0] == col_starts[0] && row_starts[1] == col_starts[1]);
+
+   /* local slices of the global arrays */
+   row_ptr = hypre_TAlloc(hypre_ulonglongint, num_rows+1, HYPRE_MEMORY_HOST);
+   ierr |= hypre_BinaryFileAccess(comm, fh, 0,
+                                  row_ptr_offset + row_starts[0] * sizeof(hypre_ulonglongint),
+                                  row_ptr, (num_rows+1) * sizeof(hypre_ulonglongint));
+   local_nnz = (hypre_longint) (row_ptr[num_rows] - row_ptr[0]);
+
+   col_ind = hypre_TAlloc(hypre_ulonglongint, local_nnz, HYPRE_MEMORY_HOST);
+   values  = hypre_TAlloc(HYPRE_Complex, local_nnz, HYPRE_MEMORY_HOST);
+   ierr |= hypre_BinaryFileAccess(comm, fh, 0,
+                                  col_offset + row_ptr[0] * sizeof(hypre_ulonglongint),
+                                  col_ind, local_nnz * sizeof(hypre_ulonglongint));
+   ierr |= hypre_BinaryFileAccess(comm, fh, 0,
+                                  value_offset + row_ptr[0] * sizeof(HYPRE_Complex),
+                                  values, local_nnz * sizeof(HYPRE_Complex));
+
+   hypre_BinaryFileClose(&fh);
+
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: incomplete read of binary matrix file\n");
+   }
+
+   /* split into diag and offd, and build col_map_offd */
+   nnz_diag = 0;
+   for (k = 0; k < local_nnz; k++)
+   {
+      col = (HYPRE_BigInt) col_ind[k];
+      if (col >= first_col_diag && col <= last_col_diag)
+      {
+         nnz_diag++;
+      }
+   }
+   nnz_offd = local_nnz - nnz_diag;
+
+   num_cols_offd = 0;
+   if (nnz_offd)
+   {
+      offd_cols = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+      j = 0;
+      for (k = 0; k < local_nnz; k++)
+      {
+         col = (HYPRE_BigInt) col_ind[k];
+         if (col < first_col_diag || col > last_col_diag)
+         {
+            offd_cols[j++] = col;
+         }
+      }
+      hypre_BigQsort0(offd_cols, 0, (HYPRE_Int) nnz_offd - 1);
+      num_cols_offd = 1;
+      for (j = 1; j < nnz_offd; j++)
+      {
+         if (offd_cols[j] > offd_cols[num_cols_offd-1])
+         {
+            offd_cols[num_cols_offd++] = offd_cols[j];
+         }
+      }
+   }
+
+   matrix = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_cols,
+                                     row_starts, col_starts, num_cols_offd,
+                                     (HYPRE_Int) nnz_diag, (HYPRE_Int) nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   diag         = hypre_ParCSRMatrixDiag(matrix);
+   offd         = hypre_ParCSRMatrixOffd(matrix);
+   diag_data    = hypre_CSRMatrixData(diag);
+   diag_i       = hypre_CSRMatrixI(diag);
+   diag_j       = hypre_CSRMatrixJ(diag);
+   offd_data    = hypre_CSRMatrixData(offd);
+   offd_i       = hypre_CSRMatrixI(offd);
+   offd_j       = hypre_CSRMatrixJ(offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      col_map_offd[i] = offd_cols[i];
+   }
+
+   nnz_diag = 0;
+   nnz_offd = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row = row_starts[0] + (HYPRE_BigInt) i;
+      diag_i[i] = (HYPRE_Int) nnz_diag;
+      offd_i[i] = (HYPRE_Int) nnz_offd;
+      k_begin   = (hypre_longint) (row_ptr[i]   - row_ptr[0]);
+      k_end     = (hypre_longint) (row_ptr[i+1] - row_ptr[0]);
+
+      if (diag_first)
+      {
+         for (k = k_begin; k < k_end; k++)
+         {
+            if ((HYPRE_BigInt) col_ind[k] == row)
+            {
+               diag_j[nnz_diag]      = i;
+               diag_data[nnz_diag++] = values[k];
+               break;
+            }
+         }
+      }
+
+      for (k = k_begin; k < k_end; k++)
+      {
+         col = (HYPRE_BigInt) col_ind[k];
+         if (col >= first_col_diag && col <= last_col_diag)
+         {
+            if (!diag_first || col != row)
+            {
+               diag_j[nnz_diag]      = (HYPRE_Int) (col - first_col_diag);
+               diag_data[nnz_diag++] = values[k];
+            }
+         }
+         else
+         {
+            offd_j[nnz_offd]      = hypre_BigBinarySearch(col_map_offd, col, num_cols_offd);
+            offd_data[nnz_offd++] = values[k];
+         }
+      }
+   }
+   diag_i[num_rows] = (HYPRE_Int) nnz_diag;
+   offd_i[num_rows] = (HYPRE_Int) nnz_offd;
+
+   hypre_TFree(offd_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(col_ind, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatrixSetNumNonzeros(matrix);
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintBinary( hypre_ParVector *vector,
+                            const char      *file_name )
+{
+   MPI_Comm             comm;
+   HYPRE_BigInt        *partitioning;
+   HYPRE_Int            my_id, num_procs, ierr = 0;
+   hypre_longint        starts_offset, value_offset, local_size;
+   hypre_ulonglongint   header[hypre_BINARY_IO_HEADER_SIZE];
+   hypre_ulonglongint   starts[2];
+   hypre_BinaryFile     fh;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (hypre_ParVectorNumVectors(vector) != 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary output of multivectors not supported\n");
+      return hypre_error_flag;
+   }
+
+   comm         = hypre_ParVectorComm(vector);
+   partitioning = hypre_ParVectorPartitioning(vector);
+   local_size   = (hypre_longint) (partitioning[1] - partitioning[0]);
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   starts_offset = hypre_BINARY_IO_HEADER_SIZE * sizeof(hypre_ulonglongint);
+   value_offset  = starts_offset + (num_procs+1) * sizeof(hypre_ulonglongint);
+
+   if (hypre_BinaryFileOpen(comm, file_name, 1, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   header[0] = hypre_BINARY_IO_VECTOR_MAGIC;
+   header[1] = hypre_BINARY_IO_VERSION;
+   header[2] = (hypre_ulonglongint) hypre_ParVectorGlobalSize(vector);
+   header[3] = 1;
+   header[4] = sizeof(HYPRE_Complex);
+   header[5] = (hypre_ulonglongint) num_procs;
+   header[6] = 0;
+   header[7] = 0;
+   ierr |= hypre_BinaryFileAccess(comm, fh, 1, 0, header,
+                                  my_id ? 0 : sizeof(header));
+
+   starts[0] = (hypre_ulonglongint) partitioning[0];
+   starts[1] = (hypre_ulonglongint) partitioning[1];
+   ierr |= hypre_BinaryFileAccessStarts(comm, fh, 1, starts_offset, starts);
+
+   ierr |= hypre_BinaryFileAccess(comm, fh, 1,
+                                  value_offset + partitioning[0] * sizeof(HYPRE_Complex),
+                                  hypre_VectorData(hypre_ParVectorLocalVector(vector)),
+                                  local_size * sizeof(HYPRE_Complex));
+
+   hypre_BinaryFileClose(&fh);
+
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: incomplete write of binary vector file\n");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorReadBinary
+ *
+ * Reads a file written by hypre_ParVectorPrintBinary.  If partitioning is
+ * not NULL it gives the local range (two entries, owned by the vector
+ * afterwards, as in hypre_ParVectorCreate); otherwise the writer's
+ * partitioning is used if the rank counts agree and an even split if not.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVector *
+hypre_ParVectorReadBinary( MPI_Comm      comm,
+                           const char   *file_name,
+                           HYPRE_BigInt *partitioning )
+{
+   hypre_ParVector     *vector;
+   HYPRE_BigInt         global_size;
+   HYPRE_Int            ierr = 0;
+   hypre_longint        starts_offset, value_offset;
+   hypre_ulonglongint   header[hypre_BINARY_IO_HEADER_SIZE];
+   hypre_BinaryFile     fh;
+
+   if (hypre_BinaryFileOpen(comm, file_name, 0, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open input file\n");
+      return NULL;
+   }
+
+   ierr = hypre_BinaryFileAccess(comm, fh, 0, 0, header, sizeof(header));
+   if (ierr || header[0] != hypre_BINARY_IO_VECTOR_MAGIC ||
+       header[1] != hypre_BINARY_IO_VERSION || header[4] != sizeof(HYPRE_Complex))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: not a compatible binary vector file\n");
+      hypre_BinaryFileClose(&fh);
+      return NULL;
+   }
+
+   global_size   = (HYPRE_BigInt) header[2];
+   starts_offset = hypre_BINARY_IO_HEADER_SIZE * sizeof(hypre_ulonglongint);
+   value_offset  = starts_offset + (header[5]+1) * sizeof(hypre_ulonglongint);
+
+   if (!partitioning)
+   {
+      ierr |= hypre_BinaryFileReadStarts(comm, fh, starts_offset, header[5],
+                                         global_size, &partitioning);
+   }
+
+   vector = hypre_ParVectorCreate(comm, global_size, partitioning);
+   hypre_ParVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+
+   ierr |= hypre_BinaryFileAccess(comm, fh, 0,
+                                  value_offset + partitioning[0] * sizeof(HYPRE_Complex),
+                                  hypre_VectorData(hypre_ParVectorLocalVector(vector)),
+                                  (partitioning[1] - partitioning[0]) * sizeof(HYPRE_Complex));
+
+   hypre_BinaryFileClose(&fh);
+
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: incomplete read of binary vector file\n");
+   }
+
+   return vector;
+}
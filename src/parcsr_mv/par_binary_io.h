@@ -0,0 +1,22 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#ifndef hypre_PAR_BINARY_IO
+#define hypre_PAR_BINARY_IO
+
+/*--------------------------------------------------------------------------
+ * Binary checkpoint files written by hypre_ParCSRMatrixPrintBinary and
+ * hypre_ParVectorPrintBinary.  The file layout is described in
+ * par_binary_io.c; all header entries are hypre_ulonglongint.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BINARY_IO_MATRIX_MAGIC  0x6879707265435352ULL  /* "hypreCSR" */
+#define hypre_BINARY_IO_VECTOR_MAGIC  0x6879707265564543ULL  /* "hypreVEC" */
+#define hypre_BINARY_IO_VERSION       1
+#define hypre_BINARY_IO_HEADER_SIZE   8
+
+#endif /* hypre_PAR_BINARY_IO */
@@ -404,12 +404,28 @@ hypre_GetAssumedPartitionProcFromRow( MPI_Comm comm, HYPRE_BigInt row,
                                       HYPRE_BigInt global_num_rows, HYPRE_Int *proc_id)
 {
    HYPRE_Int     num_procs;
-   HYPRE_BigInt  size, switch_row, extra;
-
 
    hypre_MPI_Comm_size(comm, &num_procs );
    /*hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs );*/
 
+   return hypre_GetAssumedPartitionProcFromRow_v2(num_procs, row, global_first_row,
+                                                  global_num_rows, proc_id);
+}
+
+/*--------------------------------------------------------------------
+ * hypre_GetAssumedPartitionProcFromRow_v2
+ * Same as hypre_GetAssumedPartitionProcFromRow, with the number of
+ * processors given instead of the communicator.  It makes no MPI calls,
+ * so it can be used from inside threaded loops.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GetAssumedPartitionProcFromRow_v2( HYPRE_Int num_procs, HYPRE_BigInt row,
+                                         HYPRE_BigInt global_first_row,
+                                         HYPRE_BigInt global_num_rows, HYPRE_Int *proc_id)
+{
+   HYPRE_BigInt  size, switch_row, extra;
+
    /* j = floor[(row*p/N]  - this overflows*/
    /* *proc_id = (row*num_procs)/global_num_rows;*/
 
@@ -7,6 +7,189 @@
 
 #include "_hypre_parcsr_mv.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNeighborComm
+ *
+ * Builds the distributed graph communicators used to exchange the data of
+ * comm_pkg with neighborhood collectives, one for the forward (job = 1, 11,
+ * 21) and one for the transposed (job = 2, 12, 22) direction. This is
+ * collective over the communicator of comm_pkg. Does nothing if the
+ * neighborhood collective backend is off, or if the communicators already
+ * exist. If the MPI library does not support them, comm_pkg keeps using
+ * point-to-point messages.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   MPI_Comm                  comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                 num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                 num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   hypre_ParCSRNeighborComm *neighbor_comm;
+   HYPRE_Int                 i, ierr;
+
+   if (!hypre_HandleCommNeighborColl(hypre_handle()) || hypre_ParCSRCommPkgNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   neighbor_comm = hypre_CTAlloc(hypre_ParCSRNeighborComm, 1, HYPRE_MEMORY_HOST);
+
+   ierr = hypre_MPI_Dist_graph_create_adjacent(comm,
+                                               num_recvs, hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                               num_sends, hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                               &hypre_ParCSRNeighborCommComm(neighbor_comm));
+   if (ierr != hypre_MPI_SUCCESS)
+   {
+      hypre_TFree(neighbor_comm, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   ierr = hypre_MPI_Dist_graph_create_adjacent(comm,
+                                               num_sends, hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                               num_recvs, hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                               &hypre_ParCSRNeighborCommCommT(neighbor_comm));
+   if (ierr != hypre_MPI_SUCCESS)
+   {
+      hypre_MPI_Comm_free(&hypre_ParCSRNeighborCommComm(neighbor_comm));
+      hypre_TFree(neighbor_comm, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRNeighborCommSendCounts(neighbor_comm) = hypre_TAlloc(hypre_int, num_sends, HYPRE_MEMORY_HOST);
+   hypre_ParCSRNeighborCommSendDispls(neighbor_comm) = hypre_TAlloc(hypre_int, num_sends, HYPRE_MEMORY_HOST);
+   hypre_ParCSRNeighborCommRecvCounts(neighbor_comm) = hypre_TAlloc(hypre_int, num_recvs, HYPRE_MEMORY_HOST);
+   hypre_ParCSRNeighborCommRecvDispls(neighbor_comm) = hypre_TAlloc(hypre_int, num_recvs, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_ParCSRNeighborCommSendDispls(neighbor_comm)[i] =
+         (hypre_int) hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+      hypre_ParCSRNeighborCommSendCounts(neighbor_comm)[i] =
+         (hypre_int) (hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) -
+                      hypre_ParCSRCommPkgSendMapStart(comm_pkg, i));
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_ParCSRNeighborCommRecvDispls(neighbor_comm)[i] =
+         (hypre_int) hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+      hypre_ParCSRNeighborCommRecvCounts(neighbor_comm)[i] =
+         (hypre_int) (hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) -
+                      hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i));
+   }
+
+   hypre_ParCSRCommPkgNeighborComm(comm_pkg) = neighbor_comm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgDestroyNeighborComm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_ParCSRNeighborComm *neighbor_comm = hypre_ParCSRCommPkgNeighborComm(comm_pkg);
+
+   if (neighbor_comm)
+   {
+      hypre_MPI_Comm_free(&hypre_ParCSRNeighborCommComm(neighbor_comm));
+      hypre_MPI_Comm_free(&hypre_ParCSRNeighborCommCommT(neighbor_comm));
+      hypre_TFree(hypre_ParCSRNeighborCommSendCounts(neighbor_comm), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRNeighborCommSendDispls(neighbor_comm), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRNeighborCommRecvCounts(neighbor_comm), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRNeighborCommRecvDispls(neighbor_comm), HYPRE_MEMORY_HOST);
+      hypre_TFree(neighbor_comm, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgNeighborComm(comm_pkg) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNeighborCommStart
+ *
+ * Posts the exchange of job (see hypre_ParCSRCommHandleCreate_v2) as a
+ * single neighborhood all-to-all on the graph communicators of comm_pkg.
+ * If persistent is set, the request is only initialized (MPI-4), and must
+ * be started with hypre_MPI_Startall. A non-NULL datatype overrides the
+ * element type implied by job (used for multivector exchanges).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRNeighborCommStart( HYPRE_Int            job,
+                               hypre_ParCSRCommPkg *comm_pkg,
+                               void                *send_data,
+                               void                *recv_data,
+                               HYPRE_Int            persistent,
+                               hypre_MPI_Datatype  *datatype_in,
+                               hypre_MPI_Request   *request )
+{
+   hypre_ParCSRNeighborComm *neighbor_comm = hypre_ParCSRCommPkgNeighborComm(comm_pkg);
+   hypre_MPI_Datatype        datatype;
+   hypre_MPI_Comm            comm;
+   hypre_int                *send_counts, *send_displs, *recv_counts, *recv_displs;
+   HYPRE_Int                 ierr;
+
+   switch (job)
+   {
+      case 11:
+      case 12:
+         datatype = HYPRE_MPI_INT;
+         break;
+      case 21:
+      case 22:
+         datatype = HYPRE_MPI_BIG_INT;
+         break;
+      default:
+         datatype = HYPRE_MPI_COMPLEX;
+         break;
+   }
+
+   if (datatype_in)
+   {
+      datatype = *datatype_in;
+   }
+
+   if (job == 2 || job == 12 || job == 22)
+   {
+      comm        = hypre_ParCSRNeighborCommCommT(neighbor_comm);
+      send_counts = hypre_ParCSRNeighborCommRecvCounts(neighbor_comm);
+      send_displs = hypre_ParCSRNeighborCommRecvDispls(neighbor_comm);
+      recv_counts = hypre_ParCSRNeighborCommSendCounts(neighbor_comm);
+      recv_displs = hypre_ParCSRNeighborCommSendDispls(neighbor_comm);
+   }
+   else
+   {
+      comm        = hypre_ParCSRNeighborCommComm(neighbor_comm);
+      send_counts = hypre_ParCSRNeighborCommSendCounts(neighbor_comm);
+      send_displs = hypre_ParCSRNeighborCommSendDispls(neighbor_comm);
+      recv_counts = hypre_ParCSRNeighborCommRecvCounts(neighbor_comm);
+      recv_displs = hypre_ParCSRNeighborCommRecvDispls(neighbor_comm);
+   }
+
+   if (persistent)
+   {
+      ierr = hypre_MPI_Neighbor_alltoallv_init(send_data, send_counts, send_displs, datatype,
+                                               recv_data, recv_counts, recv_displs, datatype,
+                                               comm, request);
+   }
+   else
+   {
+      ierr = hypre_MPI_Ineighbor_alltoallv(send_data, send_counts, send_displs, datatype,
+                                           recv_data, recv_counts, recv_displs, datatype,
+                                           comm, request);
+   }
+
+   if (ierr != hypre_MPI_SUCCESS)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI error\n");
+   }
+
+   return hypre_error_flag;
+}
+
 /*==========================================================================*/
 
 #ifdef HYPRE_USING_PERSISTENT_COMM
@@ -209,6 +392,23 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
          break;
    } // switch (job_type)
 
+#if defined(MPI_VERSION) && MPI_VERSION > 3
+   /* persistent neighborhood collective in place of the point-to-point requests */
+   if (hypre_ParCSRCommPkgNeighborComm(comm_pkg))
+   {
+      for (i = 0; i < num_requests; i++)
+      {
+         hypre_MPI_Request_free(&requests[i]);
+      }
+      hypre_TFree(requests, HYPRE_MEMORY_HOST);
+      requests = hypre_CTAlloc(hypre_MPI_Request, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRNeighborCommStart(job, comm_pkg, send_buff, recv_buff, 1, NULL, requests);
+
+      hypre_ParCSRCommHandleNumRequests(comm_handle) = 1;
+      hypre_ParCSRCommHandleRequests(comm_handle)    = requests;
+   }
+#endif
+
    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle) = recv_buff;
    hypre_ParCSRCommHandleSendDataBuffer(comm_handle) = send_buff;
    hypre_ParCSRCommHandleNumSendBytes(comm_handle)   = num_bytes_send;
@@ -355,6 +555,9 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
     *           and recv_mpi_types to be set in comm_pkg.
     *           datatypes need to point to absolute
     *           addresses, e.g. generated using hypre_MPI_Address .
+    * If comm_pkg has graph communicators (hypre_ParCSRCommPkgCreateNeighborComm),
+    * the exchange is a single MPI_Ineighbor_alltoallv instead of one
+    * Isend/Irecv pair per neighbor.
     *--------------------------------------------------------------------*/
 #ifndef HYPRE_WITH_GPU_AWARE_MPI
    switch (job)
@@ -417,8 +620,21 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    hypre_SyncCudaComputeStream(hypre_handle());
 #endif
 
-   num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   if (hypre_ParCSRCommPkgNeighborComm(comm_pkg))
+   {
+      /* one neighborhood collective replaces the point-to-point messages
+         of the switch below, which then has no neighbors to go through */
+      num_requests = 1;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      hypre_ParCSRNeighborCommStart(job, comm_pkg, send_data, recv_data, 0, NULL, requests);
+      num_sends = 0;
+      num_recvs = 0;
+   }
+   else
+   {
+      num_requests = num_sends + num_recvs;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   }
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
@@ -580,6 +796,109 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    return ( comm_handle );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleCreateMultiVector
+ *
+ * Same as hypre_ParCSRCommHandleCreate with job = 1 or 2, but exchanges
+ * num_vectors values per entry of the comm_pkg maps in one message per
+ * neighbor (or one neighborhood collective), instead of one exchange per
+ * vector. send_data and recv_data are host arrays stored index-major: the
+ * values of entry k are at [k*num_vectors, (k+1)*num_vectors).
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle*
+hypre_ParCSRCommHandleCreateMultiVector( HYPRE_Int            job,
+                                         hypre_ParCSRCommPkg *comm_pkg,
+                                         HYPRE_Int            num_vectors,
+                                         void                *send_data,
+                                         void                *recv_data )
+{
+   HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm                   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Complex             *d_send_data = (HYPRE_Complex *) send_data;
+   HYPRE_Complex             *d_recv_data = (HYPRE_Complex *) recv_data;
+   hypre_ParCSRCommHandle    *comm_handle;
+   hypre_MPI_Datatype         vector_type;
+   hypre_MPI_Request         *requests;
+   HYPRE_Int                  num_requests;
+   HYPRE_Int                  num_to, num_from, *to_procs, *from_procs, *to_starts, *from_starts;
+   HYPRE_Int                  i, j, ip, vec_start, vec_len;
+
+   hypre_assert(job == 1 || job == 2);
+
+   /* one element of vector_type holds the num_vectors values of an entry,
+      so that the comm_pkg offsets and counts apply unchanged */
+   hypre_MPI_Type_contiguous(num_vectors, HYPRE_MPI_COMPLEX, &vector_type);
+   hypre_MPI_Type_commit(&vector_type);
+
+   if (hypre_ParCSRCommPkgNeighborComm(comm_pkg))
+   {
+      num_requests = 1;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      hypre_ParCSRNeighborCommStart(job, comm_pkg, send_data, recv_data, 0, &vector_type, requests);
+   }
+   else
+   {
+      if (job == 1)
+      {
+         num_to      = num_sends;
+         to_procs    = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+         to_starts   = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+         num_from    = num_recvs;
+         from_procs  = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+         from_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+      }
+      else
+      {
+         num_to      = num_recvs;
+         to_procs    = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+         to_starts   = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+         num_from    = num_sends;
+         from_procs  = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+         from_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+      }
+
+      num_requests = num_to + num_from;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+      j = 0;
+      for (i = 0; i < num_from; i++)
+      {
+         ip = from_procs[i];
+         vec_start = from_starts[i];
+         vec_len = from_starts[i+1] - vec_start;
+         hypre_MPI_Irecv(&d_recv_data[vec_start*num_vectors], vec_len, vector_type,
+                         ip, 0, comm, &requests[j++]);
+      }
+      for (i = 0; i < num_to; i++)
+      {
+         ip = to_procs[i];
+         vec_start = to_starts[i];
+         vec_len = to_starts[i+1] - vec_start;
+         hypre_MPI_Isend(&d_send_data[vec_start*num_vectors], vec_len, vector_type,
+                         ip, 0, comm, &requests[j++]);
+      }
+   }
+
+   /* pending requests keep the datatype alive */
+   hypre_MPI_Type_free(&vector_type);
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+   hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleSendData(comm_handle)           = send_data;
+   hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data;
+   hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data;
+   hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
+   hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
+
+   return ( comm_handle );
+}
+
 HYPRE_Int
 hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
 {
@@ -627,6 +946,31 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleTest
+ *
+ * Nonblocking completion test of a (persistent or regular) communication
+ * handle. Sets flag to 1 if all its requests have completed. Besides
+ * querying, this lets MPI libraries without asynchronous progress advance
+ * the exchange while the caller is computing.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommHandleTest( hypre_ParCSRCommHandle *comm_handle,
+                            HYPRE_Int              *flag )
+{
+   *flag = 1;
+
+   if (comm_handle && hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
+   {
+      hypre_MPI_Testall(hypre_ParCSRCommHandleNumRequests(comm_handle),
+                        hypre_ParCSRCommHandleRequests(comm_handle),
+                        flag, hypre_MPI_STATUSES_IGNORE);
+   }
+
+   return hypre_error_flag;
+}
+
 
 /* hypre_MatCommPkgCreate_core does all the communications and computations for
    hypre_MatCommPkgCreate ( hypre_ParCSRMatrix *A) and
@@ -897,6 +1241,8 @@ hypre_ParCSRCommPkgCreate
    hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts;
    hypre_ParCSRCommPkgSendMapElmts (comm_pkg) = send_map_elmts;
 
+   hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+
    return hypre_error_flag;
 }
 
@@ -950,6 +1296,8 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
    }
 #endif
 
+   hypre_ParCSRCommPkgDestroyNeighborComm(comm_pkg);
+
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
       hypre_TFree(hypre_ParCSRCommPkgSendProcs(comm_pkg), HYPRE_MEMORY_HOST);
@@ -48,6 +48,22 @@ typedef struct
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNeighborComm:
+ *   distributed graph communicators of a comm package for exchanging
+ *   data with neighborhood collectives
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_MPI_Comm        comm;          /* receive from recv_procs, send to send_procs */
+   hypre_MPI_Comm        comm_T;        /* receive from send_procs, send to recv_procs */
+   hypre_int            *send_counts;   /* per send proc, in entries */
+   hypre_int            *send_displs;
+   hypre_int            *recv_counts;   /* per recv proc, in entries */
+   hypre_int            *recv_displs;
+} hypre_ParCSRNeighborComm;
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                     comm;
@@ -66,6 +82,9 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
+   /* graph communicators, if the neighborhood collective backend is used */
+   hypre_ParCSRNeighborComm    *neighbor_comm;
+
 #ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
@@ -101,6 +120,7 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -141,5 +161,16 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_ParCSRNeighborComm
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRNeighborCommComm(neighbor_comm)               (neighbor_comm -> comm)
+#define hypre_ParCSRNeighborCommCommT(neighbor_comm)              (neighbor_comm -> comm_T)
+#define hypre_ParCSRNeighborCommSendCounts(neighbor_comm)         (neighbor_comm -> send_counts)
+#define hypre_ParCSRNeighborCommSendDispls(neighbor_comm)         (neighbor_comm -> send_displs)
+#define hypre_ParCSRNeighborCommRecvCounts(neighbor_comm)         (neighbor_comm -> recv_counts)
+#define hypre_ParCSRNeighborCommRecvDispls(neighbor_comm)         (neighbor_comm -> recv_displs)
+
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 
@@ -0,0 +1,1085 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Two-phase (symbolic/numeric) ParCSR matrix-matrix products.
+ *
+ * The symbolic phase computes the pattern of C = A * B, including the
+ * exchange of the external rows of B, and stores everything the numeric
+ * phase needs in a hypre_ParCSRMatMatPlan.  The numeric phase then only
+ * exchanges the values of the external rows of B and accumulates the
+ * products into the existing pattern of C.  This is meant for sequences of
+ * products in which the values of A and B change but their patterns do not,
+ * e.g., the Galerkin product of an AMG re-setup.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPatternDestroy
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatPatternDestroy( hypre_ParCSRMatMatPattern *pattern )
+{
+   hypre_TFree(pattern -> diag_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(pattern -> diag_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(pattern -> offd_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(pattern -> offd_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(pattern -> col_map_offd, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanDestroy( hypre_ParCSRMatMatPlan *plan )
+{
+   HYPRE_Int i;
+
+   if (plan)
+   {
+      hypre_TFree(hypre_ParCSRMatMatPlanSendRows(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanSendOffsets(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanSendData(plan), HYPRE_MEMORY_HOST);
+      if (hypre_ParCSRMatMatPlanCommPkgJ(plan))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_ParCSRMatMatPlanCommPkgJ(plan));
+      }
+      hypre_TFree(hypre_ParCSRMatMatPlanBExtI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanBExtJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanBExtData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanMapBToFull(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanMapCToFull(plan), HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatMatPatternDestroy(&hypre_ParCSRMatMatPlanPatternA(plan));
+      hypre_ParCSRMatMatPatternDestroy(&hypre_ParCSRMatMatPlanPatternB(plan));
+      for (i = 0; i < hypre_ParCSRMatMatPlanNumThreads(plan); i++)
+      {
+         hypre_TFree(hypre_ParCSRMatMatPlanWorkspace(plan)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_ParCSRMatMatPlanWorkspace(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPatternHash
+ *
+ * FNV-1a hash of the local pattern of A, including its offd column map.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ulonglongint
+hypre_ParCSRMatrixPatternHash( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix    *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix    *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int          *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int          *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int          *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int          *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_BigInt       *col_map_offd_A = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int           num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ulonglongint  hash = 14695981039346656037ULL;
+   HYPRE_Int           i;
+
+#define hypre_PatternHashAdd(x) hash = (hash ^ (hypre_ulonglongint) (x)) * 1099511628211ULL
+
+   hypre_PatternHashAdd(num_rows);
+   hypre_PatternHashAdd(num_cols_offd);
+   for (i = 0; i < num_rows; i++)
+   {
+      hypre_PatternHashAdd(A_diag_i[i+1]);
+      hypre_PatternHashAdd(A_offd_i[i+1]);
+   }
+   for (i = 0; i < A_diag_i[num_rows]; i++)
+   {
+      hypre_PatternHashAdd(A_diag_j[i]);
+   }
+   for (i = 0; i < A_offd_i[num_rows]; i++)
+   {
+      hypre_PatternHashAdd(A_offd_j[i]);
+   }
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      hypre_PatternHashAdd(col_map_offd_A[i]);
+   }
+
+#undef hypre_PatternHashAdd
+
+   return hash;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPatternSet
+ *
+ * Copies the local pattern of A (host memory) into pattern.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatPatternSet( hypre_ParCSRMatMatPattern *pattern,
+                              hypre_ParCSRMatrix        *A )
+{
+   hypre_CSRMatrix    *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix    *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int           diag_nnz = hypre_CSRMatrixI(A_diag)[num_rows];
+   HYPRE_Int           offd_nnz = hypre_CSRMatrixI(A_offd)[num_rows];
+
+   hypre_ParCSRMatMatPatternDestroy(pattern);
+
+   pattern -> hash          = hypre_ParCSRMatrixPatternHash(A);
+   pattern -> num_rows      = num_rows;
+   pattern -> num_cols_offd = num_cols_offd;
+   pattern -> diag_i        = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   pattern -> diag_j        = hypre_TAlloc(HYPRE_Int, diag_nnz, HYPRE_MEMORY_HOST);
+   pattern -> offd_i        = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   pattern -> offd_j        = hypre_TAlloc(HYPRE_Int, offd_nnz, HYPRE_MEMORY_HOST);
+   pattern -> col_map_offd  = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+
+   hypre_TMemcpy(pattern -> diag_i, hypre_CSRMatrixI(A_diag), HYPRE_Int, num_rows + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(pattern -> diag_j, hypre_CSRMatrixJ(A_diag), HYPRE_Int, diag_nnz,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(pattern -> offd_i, hypre_CSRMatrixI(A_offd), HYPRE_Int, num_rows + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(pattern -> offd_j, hypre_CSRMatrixJ(A_offd), HYPRE_Int, offd_nnz,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(pattern -> col_map_offd, hypre_ParCSRMatrixColMapOffd(A), HYPRE_BigInt,
+                 num_cols_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPatternMatches
+ *
+ * Returns 1 if the local pattern of A is the one stored in pattern.  The
+ * hash is compared first, and the arrays only if it matches.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatMatPatternMatches( hypre_ParCSRMatMatPattern *pattern,
+                                  hypre_ParCSRMatrix        *A )
+{
+   hypre_CSRMatrix    *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix    *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   if (num_rows != (pattern -> num_rows) ||
+       num_cols_offd != (pattern -> num_cols_offd) ||
+       hypre_ParCSRMatrixPatternHash(A) != (pattern -> hash))
+   {
+      return 0;
+   }
+
+   if (memcmp(hypre_CSRMatrixI(A_diag), pattern -> diag_i,
+              (num_rows + 1) * sizeof(HYPRE_Int)) ||
+       memcmp(hypre_CSRMatrixI(A_offd), pattern -> offd_i,
+              (num_rows + 1) * sizeof(HYPRE_Int)))
+   {
+      return 0;
+   }
+
+   if (memcmp(hypre_CSRMatrixJ(A_diag), pattern -> diag_j,
+              (pattern -> diag_i)[num_rows] * sizeof(HYPRE_Int)) ||
+       memcmp(hypre_CSRMatrixJ(A_offd), pattern -> offd_j,
+              (pattern -> offd_i)[num_rows] * sizeof(HYPRE_Int)) ||
+       memcmp(hypre_ParCSRMatrixColMapOffd(A), pattern -> col_map_offd,
+              num_cols_offd * sizeof(HYPRE_BigInt)))
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanMatches
+ *
+ * Returns 1 if the local patterns of A and B are those of the symbolic
+ * phase, 0 otherwise.  The result is local to each process.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanMatches( hypre_ParCSRMatMatPlan *plan,
+                               hypre_ParCSRMatrix     *A,
+                               hypre_ParCSRMatrix     *B )
+{
+   if (!plan ||
+       hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+       hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(B)) != hypre_MEMORY_HOST)
+   {
+      return 0;
+   }
+
+   return (hypre_ParCSRMatMatPatternMatches(&hypre_ParCSRMatMatPlanPatternA(plan), A) &&
+           hypre_ParCSRMatMatPatternMatches(&hypre_ParCSRMatMatPlanPatternB(plan), B));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanSetWorkspace
+ *
+ * Makes sure there is one accumulator array per thread.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatPlanSetWorkspace( hypre_ParCSRMatMatPlan *plan )
+{
+   HYPRE_Int   num_threads = hypre_NumThreads();
+   HYPRE_Int   size = hypre_ParCSRMatMatPlanNumColsDiagB(plan) +
+                      hypre_ParCSRMatMatPlanNumColsFull(plan);
+   HYPRE_Int **workspace;
+   HYPRE_Int   i;
+
+   if (num_threads > hypre_ParCSRMatMatPlanNumThreads(plan))
+   {
+      workspace = hypre_CTAlloc(HYPRE_Int *, num_threads, HYPRE_MEMORY_HOST);
+      for (i = 0; i < hypre_ParCSRMatMatPlanNumThreads(plan); i++)
+      {
+         workspace[i] = hypre_ParCSRMatMatPlanWorkspace(plan)[i];
+      }
+      for (; i < num_threads; i++)
+      {
+         workspace[i] = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_ParCSRMatMatPlanWorkspace(plan), HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatMatPlanWorkspace(plan)  = workspace;
+      hypre_ParCSRMatMatPlanNumThreads(plan) = num_threads;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatSymbolic
+ *
+ * Computes C = A * B and returns in plan_ptr what is needed to recompute
+ * the values of C with hypre_ParCSRMatMatNumeric.  Host memory only.
+ *
+ * As in hypre_ParMatmul, C does not own its partitionings, and if A and B
+ * are square the diagonal entry is the first entry of each row of C_diag.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRMatMatSymbolic( hypre_ParCSRMatrix      *A,
+                            hypre_ParCSRMatrix      *B,
+                            hypre_ParCSRMatMatPlan **plan_ptr )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg *comm_pkg;
+   hypre_ParCSRCommPkg *comm_pkg_j;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   hypre_CSRMatrix     *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int           *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_BigInt        *row_starts_A = hypre_ParCSRMatrixRowStarts(A);
+   HYPRE_BigInt         n_rows_A = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt         n_cols_A = hypre_ParCSRMatrixGlobalNumCols(A);
+   HYPRE_Int            num_rows_diag_A = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_diag_A = hypre_CSRMatrixNumCols(A_diag);
+   HYPRE_Int            num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix     *B_diag = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int           *B_diag_i = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int           *B_diag_j = hypre_CSRMatrixJ(B_diag);
+   hypre_CSRMatrix     *B_offd = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int           *B_offd_i = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int           *B_offd_j = hypre_CSRMatrixJ(B_offd);
+   HYPRE_BigInt        *col_map_offd_B = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt        *col_starts_B = hypre_ParCSRMatrixColStarts(B);
+   HYPRE_BigInt         first_col_diag_B = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_BigInt         n_rows_B = hypre_ParCSRMatrixGlobalNumRows(B);
+   HYPRE_BigInt         n_cols_B = hypre_ParCSRMatrixGlobalNumCols(B);
+   HYPRE_Int            num_rows_diag_B = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int            num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+   HYPRE_Int            num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+
+   hypre_ParCSRMatMatPlan *plan;
+   hypre_ParCSRMatrix  *C;
+   hypre_CSRMatrix     *C_diag;
+   hypre_CSRMatrix     *C_offd;
+   HYPRE_Int           *C_diag_i, *C_diag_j = NULL;
+   HYPRE_Int           *C_offd_i, *C_offd_j = NULL;
+   HYPRE_Complex       *C_diag_data = NULL, *C_offd_data = NULL;
+   HYPRE_BigInt        *col_map_offd_C = NULL;
+   HYPRE_Int            C_diag_size, C_offd_size, num_cols_offd_C;
+
+   HYPRE_Int            num_sends, num_recvs, num_rows_send, num_rows_ext;
+   HYPRE_Int            num_nnz_send, num_nnz_ext;
+   HYPRE_Int           *send_rows = NULL, *send_offsets = NULL;
+   HYPRE_Int           *send_jstarts, *recv_jstarts;
+   HYPRE_Int           *B_ext_i, *B_ext_j = NULL;
+   HYPRE_BigInt        *send_j = NULL, *recv_j = NULL;
+
+   HYPRE_BigInt        *col_map_full = NULL;
+   HYPRE_Int            num_cols_full, num_ext_offd;
+   HYPRE_Int           *map_B_to_full = NULL, *map_C_to_full = NULL;
+   HYPRE_Int           *full_to_C = NULL;
+
+   HYPRE_Int            allsquare = 0;
+   HYPRE_Int            num_procs;
+   HYPRE_Int            i, j, k;
+
+   *plan_ptr = NULL;
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+       hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(B)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Symbolic/numeric MatMat only supports host memory\n");
+      return NULL;
+   }
+
+   if (n_cols_A != n_rows_B || num_cols_diag_A != num_rows_diag_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, " Error! Incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   if ( num_rows_diag_A == num_cols_diag_B && n_rows_A == n_cols_B )
+   {
+      allsquare = 1;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParCSRMatMatPlan, 1, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Exchange the pattern of the rows of B that correspond to the offd
+    * columns of A.  The communication package for the values is kept in
+    * the plan, with its own copies of the processor lists.
+    *-----------------------------------------------------------------------*/
+
+   num_rows_ext = 0;
+   num_nnz_ext  = 0;
+   B_ext_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+
+   if (num_procs > 1)
+   {
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      num_recvs     = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      num_rows_send = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      num_rows_ext  = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+      hypre_assert(num_rows_ext == num_cols_offd_A);
+
+      send_rows    = hypre_TAlloc(HYPRE_Int, num_rows_send, HYPRE_MEMORY_HOST);
+      send_offsets = hypre_TAlloc(HYPRE_Int, num_rows_send + 1, HYPRE_MEMORY_HOST);
+      send_offsets[0] = 0;
+      for (i = 0; i < num_rows_send; i++)
+      {
+         j = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i);
+         send_rows[i] = j;
+         send_offsets[i+1] = B_diag_i[j+1] - B_diag_i[j] + B_offd_i[j+1] - B_offd_i[j];
+      }
+
+      /* row lengths; note the shift in B_ext_i by one */
+      comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, send_offsets + 1, B_ext_i + 1);
+
+      /* overlap the prefix sum with the communication */
+      send_jstarts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      for (i = 0; i < num_rows_send; i++)
+      {
+         send_offsets[i+1] += send_offsets[i];
+      }
+      num_nnz_send = send_offsets[num_rows_send];
+      for (i = 0; i <= num_sends; i++)
+      {
+         send_jstarts[i] = send_offsets[hypre_ParCSRCommPkgSendMapStart(comm_pkg, i)];
+      }
+
+      for (i = 0; i < num_rows_ext; i++)
+      {
+         B_ext_i[i+1] += B_ext_i[i];
+      }
+      num_nnz_ext = B_ext_i[num_rows_ext];
+      recv_jstarts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i <= num_recvs; i++)
+      {
+         recv_jstarts[i] = B_ext_i[hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i)];
+      }
+
+      /* global column indices of the rows to send */
+      send_j = hypre_TAlloc(HYPRE_BigInt, num_nnz_send, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows_send; i++)
+      {
+         HYPRE_Int i1 = send_offsets[i];
+
+         j = send_rows[i];
+         for (k = B_diag_i[j]; k < B_diag_i[j+1]; k++)
+         {
+            send_j[i1++] = first_col_diag_B + (HYPRE_BigInt) B_diag_j[k];
+         }
+         for (k = B_offd_i[j]; k < B_offd_i[j+1]; k++)
+         {
+            send_j[i1++] = col_map_offd_B[B_offd_j[k]];
+         }
+      }
+
+      comm_pkg_j = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgComm         (comm_pkg_j) = comm;
+      hypre_ParCSRCommPkgNumSends     (comm_pkg_j) = num_sends;
+      hypre_ParCSRCommPkgSendProcs    (comm_pkg_j) = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapStarts(comm_pkg_j) = send_jstarts;
+      hypre_ParCSRCommPkgNumRecvs     (comm_pkg_j) = num_recvs;
+      hypre_ParCSRCommPkgRecvProcs    (comm_pkg_j) = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_j) = recv_jstarts;
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(comm_pkg_j), hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                    HYPRE_Int, num_sends, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(comm_pkg_j), hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                    HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+      recv_j = hypre_TAlloc(HYPRE_BigInt, num_nnz_ext, HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg_j, send_j, recv_j);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      hypre_TFree(send_j, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRMatMatPlanNumRowsSend(plan)  = num_rows_send;
+      hypre_ParCSRMatMatPlanSendRows(plan)     = send_rows;
+      hypre_ParCSRMatMatPlanSendOffsets(plan)  = send_offsets;
+      hypre_ParCSRMatMatPlanCommPkgJ(plan)     = comm_pkg_j;
+      hypre_ParCSRMatMatPlanSendData(plan)     = hypre_TAlloc(HYPRE_Complex, num_nnz_send, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatMatPlanBExtData(plan)     = hypre_TAlloc(HYPRE_Complex, num_nnz_ext, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Combined offd column space: sorted union of the offd columns of B and
+    * the external columns of B_ext.  Columns of B_ext are renumbered into
+    * the combined space [diag columns of B | full offd columns].
+    *-----------------------------------------------------------------------*/
+
+   num_ext_offd = 0;
+   for (i = 0; i < num_nnz_ext; i++)
+   {
+      if (recv_j[i] < first_col_diag_B || recv_j[i] >= first_col_diag_B + num_cols_diag_B)
+      {
+         num_ext_offd++;
+      }
+   }
+
+   num_cols_full = num_cols_offd_B + num_ext_offd;
+   if (num_cols_full)
+   {
+      col_map_full = hypre_TAlloc(HYPRE_BigInt, num_cols_full, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_B; i++)
+      {
+         col_map_full[i] = col_map_offd_B[i];
+      }
+      j = num_cols_offd_B;
+      for (i = 0; i < num_nnz_ext; i++)
+      {
+         if (recv_j[i] < first_col_diag_B || recv_j[i] >= first_col_diag_B + num_cols_diag_B)
+         {
+            col_map_full[j++] = recv_j[i];
+         }
+      }
+
+      hypre_BigQsort0(col_map_full, 0, num_cols_full - 1);
+
+      j = 0;
+      for (i = 1; i < num_cols_full; i++)
+      {
+         if (col_map_full[i] > col_map_full[j])
+         {
+            col_map_full[++j] = col_map_full[i];
+         }
+      }
+      num_cols_full = j + 1;
+   }
+
+   if (num_cols_offd_B)
+   {
+      map_B_to_full = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_B; i++)
+      {
+         map_B_to_full[i] = hypre_BigBinarySearch(col_map_full, col_map_offd_B[i], num_cols_full);
+      }
+   }
+
+   if (num_nnz_ext)
+   {
+      B_ext_j = hypre_TAlloc(HYPRE_Int, num_nnz_ext, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_nnz_ext; i++)
+      {
+         if (recv_j[i] < first_col_diag_B || recv_j[i] >= first_col_diag_B + num_cols_diag_B)
+         {
+            B_ext_j[i] = num_cols_diag_B +
+                         hypre_BigBinarySearch(col_map_full, recv_j[i], num_cols_full);
+         }
+         else
+         {
+            B_ext_j[i] = (HYPRE_Int) (recv_j[i] - first_col_diag_B);
+         }
+      }
+   }
+   hypre_TFree(recv_j, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatMatPlanNumRowsExt(plan)   = num_rows_ext;
+   hypre_ParCSRMatMatPlanBExtI(plan)        = B_ext_i;
+   hypre_ParCSRMatMatPlanBExtJ(plan)        = B_ext_j;
+   hypre_ParCSRMatMatPlanNumColsDiagB(plan) = num_cols_diag_B;
+   hypre_ParCSRMatMatPlanNumColsFull(plan)  = num_cols_full;
+   hypre_ParCSRMatMatPlanMapBToFull(plan)   = map_B_to_full;
+
+   hypre_ParCSRMatMatPlanSetWorkspace(plan);
+
+   /*-----------------------------------------------------------------------
+    * Pattern of C: count, prefix sum, fill.  Both passes use the same
+    * thread partition, so each thread stamps its own marker array with
+    * the row number (count) and the row number shifted by num_rows (fill).
+    *-----------------------------------------------------------------------*/
+
+   C_diag_i = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A + 1, HYPRE_MEMORY_HOST);
+   C_offd_i = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int *marker = hypre_ParCSRMatMatPlanWorkspace(plan)[hypre_GetThreadNum()];
+      HYPRE_Int  ns, ne, jj, kk, k1, col, cnt_diag, cnt_offd;
+
+      for (i = 0; i < num_cols_diag_B + num_cols_full; i++)
+      {
+         marker[i] = -1;
+      }
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows_diag_A);
+
+      for (i = ns; i < ne; i++)
+      {
+         cnt_diag = 0;
+         cnt_offd = 0;
+         if (allsquare)
+         {
+            marker[i] = i;
+            cnt_diag++;
+         }
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            k1 = A_diag_j[jj];
+            for (kk = B_diag_i[k1]; kk < B_diag_i[k1+1]; kk++)
+            {
+               col = B_diag_j[kk];
+               if (marker[col] != i)
+               {
+                  marker[col] = i;
+                  cnt_diag++;
+               }
+            }
+            for (kk = B_offd_i[k1]; kk < B_offd_i[k1+1]; kk++)
+            {
+               col = num_cols_diag_B + map_B_to_full[B_offd_j[kk]];
+               if (marker[col] != i)
+               {
+                  marker[col] = i;
+                  cnt_offd++;
+               }
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            k1 = A_offd_j[jj];
+            for (kk = B_ext_i[k1]; kk < B_ext_i[k1+1]; kk++)
+            {
+               col = B_ext_j[kk];
+               if (marker[col] != i)
+               {
+                  marker[col] = i;
+                  if (col < num_cols_diag_B)
+                  {
+                     cnt_diag++;
+                  }
+                  else
+                  {
+                     cnt_offd++;
+                  }
+               }
+            }
+         }
+         C_diag_i[i+1] = cnt_diag;
+         C_offd_i[i+1] = cnt_offd;
+      }
+   }
+
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      C_diag_i[i+1] += C_diag_i[i];
+      C_offd_i[i+1] += C_offd_i[i];
+   }
+   C_diag_size = C_diag_i[num_rows_diag_A];
+   C_offd_size = C_offd_i[num_rows_diag_A];
+
+   C_diag_j    = hypre_TAlloc(HYPRE_Int,     C_diag_size, HYPRE_MEMORY_HOST);
+   C_diag_data = hypre_TAlloc(HYPRE_Complex, C_diag_size, HYPRE_MEMORY_HOST);
+   if (C_offd_size)
+   {
+      C_offd_j    = hypre_TAlloc(HYPRE_Int,     C_offd_size, HYPRE_MEMORY_HOST);
+      C_offd_data = hypre_TAlloc(HYPRE_Complex, C_offd_size, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int *marker = hypre_ParCSRMatMatPlanWorkspace(plan)[hypre_GetThreadNum()];
+      HYPRE_Int  ns, ne, jj, kk, k1, col, stamp, cnt_diag, cnt_offd;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows_diag_A);
+
+      for (i = ns; i < ne; i++)
+      {
+         stamp    = num_rows_diag_A + i;
+         cnt_diag = C_diag_i[i];
+         cnt_offd = C_offd_i[i];
+         if (allsquare)
+         {
+            marker[i] = stamp;
+            C_diag_j[cnt_diag++] = i;
+         }
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            k1 = A_diag_j[jj];
+            for (kk = B_diag_i[k1]; kk < B_diag_i[k1+1]; kk++)
+            {
+               col = B_diag_j[kk];
+               if (marker[col] != stamp)
+               {
+                  marker[col] = stamp;
+                  C_diag_j[cnt_diag++] = col;
+               }
+            }
+            for (kk = B_offd_i[k1]; kk < B_offd_i[k1+1]; kk++)
+            {
+               col = num_cols_diag_B + map_B_to_full[B_offd_j[kk]];
+               if (marker[col] != stamp)
+               {
+                  marker[col] = stamp;
+                  C_offd_j[cnt_offd++] = col - num_cols_diag_B;
+               }
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            k1 = A_offd_j[jj];
+            for (kk = B_ext_i[k1]; kk < B_ext_i[k1+1]; kk++)
+            {
+               col = B_ext_j[kk];
+               if (marker[col] != stamp)
+               {
+                  marker[col] = stamp;
+                  if (col < num_cols_diag_B)
+                  {
+                     C_diag_j[cnt_diag++] = col;
+                  }
+                  else
+                  {
+                     C_offd_j[cnt_offd++] = col - num_cols_diag_B;
+                  }
+               }
+            }
+         }
+         hypre_assert(cnt_diag == C_diag_i[i+1] && cnt_offd == C_offd_i[i+1]);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Compress the offd columns of C.  col_map_full is sorted, so is the
+    * resulting col_map_offd_C.
+    *-----------------------------------------------------------------------*/
+
+   num_cols_offd_C = 0;
+   if (C_offd_size)
+   {
+      full_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_full, HYPRE_MEMORY_HOST);
+      for (i = 0; i < C_offd_size; i++)
+      {
+         full_to_C[C_offd_j[i]] = 1;
+      }
+      for (i = 0; i < num_cols_full; i++)
+      {
+         num_cols_offd_C += full_to_C[i];
+      }
+
+      col_map_offd_C = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_C, HYPRE_MEMORY_HOST);
+      map_C_to_full  = hypre_TAlloc(HYPRE_Int,    num_cols_offd_C, HYPRE_MEMORY_HOST);
+      for (i = 0, j = 0; i < num_cols_full; i++)
+      {
+         if (full_to_C[i])
+         {
+            col_map_offd_C[j] = col_map_full[i];
+            map_C_to_full[j]  = i;
+            full_to_C[i]      = j++;
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < C_offd_size; i++)
+      {
+         C_offd_j[i] = full_to_C[C_offd_j[i]];
+      }
+      hypre_TFree(full_to_C, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(col_map_full, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatMatPlanMapCToFull(plan) = map_C_to_full;
+   hypre_ParCSRMatMatPatternSet(&hypre_ParCSRMatMatPlanPatternA(plan), A);
+   hypre_ParCSRMatMatPatternSet(&hypre_ParCSRMatMatPlanPatternB(plan), B);
+
+   /*-----------------------------------------------------------------------
+    * Build C
+    *-----------------------------------------------------------------------*/
+
+   C = hypre_ParCSRMatrixCreate(comm, n_rows_A, n_cols_B, row_starts_A,
+                                col_starts_B, num_cols_offd_C,
+                                C_diag_size, C_offd_size);
+
+   /* Note that C does not own the partitionings */
+   hypre_ParCSRMatrixSetRowStartsOwner(C, 0);
+   hypre_ParCSRMatrixSetColStartsOwner(C, 0);
+
+   C_diag = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrixData(C_diag) = C_diag_data;
+   hypre_CSRMatrixI(C_diag)    = C_diag_i;
+   hypre_CSRMatrixJ(C_diag)    = C_diag_j;
+
+   C_offd = hypre_ParCSRMatrixOffd(C);
+   hypre_CSRMatrixI(C_offd) = C_offd_i;
+   if (num_cols_offd_C)
+   {
+      hypre_CSRMatrixData(C_offd)     = C_offd_data;
+      hypre_CSRMatrixJ(C_offd)        = C_offd_j;
+      hypre_ParCSRMatrixColMapOffd(C) = col_map_offd_C;
+   }
+
+   hypre_CSRMatrixMemoryLocation(C_diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixMemoryLocation(C_offd) = HYPRE_MEMORY_HOST;
+
+   *plan_ptr = plan;
+
+   /* values */
+   hypre_ParCSRMatMatNumeric(plan, A, B, C);
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumeric
+ *
+ * Recomputes the values of C = A * B in place, where C and plan come from
+ * hypre_ParCSRMatMatSymbolic.  A and B must have the same patterns as in
+ * the symbolic phase, which hypre_ParCSRMatMatPlanMatches can check.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatNumeric( hypre_ParCSRMatMatPlan *plan,
+                           hypre_ParCSRMatrix     *A,
+                           hypre_ParCSRMatrix     *B,
+                           hypre_ParCSRMatrix     *C )
+{
+   hypre_CSRMatrix     *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int           *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex       *A_diag_data = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix     *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex       *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int            num_rows_diag_A = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix     *B_diag = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int           *B_diag_i = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int           *B_diag_j = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex       *B_diag_data = hypre_CSRMatrixData(B_diag);
+   hypre_CSRMatrix     *B_offd = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int           *B_offd_i = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int           *B_offd_j = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Complex       *B_offd_data = hypre_CSRMatrixData(B_offd);
+
+   hypre_CSRMatrix     *C_diag = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int           *C_diag_i = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int           *C_diag_j = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex       *C_diag_data = hypre_CSRMatrixData(C_diag);
+   hypre_CSRMatrix     *C_offd = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int           *C_offd_i = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int           *C_offd_j = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex       *C_offd_data = hypre_CSRMatrixData(C_offd);
+
+   hypre_ParCSRCommPkg *comm_pkg_j;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int            num_rows_send;
+   HYPRE_Int           *send_rows, *send_offsets;
+   HYPRE_Complex       *send_data;
+   HYPRE_Int           *B_ext_i, *B_ext_j;
+   HYPRE_Complex       *B_ext_data;
+   HYPRE_Int           *map_B_to_full, *map_C_to_full;
+   HYPRE_Int            num_cols_diag_B;
+   HYPRE_Int            i;
+
+   if (!plan)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   comm_pkg_j      = hypre_ParCSRMatMatPlanCommPkgJ(plan);
+   num_rows_send   = hypre_ParCSRMatMatPlanNumRowsSend(plan);
+   send_rows       = hypre_ParCSRMatMatPlanSendRows(plan);
+   send_offsets    = hypre_ParCSRMatMatPlanSendOffsets(plan);
+   send_data       = hypre_ParCSRMatMatPlanSendData(plan);
+   B_ext_i         = hypre_ParCSRMatMatPlanBExtI(plan);
+   B_ext_j         = hypre_ParCSRMatMatPlanBExtJ(plan);
+   B_ext_data      = hypre_ParCSRMatMatPlanBExtData(plan);
+   map_B_to_full   = hypre_ParCSRMatMatPlanMapBToFull(plan);
+   map_C_to_full   = hypre_ParCSRMatMatPlanMapCToFull(plan);
+   num_cols_diag_B = hypre_ParCSRMatMatPlanNumColsDiagB(plan);
+
+   /*-----------------------------------------------------------------------
+    * Exchange the values of the external rows of B
+    *-----------------------------------------------------------------------*/
+
+   if (comm_pkg_j)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows_send; i++)
+      {
+         HYPRE_Int i1 = send_offsets[i];
+         HYPRE_Int j  = send_rows[i];
+         HYPRE_Int k;
+
+         for (k = B_diag_i[j]; k < B_diag_i[j+1]; k++)
+         {
+            send_data[i1++] = B_diag_data[k];
+         }
+         for (k = B_offd_i[j]; k < B_offd_i[j+1]; k++)
+         {
+            send_data[i1++] = B_offd_data[k];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg_j, send_data, B_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   hypre_ParCSRMatMatPlanSetWorkspace(plan);
+
+   /*-----------------------------------------------------------------------
+    * Accumulate: scatter the positions of row i of C into the combined
+    * column space, then add the products into the values of C.
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int     *pos = hypre_ParCSRMatMatPlanWorkspace(plan)[hypre_GetThreadNum()];
+      HYPRE_Int      ns, ne, jj, kk, k1, col;
+      HYPRE_Complex  a_entry;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows_diag_A);
+
+      for (i = ns; i < ne; i++)
+      {
+         for (jj = C_diag_i[i]; jj < C_diag_i[i+1]; jj++)
+         {
+            pos[C_diag_j[jj]] = jj;
+            C_diag_data[jj]   = 0.0;
+         }
+         for (jj = C_offd_i[i]; jj < C_offd_i[i+1]; jj++)
+         {
+            pos[num_cols_diag_B + map_C_to_full[C_offd_j[jj]]] = jj;
+            C_offd_data[jj] = 0.0;
+         }
+
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            k1 = A_diag_j[jj];
+            a_entry = A_diag_data[jj];
+            for (kk = B_diag_i[k1]; kk < B_diag_i[k1+1]; kk++)
+            {
+               C_diag_data[pos[B_diag_j[kk]]] += a_entry * B_diag_data[kk];
+            }
+            for (kk = B_offd_i[k1]; kk < B_offd_i[k1+1]; kk++)
+            {
+               col = num_cols_diag_B + map_B_to_full[B_offd_j[kk]];
+               C_offd_data[pos[col]] += a_entry * B_offd_data[kk];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            k1 = A_offd_j[jj];
+            a_entry = A_offd_data[jj];
+            for (kk = B_ext_i[k1]; kk < B_ext_i[k1+1]; kk++)
+            {
+               col = B_ext_j[kk];
+               if (col < num_cols_diag_B)
+               {
+                  C_diag_data[pos[col]] += a_entry * B_ext_data[kk];
+               }
+               else
+               {
+                  C_offd_data[pos[col]] += a_entry * B_ext_data[kk];
+               }
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanDestroy( hypre_ParCSRRAPPlan *plan )
+{
+   if (plan)
+   {
+      hypre_ParCSRMatrixDestroy(hypre_ParCSRRAPPlanR(plan));
+      hypre_ParCSRMatrixDestroy(hypre_ParCSRRAPPlanAP(plan));
+      hypre_ParCSRMatMatPlanDestroy(hypre_ParCSRRAPPlanAPPlan(plan));
+      hypre_ParCSRMatMatPlanDestroy(hypre_ParCSRRAPPlanRAPPlan(plan));
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanMatches
+ *
+ * Returns 1 if the local patterns of A and P are those of the symbolic
+ * phase, 0 otherwise.  The result is local to each process.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanMatches( hypre_ParCSRRAPPlan *plan,
+                            hypre_ParCSRMatrix  *A,
+                            hypre_ParCSRMatrix  *P )
+{
+   if (!plan)
+   {
+      return 0;
+   }
+
+   return hypre_ParCSRMatMatPlanMatches(hypre_ParCSRRAPPlanAPPlan(plan), A, P);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPSymbolic
+ *
+ * Computes RAP = RT^T * A * P as RT^T * (A * P), with the same conventions
+ * as hypre_ParCSRMatrixRAP: RAP gets a communication package and does not
+ * own its partitionings, which are those of the columns of RT and P.
+ * The values can be recomputed with hypre_ParCSRMatrixRAPNumeric.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRMatrixRAPSymbolic( hypre_ParCSRMatrix   *RT,
+                               hypre_ParCSRMatrix   *A,
+                               hypre_ParCSRMatrix   *P,
+                               hypre_ParCSRRAPPlan **plan_ptr )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRRAPPlan *plan;
+   hypre_ParCSRMatrix  *R = NULL;
+   hypre_ParCSRMatrix  *AP;
+   hypre_ParCSRMatrix  *RAP;
+   HYPRE_Int            num_procs;
+
+   *plan_ptr = NULL;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParCSRRAPPlan, 1, HYPRE_MEMORY_HOST);
+
+   AP = hypre_ParCSRMatMatSymbolic(A, P, &hypre_ParCSRRAPPlanAPPlan(plan));
+   hypre_ParCSRRAPPlanAP(plan) = AP;
+   if (!AP)
+   {
+      hypre_ParCSRRAPPlanDestroy(plan);
+      return NULL;
+   }
+
+   hypre_ParCSRMatrixTranspose(RT, &R, 1);
+   hypre_ParCSRRAPPlanR(plan) = R;
+
+   RAP = hypre_ParCSRMatMatSymbolic(R, AP, &hypre_ParCSRRAPPlanRAPPlan(plan));
+   if (!RAP)
+   {
+      hypre_ParCSRRAPPlanDestroy(plan);
+      return NULL;
+   }
+
+   /* R owns copies of the partitionings of RT; point to the originals */
+   hypre_ParCSRMatrixRowStarts(RAP) = hypre_ParCSRMatrixColStarts(RT);
+   hypre_ParCSRMatrixColStarts(RAP) = hypre_ParCSRMatrixColStarts(P);
+
+   if (num_procs > 1)
+   {
+      hypre_MatvecCommPkgCreate(RAP);
+   }
+
+   *plan_ptr = plan;
+
+   return RAP;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPNumeric
+ *
+ * Recomputes the values of RAP for new values of A.  RT and P, kept in
+ * the plan through R and AP, must not have changed since the symbolic phase.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPNumeric( hypre_ParCSRRAPPlan *plan,
+                              hypre_ParCSRMatrix  *A,
+                              hypre_ParCSRMatrix  *P,
+                              hypre_ParCSRMatrix  *RAP )
+{
+   if (!plan)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatMatNumeric(hypre_ParCSRRAPPlanAPPlan(plan), A, P,
+                             hypre_ParCSRRAPPlanAP(plan));
+   hypre_ParCSRMatMatNumeric(hypre_ParCSRRAPPlanRAPPlan(plan), hypre_ParCSRRAPPlanR(plan),
+                             hypre_ParCSRRAPPlanAP(plan), RAP);
+
+   return hypre_error_flag;
+}
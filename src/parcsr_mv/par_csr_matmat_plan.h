@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header info for the symbolic/numeric ParCSR matrix-matrix products
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PAR_CSR_MATMAT_PLAN_HEADER
+#define hypre_PAR_CSR_MATMAT_PLAN_HEADER
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPattern
+ *
+ * Copy of the local pattern of an operand of the symbolic phase, with its
+ * hash.  The hash rejects most changed patterns cheaply; a matching hash is
+ * confirmed by comparing the arrays.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ulonglongint    hash;
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int            *diag_i;
+   HYPRE_Int            *diag_j;
+   HYPRE_Int            *offd_i;
+   HYPRE_Int            *offd_j;
+   HYPRE_BigInt         *col_map_offd;
+
+} hypre_ParCSRMatMatPattern;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlan
+ *
+ * Output of the symbolic phase of C = A * B that the numeric phase needs
+ * besides A, B and C: the exchange of the external rows of B and their
+ * pattern, the column maps of B and C, and the thread workspace.
+ *
+ * Columns of C are numbered in a combined space: the num_cols_diag_B local
+ * columns first, followed by the num_cols_full offd columns of B and B_ext.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* exchange of the external rows of B (the offd columns of A) */
+   HYPRE_Int             num_rows_send;
+   HYPRE_Int            *send_rows;
+   HYPRE_Int            *send_offsets;
+   hypre_ParCSRCommPkg  *comm_pkg_j;
+   HYPRE_Complex        *send_data;
+
+   /* external rows of B in the combined column space */
+   HYPRE_Int             num_rows_ext;
+   HYPRE_Int            *B_ext_i;
+   HYPRE_Int            *B_ext_j;
+   HYPRE_Complex        *B_ext_data;
+
+   /* column maps */
+   HYPRE_Int             num_cols_diag_B;
+   HYPRE_Int             num_cols_full;
+   HYPRE_Int            *map_B_to_full;
+   HYPRE_Int            *map_C_to_full;
+
+   /* patterns of A and B in the symbolic phase */
+   hypre_ParCSRMatMatPattern  pattern_A;
+   hypre_ParCSRMatMatPattern  pattern_B;
+
+   /* per-thread accumulator positions, num_cols_diag_B + num_cols_full each */
+   HYPRE_Int             num_threads;
+   HYPRE_Int           **workspace;
+
+} hypre_ParCSRMatMatPlan;
+
+#define hypre_ParCSRMatMatPlanNumRowsSend(plan)   ((plan) -> num_rows_send)
+#define hypre_ParCSRMatMatPlanSendRows(plan)      ((plan) -> send_rows)
+#define hypre_ParCSRMatMatPlanSendOffsets(plan)   ((plan) -> send_offsets)
+#define hypre_ParCSRMatMatPlanCommPkgJ(plan)      ((plan) -> comm_pkg_j)
+#define hypre_ParCSRMatMatPlanSendData(plan)      ((plan) -> send_data)
+#define hypre_ParCSRMatMatPlanNumRowsExt(plan)    ((plan) -> num_rows_ext)
+#define hypre_ParCSRMatMatPlanBExtI(plan)         ((plan) -> B_ext_i)
+#define hypre_ParCSRMatMatPlanBExtJ(plan)         ((plan) -> B_ext_j)
+#define hypre_ParCSRMatMatPlanBExtData(plan)      ((plan) -> B_ext_data)
+#define hypre_ParCSRMatMatPlanNumColsDiagB(plan)  ((plan) -> num_cols_diag_B)
+#define hypre_ParCSRMatMatPlanNumColsFull(plan)   ((plan) -> num_cols_full)
+#define hypre_ParCSRMatMatPlanMapBToFull(plan)    ((plan) -> map_B_to_full)
+#define hypre_ParCSRMatMatPlanMapCToFull(plan)    ((plan) -> map_C_to_full)
+#define hypre_ParCSRMatMatPlanPatternA(plan)      ((plan) -> pattern_A)
+#define hypre_ParCSRMatMatPlanPatternB(plan)      ((plan) -> pattern_B)
+#define hypre_ParCSRMatMatPlanNumThreads(plan)    ((plan) -> num_threads)
+#define hypre_ParCSRMatMatPlanWorkspace(plan)     ((plan) -> workspace)
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlan
+ *
+ * Symbolic phase of RAP = RT^T * A * P, computed as RT^T * (A * P).  The
+ * transpose of RT and the intermediate product A * P are kept.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix      *R;
+   hypre_ParCSRMatrix      *AP;
+   hypre_ParCSRMatMatPlan  *AP_plan;
+   hypre_ParCSRMatMatPlan  *RAP_plan;
+
+} hypre_ParCSRRAPPlan;
+
+#define hypre_ParCSRRAPPlanR(plan)        ((plan) -> R)
+#define hypre_ParCSRRAPPlanAP(plan)       ((plan) -> AP)
+#define hypre_ParCSRRAPPlanAPPlan(plan)   ((plan) -> AP_plan)
+#define hypre_ParCSRRAPPlanRAPPlan(plan)  ((plan) -> RAP_plan)
+
+#endif
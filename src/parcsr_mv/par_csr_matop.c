@@ -11,6 +11,61 @@
 #include "_hypre_lapack.h"
 #include "_hypre_blas.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmul_RowPartition
+ *
+ * Splits the rows of C = A*B into num_threads contiguous blocks of roughly
+ * equal work, where the work of row i1 is the number of products it forms
+ * (see hypre_SpGemmHostPartitionRows).  Returns num_threads+1 offsets.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int *
+hypre_ParMatmul_RowPartition( HYPRE_Int  num_rows_diag_A,
+                              HYPRE_Int  num_cols_offd_A,
+                              HYPRE_Int *A_diag_i,
+                              HYPRE_Int *A_diag_j,
+                              HYPRE_Int *A_offd_i,
+                              HYPRE_Int *A_offd_j,
+                              HYPRE_Int *B_diag_i,
+                              HYPRE_Int *B_offd_i,
+                              HYPRE_Int *B_ext_diag_i,
+                              HYPRE_Int *B_ext_offd_i,
+                              HYPRE_Int  num_threads )
+{
+   HYPRE_Int *row_work = hypre_TAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
+   HYPRE_Int *part     = hypre_TAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+   HYPRE_Int  i1;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i1) HYPRE_SMP_SCHEDULE
+#endif
+   for (i1 = 0; i1 < num_rows_diag_A; i1++)
+   {
+      HYPRE_Int jj2, i2, work = 1;
+
+      for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
+      {
+         i2 = A_diag_j[jj2];
+         work += B_diag_i[i2+1] - B_diag_i[i2] + B_offd_i[i2+1] - B_offd_i[i2];
+      }
+      if (num_cols_offd_A)
+      {
+         for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
+         {
+            i2 = A_offd_j[jj2];
+            work += B_ext_diag_i[i2+1] - B_ext_diag_i[i2] +
+                    B_ext_offd_i[i2+1] - B_ext_offd_i[i2];
+         }
+      }
+      row_work[i1] = work;
+   }
+
+   hypre_SpGemmHostPartitionRows(num_rows_diag_A, row_work, num_threads, part);
+   hypre_TFree(row_work, HYPRE_MEMORY_HOST);
+
+   return part;
+}
+
 /* The following function was formerly part of hypre_ParMatmul
    but was removed so it can also be used for multiplication of
    Boolean matrices
@@ -50,7 +105,8 @@ void hypre_ParMatmul_RowSizes(
    HYPRE_Int num_threads = hypre_NumThreads();
    HYPRE_Int *jj_count_diag_array;
    HYPRE_Int *jj_count_offd_array;
-   HYPRE_Int ii, size, rest;
+   HYPRE_Int ii;
+   HYPRE_Int *part;
    /* First pass begins here.  Computes sizes of C rows.
       Arrays computed: C_diag_i, C_offd_i, B_marker
       Arrays needed: (11, all HYPRE_Int*)
@@ -71,8 +127,10 @@ void hypre_ParMatmul_RowSizes(
    /*-----------------------------------------------------------------------
     *  Loop over rows of A
     *-----------------------------------------------------------------------*/
-   size = num_rows_diag_A/num_threads;
-   rest = num_rows_diag_A - size*num_threads;
+   part = hypre_ParMatmul_RowPartition(num_rows_diag_A, num_cols_offd_A,
+                                       A_diag_i, A_diag_j, A_offd_i, A_offd_j,
+                                       B_diag_i, B_offd_i, B_ext_diag_i, B_ext_offd_i,
+                                       num_threads);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel private(ii, i1, jj_row_begin_diag, jj_row_begin_offd, jj_count_diag, jj_count_offd, jj2, i2, jj3, i3)
 #endif
@@ -81,16 +139,8 @@ void hypre_ParMatmul_RowSizes(
       HYPRE_Int *B_marker = NULL;
       HYPRE_Int ns, ne;
       ii = hypre_GetThreadNum();
-      if (ii < rest)
-      {
-         ns = ii*size+ii;
-         ne = (ii+1)*size+ii+1;
-      }
-      else
-      {
-         ns = ii*size+rest;
-         ne = (ii+1)*size+rest;
-      }
+      ns = part[ii];
+      ne = part[ii+1];
       jj_count_diag = start_indexing;
       jj_count_offd = start_indexing;
 
@@ -263,10 +313,257 @@ void hypre_ParMatmul_RowSizes(
 
    hypre_TFree(jj_count_diag_array, HYPRE_MEMORY_HOST);
    hypre_TFree(jj_count_offd_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(part, HYPRE_MEMORY_HOST);
 
    /* End of First Pass */
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmul_ConcatProduct
+ *
+ * Computes the diag and offd blocks of C = A*B with a single host SpGEMM
+ * (hypre_CSRMatrixMultiplyHost_v2).  The local rows of A are written as
+ * [A_offd A_diag] and the rows of B they reach as [B_ext; B], with the
+ * columns of B numbered as the columns of C (diag columns first, then the
+ * offd columns through map_B_to_C and B_ext_offd_j).  Entries are visited
+ * in the same order as in the fused kernel of hypre_ParMatmul, so both give
+ * the same columns and bitwise the same values.  The product is then split
+ * back into C_diag and C_offd.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParMatmul_ConcatProduct( HYPRE_MemoryLocation memory_location_C,
+                               hypre_CSRMatrix     *A_diag,
+                               hypre_CSRMatrix     *A_offd,
+                               hypre_CSRMatrix     *B_diag,
+                               hypre_CSRMatrix     *B_offd,
+                               HYPRE_Int           *B_ext_diag_i,
+                               HYPRE_Int           *B_ext_diag_j,
+                               HYPRE_Complex       *B_ext_diag_data,
+                               HYPRE_Int           *B_ext_offd_i,
+                               HYPRE_Int           *B_ext_offd_j,
+                               HYPRE_Complex       *B_ext_offd_data,
+                               HYPRE_Int           *map_B_to_C,
+                               HYPRE_Int            num_cols_offd_C,
+                               HYPRE_Int            allsquare,
+                               HYPRE_Int          **C_diag_i_ptr,
+                               HYPRE_Int          **C_diag_j_ptr,
+                               HYPRE_Complex      **C_diag_data_ptr,
+                               HYPRE_Int           *C_diag_size_ptr,
+                               HYPRE_Int          **C_offd_i_ptr,
+                               HYPRE_Int          **C_offd_j_ptr,
+                               HYPRE_Complex      **C_offd_data_ptr,
+                               HYPRE_Int           *C_offd_size_ptr )
+{
+   HYPRE_Complex   *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex   *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        num_rows_diag_A = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_diag_A = hypre_CSRMatrixNumCols(A_diag);
+   HYPRE_Int        num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   HYPRE_Complex   *B_diag_data = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int       *B_diag_i = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int       *B_diag_j = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex   *B_offd_data = hypre_CSRMatrixData(B_offd);
+   HYPRE_Int       *B_offd_i = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int       *B_offd_j = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int        num_rows_diag_B = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int        num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+   HYPRE_Int        num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+
+   hypre_CSRMatrix *A_cat, *B_cat, *C_cat;
+   HYPRE_Int       *A_cat_i, *A_cat_j, *B_cat_i, *B_cat_j, *C_cat_i, *C_cat_j;
+   HYPRE_Complex   *A_cat_data, *B_cat_data, *C_cat_data;
+
+   HYPRE_Int       *C_diag_i, *C_diag_j = NULL, *C_offd_i, *C_offd_j = NULL;
+   HYPRE_Complex   *C_diag_data = NULL, *C_offd_data = NULL;
+   HYPRE_Int        C_diag_size, C_offd_size;
+   HYPRE_Int        i;
+
+   /*-----------------------------------------------------------------------
+    *  A_cat = [A_offd A_diag]
+    *-----------------------------------------------------------------------*/
+
+   A_cat = hypre_CSRMatrixCreate(num_rows_diag_A, num_cols_offd_A + num_cols_diag_A,
+                                 A_offd_i[num_rows_diag_A] + A_diag_i[num_rows_diag_A]);
+   hypre_CSRMatrixInitialize_v2(A_cat, 0, HYPRE_MEMORY_HOST);
+   A_cat_i    = hypre_CSRMatrixI(A_cat);
+   A_cat_j    = hypre_CSRMatrixJ(A_cat);
+   A_cat_data = hypre_CSRMatrixData(A_cat);
+
+   for (i = 0; i <= num_rows_diag_A; i++)
+   {
+      A_cat_i[i] = A_offd_i[i] + A_diag_i[i];
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      HYPRE_Int jj, cnt = A_cat_i[i];
+
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         A_cat_j[cnt]      = A_offd_j[jj];
+         A_cat_data[cnt++] = A_offd_data[jj];
+      }
+      for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+      {
+         A_cat_j[cnt]      = num_cols_offd_A + A_diag_j[jj];
+         A_cat_data[cnt++] = A_diag_data[jj];
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    *  B_cat = [B_ext_offd B_ext_diag; B_diag B_offd] in the columns of C
+    *-----------------------------------------------------------------------*/
+
+   B_cat = hypre_CSRMatrixCreate(num_cols_offd_A + num_rows_diag_B,
+                                 num_cols_diag_B + num_cols_offd_C,
+                                 B_ext_offd_i[num_cols_offd_A] + B_ext_diag_i[num_cols_offd_A] +
+                                 B_diag_i[num_rows_diag_B] + B_offd_i[num_rows_diag_B]);
+   hypre_CSRMatrixInitialize_v2(B_cat, 0, HYPRE_MEMORY_HOST);
+   B_cat_i    = hypre_CSRMatrixI(B_cat);
+   B_cat_j    = hypre_CSRMatrixJ(B_cat);
+   B_cat_data = hypre_CSRMatrixData(B_cat);
+
+   for (i = 0; i <= num_cols_offd_A; i++)
+   {
+      B_cat_i[i] = B_ext_offd_i[i] + B_ext_diag_i[i];
+   }
+   for (i = 1; i <= num_rows_diag_B; i++)
+   {
+      B_cat_i[num_cols_offd_A+i] = B_cat_i[num_cols_offd_A] + B_diag_i[i] + B_offd_i[i];
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols_offd_A; i++)
+   {
+      HYPRE_Int jj, cnt = B_cat_i[i];
+
+      for (jj = B_ext_offd_i[i]; jj < B_ext_offd_i[i+1]; jj++)
+      {
+         B_cat_j[cnt]      = num_cols_diag_B + B_ext_offd_j[jj];
+         B_cat_data[cnt++] = B_ext_offd_data[jj];
+      }
+      for (jj = B_ext_diag_i[i]; jj < B_ext_diag_i[i+1]; jj++)
+      {
+         B_cat_j[cnt]      = B_ext_diag_j[jj];
+         B_cat_data[cnt++] = B_ext_diag_data[jj];
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_diag_B; i++)
+   {
+      HYPRE_Int jj, cnt = B_cat_i[num_cols_offd_A+i];
+
+      for (jj = B_diag_i[i]; jj < B_diag_i[i+1]; jj++)
+      {
+         B_cat_j[cnt]      = B_diag_j[jj];
+         B_cat_data[cnt++] = B_diag_data[jj];
+      }
+      if (num_cols_offd_B)
+      {
+         for (jj = B_offd_i[i]; jj < B_offd_i[i+1]; jj++)
+         {
+            B_cat_j[cnt]      = num_cols_diag_B + map_B_to_C[B_offd_j[jj]];
+            B_cat_data[cnt++] = B_offd_data[jj];
+         }
+      }
+   }
+
+   C_cat = hypre_CSRMatrixMultiplyHost_v2(A_cat, B_cat, allsquare);
+   hypre_CSRMatrixDestroy(A_cat);
+   hypre_CSRMatrixDestroy(B_cat);
+   C_cat_i    = hypre_CSRMatrixI(C_cat);
+   C_cat_j    = hypre_CSRMatrixJ(C_cat);
+   C_cat_data = hypre_CSRMatrixData(C_cat);
+
+   /*-----------------------------------------------------------------------
+    *  Split C_cat into C_diag and C_offd
+    *-----------------------------------------------------------------------*/
+
+   C_diag_i = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A+1, memory_location_C);
+   C_offd_i = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A+1, memory_location_C);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      HYPRE_Int jj, cnt_diag = 0;
+
+      for (jj = C_cat_i[i]; jj < C_cat_i[i+1]; jj++)
+      {
+         if (C_cat_j[jj] < num_cols_diag_B)
+         {
+            cnt_diag++;
+         }
+      }
+      C_diag_i[i+1] = cnt_diag;
+      C_offd_i[i+1] = C_cat_i[i+1] - C_cat_i[i] - cnt_diag;
+   }
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      C_diag_i[i+1] += C_diag_i[i];
+      C_offd_i[i+1] += C_offd_i[i];
+   }
+   C_diag_size = C_diag_i[num_rows_diag_A];
+   C_offd_size = C_offd_i[num_rows_diag_A];
+
+   C_diag_data = hypre_CTAlloc(HYPRE_Complex, C_diag_size, memory_location_C);
+   C_diag_j    = hypre_CTAlloc(HYPRE_Int, C_diag_size, memory_location_C);
+   if (C_offd_size)
+   {
+      C_offd_data = hypre_CTAlloc(HYPRE_Complex, C_offd_size, memory_location_C);
+      C_offd_j    = hypre_CTAlloc(HYPRE_Int, C_offd_size, memory_location_C);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      HYPRE_Int jj, jcol, cnt_diag = C_diag_i[i], cnt_offd = C_offd_i[i];
+
+      for (jj = C_cat_i[i]; jj < C_cat_i[i+1]; jj++)
+      {
+         jcol = C_cat_j[jj];
+         if (jcol < num_cols_diag_B)
+         {
+            C_diag_j[cnt_diag]      = jcol;
+            C_diag_data[cnt_diag++] = C_cat_data[jj];
+         }
+         else
+         {
+            C_offd_j[cnt_offd]      = jcol - num_cols_diag_B;
+            C_offd_data[cnt_offd++] = C_cat_data[jj];
+         }
+      }
+   }
+
+   hypre_CSRMatrixDestroy(C_cat);
+
+   *C_diag_i_ptr    = C_diag_i;
+   *C_diag_j_ptr    = C_diag_j;
+   *C_diag_data_ptr = C_diag_data;
+   *C_diag_size_ptr = C_diag_size;
+   *C_offd_i_ptr    = C_offd_i;
+   *C_offd_j_ptr    = C_offd_j;
+   *C_offd_data_ptr = C_offd_data;
+   *C_offd_size_ptr = C_offd_size;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParMatmul : multiplies two ParCSRMatrices A and B and returns
  * the product in ParCSRMatrix C
@@ -339,6 +636,7 @@ hypre_ParCSRMatrix *hypre_ParMatmul( hypre_ParCSRMatrix  *A,
    HYPRE_Int        C_diag_size;
    HYPRE_Int        C_offd_size;
    HYPRE_Int        num_cols_offd_C = 0;
+   HYPRE_Int       *row_part;
 
    hypre_CSRMatrix *Bs_ext;
 
@@ -793,191 +1091,179 @@ hypre_ParCSRMatrix *hypre_ParMatmul( hypre_ParCSRMatrix  *A,
    hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX] += hypre_MPI_Wtime();
 #endif
 
-   hypre_ParMatmul_RowSizes(
-      /*&C_diag_i, &C_offd_i, &B_marker,*/
-      memory_location_C,
-      &C_diag_i, &C_offd_i,
-      A_diag_i, A_diag_j, A_offd_i, A_offd_j,
-      B_diag_i, B_diag_j, B_offd_i, B_offd_j,
-      B_ext_diag_i, B_ext_diag_j, B_ext_offd_i, B_ext_offd_j,
-      map_B_to_C,
-      &C_diag_size, &C_offd_size,
-      num_rows_diag_A, num_cols_offd_A, allsquare,
-      num_cols_diag_B, num_cols_offd_B,
-      num_cols_offd_C
-      );
-
-   /*-----------------------------------------------------------------------
-    *  Allocate C_diag_data and C_diag_j arrays.
-    *  Allocate C_offd_data and C_offd_j arrays.
-    *-----------------------------------------------------------------------*/
-
-   last_col_diag_B = first_col_diag_B + (HYPRE_BigInt)num_cols_diag_B - 1;
-   C_diag_data = hypre_CTAlloc(HYPRE_Complex, C_diag_size, memory_location_C);
-   C_diag_j    = hypre_CTAlloc(HYPRE_Int, C_diag_size, memory_location_C);
-   if (C_offd_size)
+   if (!hypre_HandleParMatmulFused(hypre_handle()))
    {
-      C_offd_data = hypre_CTAlloc(HYPRE_Complex, C_offd_size, memory_location_C);
-      C_offd_j    = hypre_CTAlloc(HYPRE_Int, C_offd_size, memory_location_C);
+      hypre_ParMatmul_ConcatProduct(memory_location_C, A_diag, A_offd, B_diag, B_offd,
+                                    B_ext_diag_i, B_ext_diag_j, B_ext_diag_data,
+                                    B_ext_offd_i, B_ext_offd_j, B_ext_offd_data,
+                                    map_B_to_C, num_cols_offd_C, allsquare,
+                                    &C_diag_i, &C_diag_j, &C_diag_data, &C_diag_size,
+                                    &C_offd_i, &C_offd_j, &C_offd_data, &C_offd_size);
    }
-
-   /*-----------------------------------------------------------------------
-    *  Second Pass: Fill in C_diag_data and C_diag_j.
-    *  Second Pass: Fill in C_offd_data and C_offd_j.
-    *-----------------------------------------------------------------------*/
-
-   /*-----------------------------------------------------------------------
-    *  Initialize some stuff.
-    *-----------------------------------------------------------------------*/
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel
-#endif
+   else
    {
-      HYPRE_Int *B_marker = NULL;
-      HYPRE_Int ns, ne, size, rest, ii;
-      HYPRE_Int i1, i2, i3, jj2, jj3;
-      HYPRE_Int jj_row_begin_diag, jj_count_diag;
-      HYPRE_Int jj_row_begin_offd, jj_count_offd;
-      HYPRE_Int num_threads;
-      HYPRE_Complex a_entry; /*, a_b_product;*/
+      hypre_ParMatmul_RowSizes(
+         /*&C_diag_i, &C_offd_i, &B_marker,*/
+         memory_location_C,
+         &C_diag_i, &C_offd_i,
+         A_diag_i, A_diag_j, A_offd_i, A_offd_j,
+         B_diag_i, B_diag_j, B_offd_i, B_offd_j,
+         B_ext_diag_i, B_ext_diag_j, B_ext_offd_i, B_ext_offd_j,
+         map_B_to_C,
+         &C_diag_size, &C_offd_size,
+         num_rows_diag_A, num_cols_offd_A, allsquare,
+         num_cols_diag_B, num_cols_offd_B,
+         num_cols_offd_C
+         );
 
-      ii = hypre_GetThreadNum();
-      num_threads = hypre_NumActiveThreads();
-      size = num_rows_diag_A/num_threads;
-      rest = num_rows_diag_A - size*num_threads;
-      if (ii < rest)
-      {
-         ns = ii*size+ii;
-         ne = (ii+1)*size+ii+1;
-      }
-      else
-      {
-         ns = ii*size+rest;
-         ne = (ii+1)*size+rest;
-      }
-      jj_count_diag = C_diag_i[ns];
-      jj_count_offd = C_offd_i[ns];
-      if (num_cols_diag_B || num_cols_offd_C)
-      {
-         B_marker = hypre_CTAlloc(HYPRE_Int, num_cols_diag_B+num_cols_offd_C, HYPRE_MEMORY_HOST);
-      }
-      for (i1 = 0; i1 < num_cols_diag_B+num_cols_offd_C; i1++)
+      /*-----------------------------------------------------------------------
+       *  Allocate C_diag_data and C_diag_j arrays.
+       *  Allocate C_offd_data and C_offd_j arrays.
+       *-----------------------------------------------------------------------*/
+
+      last_col_diag_B = first_col_diag_B + (HYPRE_BigInt)num_cols_diag_B - 1;
+      C_diag_data = hypre_CTAlloc(HYPRE_Complex, C_diag_size, memory_location_C);
+      C_diag_j    = hypre_CTAlloc(HYPRE_Int, C_diag_size, memory_location_C);
+      if (C_offd_size)
       {
-         B_marker[i1] = -1;
+         C_offd_data = hypre_CTAlloc(HYPRE_Complex, C_offd_size, memory_location_C);
+         C_offd_j    = hypre_CTAlloc(HYPRE_Int, C_offd_size, memory_location_C);
       }
 
       /*-----------------------------------------------------------------------
-       *  Loop over interior c-points.
+       *  Second Pass: Fill in C_diag_data and C_diag_j.
+       *  Second Pass: Fill in C_offd_data and C_offd_j.
        *-----------------------------------------------------------------------*/
 
-      for (i1 = ns; i1 < ne; i1++)
+      /*-----------------------------------------------------------------------
+       *  Initialize some stuff.
+       *  C_diag_i and C_offd_i hold global offsets, so the rows may be split
+       *  over the threads differently from the first pass.
+       *-----------------------------------------------------------------------*/
+      row_part = hypre_ParMatmul_RowPartition(num_rows_diag_A, num_cols_offd_A,
+                                              A_diag_i, A_diag_j, A_offd_i, A_offd_j,
+                                              B_diag_i, B_offd_i, B_ext_diag_i, B_ext_offd_i,
+                                              hypre_NumThreads());
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
       {
+         HYPRE_Int *B_marker = NULL;
+         HYPRE_Int ns, ne, ii;
+         HYPRE_Int i1, i2, i3, jj2, jj3;
+         HYPRE_Int jj_row_begin_diag, jj_count_diag;
+         HYPRE_Int jj_row_begin_offd, jj_count_offd;
+         HYPRE_Complex a_entry; /*, a_b_product;*/
 
-         /*--------------------------------------------------------------------
-          *  Create diagonal entry, C_{i1,i1}
-          *--------------------------------------------------------------------*/
-
-         jj_row_begin_diag = jj_count_diag;
-         jj_row_begin_offd = jj_count_offd;
-         if ( allsquare )
+         ii = hypre_GetThreadNum();
+         if (hypre_NumActiveThreads() == hypre_NumThreads())
          {
-            B_marker[i1] = jj_count_diag;
-            C_diag_data[jj_count_diag] = zero;
-            C_diag_j[jj_count_diag] = i1;
-            jj_count_diag++;
+            ns = row_part[ii];
+            ne = row_part[ii+1];
+         }
+         else
+         {
+            hypre_GetSimpleThreadPartition(&ns, &ne, num_rows_diag_A);
+         }
+         jj_count_diag = C_diag_i[ns];
+         jj_count_offd = C_offd_i[ns];
+         if (num_cols_diag_B || num_cols_offd_C)
+         {
+            B_marker = hypre_CTAlloc(HYPRE_Int, num_cols_diag_B+num_cols_offd_C, HYPRE_MEMORY_HOST);
+         }
+         for (i1 = 0; i1 < num_cols_diag_B+num_cols_offd_C; i1++)
+         {
+            B_marker[i1] = -1;
          }
 
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_offd.
-          *-----------------------------------------------------------------*/
+         /*-----------------------------------------------------------------------
+          *  Loop over interior c-points.
+          *-----------------------------------------------------------------------*/
 
-         if (num_cols_offd_A)
+         for (i1 = ns; i1 < ne; i1++)
          {
-            for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
+
+            /*--------------------------------------------------------------------
+             *  Create diagonal entry, C_{i1,i1}
+             *--------------------------------------------------------------------*/
+
+            jj_row_begin_diag = jj_count_diag;
+            jj_row_begin_offd = jj_count_offd;
+            if ( allsquare )
             {
-               i2 = A_offd_j[jj2];
-               a_entry = A_offd_data[jj2];
+               B_marker[i1] = jj_count_diag;
+               C_diag_data[jj_count_diag] = zero;
+               C_diag_j[jj_count_diag] = i1;
+               jj_count_diag++;
+            }
 
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of B_ext.
-                *-----------------------------------------------------------*/
+            /*-----------------------------------------------------------------
+             *  Loop over entries in row i1 of A_offd.
+             *-----------------------------------------------------------------*/
 
-               for (jj3 = B_ext_offd_i[i2]; jj3 < B_ext_offd_i[i2+1]; jj3++)
+            if (num_cols_offd_A)
+            {
+               for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
                {
-                  i3 = num_cols_diag_B+B_ext_offd_j[jj3];
+                  i2 = A_offd_j[jj2];
+                  a_entry = A_offd_data[jj2];
 
-                  /*--------------------------------------------------------
-                   *  Check B_marker to see that C_{i1,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
-                   *--------------------------------------------------------*/
+                  /*-----------------------------------------------------------
+                   *  Loop over entries in row i2 of B_ext.
+                   *-----------------------------------------------------------*/
 
-                  if (B_marker[i3] < jj_row_begin_offd)
+                  for (jj3 = B_ext_offd_i[i2]; jj3 < B_ext_offd_i[i2+1]; jj3++)
                   {
-                     B_marker[i3] = jj_count_offd;
-                     C_offd_data[jj_count_offd] = a_entry*B_ext_offd_data[jj3];
-                     C_offd_j[jj_count_offd] = i3-num_cols_diag_B;
-                     jj_count_offd++;
+                     i3 = num_cols_diag_B+B_ext_offd_j[jj3];
+
+                     /*--------------------------------------------------------
+                      *  Check B_marker to see that C_{i1,i3} has not already
+                      *  been accounted for. If it has not, create a new entry.
+                      *  If it has, add new contribution.
+                      *--------------------------------------------------------*/
+
+                     if (B_marker[i3] < jj_row_begin_offd)
+                     {
+                        B_marker[i3] = jj_count_offd;
+                        C_offd_data[jj_count_offd] = a_entry*B_ext_offd_data[jj3];
+                        C_offd_j[jj_count_offd] = i3-num_cols_diag_B;
+                        jj_count_offd++;
+                     }
+                     else
+                        C_offd_data[B_marker[i3]] += a_entry*B_ext_offd_data[jj3];
                   }
-                  else
-                     C_offd_data[B_marker[i3]] += a_entry*B_ext_offd_data[jj3];
-               }
-               for (jj3 = B_ext_diag_i[i2]; jj3 < B_ext_diag_i[i2+1]; jj3++)
-               {
-                  i3 = B_ext_diag_j[jj3];
-                  if (B_marker[i3] < jj_row_begin_diag)
+                  for (jj3 = B_ext_diag_i[i2]; jj3 < B_ext_diag_i[i2+1]; jj3++)
                   {
-                     B_marker[i3] = jj_count_diag;
-                     C_diag_data[jj_count_diag] = a_entry*B_ext_diag_data[jj3];
-                     C_diag_j[jj_count_diag] = i3;
-                     jj_count_diag++;
+                     i3 = B_ext_diag_j[jj3];
+                     if (B_marker[i3] < jj_row_begin_diag)
+                     {
+                        B_marker[i3] = jj_count_diag;
+                        C_diag_data[jj_count_diag] = a_entry*B_ext_diag_data[jj3];
+                        C_diag_j[jj_count_diag] = i3;
+                        jj_count_diag++;
+                     }
+                     else
+                        C_diag_data[B_marker[i3]] += a_entry*B_ext_diag_data[jj3];
                   }
-                  else
-                     C_diag_data[B_marker[i3]] += a_entry*B_ext_diag_data[jj3];
                }
             }
-         }
 
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_diag.
-          *-----------------------------------------------------------------*/
+            /*-----------------------------------------------------------------
+             *  Loop over entries in row i1 of A_diag.
+             *-----------------------------------------------------------------*/
 
-         for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
-         {
-            i2 = A_diag_j[jj2];
-            a_entry = A_diag_data[jj2];
-
-            /*-----------------------------------------------------------
-             *  Loop over entries in row i2 of B_diag.
-             *-----------------------------------------------------------*/
-
-            for (jj3 = B_diag_i[i2]; jj3 < B_diag_i[i2+1]; jj3++)
+            for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
             {
-               i3 = B_diag_j[jj3];
+               i2 = A_diag_j[jj2];
+               a_entry = A_diag_data[jj2];
 
-               /*--------------------------------------------------------
-                *  Check B_marker to see that C_{i1,i3} has not already
-                *  been accounted for. If it has not, create a new entry.
-                *  If it has, add new contribution.
-                *--------------------------------------------------------*/
+               /*-----------------------------------------------------------
+                *  Loop over entries in row i2 of B_diag.
+                *-----------------------------------------------------------*/
 
-               if (B_marker[i3] < jj_row_begin_diag)
-               {
-                  B_marker[i3] = jj_count_diag;
-                  C_diag_data[jj_count_diag] = a_entry*B_diag_data[jj3];
-                  C_diag_j[jj_count_diag] = i3;
-                  jj_count_diag++;
-               }
-               else
-               {
-                  C_diag_data[B_marker[i3]] += a_entry*B_diag_data[jj3];
-               }
-            }
-            if (num_cols_offd_B)
-            {
-               for (jj3 = B_offd_i[i2]; jj3 < B_offd_i[i2+1]; jj3++)
+               for (jj3 = B_diag_i[i2]; jj3 < B_diag_i[i2+1]; jj3++)
                {
-                  i3 = num_cols_diag_B+map_B_to_C[B_offd_j[jj3]];
+                  i3 = B_diag_j[jj3];
 
                   /*--------------------------------------------------------
                    *  Check B_marker to see that C_{i1,i3} has not already
@@ -985,23 +1271,49 @@ hypre_ParCSRMatrix *hypre_ParMatmul( hypre_ParCSRMatrix  *A,
                    *  If it has, add new contribution.
                    *--------------------------------------------------------*/
 
-                  if (B_marker[i3] < jj_row_begin_offd)
+                  if (B_marker[i3] < jj_row_begin_diag)
                   {
-                     B_marker[i3] = jj_count_offd;
-                     C_offd_data[jj_count_offd] = a_entry*B_offd_data[jj3];
-                     C_offd_j[jj_count_offd] = i3-num_cols_diag_B;
-                     jj_count_offd++;
+                     B_marker[i3] = jj_count_diag;
+                     C_diag_data[jj_count_diag] = a_entry*B_diag_data[jj3];
+                     C_diag_j[jj_count_diag] = i3;
+                     jj_count_diag++;
                   }
                   else
                   {
-                     C_offd_data[B_marker[i3]] += a_entry*B_offd_data[jj3];
+                     C_diag_data[B_marker[i3]] += a_entry*B_diag_data[jj3];
+                  }
+               }
+               if (num_cols_offd_B)
+               {
+                  for (jj3 = B_offd_i[i2]; jj3 < B_offd_i[i2+1]; jj3++)
+                  {
+                     i3 = num_cols_diag_B+map_B_to_C[B_offd_j[jj3]];
+
+                     /*--------------------------------------------------------
+                      *  Check B_marker to see that C_{i1,i3} has not already
+                      *  been accounted for. If it has not, create a new entry.
+                      *  If it has, add new contribution.
+                      *--------------------------------------------------------*/
+
+                     if (B_marker[i3] < jj_row_begin_offd)
+                     {
+                        B_marker[i3] = jj_count_offd;
+                        C_offd_data[jj_count_offd] = a_entry*B_offd_data[jj3];
+                        C_offd_j[jj_count_offd] = i3-num_cols_diag_B;
+                        jj_count_offd++;
+                     }
+                     else
+                     {
+                        C_offd_data[B_marker[i3]] += a_entry*B_offd_data[jj3];
+                     }
                   }
                }
             }
          }
-      }
-      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
-   } /*end parallel region */
+         hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+      } /*end parallel region */
+      hypre_TFree(row_part, HYPRE_MEMORY_HOST);
+   }
 
    C = hypre_ParCSRMatrixCreate(comm, n_rows_A, n_cols_B, row_starts_A,
                                 col_starts_B, num_cols_offd_C,
@@ -325,6 +325,63 @@ hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_loc
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToSingle
+ *
+ * Stores the values of the diag and offd parts (and of their transposes,
+ * if kept) in single precision; see hypre_CSRMatrixConvertToSingle.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToSingle( hypre_ParCSRMatrix *A )
+{
+   if (!A)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertToSingle(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixConvertToSingle(hypre_ParCSRMatrixOffd(A));
+   if (hypre_ParCSRMatrixDiagT(A))
+   {
+      hypre_CSRMatrixConvertToSingle(hypre_ParCSRMatrixDiagT(A));
+   }
+   if (hypre_ParCSRMatrixOffdT(A))
+   {
+      hypre_CSRMatrixConvertToSingle(hypre_ParCSRMatrixOffdT(A));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertFromSingle
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertFromSingle( hypre_ParCSRMatrix *A )
+{
+   if (!A)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertFromSingle(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixConvertFromSingle(hypre_ParCSRMatrixOffd(A));
+   if (hypre_ParCSRMatrixDiagT(A))
+   {
+      hypre_CSRMatrixConvertFromSingle(hypre_ParCSRMatrixDiagT(A));
+   }
+   if (hypre_ParCSRMatrixOffdT(A))
+   {
+      hypre_CSRMatrixConvertFromSingle(hypre_ParCSRMatrixOffdT(A));
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_ParCSRMatrixSetNumNonzeros_core( hypre_ParCSRMatrix *matrix, const char* format )
 {
@@ -455,6 +512,30 @@ hypre_ParCSRMatrixSetColStartsOwner( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetSpMVFormat
+ *
+ * Selects the host SpMV storage format of the diag and offd blocks
+ * (-1: global default, 0: CSR, 1: SELL-C-sigma, 2: CSR with short column
+ * indices)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetSpMVFormat( hypre_ParCSRMatrix *matrix,
+                                 HYPRE_Int           format )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSetSpMVFormat(hypre_ParCSRMatrixDiag(matrix), format);
+   hypre_CSRMatrixSetSpMVFormat(hypre_ParCSRMatrixOffd(matrix), format);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixRead
  *--------------------------------------------------------------------------*/
@@ -2378,6 +2459,9 @@ hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A,
 
    hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
 
+   hypre_CSRMatrixUpdateCompanions(A_diag);
+   hypre_CSRMatrixUpdateCompanions(A_offd);
+
    return hypre_error_flag;
 }
 
@@ -2977,6 +3061,10 @@ hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A,
    hypre_TFree(num_lost_per_thread, HYPRE_MEMORY_HOST);
    hypre_TFree(num_lost_offd_per_thread, HYPRE_MEMORY_HOST);
 
+   /* the rows were compressed and may have been reordered in place */
+   hypre_CSRMatrixUpdateCompanions(A_diag);
+   hypre_CSRMatrixUpdateCompanions(A_offd);
+
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_INTERP_TRUNC] += hypre_MPI_Wtime();
 #endif
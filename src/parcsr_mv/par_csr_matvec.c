@@ -14,6 +14,345 @@
 #include "_hypre_parcsr_mv.h"
 #include "_hypre_utilities.hpp" //RL: TODO par_csr_matvec_device.c, include cuda there
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecUnitIsBoundary
+ *
+ * Whether work unit u of the diag kernel (a row, or a SELL chunk whose rows
+ * are given by perm) contains a row with offd entries.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_ParCSRMatrixMatvecUnitIsBoundary( HYPRE_Int *offd_i,
+                                        HYPRE_Int *perm,
+                                        HYPRE_Int  unit_rows,
+                                        HYPRE_Int  u )
+{
+   HYPRE_Int r, row;
+
+   if (!perm)
+   {
+      return offd_i[u+1] > offd_i[u];
+   }
+
+   for (r = 0; r < unit_rows; r++)
+   {
+      row = perm[u * unit_rows + r];
+      if (row >= 0 && offd_i[row+1] > offd_i[row])
+      {
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecDiagSplitHost
+ *
+ * y = alpha*diag*x + beta*b on the interior rows (boundary = 0), the rows
+ * without offd entries, or on the boundary rows (boundary = 1).  Interior
+ * rows are complete after this and are computed while the halo exchange in
+ * comm_handle is in flight; boundary rows are computed after the exchange,
+ * just before their offd part.  The work units of the kernel selected for
+ * diag are processed in blocks of about progress_rows rows, in one parallel
+ * region, each block in runs of consecutive units of the requested kind.
+ * If comm_handle is given, the master thread tests the exchange after each
+ * of its blocks until it has completed, and overlap returns the time the
+ * exchange was in flight while computing.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecDiagSplitHost( HYPRE_Complex           alpha,
+                                       hypre_CSRMatrix        *diag,
+                                       hypre_CSRMatrix        *offd,
+                                       HYPRE_Complex          *x_data,
+                                       HYPRE_Complex           beta,
+                                       HYPRE_Complex          *b_data,
+                                       HYPRE_Complex          *y_data,
+                                       HYPRE_Int               progress_rows,
+                                       HYPRE_Int               boundary,
+                                       hypre_ParCSRCommHandle *comm_handle,
+                                       HYPRE_Real             *overlap )
+{
+   HYPRE_Int       *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int       *perm = NULL;
+   HYPRE_Int        num_units, unit_rows, block_units, num_blocks;
+   HYPRE_Int        blk, done = (comm_handle == NULL);
+   HYPRE_Real       time_start, time_done = 0.0;
+
+   hypre_CSRMatrixMatvecRangeSetup(diag, &num_units, &unit_rows);
+   if (hypre_CSRMatrixSpMVUseSell(diag))
+   {
+      perm = hypre_CSRMatrixSellPerm(hypre_CSRMatrixSell(diag));
+   }
+
+   block_units = hypre_max(progress_rows / unit_rows, 1);
+   num_blocks  = (num_units + block_units - 1) / block_units;
+
+   time_start = hypre_MPI_Wtime();
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel private(blk)
+#endif
+   {
+      HYPRE_Int my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int begin, end, u, run_end;
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp for nowait HYPRE_SMP_SCHEDULE
+#endif
+      for (blk = 0; blk < num_blocks; blk++)
+      {
+         begin = blk * block_units;
+         end   = hypre_min(begin + block_units, num_units);
+
+         for (u = begin; u < end; u = run_end)
+         {
+            run_end = u + 1;
+            if (hypre_ParCSRMatrixMatvecUnitIsBoundary(offd_i, perm, unit_rows, u) != boundary)
+            {
+               continue;
+            }
+            while (run_end < end &&
+                   hypre_ParCSRMatrixMatvecUnitIsBoundary(offd_i, perm, unit_rows, run_end) == boundary)
+            {
+               run_end++;
+            }
+
+            hypre_CSRMatrixMatvecRangeHost(alpha, diag, x_data, beta, b_data, y_data, u, run_end);
+         }
+
+         /* MPI is only called from the master thread */
+         if (my_thread_num == 0 && !done)
+         {
+            hypre_ParCSRCommHandleTest(comm_handle, &done);
+            if (done)
+            {
+               time_done = hypre_MPI_Wtime();
+            }
+         }
+      }
+   }
+
+   if (overlap)
+   {
+      *overlap = (comm_handle && done ? time_done : hypre_MPI_Wtime()) - time_start;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecMultiVectorHost
+ *
+ * y = alpha*A*x + beta*b for multivectors. The halo values of all vectors
+ * are exchanged together, in one message per neighbor, and are received
+ * index-major so that the offd product reads the values of a column for
+ * all vectors from one cache line.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecMultiVectorHost( HYPRE_Complex       alpha,
+                                         hypre_ParCSRMatrix *A,
+                                         hypre_ParVector    *x,
+                                         HYPRE_Complex       beta,
+                                         hypre_ParVector    *b,
+                                         hypre_ParVector    *y )
+{
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix        *diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *offd          = hypre_ParCSRMatrixOffd(A);
+   hypre_Vector           *x_local       = hypre_ParVectorLocalVector(x);
+   hypre_Vector           *b_local       = hypre_ParVectorLocalVector(b);
+   hypre_Vector           *y_local       = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex          *x_local_data  = hypre_VectorData(x_local);
+   HYPRE_Int               num_vectors   = hypre_VectorNumVectors(x_local);
+   HYPRE_Int               vecstride     = hypre_VectorVectorStride(x_local);
+   HYPRE_Int               idxstride     = hypre_VectorIndexStride(x_local);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_Vector           *x_tmp;
+   HYPRE_Complex          *x_buf_data;
+   HYPRE_Int               num_sends, i, jv;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+   hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+
+   x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors,
+                             HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i, jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      const HYPRE_Complex *xi = x_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         x_buf_data[i * num_vectors + jv] = xi[jv * vecstride];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVector(1, comm_pkg, num_vectors, x_buf_data,
+                                                         hypre_VectorData(x_tmp));
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   if (num_cols_offd)
+   {
+      hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
+   }
+
+   hypre_SeqVectorDestroy(x_tmp);
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecTMultiVectorHost
+ *
+ * y = alpha*A^T*x + beta*y for multivectors, with a single exchange of the
+ * offd contributions of all vectors (see
+ * hypre_ParCSRMatrixMatvecMultiVectorHost).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecTMultiVectorHost( HYPRE_Complex       alpha,
+                                          hypre_ParCSRMatrix *A,
+                                          hypre_ParVector    *x,
+                                          HYPRE_Complex       beta,
+                                          hypre_ParVector    *y )
+{
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix        *diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *offd          = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *diagT         = hypre_ParCSRMatrixDiagT(A);
+   hypre_CSRMatrix        *offdT         = hypre_ParCSRMatrixOffdT(A);
+   hypre_Vector           *x_local       = hypre_ParVectorLocalVector(x);
+   hypre_Vector           *y_local       = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex          *y_local_data  = hypre_VectorData(y_local);
+   HYPRE_Int               num_vectors   = hypre_VectorNumVectors(y_local);
+   HYPRE_Int               vecstride     = hypre_VectorVectorStride(y_local);
+   HYPRE_Int               idxstride     = hypre_VectorIndexStride(y_local);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_Vector           *y_tmp;
+   HYPRE_Complex          *y_buf_data;
+   HYPRE_Int               num_sends, i, jv;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   y_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+   hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_HOST);
+
+   y_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors,
+                             HYPRE_MEMORY_HOST);
+
+   if (num_cols_offd)
+   {
+      if (offdT)
+      {
+         hypre_CSRMatrixMatvec(alpha, offdT, x_local, 0.0, y_tmp);
+      }
+      else
+      {
+         hypre_CSRMatrixMatvecT(alpha, offd, x_local, 0.0, y_tmp);
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVector(2, comm_pkg, num_vectors,
+                                                         hypre_VectorData(y_tmp), y_buf_data);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   if (diagT)
+   {
+      hypre_CSRMatrixMatvec(alpha, diagT, x_local, beta, y_local);
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecT(alpha, diag, x_local, beta, y_local);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   -= hypre_MPI_Wtime();
+#endif
+
+   /* send_map_elmts may repeat, so this is not threaded */
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      HYPRE_Complex *yi = y_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         yi[jv * vecstride] += y_buf_data[i * num_vectors + jv];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorDestroy(y_tmp);
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -54,6 +393,12 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    HYPRE_Complex *x_tmp_data, **x_buf_data;
    HYPRE_Complex *x_local_data = hypre_VectorData(x_local);
 
+   /* compute the interior rows in blocks, testing the halo exchange in between */
+   HYPRE_Int  use_overlap = 0;
+   HYPRE_Real overlap_time = 0.0;
+   hypre_ParCSRCommHandle *overlap_handle = NULL;
+   hypre_Vector *x_copy = NULL;
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Int sync_stream;
    hypre_GetSyncCudaCompute(&sync_stream);
@@ -90,6 +435,18 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if (num_vectors > 1)
+   {
+      hypre_ParCSRMatrixMatvecMultiVectorHost(alpha, A, x, beta, b, y);
+      return ierr;
+   }
+
+   /* the blocked diag kernels read the double precision values */
+   use_overlap = hypre_HandleParMatvecOverlap(hypre_handle()) > 0 && num_vectors == 1 &&
+                 !hypre_CSRMatrixSingleData(diag) && !hypre_CSRMatrixSingleData(offd);
+#endif
+
    if ( num_vectors == 1 )
    {
       x_tmp = hypre_SeqVectorCreate( num_cols_offd );
@@ -110,6 +467,9 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
       comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    }
 
+   /* graph communicators for the neighborhood collective backend */
+   hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+
    num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    hypre_assert( num_cols_offd == hypre_ParCSRCommPkgRecvVecStart(comm_pkg, hypre_ParCSRCommPkgNumRecvs(comm_pkg)) );
    hypre_assert( hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0) == 0 );
@@ -267,6 +627,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    {
 #ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_buf_data[0]);
+      overlap_handle = persistent_comm_handle;
 #endif
    }
    else
@@ -276,6 +637,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
          comm_handle[jv] = hypre_ParCSRCommHandleCreate_v2( 1, comm_pkg, HYPRE_MEMORY_DEVICE, x_buf_data[jv],
                                                             HYPRE_MEMORY_DEVICE, &x_tmp_data[jv*num_cols_offd] );
       }
+      overlap_handle = comm_handle[0];
    }
 
 #ifdef HYPRE_PROFILE
@@ -283,7 +645,25 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
 
    /* overlapped local computation */
-   hypre_CSRMatrixMatvecOutOfPlace( alpha, diag, x_local, beta, b_local, y_local, 0 );
+   if (use_overlap)
+   {
+      /* the blocks of y are written while other blocks still read x */
+      x_copy = (x_local == y_local) ? hypre_SeqVectorCloneDeep(x_local) : NULL;
+
+      hypre_ParCSRMatrixMatvecDiagSplitHost( alpha, diag, offd,
+                                             x_copy ? hypre_VectorData(x_copy) : x_local_data,
+                                             beta, hypre_VectorData(b_local),
+                                             hypre_VectorData(y_local),
+                                             hypre_HandleParMatvecOverlap(hypre_handle()), 0,
+                                             overlap_handle, &overlap_time );
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_OVERLAP] += overlap_time;
+#endif
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecOutOfPlace( alpha, diag, x_local, beta, b_local, y_local, 0 );
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
@@ -310,6 +690,18 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
 #endif
 
+   /* diag part of the boundary rows, right before their offd part */
+   if (use_overlap)
+   {
+      hypre_ParCSRMatrixMatvecDiagSplitHost( alpha, diag, offd,
+                                             x_copy ? hypre_VectorData(x_copy) : x_local_data,
+                                             beta, hypre_VectorData(b_local),
+                                             hypre_VectorData(y_local),
+                                             hypre_HandleParMatvecOverlap(hypre_handle()), 1,
+                                             NULL, NULL );
+      hypre_SeqVectorDestroy(x_copy);
+   }
+
    /* computation offd part */
    if (num_cols_offd)
    {
@@ -435,6 +827,14 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(x_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if (num_vectors > 1)
+   {
+      hypre_ParCSRMatrixMatvecTMultiVectorHost(alpha, A, x, beta, y);
+      return ierr;
+   }
+#endif
+
    if ( num_vectors == 1 )
    {
       y_tmp = hypre_SeqVectorCreate(num_cols_offd);
@@ -455,6 +855,9 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
       comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    }
 
+   /* graph communicators for the neighborhood collective backend */
+   hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+
    num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    hypre_assert( num_cols_offd == hypre_ParCSRCommPkgRecvVecStart(comm_pkg, hypre_ParCSRCommPkgNumRecvs(comm_pkg)) );
    hypre_assert( hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0) == 0 );
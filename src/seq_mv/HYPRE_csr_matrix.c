@@ -104,3 +104,72 @@ HYPRE_CSRMatrixSetSpGemmUseCusparse( HYPRE_Int use_cusparse )
    return hypre_CSRMatrixDeviceSpGemmSetUseCusparse(use_cusparse);
 }
 
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CSRMatrixSetSpMVFormat
+ *
+ * Sets the default host SpMV storage format of CSR matrices
+ * (0: CSR, 1: SELL-C-sigma, 2: CSR with short column indices).  Per-matrix
+ * settings take precedence.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_CSRMatrixSetSpMVFormat( HYPRE_Int format )
+{
+   if (format < hypre_CSR_SPMV_FORMAT_CSR || format > hypre_CSR_SPMV_FORMAT_SHORTJ)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleSpMVFormat(hypre_handle()) = format;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CSRMatrixSetSpMVSellParams
+ *
+ * Sets the chunk size C and the sorting window sigma used when building
+ * SELL-C-sigma companions.  Only affects companions built afterwards.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_CSRMatrixSetSpMVSellParams( HYPRE_Int chunk_size,
+                                  HYPRE_Int sigma )
+{
+   if (chunk_size < 1 || chunk_size > hypre_CSR_SELL_MAX_CHUNK_SIZE)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (sigma < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleSpMVSellChunkSize(hypre_handle()) = chunk_size;
+   hypre_HandleSpMVSellSigma(hypre_handle())     = sigma;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CSRMatrixSetSpMVSimd
+ *
+ * Sets the instruction set of the host SpMV kernels
+ * (-1: best supported by the CPU (default), 0: scalar, 1: AVX2, 2: AVX-512).
+ * Requests beyond what the CPU supports fall back to the best supported one.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_CSRMatrixSetSpMVSimd( HYPRE_Int isa )
+{
+   if (isa < hypre_CSR_SPMV_SIMD_AUTO || isa > hypre_CSR_SPMV_SIMD_AVX512)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleSpMVSimd(hypre_handle()) = isa;
+
+   return hypre_error_flag;
+}
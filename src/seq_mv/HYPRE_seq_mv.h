@@ -48,6 +48,9 @@ HYPRE_CSRMatrix HYPRE_CSRMatrixRead( char *file_name );
 void HYPRE_CSRMatrixPrint( HYPRE_CSRMatrix matrix , char *file_name );
 HYPRE_Int HYPRE_CSRMatrixGetNumRows( HYPRE_CSRMatrix matrix , HYPRE_Int *num_rows );
 HYPRE_Int HYPRE_CSRMatrixSetSpGemmUseCusparse( HYPRE_Int use_cusparse );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVFormat( HYPRE_Int format );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVSellParams( HYPRE_Int chunk_size, HYPRE_Int sigma );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVSimd( HYPRE_Int isa );
 
 /* HYPRE_mapped_matrix.c */
 HYPRE_MappedMatrix HYPRE_MappedMatrixCreate( void );
@@ -90,6 +93,7 @@ typedef enum HYPRE_TimerID
    // timers for solve MPI
    HYPRE_TIMER_ID_PACK_UNPACK, // copying data to/from send/recv buf
    HYPRE_TIMER_ID_HALO_EXCHANGE, // halo exchange in matvec and relax
+   HYPRE_TIMER_ID_HALO_OVERLAP, // halo exchange hidden behind the interior rows of matvec
    HYPRE_TIMER_ID_ALL_REDUCE,
 
    // timers for setup phase
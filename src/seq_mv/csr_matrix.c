@@ -43,6 +43,10 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)  = 1;
    hypre_CSRMatrixNumRownnz(matrix) = num_rows;
+   hypre_CSRMatrixSpMVFormat(matrix) = hypre_CSR_SPMV_FORMAT_DEFAULT;
+   hypre_CSRMatrixSell(matrix)       = NULL;
+   hypre_CSRMatrixShortJ(matrix)     = NULL;
+   hypre_CSRMatrixSingleData(matrix) = NULL;
 
 #if defined(HYPRE_USING_CUSPARSE)
    hypre_CSRMatrixSortedJ(matrix)    = NULL;
@@ -67,6 +71,9 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixSellDestroy(matrix);
+      hypre_CSRMatrixShortJDestroy(matrix);
+      hypre_TFree(hypre_CSRMatrixSingleData(matrix), HYPRE_MEMORY_HOST);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
@@ -86,6 +93,59 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixUpdateCompanions
+ *
+ * Brings the host SpMV companions of A up to date after its column indices
+ * or values were permuted or compressed in place: the short column indices
+ * and the single precision copy are rebuilt, and the SELL companion is
+ * dropped (it is rebuilt by the next SELL matvec).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixUpdateCompanions( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixSellDestroy(A);
+
+   if (hypre_CSRMatrixShortJ(A))
+   {
+      hypre_CSRMatrixShortJDestroy(A);
+      hypre_CSRMatrixShortJ(A) = hypre_CSRMatrixShortJCreate(A);
+   }
+
+   /* a float copy next to values that are not owned is refreshed; owned
+      values were replaced by the floats and have nothing to refresh from */
+   if (hypre_CSRMatrixSingleData(A) && hypre_CSRMatrixData(A))
+   {
+      hypre_CSRMatrixConvertFromSingle(A);
+      hypre_CSRMatrixConvertToSingle(A);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixUpdateCompanionValues
+ *
+ * Brings the host SpMV companions of A up to date after its values were
+ * changed in place, with unchanged row pointers and column indices (e.g., a
+ * numeric refill of an assembled matrix).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixUpdateCompanionValues( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixSellRefresh(A);
+
+   if (hypre_CSRMatrixSingleData(A) && hypre_CSRMatrixData(A))
+   {
+      hypre_CSRMatrixConvertFromSingle(A);
+      hypre_CSRMatrixConvertToSingle(A);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixInitialize
  *--------------------------------------------------------------------------*/
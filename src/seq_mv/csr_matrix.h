@@ -21,6 +21,93 @@ struct hypre_CsrsvData;
 typedef struct hypre_CsrsvData hypre_CsrsvData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * Host SpMV storage formats
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CSR_SPMV_FORMAT_DEFAULT  -1   /* use the global setting */
+#define hypre_CSR_SPMV_FORMAT_CSR       0
+#define hypre_CSR_SPMV_FORMAT_SELL      1
+#define hypre_CSR_SPMV_FORMAT_SHORTJ    2   /* CSR with 16/32-bit column offsets */
+
+#define hypre_CSR_SELL_MAX_CHUNK_SIZE  64
+
+/* instruction sets of the explicitly vectorized host SpMV kernels */
+#define hypre_CSR_SPMV_SIMD_AUTO       -1   /* best one supported by the CPU */
+#define hypre_CSR_SPMV_SIMD_SCALAR      0
+#define hypre_CSR_SPMV_SIMD_AVX2        1
+#define hypre_CSR_SPMV_SIMD_AVX512      2
+
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) companion of a CSR Matrix
+ *
+ * Rows are sorted by length (descending) within windows of sigma rows and
+ * grouped into chunks of C rows, which are padded to the length of their
+ * longest row.  The column indices and values of a chunk are stored column
+ * by column: entry k of slot r of chunk c is at chunk_ptr[c] + k*C + r, so
+ * that the C rows of a chunk are processed with unit stride.  Padding
+ * entries have value zero and repeat the last column index of their row
+ * (column 0 for empty rows).
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             chunk_size;      /* C */
+   HYPRE_Int             sigma;           /* sorting window */
+   HYPRE_Int             num_chunks;
+   HYPRE_Int            *chunk_len;       /* width of each chunk */
+   HYPRE_Int            *chunk_ptr;       /* start of each chunk in col and val */
+   HYPRE_Int            *perm;            /* slot -> row, -1 for padding slots */
+   HYPRE_Int            *col;             /* padded column indices */
+   HYPRE_Complex        *val;             /* padded values */
+   HYPRE_Int             num_rows;        /* size, nnz and arrays of the CSR matrix */
+   HYPRE_Int             num_nonzeros;    /* it was built from */
+   HYPRE_Int            *csr_i;
+   HYPRE_Int            *csr_j;
+   HYPRE_Complex        *csr_data;
+
+} hypre_CSRMatrixSell;
+
+#define hypre_CSRMatrixSellChunkSize(sell)          ((sell) -> chunk_size)
+#define hypre_CSRMatrixSellSigma(sell)              ((sell) -> sigma)
+#define hypre_CSRMatrixSellNumChunks(sell)          ((sell) -> num_chunks)
+#define hypre_CSRMatrixSellChunkLen(sell)           ((sell) -> chunk_len)
+#define hypre_CSRMatrixSellChunkPtr(sell)           ((sell) -> chunk_ptr)
+#define hypre_CSRMatrixSellPerm(sell)               ((sell) -> perm)
+#define hypre_CSRMatrixSellCol(sell)                ((sell) -> col)
+#define hypre_CSRMatrixSellVal(sell)                ((sell) -> val)
+#define hypre_CSRMatrixSellNumRows(sell)            ((sell) -> num_rows)
+#define hypre_CSRMatrixSellNumNonzeros(sell)        ((sell) -> num_nonzeros)
+#define hypre_CSRMatrixSellCSRI(sell)               ((sell) -> csr_i)
+#define hypre_CSRMatrixSellCSRJ(sell)               ((sell) -> csr_j)
+#define hypre_CSRMatrixSellCSRData(sell)            ((sell) -> csr_data)
+
+/*--------------------------------------------------------------------------
+ * Short column indices companion of a CSR Matrix
+ *
+ * The column index A_j[jj] of row i is stored as the offset
+ * A_j[jj] - row_base[i] from the smallest column index of the row, in 16 bits
+ * if every row spans less than 2^16 columns, and else in 32 bits if HYPRE_Int
+ * is wider than that.  If neither fits, j16 and j32 are both NULL and the CSR
+ * indices are used.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            *row_base;        /* smallest column index of each row */
+   unsigned short       *j16;             /* 16-bit offsets, or NULL */
+   hypre_uint           *j32;             /* 32-bit offsets, or NULL */
+   HYPRE_Int             num_nonzeros;    /* nnz and j of the CSR matrix it was built from */
+   HYPRE_Int            *csr_j;
+
+} hypre_CSRMatrixShortJ;
+
+#define hypre_CSRMatrixShortJRowBase(short_j)       ((short_j) -> row_base)
+#define hypre_CSRMatrixShortJJ16(short_j)           ((short_j) -> j16)
+#define hypre_CSRMatrixShortJJ32(short_j)           ((short_j) -> j32)
+#define hypre_CSRMatrixShortJNumNonzeros(short_j)   ((short_j) -> num_nonzeros)
+#define hypre_CSRMatrixShortJCSRJ(short_j)          ((short_j) -> csr_j)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -33,13 +120,15 @@ typedef struct
    HYPRE_Int             num_rows;
    HYPRE_Int             num_cols;
    HYPRE_Int             num_nonzeros;
-   hypre_int            *i_short;
-   hypre_int            *j_short;
    HYPRE_Int             owns_data;       /* Does the CSRMatrix create/destroy `data', `i', `j'? */
    HYPRE_Complex        *data;
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   HYPRE_Int             spmv_format;     /* host SpMV storage format (see above) */
+   hypre_CSRMatrixSell  *sell;            /* SELL-C-sigma companion, built lazily */
+   hypre_CSRMatrixShortJ *short_j;        /* short column indices companion, built lazily */
+   float                *single_data;     /* single precision values used by matvecs (replace owned data) */
 #if defined(HYPRE_USING_CUSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -63,6 +152,10 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)            ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSpMVFormat(matrix)           ((matrix) -> spmv_format)
+#define hypre_CSRMatrixSell(matrix)                 ((matrix) -> sell)
+#define hypre_CSRMatrixShortJ(matrix)               ((matrix) -> short_j)
+#define hypre_CSRMatrixSingleData(matrix)           ((matrix) -> single_data)
 
 #if defined(HYPRE_USING_CUSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
@@ -73,6 +166,74 @@ typedef struct
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
 
+/*--------------------------------------------------------------------------
+ * Row kernels of the short column indices companion
+ *--------------------------------------------------------------------------*/
+
+/* returns sum_{jj = jj_begin}^{jj_end-1} A_data[jj] * x_data[A_j[jj]] for row i */
+static inline HYPRE_Complex
+hypre_CSRMatrixShortJRowDot( hypre_CSRMatrixShortJ *short_j,
+                             HYPRE_Complex         *A_data,
+                             HYPRE_Int              i,
+                             HYPRE_Int              jj_begin,
+                             HYPRE_Int              jj_end,
+                             HYPRE_Complex         *x_data )
+{
+   const HYPRE_Complex *x_row = x_data + hypre_CSRMatrixShortJRowBase(short_j)[i];
+   const unsigned short *j16  = hypre_CSRMatrixShortJJ16(short_j);
+   const hypre_uint     *j32  = hypre_CSRMatrixShortJJ32(short_j);
+   HYPRE_Complex         sum  = 0.0;
+   HYPRE_Int             jj;
+
+   if (j16)
+   {
+      for (jj = jj_begin; jj < jj_end; jj++)
+      {
+         sum += A_data[jj] * x_row[j16[jj]];
+      }
+   }
+   else
+   {
+      for (jj = jj_begin; jj < jj_end; jj++)
+      {
+         sum += A_data[jj] * x_row[j32[jj]];
+      }
+   }
+
+   return sum;
+}
+
+/* y_data[A_j[jj]] += A_data[jj] * xi for the entries of row i */
+static inline void
+hypre_CSRMatrixShortJRowAxpy( hypre_CSRMatrixShortJ *short_j,
+                              HYPRE_Complex         *A_data,
+                              HYPRE_Int              i,
+                              HYPRE_Int              jj_begin,
+                              HYPRE_Int              jj_end,
+                              HYPRE_Complex          xi,
+                              HYPRE_Complex         *y_data )
+{
+   HYPRE_Complex        *y_row = y_data + hypre_CSRMatrixShortJRowBase(short_j)[i];
+   const unsigned short *j16   = hypre_CSRMatrixShortJJ16(short_j);
+   const hypre_uint     *j32   = hypre_CSRMatrixShortJJ32(short_j);
+   HYPRE_Int             jj;
+
+   if (j16)
+   {
+      for (jj = jj_begin; jj < jj_end; jj++)
+      {
+         y_row[j16[jj]] += A_data[jj] * xi;
+      }
+   }
+   else
+   {
+      for (jj = jj_begin; jj < jj_end; jj++)
+      {
+         y_row[j32[jj]] += A_data[jj] * xi;
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -51,7 +51,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
    HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
    HYPRE_Complex     temp, tempx;
-   HYPRE_Int         i, j, jj, m, ierr=0;
+   HYPRE_Int         i, j, jj, m, isa, ierr=0;
    HYPRE_Real        xpar=0.7;
    hypre_Vector     *x_tmp = NULL;
 
@@ -109,9 +109,30 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
    temp = beta / alpha;
 
+   /* use the SELL-C-sigma companion of A when it is selected */
+
+   if (offset == 0 && num_vectors == 1 && hypre_CSRMatrixSpMVUseSell(A))
+   {
+      hypre_CSRMatrixMatvecSellHost(alpha, A, x_data, beta, b_data, y_data);
+   }
+
+   /* use the short column indices of A when they are selected and fit */
+
+   else if (num_vectors == 1 && hypre_CSRMatrixSpMVUseShortJ(A) && hypre_CSRMatrixShortJSetup(A))
+   {
+      hypre_CSRMatrixMatvecShortJHost(alpha, A, x_data, beta, b_data, y_data, offset);
+   }
+
+   /* use the explicitly vectorized kernels when the CPU supports them */
+
+   else if (num_vectors == 1 && (isa = hypre_CSRMatrixSpMVSimdISA()) != hypre_CSR_SPMV_SIMD_SCALAR)
+   {
+      hypre_CSRMatrixMatvecSimdHost(isa, alpha, A, x_data, beta, b_data, y_data, offset);
+   }
+
    /* use rownnz pointer to do the A*x multiplication  when num_rownnz is smaller than num_rows */
 
-   if (num_rownnz < xpar*(num_rows) || num_vectors > 1)
+   else if (num_rownnz < xpar*(num_rows) || num_vectors > 1)
    {
       /*-----------------------------------------------------------------------
        * y = (beta/alpha)*y
@@ -416,6 +437,11 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixSingleData(A))
+   {
+      ierr = hypre_CSRMatrixMatvecSingleHost(alpha, A, x, beta, b, y, offset);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, offset);
    }
@@ -437,6 +463,82 @@ hypre_CSRMatrixMatvec( HYPRE_Complex    alpha,
    return hypre_CSRMatrixMatvecOutOfPlace(alpha, A, x, beta, y, y, 0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecRangeSetup
+ *
+ * Prepares a host single vector matvec with A that is computed in pieces by
+ * hypre_CSRMatrixMatvecRangeHost, building the companion of the selected
+ * storage format if needed.  Returns the number of work units (SELL chunks,
+ * or rows) and the number of rows per unit.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecRangeSetup( hypre_CSRMatrix *A,
+                                 HYPRE_Int       *num_units_ptr,
+                                 HYPRE_Int       *unit_rows_ptr )
+{
+   hypre_CSRMatrixSell *sell;
+
+   if (hypre_CSRMatrixSpMVUseSell(A))
+   {
+      sell = hypre_CSRMatrixSellSetup(A);
+
+      *num_units_ptr = hypre_CSRMatrixSellNumChunks(sell);
+      *unit_rows_ptr = hypre_CSRMatrixSellChunkSize(sell);
+   }
+   else
+   {
+      if (hypre_CSRMatrixSpMVUseShortJ(A))
+      {
+         hypre_CSRMatrixShortJSetup(A);
+      }
+
+      *num_units_ptr = hypre_CSRMatrixNumRows(A);
+      *unit_rows_ptr = 1;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecRangeHost
+ *
+ * y = alpha*A*x + beta*b for the rows of work units [begin, end), with the
+ * kernel that hypre_CSRMatrixMatvec selects for A.  Runs on the calling
+ * thread, so disjoint ranges can be computed from one parallel region.  Needs
+ * hypre_CSRMatrixMatvecRangeSetup; x must not alias y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecRangeHost( HYPRE_Complex    alpha,
+                                hypre_CSRMatrix *A,
+                                HYPRE_Complex   *x_data,
+                                HYPRE_Complex    beta,
+                                HYPRE_Complex   *b_data,
+                                HYPRE_Complex   *y_data,
+                                HYPRE_Int        begin,
+                                HYPRE_Int        end )
+{
+   hypre_CSRMatrixShortJ *short_j = hypre_CSRMatrixShortJ(A);
+
+   if (hypre_CSRMatrixSpMVUseSell(A))
+   {
+      hypre_CSRMatrixMatvecSellChunks(alpha, A, x_data, beta, b_data, y_data, begin, end);
+   }
+   else if (hypre_CSRMatrixSpMVUseShortJ(A) && short_j &&
+            (hypre_CSRMatrixShortJJ16(short_j) || hypre_CSRMatrixShortJJ32(short_j)))
+   {
+      hypre_CSRMatrixMatvecShortJRows(alpha, A, x_data, beta, b_data, y_data, begin, end);
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecSimdRows(hypre_CSRMatrixSpMVSimdISA(), alpha, A, x_data,
+                                    beta, b_data, y_data, begin, end);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvecT
  *
@@ -475,7 +577,7 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
    HYPRE_Complex    *y_data_expand;
    HYPRE_Int         my_thread_num = 0, offset = 0;
 
-   HYPRE_Int         i, j, jv, jj;
+   HYPRE_Int         i, j, jv, jj, isa;
    HYPRE_Int         num_threads;
 
    HYPRE_Int         ierr  = 0;
@@ -554,7 +656,22 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
     * y += A^T*x
     *-----------------------------------------------------------------*/
    num_threads = hypre_NumThreads();
-   if (num_threads > 1)
+   if (num_vectors == 1 && hypre_CSRMatrixSpMVUseSell(A))
+   {
+      hypre_CSRMatrixMatvecTSellHost(A, x_data, y_data);
+   }
+   else if (num_vectors == 1 && hypre_CSRMatrixSpMVUseShortJ(A) && hypre_CSRMatrixShortJSetup(A))
+   {
+      hypre_CSRMatrixMatvecTShortJHost(A, x_data, y_data);
+   }
+   /* the gather/scatter transpose kernels are not faster than the scalar loop
+    * on every CPU, so they are only used when explicitly requested */
+   else if (num_vectors == 1 && hypre_HandleSpMVSimd(hypre_handle()) != hypre_CSR_SPMV_SIMD_AUTO &&
+            (isa = hypre_CSRMatrixSpMVSimdISA()) != hypre_CSR_SPMV_SIMD_SCALAR)
+   {
+      hypre_CSRMatrixMatvecTSimdHost(isa, A, x_data, y_data);
+   }
+   else if (num_threads > 1)
    {
       y_data_expand = hypre_CTAlloc(HYPRE_Complex,  num_threads*y_size, HYPRE_MEMORY_HOST);
 
@@ -686,6 +803,11 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixSingleData(A))
+   {
+      ierr = hypre_CSRMatrixMatvecTSingleHost(alpha, A, x, beta, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
@@ -0,0 +1,554 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma (sliced ELLPACK) storage and host matvec functions for
+ * hypre_CSRMatrix class.
+ *
+ * The SELL companion is built lazily from the CSR arrays on the first matvec
+ * that selects it and is kept with the CSR matrix until it is destroyed.  It
+ * holds padded copies of the column indices and values in chunk column-major
+ * order.  It is rebuilt when the row pointer array of A changes, and its
+ * copies are refilled when A gets new column index or value arrays.  Routines
+ * that change the values of A in place call
+ * hypre_CSRMatrixUpdateCompanionValues (e.g., the IJ assembly).
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellFill
+ *
+ * Copies the column indices and values of A into the padded arrays of sell
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixSellFill( hypre_CSRMatrix     *A,
+                         hypre_CSRMatrixSell *sell )
+{
+   HYPRE_Int           *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int           *A_j        = hypre_CSRMatrixJ(A);
+   HYPRE_Complex       *A_data     = hypre_CSRMatrixData(A);
+   HYPRE_Int            chunk_size = hypre_CSRMatrixSellChunkSize(sell);
+   HYPRE_Int            num_chunks = hypre_CSRMatrixSellNumChunks(sell);
+   HYPRE_Int           *chunk_len  = hypre_CSRMatrixSellChunkLen(sell);
+   HYPRE_Int           *chunk_ptr  = hypre_CSRMatrixSellChunkPtr(sell);
+   HYPRE_Int           *perm       = hypre_CSRMatrixSellPerm(sell);
+   HYPRE_Int           *col        = hypre_CSRMatrixSellCol(sell);
+   HYPRE_Complex       *val        = hypre_CSRMatrixSellVal(sell);
+   HYPRE_Int            c;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Int r, k, row, len, pad_col, pos;
+
+      for (r = 0; r < chunk_size; r++)
+      {
+         row = perm[c * chunk_size + r];
+         len = row >= 0 ? A_i[row+1] - A_i[row] : 0;
+
+         /* a padding entry adds 0*x[j] to a row that reads x[j] anyway */
+         pad_col = len > 0 ? A_j[A_i[row+1] - 1] : 0;
+
+         for (k = 0; k < chunk_len[c]; k++)
+         {
+            pos = chunk_ptr[c] + k * chunk_size + r;
+            if (k < len)
+            {
+               col[pos] = A_j[A_i[row] + k];
+               val[pos] = A_data[A_i[row] + k];
+            }
+            else
+            {
+               col[pos] = pad_col;
+               val[pos] = 0.0;
+            }
+         }
+      }
+   }
+
+   hypre_CSRMatrixSellCSRJ(sell)    = A_j;
+   hypre_CSRMatrixSellCSRData(sell) = A_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrixSell *
+hypre_CSRMatrixSellCreate( hypre_CSRMatrix *A,
+                           HYPRE_Int        chunk_size,
+                           HYPRE_Int        sigma )
+{
+   HYPRE_Int           *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int            num_rows = hypre_CSRMatrixNumRows(A);
+
+   hypre_CSRMatrixSell *sell;
+   HYPRE_Int            num_chunks, num_slots;
+   HYPRE_Int           *chunk_len, *chunk_ptr, *perm, *row_key;
+   HYPRE_Int            i, c, start, end;
+
+   if (chunk_size < 1)
+   {
+      chunk_size = 1;
+   }
+   if (chunk_size > hypre_CSR_SELL_MAX_CHUNK_SIZE)
+   {
+      chunk_size = hypre_CSR_SELL_MAX_CHUNK_SIZE;
+   }
+
+   /* the sorting window must cover whole chunks */
+   sigma = hypre_max(sigma, chunk_size);
+   sigma = ((sigma + chunk_size - 1) / chunk_size) * chunk_size;
+
+   num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+   num_slots  = num_chunks * chunk_size;
+
+   chunk_len = hypre_CTAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   perm      = hypre_TAlloc(HYPRE_Int,  num_slots,  HYPRE_MEMORY_HOST);
+   row_key   = hypre_TAlloc(HYPRE_Int,  num_rows,   HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Sort the rows by decreasing length within each window of sigma rows
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_slots; i++)
+   {
+      if (i < num_rows)
+      {
+         perm[i]    = i;
+         row_key[i] = A_i[i] - A_i[i+1];
+      }
+      else
+      {
+         perm[i] = -1;
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(start, end) HYPRE_SMP_SCHEDULE
+#endif
+   for (start = 0; start < num_rows; start += sigma)
+   {
+      end = hypre_min(start + sigma, num_rows);
+      hypre_qsort2i(row_key, perm, start, end - 1);
+   }
+
+   hypre_TFree(row_key, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Chunk widths
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c, i) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Int width = 0;
+      for (i = c * chunk_size; i < (c + 1) * chunk_size; i++)
+      {
+         if (perm[i] >= 0)
+         {
+            width = hypre_max(width, A_i[perm[i]+1] - A_i[perm[i]]);
+         }
+      }
+      chunk_len[c] = width;
+   }
+
+   chunk_ptr = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_ptr[0] = 0;
+   for (c = 0; c < num_chunks; c++)
+   {
+      chunk_ptr[c+1] = chunk_ptr[c] + chunk_len[c] * chunk_size;
+   }
+
+   sell = hypre_CTAlloc(hypre_CSRMatrixSell, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CSRMatrixSellChunkSize(sell)   = chunk_size;
+   hypre_CSRMatrixSellSigma(sell)       = sigma;
+   hypre_CSRMatrixSellNumChunks(sell)   = num_chunks;
+   hypre_CSRMatrixSellChunkLen(sell)    = chunk_len;
+   hypre_CSRMatrixSellChunkPtr(sell)    = chunk_ptr;
+   hypre_CSRMatrixSellPerm(sell)        = perm;
+   hypre_CSRMatrixSellCol(sell)         = hypre_TAlloc(HYPRE_Int, chunk_ptr[num_chunks],
+                                                       HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixSellVal(sell)         = hypre_TAlloc(HYPRE_Complex, chunk_ptr[num_chunks],
+                                                       HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixSellNumRows(sell)     = num_rows;
+   hypre_CSRMatrixSellNumNonzeros(sell) = A_i[num_rows];
+   hypre_CSRMatrixSellCSRI(sell)        = A_i;
+
+   hypre_CSRMatrixSellFill(A, sell);
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDestroy
+ *
+ * Drops the SELL companion of A (if any); it is rebuilt on the next SELL
+ * matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDestroy( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixSell *sell = hypre_CSRMatrixSell(A);
+
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRMatrixSellChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSellChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSellPerm(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSellCol(sell),      HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSellVal(sell),      HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+
+      hypre_CSRMatrixSell(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellRefresh
+ *
+ * Copies the current column indices and values of A into its SELL companion
+ * (if any).  The companion is dropped instead if A has a new row pointer
+ * array or size.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellRefresh( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixSell *sell     = hypre_CSRMatrixSell(A);
+   HYPRE_Int            num_rows = hypre_CSRMatrixNumRows(A);
+
+   if (!sell)
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_CSRMatrixSellCSRI(sell)        != hypre_CSRMatrixI(A) ||
+       hypre_CSRMatrixSellNumRows(sell)     != num_rows            ||
+       hypre_CSRMatrixSellNumNonzeros(sell) != hypre_CSRMatrixI(A)[num_rows])
+   {
+      hypre_CSRMatrixSellDestroy(A);
+   }
+   else if (hypre_CSRMatrixData(A))
+   {
+      hypre_CSRMatrixSellFill(A, sell);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetSpMVFormat
+ *
+ * Selects the host SpMV storage format of A:
+ *   hypre_CSR_SPMV_FORMAT_DEFAULT (-1): follow the global setting
+ *   hypre_CSR_SPMV_FORMAT_CSR     ( 0): CSR
+ *   hypre_CSR_SPMV_FORMAT_SELL    ( 1): SELL-C-sigma
+ *   hypre_CSR_SPMV_FORMAT_SHORTJ  ( 2): CSR with short column indices
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetSpMVFormat( hypre_CSRMatrix *A,
+                              HYPRE_Int        format )
+{
+   if (format < hypre_CSR_SPMV_FORMAT_DEFAULT || format > hypre_CSR_SPMV_FORMAT_SHORTJ)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSpMVFormat(A) = format;
+
+   if (format != hypre_CSR_SPMV_FORMAT_SELL && format != hypre_CSR_SPMV_FORMAT_DEFAULT)
+   {
+      hypre_CSRMatrixSellDestroy(A);
+   }
+   if (format != hypre_CSR_SPMV_FORMAT_SHORTJ && format != hypre_CSR_SPMV_FORMAT_DEFAULT)
+   {
+      hypre_CSRMatrixShortJDestroy(A);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMVUseSell
+ *
+ * Returns 1 if host matvecs with A should go through its SELL companion
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSpMVUseSell( hypre_CSRMatrix *A )
+{
+   HYPRE_Int format = hypre_CSRMatrixSpMVFormat(A);
+
+   if (format == hypre_CSR_SPMV_FORMAT_DEFAULT)
+   {
+      format = hypre_HandleSpMVFormat(hypre_handle());
+   }
+
+   if (format != hypre_CSR_SPMV_FORMAT_SELL ||
+       hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+       hypre_CSRMatrixNumRows(A) <= 0 || !hypre_CSRMatrixI(A) || !hypre_CSRMatrixData(A))
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellSetup
+ *
+ * Returns the SELL companion of A, (re)building it if it is missing or was
+ * built from a different CSR row pointer array, and refilling it if A has
+ * new column index or value arrays.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrixSell *
+hypre_CSRMatrixSellSetup( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixSell *sell     = hypre_CSRMatrixSell(A);
+   HYPRE_Int            num_rows = hypre_CSRMatrixNumRows(A);
+
+   if ( sell && ( hypre_CSRMatrixSellCSRI(sell)        != hypre_CSRMatrixI(A) ||
+                  hypre_CSRMatrixSellNumRows(sell)     != num_rows            ||
+                  hypre_CSRMatrixSellNumNonzeros(sell) != hypre_CSRMatrixI(A)[num_rows] ) )
+   {
+      hypre_CSRMatrixSellDestroy(A);
+      sell = NULL;
+   }
+
+   if (!sell)
+   {
+      sell = hypre_CSRMatrixSellCreate(A,
+                                       hypre_HandleSpMVSellChunkSize(hypre_handle()),
+                                       hypre_HandleSpMVSellSigma(hypre_handle()));
+      hypre_CSRMatrixSell(A) = sell;
+   }
+   else if (hypre_CSRMatrixSellCSRJ(sell)    != hypre_CSRMatrixJ(A) ||
+            hypre_CSRMatrixSellCSRData(sell) != hypre_CSRMatrixData(A))
+   {
+      hypre_CSRMatrixSellFill(A, sell);
+   }
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellChunks
+ *
+ * y = alpha*A*x + beta*b for the rows of SELL chunks [chunk_begin, chunk_end),
+ * single vectors, x must not alias y.  Runs on the calling thread; the SELL
+ * companion must have been set up with hypre_CSRMatrixSellSetup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellChunks( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 HYPRE_Complex   *x_data,
+                                 HYPRE_Complex    beta,
+                                 HYPRE_Complex   *b_data,
+                                 HYPRE_Complex   *y_data,
+                                 HYPRE_Int        chunk_begin,
+                                 HYPRE_Int        chunk_end )
+{
+   hypre_CSRMatrixSell *sell = hypre_CSRMatrixSell(A);
+
+   HYPRE_Int            chunk_size = hypre_CSRMatrixSellChunkSize(sell);
+   HYPRE_Int           *chunk_len  = hypre_CSRMatrixSellChunkLen(sell);
+   HYPRE_Int           *chunk_ptr  = hypre_CSRMatrixSellChunkPtr(sell);
+   HYPRE_Int           *perm       = hypre_CSRMatrixSellPerm(sell);
+   HYPRE_Int           *col        = hypre_CSRMatrixSellCol(sell);
+   HYPRE_Complex       *val        = hypre_CSRMatrixSellVal(sell);
+   HYPRE_Int            c;
+
+   for (c = chunk_begin; c < chunk_end; c++)
+   {
+      HYPRE_Complex  tmp[hypre_CSR_SELL_MAX_CHUNK_SIZE];
+      HYPRE_Int     *c_perm = perm + c * chunk_size;
+      HYPRE_Int      width  = chunk_len[c];
+      HYPRE_Int     *c_col  = col + chunk_ptr[c];
+      HYPRE_Complex *c_val  = val + chunk_ptr[c];
+      HYPRE_Int      r, k, row;
+
+      for (r = 0; r < chunk_size; r++)
+      {
+         tmp[r] = 0.0;
+      }
+
+      /* one column of the chunk at a time, unit stride over its rows */
+      for (k = 0; k < width; k++)
+      {
+         for (r = 0; r < chunk_size; r++)
+         {
+            tmp[r] += c_val[r] * x_data[c_col[r]];
+         }
+         c_col += chunk_size;
+         c_val += chunk_size;
+      }
+
+      if (beta == 0.0)
+      {
+         for (r = 0; r < chunk_size; r++)
+         {
+            row = c_perm[r];
+            if (row >= 0)
+            {
+               y_data[row] = alpha * tmp[r];
+            }
+         }
+      }
+      else
+      {
+         for (r = 0; r < chunk_size; r++)
+         {
+            row = c_perm[r];
+            if (row >= 0)
+            {
+               y_data[row] = alpha * tmp[r] + beta * b_data[row];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellHost
+ *
+ * y = alpha*A*x + beta*b, single vectors, x must not alias y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               HYPRE_Complex   *x_data,
+                               HYPRE_Complex    beta,
+                               HYPRE_Complex   *b_data,
+                               HYPRE_Complex   *y_data )
+{
+   hypre_CSRMatrixSell *sell       = hypre_CSRMatrixSellSetup(A);
+   HYPRE_Int            num_chunks = hypre_CSRMatrixSellNumChunks(sell);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_Int chunk_begin, chunk_end;
+
+      hypre_partition1D(num_chunks, hypre_NumActiveThreads(), hypre_GetThreadNum(),
+                        &chunk_begin, &chunk_end);
+
+      hypre_CSRMatrixMatvecSellChunks(alpha, A, x_data, beta, b_data, y_data,
+                                      chunk_begin, chunk_end);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSellHost
+ *
+ * y += A^T*x, single vectors, x must not alias y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSellHost( hypre_CSRMatrix *A,
+                                HYPRE_Complex   *x_data,
+                                HYPRE_Complex   *y_data )
+{
+   hypre_CSRMatrixSell *sell = hypre_CSRMatrixSellSetup(A);
+
+   HYPRE_Int            y_size     = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int            chunk_size = hypre_CSRMatrixSellChunkSize(sell);
+   HYPRE_Int            num_chunks = hypre_CSRMatrixSellNumChunks(sell);
+   HYPRE_Int           *chunk_len  = hypre_CSRMatrixSellChunkLen(sell);
+   HYPRE_Int           *chunk_ptr  = hypre_CSRMatrixSellChunkPtr(sell);
+   HYPRE_Int           *perm       = hypre_CSRMatrixSellPerm(sell);
+   HYPRE_Int           *col        = hypre_CSRMatrixSellCol(sell);
+   HYPRE_Complex       *val        = hypre_CSRMatrixSellVal(sell);
+   HYPRE_Int            num_threads = hypre_NumThreads();
+   HYPRE_Complex       *y_data_expand = NULL;
+   HYPRE_Int            i, j;
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j)
+#endif
+   {
+      HYPRE_Complex *y_thread = num_threads > 1 ?
+                                y_data_expand + y_size * hypre_GetThreadNum() : y_data;
+      HYPRE_Complex  xr[hypre_CSR_SELL_MAX_CHUNK_SIZE];
+      HYPRE_Int      c, r, k, row;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (c = 0; c < num_chunks; c++)
+      {
+         HYPRE_Int      width = chunk_len[c];
+         HYPRE_Int     *c_col = col + chunk_ptr[c];
+         HYPRE_Complex *c_val = val + chunk_ptr[c];
+
+         for (r = 0; r < chunk_size; r++)
+         {
+            row   = perm[c * chunk_size + r];
+            xr[r] = row >= 0 ? x_data[row] : 0.0;
+         }
+
+         for (k = 0; k < width; k++)
+         {
+            for (r = 0; r < chunk_size; r++)
+            {
+               y_thread[c_col[r]] += c_val[r] * xr[r];
+            }
+            c_col += chunk_size;
+            c_val += chunk_size;
+         }
+      }
+
+      if (num_threads > 1)
+      {
+         /* implied barrier (for threads)*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_data_expand[j * y_size + i];
+            }
+         }
+      }
+   } /* end parallel threaded region */
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
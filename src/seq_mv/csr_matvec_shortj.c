@@ -0,0 +1,327 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Short column indices storage and host matvec functions for hypre_CSRMatrix
+ * class.
+ *
+ * The companion stores the column indices of each row as 16-bit (or 32-bit)
+ * offsets from the smallest column index of the row, so that the kernels that
+ * use it read 2 (or 4) bytes per nonzero for the index instead of
+ * sizeof(HYPRE_Int).  It is built lazily from the CSR arrays by the first
+ * kernel that selects it and is kept with the CSR matrix until it is
+ * destroyed.  The values are read from the CSR matrix, so they can be
+ * changed in place; routines that change the column indices in place call
+ * hypre_CSRMatrixUpdateCompanions on A, which rebuilds the companion.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixShortJCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrixShortJ *
+hypre_CSRMatrixShortJCreate( hypre_CSRMatrix *A )
+{
+   HYPRE_Int             *A_i          = hypre_CSRMatrixI(A);
+   HYPRE_Int             *A_j          = hypre_CSRMatrixJ(A);
+   HYPRE_Int              num_rows     = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int              num_nonzeros = A_i[num_rows];
+   HYPRE_Int             *row_base;
+   unsigned short        *j16 = NULL;
+   hypre_uint            *j32 = NULL;
+   HYPRE_Int              max_span = 0;
+   HYPRE_Int              i, jj;
+   hypre_CSRMatrixShortJ *short_j;
+
+   row_base = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, jj) reduction(max:max_span) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int jmin, jmax;
+
+      if (A_i[i] == A_i[i+1])
+      {
+         continue;
+      }
+
+      jmin = jmax = A_j[A_i[i]];
+      for (jj = A_i[i] + 1; jj < A_i[i+1]; jj++)
+      {
+         jmin = hypre_min(jmin, A_j[jj]);
+         jmax = hypre_max(jmax, A_j[jj]);
+      }
+      row_base[i] = jmin;
+      max_span    = hypre_max(max_span, jmax - jmin);
+   }
+
+   /* fall back to the CSR indices when the offsets are not shorter */
+   if (max_span <= 0xFFFF)
+   {
+      j16 = hypre_TAlloc(unsigned short, num_nonzeros, HYPRE_MEMORY_HOST);
+   }
+   else if (sizeof(HYPRE_Int) > sizeof(hypre_uint) && (unsigned long long) max_span <= 0xFFFFFFFFULL)
+   {
+      j32 = hypre_TAlloc(hypre_uint, num_nonzeros, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      hypre_TFree(row_base, HYPRE_MEMORY_HOST);
+   }
+
+   if (j16 || j32)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, jj) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            if (j16)
+            {
+               j16[jj] = (unsigned short) (A_j[jj] - row_base[i]);
+            }
+            else
+            {
+               j32[jj] = (hypre_uint) (A_j[jj] - row_base[i]);
+            }
+         }
+      }
+   }
+
+   short_j = hypre_CTAlloc(hypre_CSRMatrixShortJ, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CSRMatrixShortJRowBase(short_j)     = row_base;
+   hypre_CSRMatrixShortJJ16(short_j)         = j16;
+   hypre_CSRMatrixShortJJ32(short_j)         = j32;
+   hypre_CSRMatrixShortJNumNonzeros(short_j) = num_nonzeros;
+   hypre_CSRMatrixShortJCSRJ(short_j)        = A_j;
+
+   return short_j;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixShortJDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixShortJDestroy( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixShortJ *short_j = hypre_CSRMatrixShortJ(A);
+
+   if (short_j)
+   {
+      hypre_TFree(hypre_CSRMatrixShortJRowBase(short_j), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixShortJJ16(short_j),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixShortJJ32(short_j),     HYPRE_MEMORY_HOST);
+      hypre_TFree(short_j, HYPRE_MEMORY_HOST);
+
+      hypre_CSRMatrixShortJ(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMVUseShortJ
+ *
+ * Returns 1 if host kernels with A should go through its short column
+ * indices companion
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSpMVUseShortJ( hypre_CSRMatrix *A )
+{
+   HYPRE_Int format = hypre_CSRMatrixSpMVFormat(A);
+
+   if (format == hypre_CSR_SPMV_FORMAT_DEFAULT)
+   {
+      format = hypre_HandleSpMVFormat(hypre_handle());
+   }
+
+   if (format != hypre_CSR_SPMV_FORMAT_SHORTJ ||
+       hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+       hypre_CSRMatrixNumRows(A) <= 0 || !hypre_CSRMatrixI(A) || !hypre_CSRMatrixJ(A))
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixShortJSetup
+ *
+ * Returns the short column indices companion of A, (re)building it if it is
+ * missing or was built from a different CSR j array.  Returns NULL if the
+ * column offsets of A do not fit in the short formats.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrixShortJ *
+hypre_CSRMatrixShortJSetup( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixShortJ *short_j  = hypre_CSRMatrixShortJ(A);
+   HYPRE_Int              num_rows = hypre_CSRMatrixNumRows(A);
+
+   if ( short_j && ( hypre_CSRMatrixShortJCSRJ(short_j)        != hypre_CSRMatrixJ(A) ||
+                     hypre_CSRMatrixShortJNumNonzeros(short_j) != hypre_CSRMatrixI(A)[num_rows] ) )
+   {
+      hypre_CSRMatrixShortJDestroy(A);
+      short_j = NULL;
+   }
+
+   if (!short_j)
+   {
+      short_j = hypre_CSRMatrixShortJCreate(A);
+      hypre_CSRMatrixShortJ(A) = short_j;
+   }
+
+   if (!hypre_CSRMatrixShortJJ16(short_j) && !hypre_CSRMatrixShortJJ32(short_j))
+   {
+      return NULL;
+   }
+
+   return short_j;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecShortJHost
+ *
+ * y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end] for single
+ * vectors, x must not alias y.  b_data and y_data are already shifted by
+ * offset.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecShortJHost( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 HYPRE_Complex   *x_data,
+                                 HYPRE_Complex    beta,
+                                 HYPRE_Complex   *b_data,
+                                 HYPRE_Complex   *y_data,
+                                 HYPRE_Int        offset )
+{
+   hypre_CSRMatrixShortJ *short_j  = hypre_CSRMatrixShortJSetup(A);
+   HYPRE_Complex         *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int             *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int              num_rows = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int              i;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int     row  = i + offset;
+      HYPRE_Complex temp = hypre_CSRMatrixShortJRowDot(short_j, A_data, row, A_i[row], A_i[row+1], x_data);
+
+      y_data[i] = (beta == 0.0) ? alpha * temp : alpha * temp + beta * b_data[i];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecShortJRows
+ *
+ * y = alpha*A*x + beta*b for the rows [row_begin, row_end), single vectors,
+ * x must not alias y.  Runs on the calling thread; hypre_CSRMatrixShortJSetup
+ * must have returned the companion of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecShortJRows( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 HYPRE_Complex   *x_data,
+                                 HYPRE_Complex    beta,
+                                 HYPRE_Complex   *b_data,
+                                 HYPRE_Complex   *y_data,
+                                 HYPRE_Int        row_begin,
+                                 HYPRE_Int        row_end )
+{
+   hypre_CSRMatrixShortJ *short_j = hypre_CSRMatrixShortJ(A);
+   HYPRE_Complex         *A_data  = hypre_CSRMatrixData(A);
+   HYPRE_Int             *A_i     = hypre_CSRMatrixI(A);
+   HYPRE_Int              i;
+
+   for (i = row_begin; i < row_end; i++)
+   {
+      HYPRE_Complex temp = hypre_CSRMatrixShortJRowDot(short_j, A_data, i, A_i[i], A_i[i+1], x_data);
+
+      y_data[i] = (beta == 0.0) ? alpha * temp : alpha * temp + beta * b_data[i];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTShortJHost
+ *
+ * y += A^T*x, single vectors, x must not alias y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTShortJHost( hypre_CSRMatrix *A,
+                                  HYPRE_Complex   *x_data,
+                                  HYPRE_Complex   *y_data )
+{
+   hypre_CSRMatrixShortJ *short_j       = hypre_CSRMatrixShortJSetup(A);
+   HYPRE_Complex         *A_data        = hypre_CSRMatrixData(A);
+   HYPRE_Int             *A_i           = hypre_CSRMatrixI(A);
+   HYPRE_Int              num_rows      = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int              y_size        = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int              num_threads   = hypre_NumThreads();
+   HYPRE_Complex         *y_data_expand = NULL;
+   HYPRE_Int              i, j;
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j)
+#endif
+   {
+      HYPRE_Complex *y_thread = num_threads > 1 ?
+                                y_data_expand + y_size * hypre_GetThreadNum() : y_data;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         hypre_CSRMatrixShortJRowAxpy(short_j, A_data, i, A_i[i], A_i[i+1], x_data[i], y_thread);
+      }
+
+      if (num_threads > 1)
+      {
+         /* implied barrier (for threads)*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_data_expand[j * y_size + i];
+            }
+         }
+      }
+   } /* end parallel threaded region */
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
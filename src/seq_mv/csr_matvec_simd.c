@@ -0,0 +1,577 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Explicitly vectorized (AVX2 and AVX-512) host matvec functions for
+ * hypre_CSRMatrix class.
+ *
+ * The kernels are compiled with function-level target attributes, so no
+ * special compiler flags are needed, and the instruction set is selected at
+ * run time from the CPU features (see hypre_CSRMatrixSpMVSimdISA).  They are
+ * only available for double precision values with 32-bit local indices on
+ * x86-64 with GCC-compatible compilers; otherwise the scalar code is used.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__CUDACC__) && \
+    !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && !defined(HYPRE_LONG_DOUBLE) && \
+    !defined(HYPRE_BIGINT)
+#define HYPRE_SPMV_SIMD_X86
+#include <immintrin.h>
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMVSimdISA
+ *
+ * Returns the instruction set used by the host matvec: the one requested with
+ * HYPRE_CSRMatrixSetSpMVSimd, capped by what the CPU supports.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSpMVSimdISA( void )
+{
+   static HYPRE_Int detected = -1;
+   HYPRE_Int        requested = hypre_HandleSpMVSimd(hypre_handle());
+
+   if (detected < 0)
+   {
+      detected = hypre_CSR_SPMV_SIMD_SCALAR;
+#if defined(HYPRE_SPMV_SIMD_X86)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd"))
+      {
+         detected = hypre_CSR_SPMV_SIMD_AVX512;
+      }
+      else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      {
+         detected = hypre_CSR_SPMV_SIMD_AVX2;
+      }
+#endif
+   }
+
+   if (requested == hypre_CSR_SPMV_SIMD_AUTO)
+   {
+      return detected;
+   }
+
+   return hypre_min(requested, detected);
+}
+
+#if defined(HYPRE_SPMV_SIMD_X86)
+
+/*--------------------------------------------------------------------------
+ * AVX2 kernels
+ *--------------------------------------------------------------------------*/
+
+static const hypre_int hypre_spmv_avx2_tail_mask[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+
+/* sum_k a[k]*x[j[k]], k < len */
+static inline __attribute__((always_inline, target("avx2,fma"))) HYPRE_Complex
+hypre_SpMVRowDotAVX2( const HYPRE_Complex *a,
+                      const HYPRE_Int     *j,
+                      HYPRE_Int            len,
+                      const HYPRE_Complex *x )
+{
+   __m256d   acc = _mm256_setzero_pd();
+   __m128d   lo, hi;
+   HYPRE_Int k;
+
+   for (k = 0; k + 4 <= len; k += 4)
+   {
+      __m128i idx = _mm_loadu_si128((const __m128i *) (j + k));
+      __m256d xv  = _mm256_i32gather_pd(x, idx, 8);
+      acc = _mm256_fmadd_pd(_mm256_loadu_pd(a + k), xv, acc);
+   }
+
+   if (k < len)
+   {
+      /* masked loads, so that we never read past the end of the row */
+      __m128i mask32 = _mm_loadu_si128((const __m128i *) (hypre_spmv_avx2_tail_mask + 4 - (len - k)));
+      __m256i mask64 = _mm256_cvtepi32_epi64(mask32);
+      __m128i idx    = _mm_maskload_epi32((const int *) (j + k), mask32);
+      __m256d av     = _mm256_maskload_pd(a + k, mask64);
+      __m256d xv     = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, idx,
+                                                _mm256_castsi256_pd(mask64), 8);
+      acc = _mm256_fmadd_pd(av, xv, acc);
+   }
+
+   lo = _mm256_castpd256_pd128(acc);
+   hi = _mm256_extractf128_pd(acc, 1);
+   lo = _mm_add_pd(lo, hi);
+   lo = _mm_add_sd(lo, _mm_unpackhi_pd(lo, lo));
+
+   return _mm_cvtsd_f64(lo);
+}
+
+/* the constant row lengths let the compiler unroll the 7-, 19- and 27-point cases */
+static inline __attribute__((always_inline, target("avx2,fma"))) HYPRE_Complex
+hypre_SpMVRowAVX2( const HYPRE_Complex *a,
+                   const HYPRE_Int     *j,
+                   HYPRE_Int            len,
+                   const HYPRE_Complex *x )
+{
+   switch (len)
+   {
+      case 7:
+         return hypre_SpMVRowDotAVX2(a, j, 7, x);
+      case 19:
+         return hypre_SpMVRowDotAVX2(a, j, 19, x);
+      case 27:
+         return hypre_SpMVRowDotAVX2(a, j, 27, x);
+      default:
+         return hypre_SpMVRowDotAVX2(a, j, len, x);
+   }
+}
+
+static __attribute__((target("avx2,fma"))) void
+hypre_SpMVRowsAVX2( HYPRE_Complex  alpha,
+                    HYPRE_Int     *A_i,
+                    HYPRE_Int     *A_j,
+                    HYPRE_Complex *A_data,
+                    HYPRE_Int     *rows,
+                    HYPRE_Int      row_begin,
+                    HYPRE_Int      row_end,
+                    HYPRE_Complex *x_data,
+                    HYPRE_Complex  beta,
+                    HYPRE_Complex *b_data,
+                    HYPRE_Complex *y_data )
+{
+   HYPRE_Int     i, m;
+   HYPRE_Complex sum;
+
+   for (i = row_begin; i < row_end; i++)
+   {
+      m   = rows ? rows[i] : i;
+      sum = hypre_SpMVRowAVX2(A_data + A_i[m], A_j + A_i[m], A_i[m+1] - A_i[m], x_data);
+      y_data[m] = beta == 0.0 ? alpha * sum : alpha * sum + beta * b_data[m];
+   }
+}
+
+/* y[j[k]] += a[k]*xi; lanes with repeated column indices are done in order */
+static __attribute__((target("avx2,fma"))) void
+hypre_SpMVTRowsAVX2( HYPRE_Int     *A_i,
+                     HYPRE_Int     *A_j,
+                     HYPRE_Complex *A_data,
+                     HYPRE_Int      row_begin,
+                     HYPRE_Int      row_end,
+                     HYPRE_Complex *x_data,
+                     HYPRE_Complex *y_data )
+{
+   HYPRE_Int      i, jj, k, row_end_jj;
+   HYPRE_Int     *j;
+   HYPRE_Complex  yv[4];
+
+   for (i = row_begin; i < row_end; i++)
+   {
+      __m256d xi = _mm256_set1_pd(x_data[i]);
+
+      row_end_jj = A_i[i+1];
+      for (jj = A_i[i]; jj + 4 <= row_end_jj; jj += 4)
+      {
+         j = A_j + jj;
+         if (j[0] == j[1] || j[0] == j[2] || j[0] == j[3] ||
+             j[1] == j[2] || j[1] == j[3] || j[2] == j[3])
+         {
+            for (k = 0; k < 4; k++)
+            {
+               y_data[j[k]] += A_data[jj + k] * x_data[i];
+            }
+         }
+         else
+         {
+            __m128i idx = _mm_loadu_si128((const __m128i *) j);
+            __m256d y4  = _mm256_i32gather_pd(y_data, idx, 8);
+            y4 = _mm256_fmadd_pd(_mm256_loadu_pd(A_data + jj), xi, y4);
+            _mm256_storeu_pd(yv, y4);
+            for (k = 0; k < 4; k++)
+            {
+               y_data[j[k]] = yv[k];
+            }
+         }
+      }
+      for (; jj < row_end_jj; jj++)
+      {
+         y_data[A_j[jj]] += A_data[jj] * x_data[i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * AVX-512 kernels
+ *--------------------------------------------------------------------------*/
+
+static inline __attribute__((always_inline, target("avx512f"))) HYPRE_Complex
+hypre_SpMVRowDotAVX512( const HYPRE_Complex *a,
+                        const HYPRE_Int     *j,
+                        HYPRE_Int            len,
+                        const HYPRE_Complex *x )
+{
+   __m512d   acc = _mm512_setzero_pd();
+   HYPRE_Int k;
+
+   for (k = 0; k + 8 <= len; k += 8)
+   {
+      __m256i idx = _mm256_loadu_si256((const __m256i *) (j + k));
+      __m512d xv  = _mm512_i32gather_pd(idx, x, 8);
+      acc = _mm512_fmadd_pd(_mm512_loadu_pd(a + k), xv, acc);
+   }
+
+   if (k < len)
+   {
+      __mmask8 m   = (__mmask8) ((1u << (len - k)) - 1);
+      __m256i  idx = _mm512_castsi512_si256(_mm512_maskz_loadu_epi32((__mmask16) m, j + k));
+      __m512d  xv  = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), m, idx, x, 8);
+      acc = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, a + k), xv, acc);
+   }
+
+   return _mm512_reduce_add_pd(acc);
+}
+
+static inline __attribute__((always_inline, target("avx512f"))) HYPRE_Complex
+hypre_SpMVRowAVX512( const HYPRE_Complex *a,
+                     const HYPRE_Int     *j,
+                     HYPRE_Int            len,
+                     const HYPRE_Complex *x )
+{
+   switch (len)
+   {
+      case 7:
+         return hypre_SpMVRowDotAVX512(a, j, 7, x);
+      case 19:
+         return hypre_SpMVRowDotAVX512(a, j, 19, x);
+      case 27:
+         return hypre_SpMVRowDotAVX512(a, j, 27, x);
+      default:
+         return hypre_SpMVRowDotAVX512(a, j, len, x);
+   }
+}
+
+static __attribute__((target("avx512f"))) void
+hypre_SpMVRowsAVX512( HYPRE_Complex  alpha,
+                      HYPRE_Int     *A_i,
+                      HYPRE_Int     *A_j,
+                      HYPRE_Complex *A_data,
+                      HYPRE_Int     *rows,
+                      HYPRE_Int      row_begin,
+                      HYPRE_Int      row_end,
+                      HYPRE_Complex *x_data,
+                      HYPRE_Complex  beta,
+                      HYPRE_Complex *b_data,
+                      HYPRE_Complex *y_data )
+{
+   HYPRE_Int     i, m;
+   HYPRE_Complex sum;
+
+   for (i = row_begin; i < row_end; i++)
+   {
+      m   = rows ? rows[i] : i;
+      sum = hypre_SpMVRowAVX512(A_data + A_i[m], A_j + A_i[m], A_i[m+1] - A_i[m], x_data);
+      y_data[m] = beta == 0.0 ? alpha * sum : alpha * sum + beta * b_data[m];
+   }
+}
+
+/* y[j[k]] += a[k]*xi with gather/scatter; blocks with repeated column indices
+ * (detected with AVX512CD) are done in scalar */
+static __attribute__((target("avx512f,avx512cd"))) void
+hypre_SpMVTRowsAVX512( HYPRE_Int     *A_i,
+                       HYPRE_Int     *A_j,
+                       HYPRE_Complex *A_data,
+                       HYPRE_Int      row_begin,
+                       HYPRE_Int      row_end,
+                       HYPRE_Complex *x_data,
+                       HYPRE_Complex *y_data )
+{
+   HYPRE_Int i, jj, k, n, row_end_jj;
+
+   for (i = row_begin; i < row_end; i++)
+   {
+      __m512d xi = _mm512_set1_pd(x_data[i]);
+
+      row_end_jj = A_i[i+1];
+      for (jj = A_i[i]; jj < row_end_jj; jj += 8)
+      {
+         n = hypre_min(8, row_end_jj - jj);
+         {
+            __mmask8  m      = (__mmask8) ((1u << n) - 1);
+            __m512i   idx512 = _mm512_maskz_loadu_epi32((__mmask16) m, A_j + jj);
+            __m512i   conf   = _mm512_conflict_epi32(idx512);
+
+            if (_mm512_mask_test_epi32_mask((__mmask16) m, conf, conf))
+            {
+               for (k = 0; k < n; k++)
+               {
+                  y_data[A_j[jj + k]] += A_data[jj + k] * x_data[i];
+               }
+            }
+            else
+            {
+               __m256i idx = _mm512_castsi512_si256(idx512);
+               __m512d y8  = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), m, idx, y_data, 8);
+               y8 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, A_data + jj), xi, y8);
+               _mm512_mask_i32scatter_pd(y_data, m, idx, y8, 8);
+            }
+         }
+      }
+   }
+}
+
+#endif /* HYPRE_SPMV_SIMD_X86 */
+
+/*--------------------------------------------------------------------------
+ * Scalar kernels
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SpMVRowsScalar( HYPRE_Complex  alpha,
+                      HYPRE_Int     *A_i,
+                      HYPRE_Int     *A_j,
+                      HYPRE_Complex *A_data,
+                      HYPRE_Int     *rows,
+                      HYPRE_Int      row_begin,
+                      HYPRE_Int      row_end,
+                      HYPRE_Complex *x_data,
+                      HYPRE_Complex  beta,
+                      HYPRE_Complex *b_data,
+                      HYPRE_Complex *y_data )
+{
+   HYPRE_Int     i, jj, m;
+   HYPRE_Complex sum;
+
+   for (i = row_begin; i < row_end; i++)
+   {
+      m   = rows ? rows[i] : i;
+      sum = 0.0;
+      for (jj = A_i[m]; jj < A_i[m+1]; jj++)
+      {
+         sum += A_data[jj] * x_data[A_j[jj]];
+      }
+      y_data[m] = beta == 0.0 ? alpha * sum : alpha * sum + beta * b_data[m];
+   }
+}
+
+static void
+hypre_SpMVTRowsScalar( HYPRE_Int     *A_i,
+                       HYPRE_Int     *A_j,
+                       HYPRE_Complex *A_data,
+                       HYPRE_Int      row_begin,
+                       HYPRE_Int      row_end,
+                       HYPRE_Complex *x_data,
+                       HYPRE_Complex *y_data )
+{
+   HYPRE_Int i, jj;
+
+   for (i = row_begin; i < row_end; i++)
+   {
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+      {
+         y_data[A_j[jj]] += A_data[jj] * x_data[i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSimdHost
+ *
+ * y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end] for single
+ * vectors, with the given instruction set.  x_data must not alias y_data;
+ * b_data and y_data are already shifted by offset.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSimdHost( HYPRE_Int        isa,
+                               HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               HYPRE_Complex   *x_data,
+                               HYPRE_Complex    beta,
+                               HYPRE_Complex   *b_data,
+                               HYPRE_Complex   *y_data,
+                               HYPRE_Int        offset )
+{
+   HYPRE_Complex *A_data     = hypre_CSRMatrixData(A);
+   HYPRE_Int     *A_i        = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int     *A_j        = hypre_CSRMatrixJ(A);
+   HYPRE_Int      num_rows   = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int     *A_rownnz   = hypre_CSRMatrixRownnz(A);
+   HYPRE_Int      num_rownnz = hypre_CSRMatrixNumRownnz(A);
+   HYPRE_Int     *rows       = NULL;
+   HYPRE_Int      num_loop   = num_rows;
+   HYPRE_Int      i;
+
+   /* only visit the nonzero rows when there are few of them */
+   if (offset == 0 && A_rownnz && num_rownnz < 0.7 * num_rows)
+   {
+      rows     = A_rownnz;
+      num_loop = num_rownnz;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         y_data[i] = beta == 0.0 ? 0.0 : beta * b_data[i];
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_Int num_threads = hypre_NumActiveThreads();
+      HYPRE_Int my_thread   = hypre_GetThreadNum();
+      HYPRE_Int row_begin, row_end;
+
+      if (!rows && offset == 0)
+      {
+         row_begin = hypre_CSRMatrixGetLoadBalancedPartitionBegin(A);
+         row_end   = hypre_CSRMatrixGetLoadBalancedPartitionEnd(A);
+      }
+      else
+      {
+         hypre_partition1D(num_loop, num_threads, my_thread, &row_begin, &row_end);
+      }
+
+#if defined(HYPRE_SPMV_SIMD_X86)
+      if (isa == hypre_CSR_SPMV_SIMD_AVX512)
+      {
+         hypre_SpMVRowsAVX512(alpha, A_i, A_j, A_data, rows, row_begin, row_end,
+                              x_data, beta, b_data, y_data);
+      }
+      else if (isa == hypre_CSR_SPMV_SIMD_AVX2)
+      {
+         hypre_SpMVRowsAVX2(alpha, A_i, A_j, A_data, rows, row_begin, row_end,
+                            x_data, beta, b_data, y_data);
+      }
+      else
+#endif
+      {
+         hypre_SpMVRowsScalar(alpha, A_i, A_j, A_data, rows, row_begin, row_end,
+                              x_data, beta, b_data, y_data);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSimdRows
+ *
+ * y = alpha*A*x + beta*b for the rows [row_begin, row_end), single vectors,
+ * with the given instruction set.  Runs on the calling thread.  x_data must
+ * not alias y_data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSimdRows( HYPRE_Int        isa,
+                               HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               HYPRE_Complex   *x_data,
+                               HYPRE_Complex    beta,
+                               HYPRE_Complex   *b_data,
+                               HYPRE_Complex   *y_data,
+                               HYPRE_Int        row_begin,
+                               HYPRE_Int        row_end )
+{
+   HYPRE_Complex *A_data = hypre_CSRMatrixData(A);
+   HYPRE_Int     *A_i    = hypre_CSRMatrixI(A);
+   HYPRE_Int     *A_j    = hypre_CSRMatrixJ(A);
+
+#if defined(HYPRE_SPMV_SIMD_X86)
+   if (isa == hypre_CSR_SPMV_SIMD_AVX512)
+   {
+      hypre_SpMVRowsAVX512(alpha, A_i, A_j, A_data, NULL, row_begin, row_end,
+                           x_data, beta, b_data, y_data);
+   }
+   else if (isa == hypre_CSR_SPMV_SIMD_AVX2)
+   {
+      hypre_SpMVRowsAVX2(alpha, A_i, A_j, A_data, NULL, row_begin, row_end,
+                         x_data, beta, b_data, y_data);
+   }
+   else
+#endif
+   {
+      hypre_SpMVRowsScalar(alpha, A_i, A_j, A_data, NULL, row_begin, row_end,
+                           x_data, beta, b_data, y_data);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSimdHost
+ *
+ * y += A^T*x for single vectors, with the given instruction set.  x_data must
+ * not alias y_data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSimdHost( HYPRE_Int        isa,
+                                hypre_CSRMatrix *A,
+                                HYPRE_Complex   *x_data,
+                                HYPRE_Complex   *y_data )
+{
+   HYPRE_Complex *A_data        = hypre_CSRMatrixData(A);
+   HYPRE_Int     *A_i           = hypre_CSRMatrixI(A);
+   HYPRE_Int     *A_j           = hypre_CSRMatrixJ(A);
+   HYPRE_Int      num_rows      = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int      y_size        = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int      num_threads   = hypre_NumThreads();
+   HYPRE_Complex *y_data_expand = NULL;
+   HYPRE_Int      i, j;
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j)
+#endif
+   {
+      HYPRE_Int      my_thread = hypre_GetThreadNum();
+      HYPRE_Complex *y_thread  = num_threads > 1 ? y_data_expand + y_size * my_thread : y_data;
+      HYPRE_Int      row_begin, row_end;
+
+      hypre_partition1D(num_rows, hypre_NumActiveThreads(), my_thread, &row_begin, &row_end);
+
+#if defined(HYPRE_SPMV_SIMD_X86)
+      if (isa == hypre_CSR_SPMV_SIMD_AVX512)
+      {
+         hypre_SpMVTRowsAVX512(A_i, A_j, A_data, row_begin, row_end, x_data, y_thread);
+      }
+      else if (isa == hypre_CSR_SPMV_SIMD_AVX2)
+      {
+         hypre_SpMVTRowsAVX2(A_i, A_j, A_data, row_begin, row_end, x_data, y_thread);
+      }
+      else
+#endif
+      {
+         hypre_SpMVTRowsScalar(A_i, A_j, A_data, row_begin, row_end, x_data, y_thread);
+      }
+
+      if (num_threads > 1)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_data_expand[j * y_size + i];
+            }
+         }
+      }
+   } /* end parallel threaded region */
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
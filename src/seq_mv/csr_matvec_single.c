@@ -0,0 +1,317 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single precision storage of the values of a hypre_CSRMatrix, and host
+ * matvec functions for it.
+ *
+ * hypre_CSRMatrixConvertToSingle replaces the values of A by a float copy,
+ * which the matvecs below read instead, so that they load half as many bytes
+ * per nonzero.  The vectors and the accumulation stay in HYPRE_Complex.  The
+ * double precision values are freed if A owns them, so routines that access
+ * hypre_CSRMatrixData directly must not be called on a converted matrix.
+ * hypre_CSRMatrixConvertFromSingle widens the float values back, i.e., the
+ * restored matrix is the rounded one.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToSingle
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToSingle( hypre_CSRMatrix *A )
+{
+   HYPRE_Int      num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Complex *A_data       = hypre_CSRMatrixData(A);
+   float         *single_data;
+   HYPRE_Int      i;
+
+   if (hypre_CSRMatrixSingleData(A) || !A_data || num_nonzeros == 0)
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision values are not supported for complex matrices\n");
+   return hypre_error_flag;
+#else
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision values need a host matrix\n");
+      return hypre_error_flag;
+   }
+
+   single_data = hypre_TAlloc(float, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      single_data[i] = (float) A_data[i];
+   }
+
+   /* the single precision kernels do not use the SELL companion */
+   hypre_CSRMatrixSellDestroy(A);
+
+   /* values shared with another matrix are left to their owner */
+   if (hypre_CSRMatrixOwnsData(A))
+   {
+      hypre_TFree(A_data, hypre_CSRMatrixMemoryLocation(A));
+      hypre_CSRMatrixData(A) = NULL;
+   }
+   hypre_CSRMatrixSingleData(A) = single_data;
+
+   return hypre_error_flag;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertFromSingle
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertFromSingle( hypre_CSRMatrix *A )
+{
+   HYPRE_Int      num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   float         *single_data  = hypre_CSRMatrixSingleData(A);
+   HYPRE_Complex *A_data;
+   HYPRE_Int      i;
+
+   if (!single_data)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!hypre_CSRMatrixData(A))
+   {
+      A_data = hypre_TAlloc(HYPRE_Complex, num_nonzeros, hypre_CSRMatrixMemoryLocation(A));
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_nonzeros; i++)
+      {
+         A_data[i] = (HYPRE_Complex) single_data[i];
+      }
+
+      hypre_CSRMatrixData(A) = A_data;
+   }
+
+   hypre_TFree(single_data, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixSingleData(A) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSingleHost
+ *
+ * y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end] with the
+ * single precision values of A
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSingleHost( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 hypre_Vector    *x,
+                                 HYPRE_Complex    beta,
+                                 hypre_Vector    *b,
+                                 hypre_Vector    *y,
+                                 HYPRE_Int        offset )
+{
+   float            *A_data      = hypre_CSRMatrixSingleData(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *b_data      = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data      = hypre_VectorData(y) + offset;
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_b = hypre_VectorIndexStride(b);
+   HYPRE_Int         vecstride_b = hypre_VectorVectorStride(b);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Complex     temp;
+   HYPRE_Int         i, jj, jv, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+   hypre_assert( num_vectors == hypre_VectorNumVectors(b) );
+
+   if (num_cols != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+   if (num_rows != hypre_VectorSize(y) - offset || num_rows != hypre_VectorSize(b) - offset)
+   {
+      ierr = (ierr == 1) ? 3 : 2;
+   }
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   if (num_vectors == 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, jj, temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         temp = 0.0;
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            temp += (HYPRE_Complex) A_data[jj] * x_data[A_j[jj]];
+         }
+         y_data[i] = (beta == 0.0) ? alpha * temp : alpha * temp + beta * b_data[i];
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, jj, jv, temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            temp = 0.0;
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               temp += (HYPRE_Complex) A_data[jj] * x_data[jv*vecstride_x + A_j[jj]*idxstride_x];
+            }
+            temp *= alpha;
+            if (beta != 0.0)
+            {
+               temp += beta * b_data[jv*vecstride_b + i*idxstride_b];
+            }
+            y_data[jv*vecstride_y + i*idxstride_y] = temp;
+         }
+      }
+   }
+
+   hypre_SeqVectorDestroy(x_tmp);
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSingleHost
+ *
+ * y = alpha*A^T*x + beta*y with the single precision values of A
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSingleHost( HYPRE_Complex    alpha,
+                                  hypre_CSRMatrix *A,
+                                  hypre_Vector    *x,
+                                  HYPRE_Complex    beta,
+                                  hypre_Vector    *y )
+{
+   float            *A_data      = hypre_CSRMatrixSingleData(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         num_threads = hypre_NumThreads();
+   HYPRE_Int         y_size      = num_cols * num_vectors;
+   HYPRE_Complex    *y_expand;
+   HYPRE_Int         i, j, jj, jv, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+
+   if (num_rows != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+   if (num_cols != hypre_VectorSize(y))
+   {
+      ierr = (ierr == 1) ? 3 : 2;
+   }
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Accumulate A^T*x index-major in one buffer per thread
+    *-----------------------------------------------------------------------*/
+
+   y_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, jj, jv)
+#endif
+   {
+      HYPRE_Complex *y_thread = y_expand + hypre_GetThreadNum() * y_size;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            HYPRE_Complex aij = (HYPRE_Complex) A_data[jj];
+
+            for (jv = 0; jv < num_vectors; jv++)
+            {
+               y_thread[A_j[jj]*num_vectors + jv] += aij * x_data[jv*vecstride_x + i*idxstride_x];
+            }
+         }
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols; i++)
+   {
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         HYPRE_Complex temp = 0.0;
+
+         for (j = 0; j < num_threads; j++)
+         {
+            temp += y_expand[j*y_size + i*num_vectors + jv];
+         }
+         temp *= alpha;
+         if (beta != 0.0)
+         {
+            temp += beta * y_data[jv*vecstride_y + i*idxstride_y];
+         }
+         y_data[jv*vecstride_y + i*idxstride_y] = temp;
+      }
+   }
+
+   hypre_TFree(y_expand, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorDestroy(x_tmp);
+
+   return ierr;
+}
@@ -0,0 +1,479 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host sparse matrix-matrix multiplication (row-wise Gustavson).
+ *
+ * Rows of C are distributed over the threads by an estimate of their
+ * work (the number of products, an upper bound on the row size), so that
+ * each thread gets about the same number of flops rather than the same
+ * number of rows.  Each thread accumulates a row either in a dense marker
+ * array over the columns of B, or, for rows whose size bound is small
+ * compared to the number of columns of B, in a small open-addressing hash
+ * table that stays in cache.  Both accumulators produce the columns of a
+ * row in the order of their first appearance, with the diagonal first for
+ * square products, so the result does not depend on the choice.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/* number of columns of B up to which rows always use the dense marker */
+#define hypre_SPGEMM_HOST_DENSE_MAX_COLS  32768
+/* rows with bound * ratio >= number of columns of B use the dense marker */
+#define hypre_SPGEMM_HOST_DENSE_RATIO     16
+
+/*--------------------------------------------------------------------------
+ * hypre_SpGemmHostPartitionRows
+ *
+ * Splits num_rows rows into num_parts contiguous ranges of about the same
+ * total work.  row_work[i] is the work of row i, and should include some
+ * per-row overhead so that empty rows are distributed too.  On return,
+ * part[p] .. part[p+1]-1 are the rows of range p.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SpGemmHostPartitionRows( HYPRE_Int  num_rows,
+                               HYPRE_Int *row_work,
+                               HYPRE_Int  num_parts,
+                               HYPRE_Int *part )
+{
+   HYPRE_Real total, sum;
+   HYPRE_Int  i, p;
+
+   total = 0.0;
+   for (i = 0; i < num_rows; i++)
+   {
+      total += (HYPRE_Real) row_work[i];
+   }
+
+   part[0] = 0;
+   p = 1;
+   sum = 0.0;
+   for (i = 0; i < num_rows && p < num_parts; i++)
+   {
+      sum += (HYPRE_Real) row_work[i];
+      while (p < num_parts && sum * num_parts >= total * p)
+      {
+         part[p++] = i + 1;
+      }
+   }
+   for (; p <= num_parts; p++)
+   {
+      part[p] = num_rows;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Accumulator choice for a row of C with at most bound entries
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_SpGemmHostUseDense( HYPRE_Int bound,
+                          HYPRE_Int ncols_B )
+{
+   return (ncols_B <= hypre_SPGEMM_HOST_DENSE_MAX_COLS ||
+           bound * hypre_SPGEMM_HOST_DENSE_RATIO >= ncols_B);
+}
+
+/*--------------------------------------------------------------------------
+ * Thread-private hash accumulator: keys are column indices (-1 if empty),
+ * vals the positions of the columns in the row of C.  The capacity is a
+ * power of two of at least twice the row bound, so probes stay short.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_SpGemmHostHashSize( HYPRE_Int bound )
+{
+   HYPRE_Int size = 16;
+
+   while (size < 2 * bound)
+   {
+      size *= 2;
+   }
+
+   return size;
+}
+
+static inline HYPRE_Int
+hypre_SpGemmHostHashSlot( HYPRE_Int *keys,
+                          HYPRE_Int  mask,
+                          HYPRE_Int  key )
+{
+   HYPRE_Int slot = (HYPRE_Int) (((hypre_uint) key * 2654435761u) & (hypre_uint) mask);
+
+   while (keys[slot] != -1 && keys[slot] != key)
+   {
+      slot = (slot + 1) & mask;
+   }
+
+   return slot;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHost
+ * multiplies two CSR Matrices A and B and returns a CSR Matrix C;
+ * Note: The routine does not check for 0-elements which might be generated
+ *       through cancellation of elements in A and B or already contained
+ in A and B. To remove those, use hypre_CSRMatrixDeleteZeros
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
+                             hypre_CSRMatrix *B)
+{
+   HYPRE_Int diag_first = hypre_CSRMatrixNumRows(A) == hypre_CSRMatrixNumCols(B);
+
+   return hypre_CSRMatrixMultiplyHost_v2(A, B, diag_first);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHost_v2
+ *
+ * Same as hypre_CSRMatrixMultiplyHost, with the caller deciding whether
+ * entry (i,i) of C is stored first in each row i (created as an explicit
+ * zero if the product has none).  This requires the number of rows of A
+ * not to exceed the number of columns of B.  hypre_ParMatmul uses it with
+ * B holding the diag columns of the product first and the offd columns
+ * after them.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixMultiplyHost_v2( hypre_CSRMatrix *A,
+                                hypre_CSRMatrix *B,
+                                HYPRE_Int        diag_first )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         nrows_A  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         ncols_A  = hypre_CSRMatrixNumCols(A);
+   HYPRE_Complex    *B_data   = hypre_CSRMatrixData(B);
+   HYPRE_Int        *B_i      = hypre_CSRMatrixI(B);
+   HYPRE_Int        *B_j      = hypre_CSRMatrixJ(B);
+   HYPRE_Int         nrows_B  = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int         ncols_B  = hypre_CSRMatrixNumCols(B);
+   hypre_CSRMatrix  *C = NULL;
+   HYPRE_Complex    *C_data = NULL;
+   HYPRE_Int        *C_i;
+   HYPRE_Int        *C_j = NULL;
+
+   HYPRE_Int         allsquare = 0;
+   HYPRE_Int         max_num_threads;
+   HYPRE_Int        *jj_count;
+   HYPRE_Int        *row_work;
+   HYPRE_Int        *part;
+   HYPRE_Int         ic;
+
+   HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
+   HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
+
+   /* RL: TODO cannot guarantee, maybe should never assert
+   hypre_assert(memory_location_A == memory_location_B);
+   */
+
+   /* RL: in the case of A=H, B=D, or A=D, B=H, let C = D,
+    * not sure if this is the right thing to do.
+    * Also, need something like this in other places
+    * TODO */
+   HYPRE_MemoryLocation memory_location_C = hypre_max(memory_location_A, memory_location_B);
+
+   if (ncols_A != nrows_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Warning! incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   if (diag_first)
+   {
+      if (nrows_A > ncols_B)
+      {
+         hypre_error_in_arg(3);
+         return NULL;
+      }
+      allsquare = 1;
+   }
+
+   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A+1, memory_location_C);
+
+   max_num_threads = hypre_NumThreads();
+
+   jj_count = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+   part     = hypre_TAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Work estimate of each row: its number of products (plus one).  Capped
+    * by the number of columns of B, the products also bound the row size.
+    *-----------------------------------------------------------------------*/
+
+   row_work = hypre_TAlloc(HYPRE_Int, nrows_A, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ic) HYPRE_SMP_SCHEDULE
+#endif
+   for (ic = 0; ic < nrows_A; ic++)
+   {
+      HYPRE_Int ia, bound = allsquare;
+
+      for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+      {
+         bound += B_i[A_j[ia]+1] - B_i[A_j[ia]];
+      }
+      row_work[ic] = bound + 1;
+   }
+
+   hypre_SpGemmHostPartitionRows(nrows_A, row_work, max_num_threads, part);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(ic)
+#endif
+   {
+      HYPRE_Int     *B_marker = NULL;
+      HYPRE_Int     *hash_keys = NULL, *hash_vals = NULL;
+      HYPRE_Int      hash_size, max_hash_bound = 0;
+      HYPRE_Int      use_dense = 0, use_hash = 0;
+      HYPRE_Int      ns, ne, ii, jj, i1, num_threads;
+      HYPRE_Int      ia, ib, ja, jb, num_nonzeros, row_start, counter;
+      HYPRE_Int      mask, slot, bound;
+      HYPRE_Complex  a_entry;
+
+      ii = hypre_GetThreadNum();
+      num_threads = hypre_NumActiveThreads();
+
+      if (num_threads == max_num_threads)
+      {
+         ns = part[ii];
+         ne = part[ii+1];
+      }
+      else
+      {
+         hypre_GetSimpleThreadPartition(&ns, &ne, nrows_A);
+      }
+
+      /* accumulators needed by the rows of this thread */
+      for (ic = ns; ic < ne; ic++)
+      {
+         bound = hypre_min(row_work[ic] - 1, ncols_B);
+         if (hypre_SpGemmHostUseDense(bound, ncols_B))
+         {
+            use_dense = 1;
+         }
+         else
+         {
+            use_hash = 1;
+            max_hash_bound = hypre_max(max_hash_bound, bound);
+         }
+      }
+      if (use_dense)
+      {
+         B_marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+         for (ib = 0; ib < ncols_B; ib++)
+         {
+            B_marker[ib] = -1;
+         }
+      }
+      if (use_hash)
+      {
+         hash_size = hypre_SpGemmHostHashSize(max_hash_bound);
+         hash_keys = hypre_TAlloc(HYPRE_Int, hash_size, HYPRE_MEMORY_HOST);
+         hash_vals = hypre_TAlloc(HYPRE_Int, hash_size, HYPRE_MEMORY_HOST);
+      }
+
+      /*--------------------------------------------------------------------
+       * First pass: row sizes
+       *--------------------------------------------------------------------*/
+
+      num_nonzeros = 0;
+      for (ic = ns; ic < ne; ic++)
+      {
+         C_i[ic] = num_nonzeros;
+         bound = hypre_min(row_work[ic] - 1, ncols_B);
+
+         if (hypre_SpGemmHostUseDense(bound, ncols_B))
+         {
+            if (allsquare)
+            {
+               B_marker[ic] = ic;
+               num_nonzeros++;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  if (B_marker[jb] != ic)
+                  {
+                     B_marker[jb] = ic;
+                     num_nonzeros++;
+                  }
+               }
+            }
+         }
+         else
+         {
+            mask = hypre_SpGemmHostHashSize(bound) - 1;
+            for (i1 = 0; i1 <= mask; i1++)
+            {
+               hash_keys[i1] = -1;
+            }
+            if (allsquare)
+            {
+               hash_keys[hypre_SpGemmHostHashSlot(hash_keys, mask, ic)] = ic;
+               num_nonzeros++;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  slot = hypre_SpGemmHostHashSlot(hash_keys, mask, jb);
+                  if (hash_keys[slot] == -1)
+                  {
+                     hash_keys[slot] = jb;
+                     num_nonzeros++;
+                  }
+               }
+            }
+         }
+      }
+      jj_count[ii] = num_nonzeros;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      if (ii)
+      {
+         jj = jj_count[0];
+         for (i1 = 1; i1 < ii; i1++)
+            jj += jj_count[i1];
+
+         for (i1 = ns; i1 < ne; i1++)
+            C_i[i1] += jj;
+      }
+      else
+      {
+         C_i[nrows_A] = 0;
+         for (i1 = 0; i1 < num_threads; i1++)
+            C_i[nrows_A] += jj_count[i1];
+
+         C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
+         hypre_CSRMatrixI(C) = C_i;
+         hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
+         C_j = hypre_CSRMatrixJ(C);
+         C_data = hypre_CSRMatrixData(C);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      /*--------------------------------------------------------------------
+       * Second pass: columns and values
+       *--------------------------------------------------------------------*/
+
+      if (use_dense)
+      {
+         for (ib = 0; ib < ncols_B; ib++)
+         {
+            B_marker[ib] = -1;
+         }
+      }
+
+      counter = C_i[ns];
+      for (ic = ns; ic < ne; ic++)
+      {
+         row_start = C_i[ic];
+         bound = hypre_min(row_work[ic] - 1, ncols_B);
+
+         if (hypre_SpGemmHostUseDense(bound, ncols_B))
+         {
+            if (allsquare)
+            {
+               B_marker[ic] = counter;
+               C_data[counter] = 0;
+               C_j[counter] = ic;
+               counter++;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  if (B_marker[jb] < row_start)
+                  {
+                     B_marker[jb] = counter;
+                     C_j[counter] = jb;
+                     C_data[counter] = a_entry*B_data[ib];
+                     counter++;
+                  }
+                  else
+                  {
+                     C_data[B_marker[jb]] += a_entry*B_data[ib];
+                  }
+               }
+            }
+         }
+         else
+         {
+            mask = hypre_SpGemmHostHashSize(bound) - 1;
+            for (i1 = 0; i1 <= mask; i1++)
+            {
+               hash_keys[i1] = -1;
+            }
+            if (allsquare)
+            {
+               slot = hypre_SpGemmHostHashSlot(hash_keys, mask, ic);
+               hash_keys[slot] = ic;
+               hash_vals[slot] = counter;
+               C_data[counter] = 0;
+               C_j[counter] = ic;
+               counter++;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  slot = hypre_SpGemmHostHashSlot(hash_keys, mask, jb);
+                  if (hash_keys[slot] == -1)
+                  {
+                     hash_keys[slot] = jb;
+                     hash_vals[slot] = counter;
+                     C_j[counter] = jb;
+                     C_data[counter] = a_entry*B_data[ib];
+                     counter++;
+                  }
+                  else
+                  {
+                     C_data[hash_vals[slot]] += a_entry*B_data[ib];
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_vals, HYPRE_MEMORY_HOST);
+   } /*end parallel region */
+
+   hypre_TFree(jj_count, HYPRE_MEMORY_HOST);
+   hypre_TFree(part, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_work, HYPRE_MEMORY_HOST);
+
+   return C;
+}
@@ -9,7 +9,6 @@
 hypre_CSRMatrix *hypre_CSRMatrixAddHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixAdd ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixBigAdd ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
-hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiply ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixDeleteZeros ( hypre_CSRMatrix *A , HYPRE_Real tol );
 HYPRE_Int hypre_CSRMatrixTransposeHost ( hypre_CSRMatrix *A , hypre_CSRMatrix **AT , HYPRE_Int data );
@@ -48,6 +47,8 @@ HYPRE_Int hypre_CSRMatrixTriLowerUpperSolveCusparse(char uplo, hypre_CSRMatrix *
 /* csr_matrix.c */
 hypre_CSRMatrix *hypre_CSRMatrixCreate ( HYPRE_Int num_rows , HYPRE_Int num_cols , HYPRE_Int num_nonzeros );
 HYPRE_Int hypre_CSRMatrixDestroy ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixUpdateCompanions ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixUpdateCompanionValues ( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_CSRMatrixInitialize ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixBigInitialize ( hypre_CSRMatrix *matrix );
@@ -68,6 +69,11 @@ HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memo
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows, HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
 
+/* csr_spgemm_host.c */
+HYPRE_Int hypre_SpGemmHostPartitionRows ( HYPRE_Int num_rows , HYPRE_Int *row_work , HYPRE_Int num_parts , HYPRE_Int *part );
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost_v2 ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , HYPRE_Int diag_first );
+
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -75,6 +81,40 @@ HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_CSRMatri
 HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y , HYPRE_Int *CF_marker_x , HYPRE_Int *CF_marker_y , HYPRE_Int fpt );
+HYPRE_Int hypre_CSRMatrixMatvecRangeSetup ( hypre_CSRMatrix *A , HYPRE_Int *num_units_ptr , HYPRE_Int *unit_rows_ptr );
+HYPRE_Int hypre_CSRMatrixMatvecRangeHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int begin , HYPRE_Int end );
+
+/* csr_matvec_sell.c */
+hypre_CSRMatrixSell *hypre_CSRMatrixSellCreate ( hypre_CSRMatrix *A , HYPRE_Int chunk_size , HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellRefresh ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSetSpMVFormat ( hypre_CSRMatrix *A , HYPRE_Int format );
+HYPRE_Int hypre_CSRMatrixSpMVUseSell ( hypre_CSRMatrix *A );
+hypre_CSRMatrixSell *hypre_CSRMatrixSellSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellChunks ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int chunk_begin , HYPRE_Int chunk_end );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data );
+HYPRE_Int hypre_CSRMatrixMatvecTSellHost ( hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex *y_data );
+
+/* csr_matvec_shortj.c */
+hypre_CSRMatrixShortJ *hypre_CSRMatrixShortJCreate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixShortJDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSpMVUseShortJ ( hypre_CSRMatrix *A );
+hypre_CSRMatrixShortJ *hypre_CSRMatrixShortJSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecShortJHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecShortJRows ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int row_begin , HYPRE_Int row_end );
+HYPRE_Int hypre_CSRMatrixMatvecTShortJHost ( hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex *y_data );
+
+/* csr_matvec_single.c */
+HYPRE_Int hypre_CSRMatrixConvertToSingle ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixConvertFromSingle ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSingleHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTSingleHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
+
+/* csr_matvec_simd.c */
+HYPRE_Int hypre_CSRMatrixSpMVSimdISA ( void );
+HYPRE_Int hypre_CSRMatrixMatvecSimdHost ( HYPRE_Int isa , HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecSimdRows ( HYPRE_Int isa , HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int row_begin , HYPRE_Int row_end );
+HYPRE_Int hypre_CSRMatrixMatvecTSimdHost ( HYPRE_Int isa , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex *y_data );
 
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -94,6 +134,9 @@ HYPRE_Int HYPRE_CSRMatrixInitialize ( HYPRE_CSRMatrix matrix );
 HYPRE_CSRMatrix HYPRE_CSRMatrixRead ( char *file_name );
 void HYPRE_CSRMatrixPrint ( HYPRE_CSRMatrix matrix , char *file_name );
 HYPRE_Int HYPRE_CSRMatrixGetNumRows ( HYPRE_CSRMatrix matrix , HYPRE_Int *num_rows );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVFormat ( HYPRE_Int format );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVSellParams ( HYPRE_Int chunk_size , HYPRE_Int sigma );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVSimd ( HYPRE_Int isa );
 
 /* HYPRE_mapped_matrix.c */
 HYPRE_MappedMatrix HYPRE_MappedMatrixCreate ( void );
@@ -179,6 +222,9 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y, HYPRE_Int k);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorPrefetch(hypre_Vector *x, HYPRE_MemoryLocation memory_location);
+HYPRE_Int hypre_SeqMultiVectorCopyColumn ( hypre_Vector *x, HYPRE_Int jv, hypre_Vector *y, HYPRE_Int to_y );
+HYPRE_Int hypre_SeqMultiVectorGetColumn ( hypre_Vector *x, HYPRE_Int jv, hypre_Vector *y );
+HYPRE_Int hypre_SeqMultiVectorSetColumn ( hypre_Vector *x, HYPRE_Int jv, hypre_Vector *y );
 //HYPRE_Int hypre_SeqVectorMax( HYPRE_Complex alpha, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
 
 HYPRE_Int hypreDevice_CSRSpAdd(HYPRE_Int ma, HYPRE_Int mb, HYPRE_Int n, HYPRE_Int nnzA, HYPRE_Int nnzB, HYPRE_Int *d_ia, HYPRE_Int *d_ja, HYPRE_Complex *d_aa, HYPRE_Int *d_ib, HYPRE_Int *d_jb, HYPRE_Complex *d_ab, HYPRE_Int *d_num_b, HYPRE_Int *nnzC_out, HYPRE_Int **d_ic_out, HYPRE_Int **d_jc_out, HYPRE_Complex **d_ac_out);
@@ -41,6 +41,93 @@ struct hypre_CsrsvData;
 typedef struct hypre_CsrsvData hypre_CsrsvData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * Host SpMV storage formats
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CSR_SPMV_FORMAT_DEFAULT  -1   /* use the global setting */
+#define hypre_CSR_SPMV_FORMAT_CSR       0
+#define hypre_CSR_SPMV_FORMAT_SELL      1
+#define hypre_CSR_SPMV_FORMAT_SHORTJ    2   /* CSR with 16/32-bit column offsets */
+
+#define hypre_CSR_SELL_MAX_CHUNK_SIZE  64
+
+/* instruction sets of the explicitly vectorized host SpMV kernels */
+#define hypre_CSR_SPMV_SIMD_AUTO       -1   /* best one supported by the CPU */
+#define hypre_CSR_SPMV_SIMD_SCALAR      0
+#define hypre_CSR_SPMV_SIMD_AVX2        1
+#define hypre_CSR_SPMV_SIMD_AVX512      2
+
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) companion of a CSR Matrix
+ *
+ * Rows are sorted by length (descending) within windows of sigma rows and
+ * grouped into chunks of C rows, which are padded to the length of their
+ * longest row.  The column indices and values of a chunk are stored column
+ * by column: entry k of slot r of chunk c is at chunk_ptr[c] + k*C + r, so
+ * that the C rows of a chunk are processed with unit stride.  Padding
+ * entries have value zero and repeat the last column index of their row
+ * (column 0 for empty rows).
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             chunk_size;      /* C */
+   HYPRE_Int             sigma;           /* sorting window */
+   HYPRE_Int             num_chunks;
+   HYPRE_Int            *chunk_len;       /* width of each chunk */
+   HYPRE_Int            *chunk_ptr;       /* start of each chunk in col and val */
+   HYPRE_Int            *perm;            /* slot -> row, -1 for padding slots */
+   HYPRE_Int            *col;             /* padded column indices */
+   HYPRE_Complex        *val;             /* padded values */
+   HYPRE_Int             num_rows;        /* size, nnz and arrays of the CSR matrix */
+   HYPRE_Int             num_nonzeros;    /* it was built from */
+   HYPRE_Int            *csr_i;
+   HYPRE_Int            *csr_j;
+   HYPRE_Complex        *csr_data;
+
+} hypre_CSRMatrixSell;
+
+#define hypre_CSRMatrixSellChunkSize(sell)          ((sell) -> chunk_size)
+#define hypre_CSRMatrixSellSigma(sell)              ((sell) -> sigma)
+#define hypre_CSRMatrixSellNumChunks(sell)          ((sell) -> num_chunks)
+#define hypre_CSRMatrixSellChunkLen(sell)           ((sell) -> chunk_len)
+#define hypre_CSRMatrixSellChunkPtr(sell)           ((sell) -> chunk_ptr)
+#define hypre_CSRMatrixSellPerm(sell)               ((sell) -> perm)
+#define hypre_CSRMatrixSellCol(sell)                ((sell) -> col)
+#define hypre_CSRMatrixSellVal(sell)                ((sell) -> val)
+#define hypre_CSRMatrixSellNumRows(sell)            ((sell) -> num_rows)
+#define hypre_CSRMatrixSellNumNonzeros(sell)        ((sell) -> num_nonzeros)
+#define hypre_CSRMatrixSellCSRI(sell)               ((sell) -> csr_i)
+#define hypre_CSRMatrixSellCSRJ(sell)               ((sell) -> csr_j)
+#define hypre_CSRMatrixSellCSRData(sell)            ((sell) -> csr_data)
+
+/*--------------------------------------------------------------------------
+ * Short column indices companion of a CSR Matrix
+ *
+ * The column index A_j[jj] of row i is stored as the offset
+ * A_j[jj] - row_base[i] from the smallest column index of the row, in 16 bits
+ * if every row spans less than 2^16 columns, and else in 32 bits if HYPRE_Int
+ * is wider than that.  If neither fits, j16 and j32 are both NULL and the CSR
+ * indices are used.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            *row_base;        /* smallest column index of each row */
+   unsigned short       *j16;             /* 16-bit offsets, or NULL */
+   hypre_uint           *j32;             /* 32-bit offsets, or NULL */
+   HYPRE_Int             num_nonzeros;    /* nnz and j of the CSR matrix it was built from */
+   HYPRE_Int            *csr_j;
+
+} hypre_CSRMatrixShortJ;
+
+#define hypre_CSRMatrixShortJRowBase(short_j)       ((short_j) -> row_base)
+#define hypre_CSRMatrixShortJJ16(short_j)           ((short_j) -> j16)
+#define hypre_CSRMatrixShortJJ32(short_j)           ((short_j) -> j32)
+#define hypre_CSRMatrixShortJNumNonzeros(short_j)   ((short_j) -> num_nonzeros)
+#define hypre_CSRMatrixShortJCSRJ(short_j)          ((short_j) -> csr_j)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -53,13 +140,15 @@ typedef struct
    HYPRE_Int             num_rows;
    HYPRE_Int             num_cols;
    HYPRE_Int             num_nonzeros;
-   hypre_int            *i_short;
-   hypre_int            *j_short;
    HYPRE_Int             owns_data;       /* Does the CSRMatrix create/destroy `data', `i', `j'? */
    HYPRE_Complex        *data;
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   HYPRE_Int             spmv_format;     /* host SpMV storage format (see above) */
+   hypre_CSRMatrixSell  *sell;            /* SELL-C-sigma companion, built lazily */
+   hypre_CSRMatrixShortJ *short_j;        /* short column indices companion, built lazily */
+   float                *single_data;     /* single precision values used by matvecs (replace owned data) */
 #if defined(HYPRE_USING_CUSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -83,6 +172,10 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)            ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSpMVFormat(matrix)           ((matrix) -> spmv_format)
+#define hypre_CSRMatrixSell(matrix)                 ((matrix) -> sell)
+#define hypre_CSRMatrixShortJ(matrix)               ((matrix) -> short_j)
+#define hypre_CSRMatrixSingleData(matrix)           ((matrix) -> single_data)
 
 #if defined(HYPRE_USING_CUSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
@@ -93,6 +186,74 @@ typedef struct
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
 
+/*--------------------------------------------------------------------------
+ * Row kernels of the short column indices companion
+ *--------------------------------------------------------------------------*/
+
+/* returns sum_{jj = jj_begin}^{jj_end-1} A_data[jj] * x_data[A_j[jj]] for row i */
+static inline HYPRE_Complex
+hypre_CSRMatrixShortJRowDot( hypre_CSRMatrixShortJ *short_j,
+                             HYPRE_Complex         *A_data,
+                             HYPRE_Int              i,
+                             HYPRE_Int              jj_begin,
+                             HYPRE_Int              jj_end,
+                             HYPRE_Complex         *x_data )
+{
+   const HYPRE_Complex *x_row = x_data + hypre_CSRMatrixShortJRowBase(short_j)[i];
+   const unsigned short *j16  = hypre_CSRMatrixShortJJ16(short_j);
+   const hypre_uint     *j32  = hypre_CSRMatrixShortJJ32(short_j);
+   HYPRE_Complex         sum  = 0.0;
+   HYPRE_Int             jj;
+
+   if (j16)
+   {
+      for (jj = jj_begin; jj < jj_end; jj++)
+      {
+         sum += A_data[jj] * x_row[j16[jj]];
+      }
+   }
+   else
+   {
+      for (jj = jj_begin; jj < jj_end; jj++)
+      {
+         sum += A_data[jj] * x_row[j32[jj]];
+      }
+   }
+
+   return sum;
+}
+
+/* y_data[A_j[jj]] += A_data[jj] * xi for the entries of row i */
+static inline void
+hypre_CSRMatrixShortJRowAxpy( hypre_CSRMatrixShortJ *short_j,
+                              HYPRE_Complex         *A_data,
+                              HYPRE_Int              i,
+                              HYPRE_Int              jj_begin,
+                              HYPRE_Int              jj_end,
+                              HYPRE_Complex          xi,
+                              HYPRE_Complex         *y_data )
+{
+   HYPRE_Complex        *y_row = y_data + hypre_CSRMatrixShortJRowBase(short_j)[i];
+   const unsigned short *j16   = hypre_CSRMatrixShortJJ16(short_j);
+   const hypre_uint     *j32   = hypre_CSRMatrixShortJJ32(short_j);
+   HYPRE_Int             jj;
+
+   if (j16)
+   {
+      for (jj = jj_begin; jj < jj_end; jj++)
+      {
+         y_row[j16[jj]] += A_data[jj] * xi;
+      }
+   }
+   else
+   {
+      for (jj = jj_begin; jj < jj_end; jj++)
+      {
+         y_row[j32[jj]] += A_data[jj] * xi;
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -275,7 +436,6 @@ typedef struct
 hypre_CSRMatrix *hypre_CSRMatrixAddHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixAdd ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixBigAdd ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
-hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiply ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixDeleteZeros ( hypre_CSRMatrix *A , HYPRE_Real tol );
 HYPRE_Int hypre_CSRMatrixTransposeHost ( hypre_CSRMatrix *A , hypre_CSRMatrix **AT , HYPRE_Int data );
@@ -314,6 +474,8 @@ HYPRE_Int hypre_CSRMatrixTriLowerUpperSolveCusparse(char uplo, hypre_CSRMatrix *
 /* csr_matrix.c */
 hypre_CSRMatrix *hypre_CSRMatrixCreate ( HYPRE_Int num_rows , HYPRE_Int num_cols , HYPRE_Int num_nonzeros );
 HYPRE_Int hypre_CSRMatrixDestroy ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixUpdateCompanions ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixUpdateCompanionValues ( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_CSRMatrixInitialize ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixBigInitialize ( hypre_CSRMatrix *matrix );
@@ -334,6 +496,11 @@ HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memo
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows, HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
 
+/* csr_spgemm_host.c */
+HYPRE_Int hypre_SpGemmHostPartitionRows ( HYPRE_Int num_rows , HYPRE_Int *row_work , HYPRE_Int num_parts , HYPRE_Int *part );
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost_v2 ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , HYPRE_Int diag_first );
+
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -341,6 +508,40 @@ HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_CSRMatri
 HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y , HYPRE_Int *CF_marker_x , HYPRE_Int *CF_marker_y , HYPRE_Int fpt );
+HYPRE_Int hypre_CSRMatrixMatvecRangeSetup ( hypre_CSRMatrix *A , HYPRE_Int *num_units_ptr , HYPRE_Int *unit_rows_ptr );
+HYPRE_Int hypre_CSRMatrixMatvecRangeHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int begin , HYPRE_Int end );
+
+/* csr_matvec_sell.c */
+hypre_CSRMatrixSell *hypre_CSRMatrixSellCreate ( hypre_CSRMatrix *A , HYPRE_Int chunk_size , HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellRefresh ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSetSpMVFormat ( hypre_CSRMatrix *A , HYPRE_Int format );
+HYPRE_Int hypre_CSRMatrixSpMVUseSell ( hypre_CSRMatrix *A );
+hypre_CSRMatrixSell *hypre_CSRMatrixSellSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellChunks ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int chunk_begin , HYPRE_Int chunk_end );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data );
+HYPRE_Int hypre_CSRMatrixMatvecTSellHost ( hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex *y_data );
+
+/* csr_matvec_shortj.c */
+hypre_CSRMatrixShortJ *hypre_CSRMatrixShortJCreate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixShortJDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSpMVUseShortJ ( hypre_CSRMatrix *A );
+hypre_CSRMatrixShortJ *hypre_CSRMatrixShortJSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecShortJHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecShortJRows ( HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int row_begin , HYPRE_Int row_end );
+HYPRE_Int hypre_CSRMatrixMatvecTShortJHost ( hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex *y_data );
+
+/* csr_matvec_single.c */
+HYPRE_Int hypre_CSRMatrixConvertToSingle ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixConvertFromSingle ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSingleHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTSingleHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
+
+/* csr_matvec_simd.c */
+HYPRE_Int hypre_CSRMatrixSpMVSimdISA ( void );
+HYPRE_Int hypre_CSRMatrixMatvecSimdHost ( HYPRE_Int isa , HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecSimdRows ( HYPRE_Int isa , HYPRE_Complex alpha , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data , HYPRE_Int row_begin , HYPRE_Int row_end );
+HYPRE_Int hypre_CSRMatrixMatvecTSimdHost ( HYPRE_Int isa , hypre_CSRMatrix *A , HYPRE_Complex *x_data , HYPRE_Complex *y_data );
 
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -360,6 +561,9 @@ HYPRE_Int HYPRE_CSRMatrixInitialize ( HYPRE_CSRMatrix matrix );
 HYPRE_CSRMatrix HYPRE_CSRMatrixRead ( char *file_name );
 void HYPRE_CSRMatrixPrint ( HYPRE_CSRMatrix matrix , char *file_name );
 HYPRE_Int HYPRE_CSRMatrixGetNumRows ( HYPRE_CSRMatrix matrix , HYPRE_Int *num_rows );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVFormat ( HYPRE_Int format );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVSellParams ( HYPRE_Int chunk_size , HYPRE_Int sigma );
+HYPRE_Int HYPRE_CSRMatrixSetSpMVSimd ( HYPRE_Int isa );
 
 /* HYPRE_mapped_matrix.c */
 HYPRE_MappedMatrix HYPRE_MappedMatrixCreate ( void );
@@ -445,6 +649,9 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y, HYPRE_Int k);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorPrefetch(hypre_Vector *x, HYPRE_MemoryLocation memory_location);
+HYPRE_Int hypre_SeqMultiVectorCopyColumn ( hypre_Vector *x, HYPRE_Int jv, hypre_Vector *y, HYPRE_Int to_y );
+HYPRE_Int hypre_SeqMultiVectorGetColumn ( hypre_Vector *x, HYPRE_Int jv, hypre_Vector *y );
+HYPRE_Int hypre_SeqMultiVectorSetColumn ( hypre_Vector *x, HYPRE_Int jv, hypre_Vector *y );
 //HYPRE_Int hypre_SeqVectorMax( HYPRE_Complex alpha, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
 
 HYPRE_Int hypreDevice_CSRSpAdd(HYPRE_Int ma, HYPRE_Int mb, HYPRE_Int n, HYPRE_Int nnzA, HYPRE_Int nnzB, HYPRE_Int *d_ia, HYPRE_Int *d_ja, HYPRE_Complex *d_aa, HYPRE_Int *d_ib, HYPRE_Int *d_jb, HYPRE_Complex *d_ab, HYPRE_Int *d_num_b, HYPRE_Int *nnzC_out, HYPRE_Int **d_ic_out, HYPRE_Int **d_jc_out, HYPRE_Complex **d_ac_out);
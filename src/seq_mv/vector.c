@@ -707,6 +707,105 @@ hypre_SeqVectorPrefetch( hypre_Vector *x, HYPRE_MemoryLocation memory_location)
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqMultiVectorGetColumn / hypre_SeqMultiVectorSetColumn
+ *
+ * Copy vector jv of the multivector x to/from the single vector y.  The
+ * copy runs where the data lives; x and y must share a memory location.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqMultiVectorCopyColumn( hypre_Vector *x,
+                                HYPRE_Int     jv,
+                                hypre_Vector *y,
+                                HYPRE_Int     to_y )
+{
+   HYPRE_Complex *x_data    = hypre_VectorData(x) + jv * hypre_VectorVectorStride(x);
+   HYPRE_Complex *y_data    = hypre_VectorData(y);
+   HYPRE_Int      idxstride = hypre_VectorIndexStride(x);
+   HYPRE_Int      size      = hypre_VectorSize(x);
+
+   if (hypre_VectorMemoryLocation(x) != hypre_VectorMemoryLocation(y))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Column copy between different memory locations!\n");
+      return hypre_error_flag;
+   }
+
+   if (idxstride == 1)
+   {
+      if (to_y)
+      {
+         hypre_TMemcpy(y_data, x_data, HYPRE_Complex, size,
+                       hypre_VectorMemoryLocation(y), hypre_VectorMemoryLocation(x));
+      }
+      else
+      {
+         hypre_TMemcpy(x_data, y_data, HYPRE_Complex, size,
+                       hypre_VectorMemoryLocation(x), hypre_VectorMemoryLocation(y));
+      }
+
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA)
+   if (hypre_GetExecPolicy1(hypre_VectorMemoryLocation(x)) == HYPRE_EXEC_DEVICE)
+   {
+      auto map = thrust::make_transform_iterator(thrust::counting_iterator<HYPRE_Int>(0),
+                                                 idxstride * _1);
+      if (to_y)
+      {
+         HYPRE_THRUST_CALL( gather, map, map + size, x_data, y_data );
+      }
+      else
+      {
+         HYPRE_THRUST_CALL( scatter, y_data, y_data + size, map, x_data );
+      }
+      hypre_SyncCudaComputeStream(hypre_handle());
+   }
+   else
+#endif
+   {
+      HYPRE_Int i;
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#pragma omp target teams distribute parallel for private(i) is_device_ptr(y_data, x_data)
+#elif defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         if (to_y)
+         {
+            y_data[i] = x_data[i * idxstride];
+         }
+         else
+         {
+            x_data[i * idxstride] = y_data[i];
+         }
+      }
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+      hypre_SyncCudaComputeStream(hypre_handle());
+#endif
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SeqMultiVectorGetColumn( hypre_Vector *x,
+                               HYPRE_Int     jv,
+                               hypre_Vector *y )
+{
+   return hypre_SeqMultiVectorCopyColumn(x, jv, y, 1);
+}
+
+HYPRE_Int
+hypre_SeqMultiVectorSetColumn( hypre_Vector *x,
+                               HYPRE_Int     jv,
+                               hypre_Vector *y )
+{
+   return hypre_SeqMultiVectorCopyColumn(x, jv, y, 0);
+}
+
 #if 0
 /* y[i] = max(alpha*x[i], beta*y[i]) */
 HYPRE_Int
@@ -168,6 +168,9 @@ HYPRE_SStructSysPFMGSetNonZeroGuess(HYPRE_SStructSolver solver);
  *    - 0 : Jacobi
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
+ *    - 4 : Zebra line Gauss-Seidel (symmetric: RB pre-relaxation, BR
+ *          post-relaxation), applied one variable at a time.  The lines are
+ *          along the direction of strongest coupling on each level.
  **/
 HYPRE_Int
 HYPRE_SStructSysPFMGSetRelaxType(HYPRE_SStructSolver solver,
@@ -25,6 +25,8 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
 
+   hypre_PCGFunctionsSetInnerProdNonblocking( pcg_functions,
+      hypre_SStructKrylovInnerProdStart, hypre_SStructKrylovInnerProdWait );
    *solver = ( (HYPRE_SStructSolver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
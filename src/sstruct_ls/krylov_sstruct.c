@@ -215,6 +215,49 @@ hypre_SStructKrylovInnerProd( void *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovInnerProdStart( HYPRE_Int    n,
+                                   void       **x,
+                                   void       **y,
+                                   HYPRE_Real  *result,
+                                   void       **request )
+{
+   MPI_Comm           comm = hypre_SStructVectorComm((hypre_SStructVector *) x[0]);
+   hypre_MPI_Request *req;
+   HYPRE_Int          k;
+
+   for (k = 0; k < n; k++)
+   {
+      hypre_SStructInnerProdLocal( (hypre_SStructVector *) x[k],
+                                   (hypre_SStructVector *) y[k], &result[k] );
+   }
+
+   req = hypre_CTAlloc(hypre_MPI_Request, 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, req);
+   *request = (void *) req;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovInnerProdWait( void *request )
+{
+   hypre_MPI_Request *req = (hypre_MPI_Request *) request;
+   hypre_MPI_Status   status;
+
+   hypre_MPI_Wait(req, &status);
+   hypre_TFree(req, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -129,16 +129,23 @@ hypre_NodeRelaxDestroy( void *relax_vdata )
 
    if (relax_data)
    {
-      nvars = hypre_SStructPMatrixNVars(relax_data -> A);
+      /* A and the compute packages only exist after setup */
+      nvars = (relax_data -> A) ? hypre_SStructPMatrixNVars(relax_data -> A) : 0;
       for (i = 0; i < (relax_data -> num_nodesets); i++)
       {
          hypre_TFree(relax_data -> nodeset_indices[i], HYPRE_MEMORY_HOST);
-         for (vi = 0; vi < nvars; vi++)
+      }
+      if (relax_data -> compute_pkgs)
+      {
+         for (i = 0; i < (relax_data -> num_nodesets); i++)
          {
-            hypre_ComputePkgDestroy(relax_data -> svec_compute_pkgs[i][vi]);
+            for (vi = 0; vi < nvars; vi++)
+            {
+               hypre_ComputePkgDestroy(relax_data -> svec_compute_pkgs[i][vi]);
+            }
+            hypre_TFree(relax_data -> svec_compute_pkgs[i], HYPRE_MEMORY_HOST);
+            hypre_ComputePkgDestroy(relax_data -> compute_pkgs[i]);
          }
-         hypre_TFree(relax_data -> svec_compute_pkgs[i], HYPRE_MEMORY_HOST);
-         hypre_ComputePkgDestroy(relax_data -> compute_pkgs[i]);
       }
       hypre_TFree(relax_data -> nodeset_sizes, HYPRE_MEMORY_HOST);
       hypre_TFree(relax_data -> nodeset_ranks, HYPRE_MEMORY_HOST);
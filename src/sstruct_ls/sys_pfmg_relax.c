@@ -12,10 +12,20 @@
 
 typedef struct
 {
+   MPI_Comm                comm;
    void                   *relax_data;
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
 
+   /* zebra line Gauss-Seidel (relax_type 4) */
+   HYPRE_Int               nvars;
+   HYPRE_Int               line_dir;
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   void                  **line_relax_data;  /* diagonal blocks */
+   void                 ***smatvec_data;     /* off-diagonal blocks */
+   hypre_SStructPVector   *t;
+
 } hypre_SysPFMGRelaxData;
 
 /*--------------------------------------------------------------------------
@@ -27,12 +37,45 @@ hypre_SysPFMGRelaxCreate( MPI_Comm  comm )
    hypre_SysPFMGRelaxData *sys_pfmg_relax_data;
 
    sys_pfmg_relax_data = hypre_CTAlloc(hypre_SysPFMGRelaxData,  1, HYPRE_MEMORY_HOST);
+   (sys_pfmg_relax_data -> comm)       = comm;
    (sys_pfmg_relax_data -> relax_data) = hypre_NodeRelaxCreate(comm);
    (sys_pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
+   (sys_pfmg_relax_data -> max_iter)   = 1000;
 
    return (void *) sys_pfmg_relax_data;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SysPFMGRelaxDestroyLineData( hypre_SysPFMGRelaxData *sys_pfmg_relax_data )
+{
+   HYPRE_Int  nvars = (sys_pfmg_relax_data -> nvars);
+   HYPRE_Int  vi, vj;
+
+   if (sys_pfmg_relax_data -> line_relax_data)
+   {
+      for (vi = 0; vi < nvars; vi++)
+      {
+         hypre_LineRelaxDestroy((sys_pfmg_relax_data -> line_relax_data)[vi]);
+         for (vj = 0; vj < nvars; vj++)
+         {
+            if ((sys_pfmg_relax_data -> smatvec_data)[vi][vj])
+            {
+               hypre_StructMatvecDestroy((sys_pfmg_relax_data -> smatvec_data)[vi][vj]);
+            }
+         }
+         hypre_TFree((sys_pfmg_relax_data -> smatvec_data)[vi], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(sys_pfmg_relax_data -> line_relax_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(sys_pfmg_relax_data -> smatvec_data, HYPRE_MEMORY_HOST);
+   }
+   (sys_pfmg_relax_data -> nvars) = 0;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -44,6 +87,8 @@ hypre_SysPFMGRelaxDestroy( void *sys_pfmg_relax_vdata )
    if (sys_pfmg_relax_data)
    {
       hypre_NodeRelaxDestroy(sys_pfmg_relax_data -> relax_data);
+      hypre_SysPFMGRelaxDestroyLineData(sys_pfmg_relax_data);
+      hypre_SStructPVectorDestroy(sys_pfmg_relax_data -> t);
       hypre_TFree(sys_pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -61,7 +106,75 @@ hypre_SysPFMGRelax( void                 *sys_pfmg_relax_vdata,
 {
    hypre_SysPFMGRelaxData *sys_pfmg_relax_data = (hypre_SysPFMGRelaxData *)sys_pfmg_relax_vdata;
 
-   hypre_NodeRelax((sys_pfmg_relax_data -> relax_data), A, b, x);
+   if ((sys_pfmg_relax_data -> relax_type) == 4)
+   {
+      hypre_SysPFMGLineRelax(sys_pfmg_relax_vdata, A, b, x);
+   }
+   else
+   {
+      hypre_NodeRelax((sys_pfmg_relax_data -> relax_data), A, b, x);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Zebra line Gauss-Seidel for systems.  The variables are relaxed one after
+ * the other (block Gauss-Seidel), each with a zebra line sweep on its
+ * diagonal block and the coupling to the other variables moved to the
+ * right-hand side.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SysPFMGLineRelax( void                 *sys_pfmg_relax_vdata,
+                        hypre_SStructPMatrix *A,
+                        hypre_SStructPVector *b,
+                        hypre_SStructPVector *x                )
+{
+   hypre_SysPFMGRelaxData *sys_pfmg_relax_data = (hypre_SysPFMGRelaxData *)sys_pfmg_relax_vdata;
+   HYPRE_Int               nvars           = (sys_pfmg_relax_data -> nvars);
+   HYPRE_Int               max_iter        = (sys_pfmg_relax_data -> max_iter);
+   HYPRE_Int               zero_guess      = (sys_pfmg_relax_data -> zero_guess);
+   void                  **line_relax_data = (sys_pfmg_relax_data -> line_relax_data);
+   void                 ***smatvec_data    = (sys_pfmg_relax_data -> smatvec_data);
+   hypre_SStructPVector   *t               = (sys_pfmg_relax_data -> t);
+
+   hypre_StructVector     *sb;
+   HYPRE_Int               iter, vi, vj;
+
+   if (zero_guess)
+   {
+      hypre_SStructPVectorSetConstantValues(x, 0.0);
+   }
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      for (vi = 0; vi < nvars; vi++)
+      {
+         /* b_vi - sum_{vj != vi} A_vi,vj x_vj; x_vj is still zero on the
+          * first sweep for vj > vi when using a zero initial guess */
+         sb = hypre_SStructPVectorSVector(b, vi);
+         for (vj = 0; vj < nvars; vj++)
+         {
+            if ( smatvec_data[vi][vj] && !(zero_guess && (iter == 0) && (vj > vi)) )
+            {
+               if (sb == hypre_SStructPVectorSVector(b, vi))
+               {
+                  sb = hypre_SStructPVectorSVector(t, vi);
+                  hypre_StructCopy(hypre_SStructPVectorSVector(b, vi), sb);
+               }
+               hypre_StructMatvecCompute(smatvec_data[vi][vj], -1.0,
+                                         hypre_SStructPMatrixSMatrix(A, vi, vj),
+                                         hypre_SStructPVectorSVector(x, vj),
+                                         1.0, sb);
+            }
+         }
+
+         hypre_LineRelaxSetZeroGuess(line_relax_data[vi], (zero_guess && (iter == 0)));
+         hypre_LineRelax(line_relax_data[vi], hypre_SStructPMatrixSMatrix(A, vi, vi),
+                         sb, hypre_SStructPVectorSVector(x, vi));
+      }
+   }
 
    return hypre_error_flag;
 }
@@ -80,12 +193,51 @@ hypre_SysPFMGRelaxSetup( void                 *sys_pfmg_relax_vdata,
    HYPRE_Int               relax_type    = (sys_pfmg_relax_data -> relax_type);
    HYPRE_Real              jacobi_weight = (sys_pfmg_relax_data -> jacobi_weight);
 
+   HYPRE_Int               nvars, vi, vj;
+
    if (relax_type == 1)
    {
       hypre_NodeRelaxSetWeight(relax_data, jacobi_weight);
    }
 
-   hypre_NodeRelaxSetup((sys_pfmg_relax_data -> relax_data), A, b, x);
+   hypre_SysPFMGRelaxDestroyLineData(sys_pfmg_relax_data);
+
+   if (relax_type == 4)
+   {
+      nvars = hypre_SStructPMatrixNVars(A);
+      (sys_pfmg_relax_data -> nvars) = nvars;
+      (sys_pfmg_relax_data -> line_relax_data) = hypre_TAlloc(void *, nvars, HYPRE_MEMORY_HOST);
+      (sys_pfmg_relax_data -> smatvec_data) = hypre_TAlloc(void **, nvars, HYPRE_MEMORY_HOST);
+      for (vi = 0; vi < nvars; vi++)
+      {
+         (sys_pfmg_relax_data -> line_relax_data)[vi] =
+            hypre_LineRelaxCreate(sys_pfmg_relax_data -> comm);
+         hypre_LineRelaxSetMaxIter((sys_pfmg_relax_data -> line_relax_data)[vi], 1);
+         hypre_LineRelaxSetLineDir((sys_pfmg_relax_data -> line_relax_data)[vi],
+                                   (sys_pfmg_relax_data -> line_dir));
+         hypre_LineRelaxSetup((sys_pfmg_relax_data -> line_relax_data)[vi],
+                              hypre_SStructPMatrixSMatrix(A, vi, vi),
+                              hypre_SStructPVectorSVector(b, vi),
+                              hypre_SStructPVectorSVector(x, vi));
+
+         (sys_pfmg_relax_data -> smatvec_data)[vi] = hypre_TAlloc(void *, nvars, HYPRE_MEMORY_HOST);
+         for (vj = 0; vj < nvars; vj++)
+         {
+            (sys_pfmg_relax_data -> smatvec_data)[vi][vj] = NULL;
+            if ((vj != vi) && (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL))
+            {
+               (sys_pfmg_relax_data -> smatvec_data)[vi][vj] = hypre_StructMatvecCreate();
+               hypre_StructMatvecSetup((sys_pfmg_relax_data -> smatvec_data)[vi][vj],
+                                       hypre_SStructPMatrixSMatrix(A, vi, vj),
+                                       hypre_SStructPVectorSVector(x, vj));
+            }
+         }
+      }
+   }
+   else
+   {
+      hypre_NodeRelaxSetup((sys_pfmg_relax_data -> relax_data), A, b, x);
+   }
 
    return hypre_error_flag;
 }
@@ -142,6 +294,9 @@ hypre_SysPFMGRelaxSetType( void  *sys_pfmg_relax_vdata,
          hypre_NodeRelaxSetNodeset(relax_data, 1, 4, stride, indices);
       }
       break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+         break;
    }
 
    return hypre_error_flag;
@@ -183,6 +338,17 @@ hypre_SysPFMGRelaxSetPreRelax( void  *sys_pfmg_relax_vdata )
          hypre_NodeRelaxSetNodesetRank(relax_data, 1, 1);
       }
       break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+      {
+         HYPRE_Int  vi;
+
+         for (vi = 0; vi < (sys_pfmg_relax_data -> nvars); vi++)
+         {
+            hypre_LineRelaxSetStartRed((sys_pfmg_relax_data -> line_relax_data)[vi]);
+         }
+      }
+      break;
    }
 
    return hypre_error_flag;
@@ -210,6 +376,17 @@ hypre_SysPFMGRelaxSetPostRelax( void  *sys_pfmg_relax_vdata )
          hypre_NodeRelaxSetNodesetRank(relax_data, 1, 0);
       }
       break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+      {
+         HYPRE_Int  vi;
+
+         for (vi = 0; vi < (sys_pfmg_relax_data -> nvars); vi++)
+         {
+            hypre_LineRelaxSetStartBlack((sys_pfmg_relax_data -> line_relax_data)[vi]);
+         }
+      }
+      break;
    }
 
    return hypre_error_flag;
@@ -239,6 +416,7 @@ hypre_SysPFMGRelaxSetMaxIter( void  *sys_pfmg_relax_vdata,
    hypre_SysPFMGRelaxData *sys_pfmg_relax_data = (hypre_SysPFMGRelaxData *)sys_pfmg_relax_vdata;
 
    hypre_NodeRelaxSetMaxIter((sys_pfmg_relax_data -> relax_data), max_iter);
+   (sys_pfmg_relax_data -> max_iter) = max_iter;
 
    return hypre_error_flag;
 }
@@ -253,6 +431,7 @@ hypre_SysPFMGRelaxSetZeroGuess( void  *sys_pfmg_relax_vdata,
    hypre_SysPFMGRelaxData *sys_pfmg_relax_data = (hypre_SysPFMGRelaxData *)sys_pfmg_relax_vdata;
 
    hypre_NodeRelaxSetZeroGuess((sys_pfmg_relax_data -> relax_data), zero_guess);
+   (sys_pfmg_relax_data -> zero_guess) = zero_guess;
 
    return hypre_error_flag;
 }
@@ -267,6 +446,24 @@ hypre_SysPFMGRelaxSetTempVec( void               *sys_pfmg_relax_vdata,
    hypre_SysPFMGRelaxData *sys_pfmg_relax_data = (hypre_SysPFMGRelaxData *)sys_pfmg_relax_vdata;
 
    hypre_NodeRelaxSetTempVec((sys_pfmg_relax_data -> relax_data), t);
+   hypre_SStructPVectorDestroy(sys_pfmg_relax_data -> t);
+   hypre_SStructPVectorRef(t, &(sys_pfmg_relax_data -> t));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Direction of the lines for zebra line Gauss-Seidel (relax_type 4).  This
+ * must be called before the setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SysPFMGRelaxSetLineDir( void      *sys_pfmg_relax_vdata,
+                              HYPRE_Int  line_dir )
+{
+   hypre_SysPFMGRelaxData *sys_pfmg_relax_data = (hypre_SysPFMGRelaxData *)sys_pfmg_relax_vdata;
+
+   (sys_pfmg_relax_data -> line_dir) = line_dir;
 
    return hypre_error_flag;
 }
@@ -91,6 +91,7 @@ hypre_SysPFMGSetup( void                 *sys_pfmg_vdata,
    hypre_Box            *cbox;
 
    HYPRE_Real           *relax_weights;
+   HYPRE_Int            *line_dirs;
    HYPRE_Real           *mean, *deviation;
    HYPRE_Real            alpha, beta;
    HYPRE_Int             dxyz_flag;
@@ -191,6 +192,7 @@ hypre_SysPFMGSetup( void                 *sys_pfmg_vdata,
    cdir_l = hypre_TAlloc(HYPRE_Int, max_levels, HYPRE_MEMORY_HOST);
    active_l = hypre_TAlloc(HYPRE_Int, max_levels, HYPRE_MEMORY_HOST);
    relax_weights = hypre_CTAlloc(HYPRE_Real, max_levels, HYPRE_MEMORY_HOST);
+   line_dirs = hypre_CTAlloc(HYPRE_Int, max_levels, HYPRE_MEMORY_HOST);
    hypre_SetIndex3(coarsen, 1, 1, 1); /* forces relaxation on finest grid */
    for (l = 0; ; l++)
    {
@@ -210,6 +212,9 @@ hypre_SysPFMGSetup( void                 *sys_pfmg_vdata,
       }
       relax_weights[l] = 2.0/3.0;
 
+      /* line relaxation is along the direction of strongest coupling */
+      line_dirs[l] = hypre_max(cdir, 0);
+
       /* If it's possible to coarsen, change relax_weights */
       beta = 0.0;
       if (cdir != -1)
@@ -466,6 +471,7 @@ hypre_SysPFMGSetup( void                 *sys_pfmg_vdata,
    }
    hypre_SysPFMGRelaxSetType(relax_data_l[0], relax_type);
    hypre_SysPFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   hypre_SysPFMGRelaxSetLineDir(relax_data_l[0], line_dirs[0]);
    hypre_SysPFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -484,6 +490,7 @@ hypre_SysPFMGSetup( void                 *sys_pfmg_vdata,
          }
          hypre_SysPFMGRelaxSetType(relax_data_l[l], relax_type);
          hypre_SysPFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+         hypre_SysPFMGRelaxSetLineDir(relax_data_l[l], line_dirs[l]);
       }
 
       /* change coarsest grid relaxation parameters */
@@ -510,6 +517,7 @@ hypre_SysPFMGSetup( void                 *sys_pfmg_vdata,
       }
    }
    hypre_TFree(relax_weights, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_dirs, HYPRE_MEMORY_HOST);
 
    for (l = 0; l < num_levels; l++)
    {
@@ -240,6 +240,11 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Zebra line Gauss-Seidel (symmetric: RB pre-relaxation, BR
+ *          post-relaxation).  The lines are along the direction of strongest
+ *          coupling on each level.  Lines split between boxes or processes are
+ *          solved with cyclic reduction when the matrix has variable
+ *          coefficients.
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                  HYPRE_Int          relax_type);
@@ -288,6 +293,19 @@ HYPRE_Int HYPRE_StructPFMGSetNumPostRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
                                  HYPRE_Int          skip_relax);
 
+/**
+ * (Optional) Fuse the computation of the residual with its restriction, and
+ * the interpolation of the coarse error with the correction of the solution.
+ * The residual is then only stored at the points that the restriction reads,
+ * and the fine error is not formed, which saves passes over the fine grid
+ * vectors.  Applies to matrices that are not constant coefficient, on the
+ * CPU.  On the finest grid, the residual is not fused when a tolerance is
+ * set, since its norm is needed, and the correction is not fused when the
+ * relative change is checked.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetFuseTransfers(HYPRE_StructSolver solver,
+                                     HYPRE_Int          fuse_transfers);
+
 /*
  * RE-VISIT
  **/
@@ -417,6 +435,15 @@ HYPRE_Int HYPRE_StructSMGSetNumPreRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructSMGSetNumPostRelax(HYPRE_StructSolver solver,
                                    HYPRE_Int          num_post_relax);
 
+/**
+ * (Optional) Fuse the computation of the residual with its restriction, and
+ * the interpolation of the coarse error with the correction of the solution.
+ * See \ref HYPRE_StructPFMGSetFuseTransfers.  The finest grid is only fused
+ * when the base stride is one in all directions.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructSMGSetFuseTransfers(HYPRE_StructSolver solver,
+                                    HYPRE_Int          fuse_transfers);
+
 /**
  * (Optional) Set the amount of logging to do.
  **/
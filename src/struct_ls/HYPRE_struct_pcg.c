@@ -30,6 +30,8 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
 
+   hypre_PCGFunctionsSetInnerProdNonblocking( pcg_functions,
+      hypre_StructKrylovInnerProdStart, hypre_StructKrylovInnerProdWait );
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -250,6 +250,23 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetFuseTransfers( HYPRE_StructSolver solver,
+                                  HYPRE_Int          fuse_transfers )
+{
+   return( hypre_PFMGSetFuseTransfers( (void *) solver, fuse_transfers) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetFuseTransfers( HYPRE_StructSolver solver,
+                                  HYPRE_Int        * fuse_transfers )
+{
+   return( hypre_PFMGGetFuseTransfers( (void *) solver, fuse_transfers) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -185,6 +185,23 @@ HYPRE_StructSMGGetNumPostRelax( HYPRE_StructSolver solver,
    return( hypre_SMGGetNumPostRelax( (void *) solver, num_post_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructSMGSetFuseTransfers( HYPRE_StructSolver solver,
+                                 HYPRE_Int          fuse_transfers )
+{
+   return( hypre_SMGSetFuseTransfers( (void *) solver, fuse_transfers) );
+}
+
+HYPRE_Int
+HYPRE_StructSMGGetFuseTransfers( HYPRE_StructSolver solver,
+                                 HYPRE_Int        * fuse_transfers )
+{
+   return( hypre_SMGGetFuseTransfers( (void *) solver, fuse_transfers) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
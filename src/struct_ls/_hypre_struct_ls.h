@@ -225,6 +225,8 @@ HYPRE_Int HYPRE_StructPFMGSetNumPostRelax ( HYPRE_StructSolver solver , HYPRE_In
 HYPRE_Int HYPRE_StructPFMGGetNumPostRelax ( HYPRE_StructSolver solver , HYPRE_Int *num_post_relax );
 HYPRE_Int HYPRE_StructPFMGSetSkipRelax ( HYPRE_StructSolver solver , HYPRE_Int skip_relax );
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax ( HYPRE_StructSolver solver , HYPRE_Int *skip_relax );
+HYPRE_Int HYPRE_StructPFMGSetFuseTransfers ( HYPRE_StructSolver solver , HYPRE_Int fuse_transfers );
+HYPRE_Int HYPRE_StructPFMGGetFuseTransfers ( HYPRE_StructSolver solver , HYPRE_Int *fuse_transfers );
 HYPRE_Int HYPRE_StructPFMGSetDxyz ( HYPRE_StructSolver solver , HYPRE_Real *dxyz );
 HYPRE_Int HYPRE_StructPFMGSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructPFMGGetLogging ( HYPRE_StructSolver solver , HYPRE_Int *logging );
@@ -254,6 +256,8 @@ HYPRE_Int HYPRE_StructSMGSetNumPreRelax ( HYPRE_StructSolver solver , HYPRE_Int
 HYPRE_Int HYPRE_StructSMGGetNumPreRelax ( HYPRE_StructSolver solver , HYPRE_Int *num_pre_relax );
 HYPRE_Int HYPRE_StructSMGSetNumPostRelax ( HYPRE_StructSolver solver , HYPRE_Int num_post_relax );
 HYPRE_Int HYPRE_StructSMGGetNumPostRelax ( HYPRE_StructSolver solver , HYPRE_Int *num_post_relax );
+HYPRE_Int HYPRE_StructSMGSetFuseTransfers ( HYPRE_StructSolver solver , HYPRE_Int fuse_transfers );
+HYPRE_Int HYPRE_StructSMGGetFuseTransfers ( HYPRE_StructSolver solver , HYPRE_Int *fuse_transfers );
 HYPRE_Int HYPRE_StructSMGSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructSMGGetLogging ( HYPRE_StructSolver solver , HYPRE_Int *logging );
 HYPRE_Int HYPRE_StructSMGSetPrintLevel ( HYPRE_StructSolver solver , HYPRE_Int print_level );
@@ -298,6 +302,17 @@ HYPRE_Int hypre_JacobiGetNumIterations ( void *jacobi_vdata , HYPRE_Int *num_ite
 HYPRE_Int hypre_JacobiSetTempVec ( void *jacobi_vdata , hypre_StructVector *t );
 HYPRE_Int hypre_JacobiGetFinalRelativeResidualNorm ( void *jacobi_vdata , HYPRE_Real *norm );
 
+/* line_relax.c */
+void *hypre_LineRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_LineRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_LineRelaxSetup ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_LineRelax ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_LineRelaxSetMaxIter ( void *relax_vdata , HYPRE_Int max_iter );
+HYPRE_Int hypre_LineRelaxSetZeroGuess ( void *relax_vdata , HYPRE_Int zero_guess );
+HYPRE_Int hypre_LineRelaxSetLineDir ( void *relax_vdata , HYPRE_Int line_dir );
+HYPRE_Int hypre_LineRelaxSetStartRed ( void *relax_vdata );
+HYPRE_Int hypre_LineRelaxSetStartBlack ( void *relax_vdata );
+
 /* pcg_struct.c */
 void *hypre_StructKrylovCAlloc ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
 HYPRE_Int hypre_StructKrylovFree ( void *ptr );
@@ -308,6 +323,8 @@ void *hypre_StructKrylovMatvecCreate ( void *A , void *x );
 HYPRE_Int hypre_StructKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_StructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_StructKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_StructKrylovInnerProdStart ( HYPRE_Int n , void **x , void **y , HYPRE_Real *result , void **request );
+HYPRE_Int hypre_StructKrylovInnerProdWait ( void *request );
 HYPRE_Int hypre_StructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
@@ -371,6 +388,8 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata , HYPRE_Int num_post_rela
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata , HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata , HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata , HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetFuseTransfers ( void *pfmg_vdata , HYPRE_Int fuse_transfers );
+HYPRE_Int hypre_PFMGGetFuseTransfers ( void *pfmg_vdata , HYPRE_Int *fuse_transfers );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata , HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata , HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata , HYPRE_Int *logging );
@@ -393,6 +412,7 @@ HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata , HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata , HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata , HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata , hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxSetLineDir ( void *pfmg_relax_vdata , HYPRE_Int line_dir );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
@@ -482,12 +502,16 @@ HYPRE_Int hypre_StructInterpAssemble ( hypre_StructMatrix *A , hypre_StructMatri
 void *hypre_SemiInterpCreate ( void );
 HYPRE_Int hypre_SemiInterpSetup ( void *interp_vdata , hypre_StructMatrix *P , HYPRE_Int P_stored_as_transpose , hypre_StructVector *xc , hypre_StructVector *e , hypre_Index cindex , hypre_Index findex , hypre_Index stride );
 HYPRE_Int hypre_SemiInterp ( void *interp_vdata , hypre_StructMatrix *P , hypre_StructVector *xc , hypre_StructVector *e );
+HYPRE_Int hypre_SemiInterpCorrect ( void *interp_vdata , hypre_StructMatrix *P , hypre_StructVector *xc , hypre_StructVector *e , hypre_StructVector *x );
 HYPRE_Int hypre_SemiInterpDestroy ( void *interp_vdata );
 
 /* semi_restrict.c */
 void *hypre_SemiRestrictCreate ( void );
 HYPRE_Int hypre_SemiRestrictSetup ( void *restrict_vdata , hypre_StructMatrix *R , HYPRE_Int R_stored_as_transpose , hypre_StructVector *r , hypre_StructVector *rc , hypre_Index cindex , hypre_Index findex , hypre_Index stride );
 HYPRE_Int hypre_SemiRestrict ( void *restrict_vdata , hypre_StructMatrix *R , hypre_StructVector *r , hypre_StructVector *rc );
+HYPRE_Int hypre_SemiRestrictResidualSupported ( hypre_StructMatrix *A );
+HYPRE_Int hypre_SemiRestrictResidualSetup ( void *restrict_vdata , hypre_StructMatrix *A , hypre_StructVector *x );
+HYPRE_Int hypre_SemiRestrictResidual ( void *restrict_vdata , hypre_StructMatrix *R , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *b , hypre_StructVector *r , hypre_StructVector *rc );
 HYPRE_Int hypre_SemiRestrictDestroy ( void *restrict_vdata );
 
 /* semi_setup_rap.c */
@@ -528,6 +552,8 @@ HYPRE_Int hypre_SMGSetNumPreRelax ( void *smg_vdata , HYPRE_Int num_pre_relax );
 HYPRE_Int hypre_SMGGetNumPreRelax ( void *smg_vdata , HYPRE_Int *num_pre_relax );
 HYPRE_Int hypre_SMGSetNumPostRelax ( void *smg_vdata , HYPRE_Int num_post_relax );
 HYPRE_Int hypre_SMGGetNumPostRelax ( void *smg_vdata , HYPRE_Int *num_post_relax );
+HYPRE_Int hypre_SMGSetFuseTransfers ( void *smg_vdata , HYPRE_Int fuse_transfers );
+HYPRE_Int hypre_SMGGetFuseTransfers ( void *smg_vdata , HYPRE_Int *fuse_transfers );
 HYPRE_Int hypre_SMGSetBase ( void *smg_vdata , hypre_Index base_index , hypre_Index base_stride );
 HYPRE_Int hypre_SMGSetLogging ( void *smg_vdata , HYPRE_Int logging );
 HYPRE_Int hypre_SMGGetLogging ( void *smg_vdata , HYPRE_Int *logging );
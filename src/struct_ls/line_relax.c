@@ -0,0 +1,953 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Zebra line Gauss-Seidel relaxation.
+ *
+ * The unknowns are grouped into lines along one grid direction (line_dir),
+ * and the lines are colored red/black in a checkerboard pattern over the
+ * other directions.  A half-sweep relaxes all lines of one color by solving
+ * the tridiagonal systems formed by the diagonal and the two stencil entries
+ * along line_dir.  All other stencil entries are applied to the current
+ * iterate.  For 5-pt (2D) and 7-pt (3D) stencils, lines of one color do not
+ * couple, so this is exact line Gauss-Seidel.
+ *
+ * When every line lies within one box, the tridiagonal systems are factored
+ * at setup.  Each half-sweep computes the residual on the lines of the
+ * color, then does the forward elimination and back substitution one point
+ * along the lines at a time, with the box loop running across all lines of
+ * the color.
+ *
+ * When some line is split between boxes (or processes), or wraps around a
+ * periodic direction, the line systems are solved with cyclic reduction
+ * instead, one solver per point set of each color, so that the solves span
+ * the boxes and processes that share a line.  Cyclic reduction needs
+ * variable coefficients and a periodic length (if any) that is a power of
+ * two.  Otherwise, split lines are relaxed as separate pieces, which see
+ * each other's values from the last exchange of ghost values (block Jacobi
+ * across the split).
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Int               rb_start;    /* 1 = relax red lines first */
+   HYPRE_Int               line_dir;
+
+   hypre_StructMatrix     *A;
+   hypre_StructVector     *b;
+   hypre_StructVector     *x;
+
+   HYPRE_Int               diag_rank;
+   HYPRE_Int               lower_rank;  /* -1 if there is no entry */
+   HYPRE_Int               upper_rank;  /* -1 if there is no entry */
+
+   /* line factors, with the data layout of x */
+   HYPRE_Real             *lower;       /* coupling to the previous point */
+   HYPRE_Real             *upper;       /* eliminated coupling to the next point */
+   HYPRE_Real             *pivot;       /* inverse pivots */
+   hypre_StructVector     *t;           /* residual, then line correction */
+
+   /* cyclic reduction solvers for split lines (NULL if not used) */
+   hypre_StructMatrix     *A_line;
+   void                  **solve_data;  /* indexed by 4*color + set */
+
+   hypre_ComputePkg       *compute_pkg;
+
+   /* log info (always logged) */
+   HYPRE_Int               num_iterations;
+   HYPRE_Int               time_index;
+
+} hypre_LineRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_LineRelaxCreate( MPI_Comm  comm )
+{
+   hypre_LineRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_LineRelaxData,  1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("LineRelax");
+
+   /* set defaults */
+   (relax_data -> max_iter)    = 1000;
+   (relax_data -> zero_guess)  = 0;
+   (relax_data -> rb_start)    = 1;
+   (relax_data -> line_dir)    = 0;
+   (relax_data -> A)           = NULL;
+   (relax_data -> b)           = NULL;
+   (relax_data -> x)           = NULL;
+   (relax_data -> lower)       = NULL;
+   (relax_data -> upper)       = NULL;
+   (relax_data -> pivot)       = NULL;
+   (relax_data -> t)           = NULL;
+   (relax_data -> A_line)      = NULL;
+   (relax_data -> solve_data)  = NULL;
+   (relax_data -> compute_pkg) = NULL;
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ * Free the line factors and solvers
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxDestroyLineData( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+   HYPRE_Int            i;
+
+   hypre_TFree(relax_data -> lower, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(relax_data -> upper, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(relax_data -> pivot, HYPRE_MEMORY_DEVICE);
+   hypre_StructVectorDestroy(relax_data -> t);
+   (relax_data -> t) = NULL;
+
+   if (relax_data -> solve_data)
+   {
+      for (i = 0; i < 8; i++)
+      {
+         if ((relax_data -> solve_data)[i])
+         {
+            hypre_CyclicReductionDestroy((relax_data -> solve_data)[i]);
+         }
+      }
+      hypre_TFree(relax_data -> solve_data, HYPRE_MEMORY_HOST);
+      hypre_StructMatrixDestroy(relax_data -> A_line);
+      (relax_data -> A_line) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxDestroy( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_StructMatrixDestroy(relax_data -> A);
+      hypre_StructVectorDestroy(relax_data -> b);
+      hypre_StructVectorDestroy(relax_data -> x);
+      hypre_LineRelaxDestroyLineData(relax_vdata);
+      hypre_ComputePkgDestroy(relax_data -> compute_pkg);
+
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set up 'stride' and the offsets 'indexes' of the point sets that make up
+ * the lines of one color, and return the number of point sets.  The lines
+ * of color 'color' are those where the sum of the indexes in the directions
+ * other than 'line_dir' has the parity of 'color'.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxColorSets( HYPRE_Int    ndim,
+                          HYPRE_Int    line_dir,
+                          HYPRE_Int    color,
+                          hypre_Index  stride,
+                          hypre_Index *indexes )
+{
+   HYPRE_Int  perp[HYPRE_MAXDIM];
+   HYPRE_Int  nperp, m, p, parity, num_sets;
+
+   hypre_SetIndex(stride, 1);
+   nperp = 0;
+   for (p = 0; p < ndim; p++)
+   {
+      if (p != line_dir)
+      {
+         hypre_IndexD(stride, p) = 2;
+         perp[nperp++] = p;
+      }
+   }
+
+   num_sets = 0;
+   for (m = 0; m < (1 << nperp); m++)
+   {
+      parity = 0;
+      hypre_SetIndex(indexes[num_sets], 0);
+      for (p = 0; p < nperp; p++)
+      {
+         if (m & (1 << p))
+         {
+            hypre_IndexD(indexes[num_sets], perp[p]) = 1;
+            parity++;
+         }
+      }
+      if ((parity % 2) == color)
+      {
+         num_sets++;
+      }
+   }
+
+   return num_sets;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetup( void               *relax_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x )
+{
+   hypre_LineRelaxData   *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   MPI_Comm               comm = (relax_data -> comm);
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_Int              line_dir;
+   HYPRE_Int              diag_rank, lower_rank, upper_rank;
+   hypre_ComputePkg      *compute_pkg;
+   hypre_ComputeInfo     *compute_info;
+   hypre_StructVector    *t;
+   hypre_StructMatrix    *A_line;
+   void                 **solve_data;
+   HYPRE_Int              line_indices[3];
+   HYPRE_Int              periodic, split, split_all;
+
+   hypre_StructGrid      *grid;
+   hypre_StructStencil   *stencil;
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *bbox;
+   hypre_Box             *A_dbox;
+   hypre_Box             *x_dbox;
+   hypre_Index            index, start, loop_size, unit_stride, stride;
+   hypre_Index            set_indexes[4];
+   HYPRE_Int              num_sets, color, s;
+
+   HYPRE_Real            *lower, *upper, *pivot;
+   HYPRE_Real            *lp, *up, *pp;
+   HYPRE_Real            *Adp, *Alp, *Aup;
+   HYPRE_Int              Adv, Alv, Auv;
+   HYPRE_Real             lscale, uscale;
+   HYPRE_Int              data_size, loff, n, i, k;
+
+   /*----------------------------------------------------------
+    * Find the diagonal and the line entries of the stencil
+    *----------------------------------------------------------*/
+
+   grid    = hypre_StructMatrixGrid(A);
+   stencil = hypre_StructMatrixStencil(A);
+
+   line_dir = hypre_min(hypre_max((relax_data -> line_dir), 0), ndim - 1);
+
+   hypre_SetIndex(index, 0);
+   diag_rank = hypre_StructStencilElementRank(stencil, index);
+   hypre_IndexD(index, line_dir) = -1;
+   lower_rank = hypre_StructStencilElementRank(stencil, index);
+   hypre_IndexD(index, line_dir) = 1;
+   upper_rank = hypre_StructStencilElementRank(stencil, index);
+
+   /*----------------------------------------------------------
+    * Set up the compute package
+    *----------------------------------------------------------*/
+
+   hypre_CreateComputeInfo(grid, stencil, &compute_info);
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+                          grid, &compute_pkg);
+
+   /*----------------------------------------------------------
+    * Check for lines that do not end at the box boundaries
+    *----------------------------------------------------------*/
+
+   boxes = hypre_StructGridBoxes(grid);
+
+   /* cyclic reduction halves a periodic direction on every level */
+   periodic = hypre_IndexD(hypre_StructGridPeriodic(grid), line_dir);
+
+   split_all = 0;
+   if ((constant_coefficient == 0) && (lower_rank > -1) && (upper_rank > -1) &&
+       ((periodic & (periodic - 1)) == 0))
+   {
+      bbox  = hypre_StructGridBoundingBox(grid);
+      split = (periodic > 0);
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+         if ( (hypre_BoxVolume(box) > 0) &&
+              ((hypre_BoxIMinD(box, line_dir) > hypre_BoxIMinD(bbox, line_dir)) ||
+               (hypre_BoxIMaxD(box, line_dir) < hypre_BoxIMaxD(bbox, line_dir))) )
+         {
+            split = 1;
+         }
+      }
+      hypre_MPI_Allreduce(&split, &split_all, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   }
+
+   /*----------------------------------------------------------
+    * Set up the line solves
+    *----------------------------------------------------------*/
+
+   hypre_LineRelaxDestroyLineData(relax_vdata);
+
+   /* t has the data layout of x, so it can share its box offsets */
+   t = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(t, hypre_StructVectorNumGhost(x));
+   hypre_StructVectorInitialize(t);
+   hypre_StructVectorAssemble(t);
+
+   lower = NULL;
+   upper = NULL;
+   pivot = NULL;
+   A_line = NULL;
+   solve_data = NULL;
+
+   if (split_all)
+   {
+      line_indices[0] = diag_rank;
+      line_indices[1] = lower_rank;
+      line_indices[2] = upper_rank;
+      A_line = hypre_StructMatrixCreateMask(A, 3, line_indices);
+
+      solve_data = hypre_CTAlloc(void *, 8, HYPRE_MEMORY_HOST);
+      for (color = 0; color < 2; color++)
+      {
+         num_sets = hypre_LineRelaxColorSets(ndim, line_dir, color,
+                                             stride, set_indexes);
+         for (s = 0; s < num_sets; s++)
+         {
+            solve_data[4*color + s] = hypre_CyclicReductionCreate(comm);
+            hypre_CyclicReductionSetCDir(solve_data[4*color + s], line_dir);
+            hypre_CyclicReductionSetBase(solve_data[4*color + s],
+                                         set_indexes[s], stride);
+            hypre_CyclicReductionSetup(solve_data[4*color + s], A_line, t, t);
+         }
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Factor the line systems (Thomas algorithm without pivoting)
+    *----------------------------------------------------------*/
+
+   if (!split_all)
+   {
+      data_size = hypre_StructVectorDataSize(x);
+      lower = hypre_CTAlloc(HYPRE_Real, data_size, HYPRE_MEMORY_DEVICE);
+      upper = hypre_CTAlloc(HYPRE_Real, data_size, HYPRE_MEMORY_DEVICE);
+      pivot = hypre_CTAlloc(HYPRE_Real, data_size, HYPRE_MEMORY_DEVICE);
+
+      /* constant entries are read at index 0 (Av = 0), missing entries are
+       * replaced by the diagonal scaled by 0 */
+      Adv = (constant_coefficient == 1) ? 0 : 1;
+      Alv = (constant_coefficient == 0) ? 1 : 0;
+      Auv = (constant_coefficient == 0) ? 1 : 0;
+
+      hypre_SetIndex(unit_stride, 1);
+      hypre_ForBoxI(i, boxes)
+      {
+         box    = hypre_BoxArrayBox(boxes, i);
+         A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+         if (hypre_BoxVolume(box) == 0)
+         {
+            continue;
+         }
+
+         lp = lower + hypre_StructVectorDataIndices(x)[i];
+         up = upper + hypre_StructVectorDataIndices(x)[i];
+         pp = pivot + hypre_StructVectorDataIndices(x)[i];
+
+         Adp = hypre_StructMatrixBoxData(A, i, diag_rank);
+         Alp = (lower_rank > -1) ? hypre_StructMatrixBoxData(A, i, lower_rank) : Adp;
+         Aup = (upper_rank > -1) ? hypre_StructMatrixBoxData(A, i, upper_rank) : Adp;
+
+         hypre_SetIndex(index, 0);
+         hypre_IndexD(index, line_dir) = 1;
+         loff = hypre_BoxOffsetDistance(x_dbox, index);
+
+         hypre_BoxGetSize(box, loop_size);
+         n = hypre_IndexD(loop_size, line_dir);
+         hypre_IndexD(loop_size, line_dir) = 1;
+         hypre_CopyIndex(hypre_BoxIMin(box), start);
+
+         for (k = 0; k < n; k++)
+         {
+            hypre_IndexD(start, line_dir) = hypre_BoxIMinD(box, line_dir) + k;
+
+            /* the line ends at the box boundary */
+            lscale = ((k > 0) && (lower_rank > -1)) ? 1.0 : 0.0;
+            uscale = ((k < n-1) && (upper_rank > -1)) ? 1.0 : 0.0;
+
+#define DEVICE_VAR is_device_ptr(lp,up,pp,Adp,Alp,Aup)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                A_dbox, start, unit_stride, Ai,
+                                x_dbox, start, unit_stride, xi);
+            {
+               HYPRE_Real  a = lscale * Alp[Alv*Ai];
+               HYPRE_Real  m = Adp[Adv*Ai];
+
+               if (lscale > 0.0)
+               {
+                  m -= a * up[xi - loff];
+               }
+               lp[xi] = a;
+               pp[xi] = 1.0 / m;
+               up[xi] = uscale * Aup[Auv*Ai] / m;
+            }
+            hypre_BoxLoop2End(Ai, xi);
+#undef DEVICE_VAR
+         }
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Set up the relax data structure
+    *----------------------------------------------------------*/
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   hypre_ComputePkgDestroy(relax_data -> compute_pkg);
+
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+   (relax_data -> x) = hypre_StructVectorRef(x);
+   (relax_data -> b) = hypre_StructVectorRef(b);
+   (relax_data -> line_dir)    = line_dir;
+   (relax_data -> diag_rank)   = diag_rank;
+   (relax_data -> lower_rank)  = lower_rank;
+   (relax_data -> upper_rank)  = upper_rank;
+   (relax_data -> lower)       = lower;
+   (relax_data -> upper)       = upper;
+   (relax_data -> pivot)       = pivot;
+   (relax_data -> t)           = t;
+   (relax_data -> A_line)      = A_line;
+   (relax_data -> solve_data)  = solve_data;
+   (relax_data -> compute_pkg) = compute_pkg;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelax( void               *relax_vdata,
+                 hypre_StructMatrix *A,
+                 hypre_StructVector *b,
+                 hypre_StructVector *x )
+{
+   hypre_LineRelaxData   *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   HYPRE_Int              max_iter    = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess  = (relax_data -> zero_guess);
+   HYPRE_Int              rb_start    = (relax_data -> rb_start);
+   HYPRE_Int              line_dir    = (relax_data -> line_dir);
+   HYPRE_Real            *lower       = (relax_data -> lower);
+   HYPRE_Real            *upper       = (relax_data -> upper);
+   HYPRE_Real            *pivot       = (relax_data -> pivot);
+   hypre_StructVector    *t           = (relax_data -> t);
+   hypre_StructMatrix    *A_line      = (relax_data -> A_line);
+   void                 **solve_data  = (relax_data -> solve_data);
+   hypre_ComputePkg      *compute_pkg = (relax_data -> compute_pkg);
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+
+   hypre_CommHandle      *comm_handle;
+
+   hypre_BoxArrayArray   *compute_box_aa;
+   hypre_BoxArray        *compute_box_a;
+   hypre_BoxArray        *boxes;
+   hypre_Box             *compute_box;
+   hypre_Box             *box;
+   hypre_Box             *set_box;
+
+   hypre_Box             *A_dbox;
+   hypre_Box             *b_dbox;
+   hypre_Box             *x_dbox;
+
+   HYPRE_Real            *Ap0, *Ap1, *Ap2;
+   HYPRE_Real            *bp;
+   HYPRE_Real            *xp;
+   HYPRE_Real            *wp, *lp, *up, *pp;
+   HYPRE_Real             AA;
+   HYPRE_Int              xoff0, xoff1, xoff2;
+   HYPRE_Int              loff;
+
+   hypre_Index            index, start, stride, loop_size;
+   hypre_Index            set_indexes[4];
+   HYPRE_Int              num_sets;
+
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+   HYPRE_Int             *entries;
+   HYPRE_Int              num_entries;
+
+   HYPRE_Int              iter, rb, color, s, si, depth, n, k;
+   HYPRE_Int              compute_i, i, j;
+
+   /*----------------------------------------------------------
+    * Initialize some things and deal with special cases
+    *----------------------------------------------------------*/
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+   (relax_data -> x) = hypre_StructVectorRef(x);
+   (relax_data -> b) = hypre_StructVectorRef(b);
+
+   (relax_data -> num_iterations) = 0;
+
+   /* if using a zero initial guess, set x to zero */
+   if (zero_guess)
+   {
+      hypre_StructVectorSetConstantValues(x, 0.0);
+   }
+
+   /* if max_iter is zero, return */
+   if (max_iter == 0)
+   {
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+
+   /* variable entries first, then constant entries */
+   entries = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   num_entries = 0;
+   for (s = 0; s < stencil_size; s++)
+   {
+      if ( (constant_coefficient == 0) ||
+           ((constant_coefficient == 2) && (s == (relax_data -> diag_rank))) )
+      {
+         entries[num_entries++] = s;
+      }
+   }
+   k = num_entries;
+   for (s = 0; s < stencil_size; s++)
+   {
+      if ( (constant_coefficient == 1) ||
+           ((constant_coefficient == 2) && (s != (relax_data -> diag_rank))) )
+      {
+         entries[k++] = s;
+      }
+   }
+
+   set_box = hypre_BoxCreate(ndim);
+   boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+
+   /*----------------------------------------------------------
+    * Do the half-sweeps
+    *----------------------------------------------------------*/
+
+   rb = rb_start;
+   for (iter = 0; iter < 2*max_iter; iter++)
+   {
+      color = (rb + 1) % 2;
+      num_sets = hypre_LineRelaxColorSets(ndim, line_dir, color,
+                                          stride, set_indexes);
+
+      /*-------------------------------------------------------
+       * Compute the residual on the lines of this color
+       *-------------------------------------------------------*/
+
+      for (compute_i = 0; compute_i < 2; compute_i++)
+      {
+         switch(compute_i)
+         {
+            case 0:
+            {
+               if (!(zero_guess && (iter == 0)))
+               {
+                  xp = hypre_StructVectorData(x);
+                  hypre_InitializeIndtComputations(compute_pkg, xp, &comm_handle);
+               }
+               compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+            }
+            break;
+
+            case 1:
+            {
+               if (!(zero_guess && (iter == 0)))
+               {
+                  hypre_FinalizeIndtComputations(comm_handle);
+               }
+               compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+            }
+            break;
+         }
+
+         hypre_ForBoxArrayI(i, compute_box_aa)
+         {
+            compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+            A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+            b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+            bp = hypre_StructVectorBoxData(b, i);
+            xp = hypre_StructVectorBoxData(x, i);
+            wp = hypre_StructVectorBoxData(t, i);
+
+            hypre_ForBoxI(j, compute_box_a)
+            {
+               compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+               for (s = 0; s < num_sets; s++)
+               {
+                  hypre_CopyBox(compute_box, set_box);
+                  hypre_ProjectBox(set_box, set_indexes[s], stride);
+                  if (hypre_BoxVolume(set_box) == 0)
+                  {
+                     continue;
+                  }
+                  hypre_CopyIndex(hypre_BoxIMin(set_box), start);
+                  hypre_BoxGetStrideSize(set_box, stride, loop_size);
+
+#define DEVICE_VAR is_device_ptr(wp,bp)
+                  hypre_BoxLoop2Begin(ndim, loop_size,
+                                      b_dbox, start, stride, bi,
+                                      x_dbox, start, stride, wi);
+                  {
+                     wp[wi] = bp[bi];
+                  }
+                  hypre_BoxLoop2End(bi, wi);
+#undef DEVICE_VAR
+
+                  if (zero_guess && (iter == 0))
+                  {
+                     continue;
+                  }
+
+                  /* variable entries, up to three at a time */
+                  for (si = 0; si < num_entries; si += depth)
+                  {
+                     depth = hypre_min(3, (num_entries - si));
+
+                     Ap0 = hypre_StructMatrixBoxData(A, i, entries[si]);
+                     xoff0 = hypre_BoxOffsetDistance(
+                        x_dbox, stencil_shape[entries[si]]);
+                     if (depth > 1)
+                     {
+                        Ap1 = hypre_StructMatrixBoxData(A, i, entries[si+1]);
+                        xoff1 = hypre_BoxOffsetDistance(
+                           x_dbox, stencil_shape[entries[si+1]]);
+                     }
+                     if (depth > 2)
+                     {
+                        Ap2 = hypre_StructMatrixBoxData(A, i, entries[si+2]);
+                        xoff2 = hypre_BoxOffsetDistance(
+                           x_dbox, stencil_shape[entries[si+2]]);
+                     }
+
+                     switch(depth)
+                     {
+                        case 3:
+#define DEVICE_VAR is_device_ptr(wp,Ap0,Ap1,Ap2,xp)
+                           hypre_BoxLoop2Begin(ndim, loop_size,
+                                               A_dbox, start, stride, Ai,
+                                               x_dbox, start, stride, xi);
+                           {
+                              wp[xi] -=
+                                 Ap0[Ai] * xp[xi + xoff0] +
+                                 Ap1[Ai] * xp[xi + xoff1] +
+                                 Ap2[Ai] * xp[xi + xoff2];
+                           }
+                           hypre_BoxLoop2End(Ai, xi);
+#undef DEVICE_VAR
+                           break;
+
+                        case 2:
+#define DEVICE_VAR is_device_ptr(wp,Ap0,Ap1,xp)
+                           hypre_BoxLoop2Begin(ndim, loop_size,
+                                               A_dbox, start, stride, Ai,
+                                               x_dbox, start, stride, xi);
+                           {
+                              wp[xi] -=
+                                 Ap0[Ai] * xp[xi + xoff0] +
+                                 Ap1[Ai] * xp[xi + xoff1];
+                           }
+                           hypre_BoxLoop2End(Ai, xi);
+#undef DEVICE_VAR
+                           break;
+
+                        case 1:
+#define DEVICE_VAR is_device_ptr(wp,Ap0,xp)
+                           hypre_BoxLoop2Begin(ndim, loop_size,
+                                               A_dbox, start, stride, Ai,
+                                               x_dbox, start, stride, xi);
+                           {
+                              wp[xi] -= Ap0[Ai] * xp[xi + xoff0];
+                           }
+                           hypre_BoxLoop2End(Ai, xi);
+#undef DEVICE_VAR
+                           break;
+                     }
+                  }
+
+                  /* constant entries */
+                  for (si = num_entries; si < stencil_size; si++)
+                  {
+                     Ap0 = hypre_StructMatrixBoxData(A, i, entries[si]);
+                     AA = Ap0[hypre_CCBoxIndexRank(A_dbox, start)];
+                     xoff0 = hypre_BoxOffsetDistance(
+                        x_dbox, stencil_shape[entries[si]]);
+
+#define DEVICE_VAR is_device_ptr(wp,xp)
+                     hypre_BoxLoop1Begin(ndim, loop_size,
+                                         x_dbox, start, stride, xi);
+                     {
+                        wp[xi] -= AA * xp[xi + xoff0];
+                     }
+                     hypre_BoxLoop1End(xi);
+#undef DEVICE_VAR
+                  }
+               }
+            }
+         }
+      }
+
+      /*-------------------------------------------------------
+       * Solve for the line corrections and update x
+       *-------------------------------------------------------*/
+
+      if (solve_data)
+      {
+         for (s = 0; s < num_sets; s++)
+         {
+            hypre_CyclicReduction(solve_data[4*color + s], A_line, t, t);
+         }
+
+         hypre_ForBoxI(i, boxes)
+         {
+            box    = hypre_BoxArrayBox(boxes, i);
+            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+            xp = hypre_StructVectorBoxData(x, i);
+            wp = hypre_StructVectorBoxData(t, i);
+
+            for (s = 0; s < num_sets; s++)
+            {
+               hypre_CopyBox(box, set_box);
+               hypre_ProjectBox(set_box, set_indexes[s], stride);
+               if (hypre_BoxVolume(set_box) == 0)
+               {
+                  continue;
+               }
+               hypre_CopyIndex(hypre_BoxIMin(set_box), start);
+               hypre_BoxGetStrideSize(set_box, stride, loop_size);
+
+#define DEVICE_VAR is_device_ptr(xp,wp)
+               hypre_BoxLoop1Begin(ndim, loop_size,
+                                   x_dbox, start, stride, xi);
+               {
+                  xp[xi] += wp[xi];
+               }
+               hypre_BoxLoop1End(xi);
+#undef DEVICE_VAR
+            }
+         }
+      }
+      else
+      {
+         hypre_ForBoxI(i, boxes)
+         {
+            box    = hypre_BoxArrayBox(boxes, i);
+            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+            xp = hypre_StructVectorBoxData(x, i);
+            wp = hypre_StructVectorBoxData(t, i);
+            lp = lower + hypre_StructVectorDataIndices(x)[i];
+            up = upper + hypre_StructVectorDataIndices(x)[i];
+            pp = pivot + hypre_StructVectorDataIndices(x)[i];
+
+            hypre_SetIndex(index, 0);
+            hypre_IndexD(index, line_dir) = 1;
+            loff = hypre_BoxOffsetDistance(x_dbox, index);
+
+            for (s = 0; s < num_sets; s++)
+            {
+               hypre_CopyBox(box, set_box);
+               hypre_ProjectBox(set_box, set_indexes[s], stride);
+               if (hypre_BoxVolume(set_box) == 0)
+               {
+                  continue;
+               }
+               hypre_CopyIndex(hypre_BoxIMin(set_box), start);
+               hypre_BoxGetStrideSize(set_box, stride, loop_size);
+               n = hypre_IndexD(loop_size, line_dir);
+               hypre_IndexD(loop_size, line_dir) = 1;
+
+               /* forward elimination */
+               for (k = 0; k < n; k++)
+               {
+                  hypre_IndexD(start, line_dir) = hypre_BoxIMinD(set_box, line_dir) + k;
+
+                  if (k == 0)
+                  {
+#define DEVICE_VAR is_device_ptr(wp,pp)
+                     hypre_BoxLoop1Begin(ndim, loop_size,
+                                         x_dbox, start, stride, xi);
+                     {
+                        wp[xi] *= pp[xi];
+                     }
+                     hypre_BoxLoop1End(xi);
+#undef DEVICE_VAR
+                  }
+                  else
+                  {
+#define DEVICE_VAR is_device_ptr(wp,lp,pp)
+                     hypre_BoxLoop1Begin(ndim, loop_size,
+                                         x_dbox, start, stride, xi);
+                     {
+                        wp[xi] = (wp[xi] - lp[xi] * wp[xi - loff]) * pp[xi];
+                     }
+                     hypre_BoxLoop1End(xi);
+#undef DEVICE_VAR
+                  }
+               }
+
+               /* back substitution and update */
+               for (k = n - 1; k > -1; k--)
+               {
+                  hypre_IndexD(start, line_dir) = hypre_BoxIMinD(set_box, line_dir) + k;
+
+                  if (k == n - 1)
+                  {
+#define DEVICE_VAR is_device_ptr(xp,wp)
+                     hypre_BoxLoop1Begin(ndim, loop_size,
+                                         x_dbox, start, stride, xi);
+                     {
+                        xp[xi] += wp[xi];
+                     }
+                     hypre_BoxLoop1End(xi);
+#undef DEVICE_VAR
+                  }
+                  else
+                  {
+#define DEVICE_VAR is_device_ptr(xp,wp,up)
+                     hypre_BoxLoop1Begin(ndim, loop_size,
+                                         x_dbox, start, stride, xi);
+                     {
+                        wp[xi] -= up[xi] * wp[xi + loff];
+                        xp[xi] += wp[xi];
+                     }
+                     hypre_BoxLoop1End(xi);
+#undef DEVICE_VAR
+                  }
+               }
+            }
+         }
+      }
+
+      rb = (rb + 1) % 2;
+   }
+
+   (relax_data -> num_iterations) = max_iter;
+
+   hypre_BoxDestroy(set_box);
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetMaxIter( void      *relax_vdata,
+                           HYPRE_Int  max_iter )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetZeroGuess( void      *relax_vdata,
+                             HYPRE_Int  zero_guess )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set the direction of the lines.  This must be called before the setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetLineDir( void      *relax_vdata,
+                           HYPRE_Int  line_dir )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> line_dir) = line_dir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetStartRed( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> rb_start) = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetStartBlack( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> rb_start) = 0;
+
+   return hypre_error_flag;
+}
@@ -138,6 +138,49 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdStart( HYPRE_Int    n,
+                                  void       **x,
+                                  void       **y,
+                                  HYPRE_Real  *result,
+                                  void       **request )
+{
+   MPI_Comm           comm = hypre_StructVectorComm((hypre_StructVector *) x[0]);
+   hypre_MPI_Request *req;
+   HYPRE_Int          k;
+
+   for (k = 0; k < n; k++)
+   {
+      result[k] = hypre_StructInnerProdLocal( (hypre_StructVector *) x[k],
+                                              (hypre_StructVector *) y[k] );
+   }
+
+   req = hypre_CTAlloc(hypre_MPI_Request, 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, req);
+   *request = (void *) req;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdWait( void *request )
+{
+   hypre_MPI_Request *req = (hypre_MPI_Request *) request;
+   hypre_MPI_Status   status;
+
+   hypre_MPI_Wait(req, &status);
+   hypre_TFree(req, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
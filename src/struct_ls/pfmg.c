@@ -37,6 +37,7 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)    = 1;
    (pfmg_data -> num_post_relax)   = 1;
    (pfmg_data -> skip_relax)       = 1;
+   (pfmg_data -> fuse_transfers)   = 0;
    (pfmg_data -> logging)          = 0;
    (pfmg_data -> print_level)      = 0;
 
@@ -109,6 +110,7 @@ hypre_PFMGDestroy( void *pfmg_vdata )
 
           hypre_TFree(pfmg_data -> cdir_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> active_l, HYPRE_MEMORY_HOST);
+         hypre_TFree(pfmg_data -> fuse_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> grid_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> P_grid_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> A_l, HYPRE_MEMORY_HOST);
@@ -404,6 +406,31 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetFuseTransfers( void *pfmg_vdata,
+                            HYPRE_Int  fuse_transfers )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> fuse_transfers) = fuse_transfers;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetFuseTransfers( void *pfmg_vdata,
+                            HYPRE_Int *fuse_transfers )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *fuse_transfers = (pfmg_data -> fuse_transfers);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -36,6 +36,7 @@ typedef struct
    HYPRE_Int             num_pre_relax;  /* number of pre relaxation sweeps */
    HYPRE_Int             num_post_relax; /* number of post relaxation sweeps */
    HYPRE_Int             skip_relax;     /* flag to allow skipping relaxation */
+   HYPRE_Int             fuse_transfers; /* flag for fused grid transfers */
    HYPRE_Real            relax_weight;
    HYPRE_Real            dxyz[3];     /* parameters used to determine cdir */
 
@@ -43,6 +44,7 @@ typedef struct
 
    HYPRE_Int            *cdir_l;  /* coarsening directions */
    HYPRE_Int            *active_l;  /* flags to relax on level l*/
+   HYPRE_Int            *fuse_l;  /* flags to fuse grid transfers on level l */
 
    hypre_StructGrid    **grid_l;
    hypre_StructGrid    **P_grid_l;
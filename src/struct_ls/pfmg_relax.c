@@ -14,6 +14,7 @@ typedef struct
 {
    void                   *relax_data;
    void                   *rb_relax_data;
+   void                   *line_relax_data;
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
 
@@ -30,6 +31,7 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    pfmg_relax_data = hypre_CTAlloc(hypre_PFMGRelaxData,  1, HYPRE_MEMORY_HOST);
    (pfmg_relax_data -> relax_data) = hypre_PointRelaxCreate(comm);
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
+   (pfmg_relax_data -> line_relax_data) = hypre_LineRelaxCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
 
@@ -48,6 +50,7 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_LineRelaxDestroy(pfmg_relax_data -> line_relax_data);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -85,6 +88,9 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
           
+         break;
+      case 4:
+         hypre_LineRelax((pfmg_relax_data -> line_relax_data), A, b, x);
          break;
    }
 
@@ -114,6 +120,9 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+         hypre_LineRelaxSetup((pfmg_relax_data -> line_relax_data), A, b, x);
+         break;
    }
 
    if (relax_type==1)
@@ -154,6 +163,7 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
 
       case 2: /* Red-Black Gauss-Seidel */
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
+      case 4: /* Zebra line Gauss-Seidel */
          break;
    }
 
@@ -196,6 +206,10 @@ hypre_PFMGRelaxSetPreRelax( void  *pfmg_relax_vdata )
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
          break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+         hypre_LineRelaxSetStartRed((pfmg_relax_data -> line_relax_data));
+         break;
    }
 
    return hypre_error_flag;
@@ -223,6 +237,10 @@ hypre_PFMGRelaxSetPostRelax( void  *pfmg_relax_vdata )
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
          break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+         hypre_LineRelaxSetStartBlack((pfmg_relax_data -> line_relax_data));
+         break;
    }
 
    return hypre_error_flag;
@@ -254,6 +272,7 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   hypre_LineRelaxSetMaxIter((pfmg_relax_data -> line_relax_data), max_iter);
 
    return hypre_error_flag;
 }
@@ -269,6 +288,7 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   hypre_LineRelaxSetZeroGuess((pfmg_relax_data -> line_relax_data), zero_guess);
 
    return hypre_error_flag;
 }
@@ -287,3 +307,20 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGRelaxSetLineDir
+ *
+ * Direction of the lines for zebra line Gauss-Seidel (relax_type 4)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetLineDir( void      *pfmg_relax_vdata,
+                           HYPRE_Int  line_dir )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_LineRelaxSetLineDir((pfmg_relax_data -> line_relax_data), line_dir);
+
+   return hypre_error_flag;
+}
@@ -73,6 +73,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight= (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             fuse_transfers    = (pfmg_data -> fuse_transfers);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
 
@@ -89,6 +90,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    HYPRE_Int            *cdir_l;
    HYPRE_Int            *active_l;
+   HYPRE_Int            *fuse_l;
    hypre_StructGrid    **grid_l;
    hypre_StructGrid    **P_grid_l;
 
@@ -97,6 +99,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             data_size = 0;
    HYPRE_Int             data_size_const = 0;
    HYPRE_Real           *relax_weights;
+   HYPRE_Int            *line_dirs;
    HYPRE_Real           *mean, *deviation;
    HYPRE_Real            alpha, beta;
 
@@ -195,6 +198,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    cdir_l = hypre_TAlloc(HYPRE_Int, max_levels, HYPRE_MEMORY_HOST);
    active_l = hypre_TAlloc(HYPRE_Int, max_levels, HYPRE_MEMORY_HOST);
    relax_weights = hypre_CTAlloc(HYPRE_Real, max_levels, HYPRE_MEMORY_HOST);
+   line_dirs = hypre_CTAlloc(HYPRE_Int, max_levels, HYPRE_MEMORY_HOST);
    hypre_SetIndex3(coarsen, 1, 1, 1); /* forces relaxation on finest grid */
 
 #if defined(HYPRE_USING_CUDA)
@@ -228,6 +232,9 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       }
       relax_weights[l] = 1.0;
 
+      /* line relaxation is along the direction of strongest coupling */
+      line_dirs[l] = hypre_max(cdir, 0);
+
       /* If it's possible to coarsen, change relax_weights */
       beta = 0.0;
       if (cdir != -1)
@@ -577,6 +584,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    matvec_data_l   = hypre_TAlloc(void *, num_levels, HYPRE_MEMORY_HOST);
    restrict_data_l = hypre_TAlloc(void *, num_levels, HYPRE_MEMORY_HOST);
    interp_data_l   = hypre_TAlloc(void *, num_levels, HYPRE_MEMORY_HOST);
+   fuse_l          = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
 
    for (l = 0; l < (num_levels - 1); l++)
    {
@@ -616,6 +624,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       restrict_data_l[l] = hypre_SemiRestrictCreate();
       hypre_SemiRestrictSetup(restrict_data_l[l], RT_l[l], 1, r_l[l], b_l[l+1],
                               cindex, findex, stride);
+
+      /* set up the fused residual and restriction */
+      if (fuse_transfers && hypre_SemiRestrictResidualSupported(A_l[l]))
+      {
+         hypre_SemiRestrictResidualSetup(restrict_data_l[l], A_l[l], x_l[l]);
+         fuse_l[l] = 1;
+      }
    }
 
 #if defined(HYPRE_USING_CUDA)
@@ -659,6 +674,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   hypre_PFMGRelaxSetLineDir(relax_data_l[0], line_dirs[0]);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -679,6 +695,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+            hypre_PFMGRelaxSetLineDir(relax_data_l[l], line_dirs[l]);
          }
       }
 
@@ -710,6 +727,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       }
    }
    hypre_TFree(relax_weights, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_dirs, HYPRE_MEMORY_HOST);
 
    for (l = 0; l < num_levels; l++)
    {
@@ -719,6 +737,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
 
    (pfmg_data -> active_l)        = active_l;
+   (pfmg_data -> fuse_l)          = fuse_l;
    (pfmg_data -> relax_data_l)    = relax_data_l;
    (pfmg_data -> matvec_data_l)   = matvec_data_l;
    (pfmg_data -> restrict_data_l) = restrict_data_l;
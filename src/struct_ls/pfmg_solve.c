@@ -42,6 +42,7 @@ hypre_PFMGSolve( void               *pfmg_vdata,
    HYPRE_Int             num_pre_relax   = (pfmg_data -> num_pre_relax);
    HYPRE_Int             num_post_relax  = (pfmg_data -> num_post_relax);
    HYPRE_Int             num_levels      = (pfmg_data -> num_levels);
+   HYPRE_Int            *fuse_l          = (pfmg_data -> fuse_l);
    hypre_StructMatrix  **A_l             = (pfmg_data -> A_l);
    hypre_StructMatrix  **P_l             = (pfmg_data -> P_l);
    hypre_StructMatrix  **RT_l            = (pfmg_data -> RT_l);
@@ -63,6 +64,7 @@ hypre_PFMGSolve( void               *pfmg_vdata,
 
    HYPRE_Int             i, l;
    HYPRE_Int             constant_coefficient;
+   HYPRE_Int             fuse_residual, fuse_correction;
 
 #if DEBUG
    char                  filename[255];
@@ -76,6 +78,10 @@ hypre_PFMGSolve( void               *pfmg_vdata,
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
 
+   /* the fine grid residual and error are needed by the convergence check */
+   fuse_residual   = (fuse_l[0] && !(tol > 0.0));
+   fuse_correction = (fuse_l[0] && !((tol > 0.0) && (rel_change)));
+
    hypre_StructMatrixDestroy(A_l[0]);
    hypre_StructVectorDestroy(b_l[0]);
    hypre_StructVectorDestroy(x_l[0]);
@@ -149,10 +155,13 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       hypre_PFMGRelax(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
       zero_guess = 0;
 
-      /* compute fine grid residual (b - Ax) */
-      hypre_StructCopy(b_l[0], r_l[0]);
-      hypre_StructMatvecCompute(matvec_data_l[0],
-                                -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      /* compute fine grid residual (b - Ax), unless fused with restriction */
+      if (!fuse_residual)
+      {
+         hypre_StructCopy(b_l[0], r_l[0]);
+         hypre_StructMatvecCompute(matvec_data_l[0],
+                                   -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      }
 
       /* convergence check */
       if (tol > 0.0)
@@ -186,7 +195,15 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       if (num_levels > 1)
       {
          /* restrict fine grid residual */
-         hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         if (fuse_residual)
+         {
+            hypre_SemiRestrictResidual(restrict_data_l[0], RT_l[0], A_l[0],
+                                       x_l[0], b_l[0], r_l[0], b_l[1]);
+         }
+         else
+         {
+            hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         }
 #if DEBUG
          hypre_sprintf(filename, "zout_xdown.%02d", 0);
          hypre_StructVectorPrint(filename, x_l[0], 0);
@@ -220,10 +237,13 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
                hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
-               /* compute residual (b - Ax) */
-               hypre_StructCopy(b_l[l], r_l[l]);
-               hypre_StructMatvecCompute(matvec_data_l[l],
-                                         -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+               /* compute residual (b - Ax), unless fused with restriction */
+               if (!fuse_l[l])
+               {
+                  hypre_StructCopy(b_l[l], r_l[l]);
+                  hypre_StructMatvecCompute(matvec_data_l[l],
+                                            -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+               }
             }
             else
             {
@@ -233,7 +253,15 @@ hypre_PFMGSolve( void               *pfmg_vdata,
             }
 
             /* restrict residual */
-            hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l+1]);
+            if (fuse_l[l] && active_l[l])
+            {
+               hypre_SemiRestrictResidual(restrict_data_l[l], RT_l[l], A_l[l],
+                                          x_l[l], b_l[l], r_l[l], b_l[l+1]);
+            }
+            else
+            {
+               hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l+1]);
+            }
 #if DEBUG
             hypre_printf("Level %d: b_l = %.30e\n",l+1, hypre_StructInnerProd(b_l[l+1], b_l[l+1]));
             hypre_sprintf(filename, "zout_xdown.%02d", l);
@@ -284,8 +312,16 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_StructVectorClearAllValues(e_l[l]);
             }
             /* interpolate error and correct (x = x + Pe_c) */
-            hypre_SemiInterp(interp_data_l[l], P_l[l], x_l[l+1], e_l[l]);
-            hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            if (fuse_l[l])
+            {
+               hypre_SemiInterpCorrect(interp_data_l[l], P_l[l], x_l[l+1],
+                                       e_l[l], x_l[l]);
+            }
+            else
+            {
+               hypre_SemiInterp(interp_data_l[l], P_l[l], x_l[l+1], e_l[l]);
+               hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            }
             HYPRE_ANNOTATE_MGLEVEL_END(l + 1);
 #if DEBUG
             hypre_sprintf(filename, "zout_eup.%02d", l);
@@ -316,8 +352,16 @@ hypre_PFMGSolve( void               *pfmg_vdata,
             hypre_StructVectorClearAllValues(e_l[0]);
          }
          /* interpolate error and correct on fine grid (x = x + Pe_c) */
-         hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
-         hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         if (fuse_correction)
+         {
+            hypre_SemiInterpCorrect(interp_data_l[0], P_l[0], x_l[1],
+                                    e_l[0], x_l[0]);
+         }
+         else
+         {
+            hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
+            hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         }
          HYPRE_ANNOTATE_MGLEVEL_END(1);
 #if DEBUG
          hypre_printf("Level 0: x_l = %.15e\n", hypre_StructInnerProd(x_l[0], x_l[0]));
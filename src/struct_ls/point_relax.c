@@ -959,6 +959,10 @@ hypre_PointRelax_core12( void               *relax_vdata,
    hypre_Index            loop_size;
    HYPRE_Int              si, sk, ssi[MAX_DEPTH], depth, k;
    HYPRE_Int              Ai;
+   HYPRE_Real             AAs[27];
+   HYPRE_Int              xr[9];
+   HYPRE_Int              xr0, xr1, xr2, xr3, xr4, xr5, xr6, xr7, xr8;
+   HYPRE_Int              box_stencil;
 
    stencil       = hypre_StructMatrixStencil(A);
    stencil_shape = hypre_StructStencilShape(stencil);
@@ -974,32 +978,124 @@ hypre_PointRelax_core12( void               *relax_vdata,
       For a variable diagonal, this diagonal division is done
       at the end of the computation. */
    Ai = hypre_CCBoxIndexRank( A_data_box, start );
-
-#define DEVICE_VAR is_device_ptr(tp,bp)
-   if ( constant_coefficient==1 ) /* constant diagonal */
+   AApd = 1;
+   if ( constant_coefficient==1 )
    {
       Apd = hypre_StructMatrixBoxData(A, boxarray_id, diag_rank);
       AApd = 1/Apd[Ai];
+   }
+
+   /* Stencils within a 3x3 or 3x3x3 box (9, 19 and 27 points) are done in
+      a single pass, with kernels specialized for the box shape */
+   box_stencil = hypre_StructMatrixCCBoxStencil(A, boxarray_id, diag_rank, AApd,
+                                                x_data_box, AAs, xr);
+   if (box_stencil)
+   {
+      xr0 = xr[0]; xr1 = xr[1]; xr2 = xr[2];
+      xr3 = xr[3]; xr4 = xr[4]; xr5 = xr[5];
+      xr6 = xr[6]; xr7 = xr[7]; xr8 = xr[8];
 
-      hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                          b_data_box, start, stride, bi,
-                          t_data_box, start, stride, ti);
+#define DEVICE_VAR is_device_ptr(tp,xp,bp)
+      switch (box_stencil)
       {
-         tp[ti] = AApd * bp[bi];
+         case 27:
+            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                b_data_box, start, stride, bi,
+                                x_data_box, start, stride, xi,
+                                t_data_box, start, stride, ti);
+            {
+               tp[ti] = AApd * bp[bi] -
+                  AAs[0] * xp[xi + xr0 - 1] -
+                  AAs[1] * xp[xi + xr0] -
+                  AAs[2] * xp[xi + xr0 + 1] -
+                  AAs[3] * xp[xi + xr1 - 1] -
+                  AAs[4] * xp[xi + xr1] -
+                  AAs[5] * xp[xi + xr1 + 1] -
+                  AAs[6] * xp[xi + xr2 - 1] -
+                  AAs[7] * xp[xi + xr2] -
+                  AAs[8] * xp[xi + xr2 + 1] -
+                  AAs[9] * xp[xi + xr3 - 1] -
+                  AAs[10] * xp[xi + xr3] -
+                  AAs[11] * xp[xi + xr3 + 1] -
+                  AAs[12] * xp[xi + xr4 - 1] -
+                  AAs[14] * xp[xi + xr4 + 1] -
+                  AAs[15] * xp[xi + xr5 - 1] -
+                  AAs[16] * xp[xi + xr5] -
+                  AAs[17] * xp[xi + xr5 + 1] -
+                  AAs[18] * xp[xi + xr6 - 1] -
+                  AAs[19] * xp[xi + xr6] -
+                  AAs[20] * xp[xi + xr6 + 1] -
+                  AAs[21] * xp[xi + xr7 - 1] -
+                  AAs[22] * xp[xi + xr7] -
+                  AAs[23] * xp[xi + xr7 + 1] -
+                  AAs[24] * xp[xi + xr8 - 1] -
+                  AAs[25] * xp[xi + xr8] -
+                  AAs[26] * xp[xi + xr8 + 1];
+            }
+            hypre_BoxLoop3End(bi, xi, ti);
+            break;
+
+         case 19:
+            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                b_data_box, start, stride, bi,
+                                x_data_box, start, stride, xi,
+                                t_data_box, start, stride, ti);
+            {
+               tp[ti] = AApd * bp[bi] -
+                  AAs[1] * xp[xi + xr0] -
+                  AAs[3] * xp[xi + xr1 - 1] -
+                  AAs[4] * xp[xi + xr1] -
+                  AAs[5] * xp[xi + xr1 + 1] -
+                  AAs[7] * xp[xi + xr2] -
+                  AAs[9] * xp[xi + xr3 - 1] -
+                  AAs[10] * xp[xi + xr3] -
+                  AAs[11] * xp[xi + xr3 + 1] -
+                  AAs[12] * xp[xi + xr4 - 1] -
+                  AAs[14] * xp[xi + xr4 + 1] -
+                  AAs[15] * xp[xi + xr5 - 1] -
+                  AAs[16] * xp[xi + xr5] -
+                  AAs[17] * xp[xi + xr5 + 1] -
+                  AAs[19] * xp[xi + xr6] -
+                  AAs[21] * xp[xi + xr7 - 1] -
+                  AAs[22] * xp[xi + xr7] -
+                  AAs[23] * xp[xi + xr7 + 1] -
+                  AAs[25] * xp[xi + xr8];
+            }
+            hypre_BoxLoop3End(bi, xi, ti);
+            break;
+
+         case 9:
+            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                b_data_box, start, stride, bi,
+                                x_data_box, start, stride, xi,
+                                t_data_box, start, stride, ti);
+            {
+               tp[ti] = AApd * bp[bi] -
+                  AAs[9] * xp[xi + xr3 - 1] -
+                  AAs[10] * xp[xi + xr3] -
+                  AAs[11] * xp[xi + xr3 + 1] -
+                  AAs[12] * xp[xi + xr4 - 1] -
+                  AAs[14] * xp[xi + xr4 + 1] -
+                  AAs[15] * xp[xi + xr5 - 1] -
+                  AAs[16] * xp[xi + xr5] -
+                  AAs[17] * xp[xi + xr5 + 1];
+            }
+            hypre_BoxLoop3End(bi, xi, ti);
+            break;
       }
-      hypre_BoxLoop2End(bi, ti);
+#undef DEVICE_VAR
+
+      return hypre_error_flag;
    }
-   else /* constant_coefficient==2, variable diagonal */
+
+#define DEVICE_VAR is_device_ptr(tp,bp)
+   hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
+                       b_data_box, start, stride, bi,
+                       t_data_box, start, stride, ti);
    {
-      AApd = 1;
-      hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                          b_data_box, start, stride, bi,
-                          t_data_box, start, stride, ti);
-      {
-         tp[ti] = bp[bi];
-      }
-      hypre_BoxLoop2End(bi, ti);
+      tp[ti] = AApd * bp[bi];
    }
+   hypre_BoxLoop2End(bi, ti);
 #undef DEVICE_VAR
 
    /* unroll up to depth MAX_DEPTH */
@@ -8,6 +8,11 @@
 #include "_hypre_struct_ls.h"
 #include "_hypre_struct_mv.hpp"
 
+#ifdef MAX_DEPTH
+#undef MAX_DEPTH
+#endif
+#define MAX_DEPTH 7
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -16,7 +21,10 @@ typedef struct
    hypre_StructMatrix *R;
    HYPRE_Int           R_stored_as_transpose;
    hypre_ComputePkg   *compute_pkg;
+   hypre_ComputePkg   *x_compute_pkg;  /* for the fused residual */
+   HYPRE_Int           fpoints_only;   /* fused residual only at F-points */
    hypre_Index         cindex;
+   hypre_Index         findex;
    hypre_Index         stride;
 
    HYPRE_Int           time_index;
@@ -81,6 +89,7 @@ hypre_SemiRestrictSetup( void               *restrict_vdata,
    (restrict_data -> R_stored_as_transpose) = R_stored_as_transpose;
    (restrict_data -> compute_pkg) = compute_pkg;
    hypre_CopyIndex(cindex ,(restrict_data -> cindex));
+   hypre_CopyIndex(findex ,(restrict_data -> findex));
    hypre_CopyIndex(stride ,(restrict_data -> stride));
 
    return hypre_error_flag;
@@ -310,6 +319,597 @@ hypre_SemiRestrict( void               *restrict_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SemiRestrictResidualSupported
+ *
+ * Returns 1 if hypre_SemiRestrictResidual can be used with A
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictResidualSupported( hypre_StructMatrix *A )
+{
+#if defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return 0;
+#else
+   HYPRE_Int  stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+
+   return ( (hypre_StructMatrixConstantCoefficient(A) == 0) &&
+            (stencil_size <= HYPRE_MAXDIM * HYPRE_MAXDIM * HYPRE_MAXDIM) );
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiRestrictResidualSetup
+ *
+ * Sets up the communication of x for hypre_SemiRestrictResidual.  This must
+ * be called after hypre_SemiRestrictSetup.
+ *
+ * When the grid is coarsened in the first dimension, the C-points and the
+ * F-points share cache lines, so the residual is computed at all points in
+ * one pass instead of reading A and x once for each kind of point.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictResidualSetup( void               *restrict_vdata,
+                                 hypre_StructMatrix *A,
+                                 hypre_StructVector *x              )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+   HYPRE_Int               fpoints_only;
+
+   hypre_StructGrid       *grid;
+   hypre_StructStencil    *stencil;
+
+   hypre_ComputeInfo      *compute_info;
+   hypre_ComputePkg       *compute_pkg;
+
+   fpoints_only = (hypre_IndexD((restrict_data -> stride), 0) == 1);
+
+   /*----------------------------------------------------------
+    * Set up the compute package: all ghost values of x are
+    * exchanged, but only the F-points may be computed
+    *----------------------------------------------------------*/
+
+   grid    = hypre_StructVectorGrid(x);
+   stencil = hypre_StructMatrixStencil(A);
+
+   hypre_CreateComputeInfo(grid, stencil, &compute_info);
+   if (fpoints_only)
+   {
+      hypre_ComputeInfoProjectComp(compute_info, (restrict_data -> findex),
+                                   (restrict_data -> stride));
+   }
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+                          grid, &compute_pkg);
+
+   hypre_ComputePkgDestroy(restrict_data -> x_compute_pkg);
+   (restrict_data -> x_compute_pkg) = compute_pkg;
+   (restrict_data -> fpoints_only)  = fpoints_only;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiRestrictResidualBox
+ *
+ * Computes o = b - Ax on the points of size loop_size at start, unrolling up
+ * to depth MAX_DEPTH.  With more than MAX_DEPTH stencil entries, the later
+ * entries are subtracted in more passes over o.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SemiRestrictResidualBox( HYPRE_Int       ndim,
+                               hypre_Index     loop_size,
+                               hypre_Box      *A_dbox,
+                               hypre_IndexRef  start,
+                               hypre_IndexRef  stride,
+                               hypre_Box      *x_dbox,
+                               hypre_Box      *b_dbox,
+                               hypre_Box      *o_dbox,
+                               hypre_IndexRef  ostart,
+                               hypre_IndexRef  ostride,
+                               HYPRE_Int       stencil_size,
+                               HYPRE_Real    **Ap,
+                               HYPRE_Int      *xoff,
+                               HYPRE_Real     *xp,
+                               HYPRE_Real     *bp,
+                               HYPRE_Real     *op )
+{
+   HYPRE_Real     *Ap0, *Ap1, *Ap2, *Ap3, *Ap4, *Ap5, *Ap6;
+   HYPRE_Int       xoff0, xoff1, xoff2, xoff3, xoff4, xoff5, xoff6;
+   HYPRE_Real     *ip;
+   hypre_Box      *i_dbox;
+   hypre_IndexRef  istart, istride;
+   HYPRE_Int       si, depth;
+
+   for (si = 0; si < stencil_size; si += MAX_DEPTH)
+   {
+      /* the first pass starts from b, the others update o */
+      if (si == 0)
+      {
+         ip = bp; i_dbox = b_dbox; istart = start; istride = stride;
+      }
+      else
+      {
+         ip = op; i_dbox = o_dbox; istart = ostart; istride = ostride;
+      }
+
+      depth = hypre_min(MAX_DEPTH, (stencil_size - si));
+      switch (depth)
+      {
+            case 7:
+               Ap0 = Ap[si+0]; xoff0 = xoff[si+0];
+               Ap1 = Ap[si+1]; xoff1 = xoff[si+1];
+               Ap2 = Ap[si+2]; xoff2 = xoff[si+2];
+               Ap3 = Ap[si+3]; xoff3 = xoff[si+3];
+               Ap4 = Ap[si+4]; xoff4 = xoff[si+4];
+               Ap5 = Ap[si+5]; xoff5 = xoff[si+5];
+               Ap6 = Ap[si+6]; xoff6 = xoff[si+6];
+#define DEVICE_VAR is_device_ptr(op,ip,xp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6)
+               hypre_BoxLoop4Begin(ndim, loop_size,
+                                   A_dbox, start,  stride,  Ai,
+                                   x_dbox, start,  stride,  xi,
+                                   i_dbox, istart, istride, ii,
+                                   o_dbox, ostart, ostride, oi);
+               {
+                  op[oi] = ip[ii] -
+                        Ap0[Ai] * xp[xi + xoff0] -
+                        Ap1[Ai] * xp[xi + xoff1] -
+                        Ap2[Ai] * xp[xi + xoff2] -
+                        Ap3[Ai] * xp[xi + xoff3] -
+                        Ap4[Ai] * xp[xi + xoff4] -
+                        Ap5[Ai] * xp[xi + xoff5] -
+                        Ap6[Ai] * xp[xi + xoff6];
+               }
+               hypre_BoxLoop4End(Ai, xi, ii, oi);
+#undef DEVICE_VAR
+               break;
+
+            case 6:
+               Ap0 = Ap[si+0]; xoff0 = xoff[si+0];
+               Ap1 = Ap[si+1]; xoff1 = xoff[si+1];
+               Ap2 = Ap[si+2]; xoff2 = xoff[si+2];
+               Ap3 = Ap[si+3]; xoff3 = xoff[si+3];
+               Ap4 = Ap[si+4]; xoff4 = xoff[si+4];
+               Ap5 = Ap[si+5]; xoff5 = xoff[si+5];
+#define DEVICE_VAR is_device_ptr(op,ip,xp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5)
+               hypre_BoxLoop4Begin(ndim, loop_size,
+                                   A_dbox, start,  stride,  Ai,
+                                   x_dbox, start,  stride,  xi,
+                                   i_dbox, istart, istride, ii,
+                                   o_dbox, ostart, ostride, oi);
+               {
+                  op[oi] = ip[ii] -
+                        Ap0[Ai] * xp[xi + xoff0] -
+                        Ap1[Ai] * xp[xi + xoff1] -
+                        Ap2[Ai] * xp[xi + xoff2] -
+                        Ap3[Ai] * xp[xi + xoff3] -
+                        Ap4[Ai] * xp[xi + xoff4] -
+                        Ap5[Ai] * xp[xi + xoff5];
+               }
+               hypre_BoxLoop4End(Ai, xi, ii, oi);
+#undef DEVICE_VAR
+               break;
+
+            case 5:
+               Ap0 = Ap[si+0]; xoff0 = xoff[si+0];
+               Ap1 = Ap[si+1]; xoff1 = xoff[si+1];
+               Ap2 = Ap[si+2]; xoff2 = xoff[si+2];
+               Ap3 = Ap[si+3]; xoff3 = xoff[si+3];
+               Ap4 = Ap[si+4]; xoff4 = xoff[si+4];
+#define DEVICE_VAR is_device_ptr(op,ip,xp,Ap0,Ap1,Ap2,Ap3,Ap4)
+               hypre_BoxLoop4Begin(ndim, loop_size,
+                                   A_dbox, start,  stride,  Ai,
+                                   x_dbox, start,  stride,  xi,
+                                   i_dbox, istart, istride, ii,
+                                   o_dbox, ostart, ostride, oi);
+               {
+                  op[oi] = ip[ii] -
+                        Ap0[Ai] * xp[xi + xoff0] -
+                        Ap1[Ai] * xp[xi + xoff1] -
+                        Ap2[Ai] * xp[xi + xoff2] -
+                        Ap3[Ai] * xp[xi + xoff3] -
+                        Ap4[Ai] * xp[xi + xoff4];
+               }
+               hypre_BoxLoop4End(Ai, xi, ii, oi);
+#undef DEVICE_VAR
+               break;
+
+            case 4:
+               Ap0 = Ap[si+0]; xoff0 = xoff[si+0];
+               Ap1 = Ap[si+1]; xoff1 = xoff[si+1];
+               Ap2 = Ap[si+2]; xoff2 = xoff[si+2];
+               Ap3 = Ap[si+3]; xoff3 = xoff[si+3];
+#define DEVICE_VAR is_device_ptr(op,ip,xp,Ap0,Ap1,Ap2,Ap3)
+               hypre_BoxLoop4Begin(ndim, loop_size,
+                                   A_dbox, start,  stride,  Ai,
+                                   x_dbox, start,  stride,  xi,
+                                   i_dbox, istart, istride, ii,
+                                   o_dbox, ostart, ostride, oi);
+               {
+                  op[oi] = ip[ii] -
+                        Ap0[Ai] * xp[xi + xoff0] -
+                        Ap1[Ai] * xp[xi + xoff1] -
+                        Ap2[Ai] * xp[xi + xoff2] -
+                        Ap3[Ai] * xp[xi + xoff3];
+               }
+               hypre_BoxLoop4End(Ai, xi, ii, oi);
+#undef DEVICE_VAR
+               break;
+
+            case 3:
+               Ap0 = Ap[si+0]; xoff0 = xoff[si+0];
+               Ap1 = Ap[si+1]; xoff1 = xoff[si+1];
+               Ap2 = Ap[si+2]; xoff2 = xoff[si+2];
+#define DEVICE_VAR is_device_ptr(op,ip,xp,Ap0,Ap1,Ap2)
+               hypre_BoxLoop4Begin(ndim, loop_size,
+                                   A_dbox, start,  stride,  Ai,
+                                   x_dbox, start,  stride,  xi,
+                                   i_dbox, istart, istride, ii,
+                                   o_dbox, ostart, ostride, oi);
+               {
+                  op[oi] = ip[ii] -
+                        Ap0[Ai] * xp[xi + xoff0] -
+                        Ap1[Ai] * xp[xi + xoff1] -
+                        Ap2[Ai] * xp[xi + xoff2];
+               }
+               hypre_BoxLoop4End(Ai, xi, ii, oi);
+#undef DEVICE_VAR
+               break;
+
+            case 2:
+               Ap0 = Ap[si+0]; xoff0 = xoff[si+0];
+               Ap1 = Ap[si+1]; xoff1 = xoff[si+1];
+#define DEVICE_VAR is_device_ptr(op,ip,xp,Ap0,Ap1)
+               hypre_BoxLoop4Begin(ndim, loop_size,
+                                   A_dbox, start,  stride,  Ai,
+                                   x_dbox, start,  stride,  xi,
+                                   i_dbox, istart, istride, ii,
+                                   o_dbox, ostart, ostride, oi);
+               {
+                  op[oi] = ip[ii] -
+                        Ap0[Ai] * xp[xi + xoff0] -
+                        Ap1[Ai] * xp[xi + xoff1];
+               }
+               hypre_BoxLoop4End(Ai, xi, ii, oi);
+#undef DEVICE_VAR
+               break;
+
+            case 1:
+               Ap0 = Ap[si+0]; xoff0 = xoff[si+0];
+#define DEVICE_VAR is_device_ptr(op,ip,xp,Ap0)
+               hypre_BoxLoop4Begin(ndim, loop_size,
+                                   A_dbox, start,  stride,  Ai,
+                                   x_dbox, start,  stride,  xi,
+                                   i_dbox, istart, istride, ii,
+                                   o_dbox, ostart, ostride, oi);
+               {
+                  op[oi] = ip[ii] -
+                        Ap0[Ai] * xp[xi + xoff0];
+               }
+               hypre_BoxLoop4End(Ai, xi, ii, oi);
+#undef DEVICE_VAR
+               break;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiRestrictResidual
+ *
+ * Computes the residual r = b - Ax and restricts it to rc, without copying
+ * b to r first.  Unless the grid is coarsened in the first dimension, the
+ * residual is only stored at the F-points, which are the points that the
+ * restriction reads from r, and the residual at a C-point is computed in the
+ * loop that restricts to it.  On return, r then only holds the residual at
+ * the F-points.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictResidual( void               *restrict_vdata,
+                            hypre_StructMatrix *R,
+                            hypre_StructMatrix *A,
+                            hypre_StructVector *x,
+                            hypre_StructVector *b,
+                            hypre_StructVector *r,
+                            hypre_StructVector *rc             )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   HYPRE_Int               R_stored_as_transpose;
+   HYPRE_Int               fpoints_only;
+   hypre_ComputePkg       *compute_pkg;
+   hypre_ComputePkg       *x_compute_pkg;
+   hypre_IndexRef          cindex;
+   hypre_IndexRef          stride;
+
+   hypre_StructGrid       *fgrid;
+   HYPRE_Int              *fgrid_ids;
+   hypre_StructGrid       *cgrid;
+   hypre_BoxArray         *cgrid_boxes;
+   HYPRE_Int              *cgrid_ids;
+
+   hypre_CommHandle       *comm_handle;
+
+   hypre_BoxArrayArray    *compute_box_aa;
+   hypre_BoxArray         *compute_box_a;
+   hypre_Box              *compute_box;
+
+   hypre_Box              *R_dbox;
+   hypre_Box              *A_dbox;
+   hypre_Box              *x_dbox;
+   hypre_Box              *b_dbox;
+   hypre_Box              *r_dbox;
+   hypre_Box              *rc_dbox;
+
+   HYPRE_Int               Ri;
+   HYPRE_Int               constant_coefficient;
+
+   HYPRE_Real             *Rp0, *Rp1;
+   HYPRE_Real             *Ap[HYPRE_MAXDIM * HYPRE_MAXDIM * HYPRE_MAXDIM];
+   HYPRE_Int               xoff[HYPRE_MAXDIM * HYPRE_MAXDIM * HYPRE_MAXDIM];
+   HYPRE_Real             *xp;
+   HYPRE_Real             *bp;
+   HYPRE_Real             *rp;
+   HYPRE_Real             *rcp;
+
+   hypre_Index             loop_size;
+   hypre_IndexRef          start;
+   hypre_IndexRef          rstride;
+   hypre_Index             startc;
+   hypre_Index             stridec;
+
+   hypre_StructStencil    *stencil;
+   hypre_Index            *stencil_shape;
+   hypre_Index            *A_stencil_shape;
+   HYPRE_Int               A_stencil_size;
+   HYPRE_Int               ndim;
+
+   HYPRE_Int               compute_i, fi, ci, i, j, si;
+
+   /*-----------------------------------------------------------------------
+    * Initialize some things.
+    *-----------------------------------------------------------------------*/
+
+   x_compute_pkg = (restrict_data -> x_compute_pkg);
+   if (x_compute_pkg == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Fused residual and restriction has not been set up");
+      return hypre_error_flag;
+   }
+
+   hypre_BeginTiming(restrict_data -> time_index);
+
+   R_stored_as_transpose = (restrict_data -> R_stored_as_transpose);
+   fpoints_only  = (restrict_data -> fpoints_only);
+   compute_pkg   = (restrict_data -> compute_pkg);
+   cindex        = (restrict_data -> cindex);
+   stride        = (restrict_data -> stride);
+
+   stencil       = hypre_StructMatrixStencil(R);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(R);
+   hypre_assert( constant_coefficient==0 || constant_coefficient==1 );
+
+   A_stencil_shape = hypre_StructStencilShape(hypre_StructMatrixStencil(A));
+   A_stencil_size  = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+   ndim            = hypre_StructMatrixNDim(A);
+
+   if (constant_coefficient) hypre_StructVectorClearBoundGhostValues(r, 0);
+
+   hypre_SetIndex3(stridec, 1, 1, 1);
+   rstride = fpoints_only ? stride : stridec;
+
+   /*--------------------------------------------------------------------
+    * Compute the residual at the F-points (or at all points).
+    *--------------------------------------------------------------------*/
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch(compute_i)
+      {
+         case 0:
+         {
+            xp = hypre_StructVectorData(x);
+            hypre_InitializeIndtComputations(x_compute_pkg, xp, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(x_compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(x_compute_pkg);
+         }
+         break;
+      }
+
+      hypre_ForBoxArrayI(i, compute_box_aa)
+      {
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+         A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+         r_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r), i);
+
+         for (si = 0; si < A_stencil_size; si++)
+         {
+            Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+            xoff[si] = hypre_BoxOffsetDistance(x_dbox, A_stencil_shape[si]);
+         }
+         xp = hypre_StructVectorBoxData(x, i);
+         bp = hypre_StructVectorBoxData(b, i);
+         rp = hypre_StructVectorBoxData(r, i);
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+            start = hypre_BoxIMin(compute_box);
+            hypre_BoxGetStrideSize(compute_box, rstride, loop_size);
+
+            hypre_SemiRestrictResidualBox(ndim, loop_size,
+                                          A_dbox, start, rstride, x_dbox, b_dbox,
+                                          r_dbox, start, rstride,
+                                          A_stencil_size, Ap, xoff, xp, bp, rp);
+         }
+      }
+   }
+
+   if (!fpoints_only)
+   {
+      hypre_IncFLOPCount(2*A_stencil_size*hypre_StructVectorGlobalSize(x));
+      hypre_EndTiming(restrict_data -> time_index);
+
+      return hypre_SemiRestrict(restrict_vdata, R, r, rc);
+   }
+
+   /*--------------------------------------------------------------------
+    * Restrict, computing the residual at the C-points.  The ghost values
+    * of x are up to date from the first step.
+    *--------------------------------------------------------------------*/
+
+   fgrid = hypre_StructVectorGrid(r);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+   cgrid = hypre_StructVectorGrid(rc);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch(compute_i)
+      {
+         case 0:
+         {
+            rp = hypre_StructVectorData(r);
+            hypre_InitializeIndtComputations(compute_pkg, rp, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+         }
+         break;
+      }
+
+      fi = 0;
+      hypre_ForBoxI(ci, cgrid_boxes)
+      {
+         while (fgrid_ids[fi] != cgrid_ids[ci])
+         {
+            fi++;
+         }
+
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, fi);
+
+         R_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R),  fi);
+         A_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A),  fi);
+         x_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x),  fi);
+         b_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b),  fi);
+         r_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r),  fi);
+         rc_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(rc), ci);
+
+         HYPRE_Int Rp0_offset = 0, rp0_offset, rp1_offset;
+
+         if (R_stored_as_transpose)
+         {
+            Rp0 = hypre_StructMatrixBoxData(R, fi, 1);
+            Rp1 = hypre_StructMatrixBoxData(R, fi, 0);
+            if ( constant_coefficient )
+            {
+               Rp0_offset = -hypre_CCBoxOffsetDistance(R_dbox, stencil_shape[1]);
+            }
+            else
+            {
+               Rp0_offset = -hypre_BoxOffsetDistance(R_dbox, stencil_shape[1]);
+            }
+         }
+         else
+         {
+            Rp0 = hypre_StructMatrixBoxData(R, fi, 0);
+            Rp1 = hypre_StructMatrixBoxData(R, fi, 1);
+         }
+         for (si = 0; si < A_stencil_size; si++)
+         {
+            Ap[si]   = hypre_StructMatrixBoxData(A, fi, si);
+            xoff[si] = hypre_BoxOffsetDistance(x_dbox, A_stencil_shape[si]);
+         }
+         xp  = hypre_StructVectorBoxData(x, fi);
+         bp  = hypre_StructVectorBoxData(b, fi);
+         rp  = hypre_StructVectorBoxData(r, fi);
+         rp0_offset = hypre_BoxOffsetDistance(r_dbox, stencil_shape[0]);
+         rp1_offset = hypre_BoxOffsetDistance(r_dbox, stencil_shape[1]);
+         rcp = hypre_StructVectorBoxData(rc, ci);
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+            start  = hypre_BoxIMin(compute_box);
+            hypre_StructMapFineToCoarse(start, cindex, stride, startc);
+
+            hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+            /* residual at the C-points */
+            hypre_SemiRestrictResidualBox(ndim, loop_size,
+                                          A_dbox, start, stride, x_dbox, b_dbox,
+                                          rc_dbox, startc, stridec,
+                                          A_stencil_size, Ap, xoff, xp, bp, rcp);
+
+            if ( constant_coefficient )
+            {
+               HYPRE_Complex Rp0val,Rp1val;
+               Ri = hypre_CCBoxIndexRank( R_dbox, startc );
+
+               Rp0val = Rp0[Ri+Rp0_offset];
+               Rp1val = Rp1[Ri];
+#define DEVICE_VAR is_device_ptr(rcp,rp)
+               hypre_BoxLoop2Begin(ndim, loop_size,
+                                   r_dbox,  start,  stride,  ri,
+                                   rc_dbox, startc, stridec, rci);
+               {
+                  rcp[rci] += (Rp0val * rp[ri+rp0_offset] +
+                               Rp1val * rp[ri+rp1_offset]);
+               }
+               hypre_BoxLoop2End(ri, rci);
+#undef DEVICE_VAR
+            }
+            else
+            {
+#define DEVICE_VAR is_device_ptr(rcp,rp,Rp0,Rp1)
+               hypre_BoxLoop3Begin(ndim, loop_size,
+                                   R_dbox,  startc, stridec, Ri,
+                                   r_dbox,  start,  stride,  ri,
+                                   rc_dbox, startc, stridec, rci);
+               {
+                  rcp[rci] += (Rp0[Ri+Rp0_offset] * rp[ri+rp0_offset] +
+                               Rp1[Ri]            * rp[ri+rp1_offset]);
+               }
+               hypre_BoxLoop3End(Ri, ri, rci);
+#undef DEVICE_VAR
+            }
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Return
+    *-----------------------------------------------------------------------*/
+
+   hypre_IncFLOPCount(2*A_stencil_size*hypre_StructVectorGlobalSize(x) +
+                      4*hypre_StructVectorGlobalSize(rc));
+   hypre_EndTiming(restrict_data -> time_index);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -322,6 +922,7 @@ hypre_SemiRestrictDestroy( void *restrict_vdata )
    {
       hypre_StructMatrixDestroy(restrict_data -> R);
       hypre_ComputePkgDestroy(restrict_data -> compute_pkg);
+      hypre_ComputePkgDestroy(restrict_data -> x_compute_pkg);
       hypre_FinalizeTiming(restrict_data -> time_index);
       hypre_TFree(restrict_data, HYPRE_MEMORY_HOST);
    }
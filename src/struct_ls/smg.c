@@ -32,6 +32,7 @@ hypre_SMGCreate( MPI_Comm  comm )
    (smg_data -> num_pre_relax)  = 1;
    (smg_data -> num_post_relax) = 1;
    (smg_data -> cdir) = 2;
+   (smg_data -> fuse_transfers) = 0;
    hypre_SetIndex3((smg_data -> base_index), 0, 0, 0);
    hypre_SetIndex3((smg_data -> base_stride), 1, 1, 1);
    (smg_data -> logging) = 0;
@@ -83,6 +84,7 @@ hypre_SMGDestroy( void *smg_vdata )
          hypre_TFree(smg_data -> residual_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(smg_data -> restrict_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(smg_data -> interp_data_l, HYPRE_MEMORY_HOST);
+         hypre_TFree(smg_data -> fuse_l, HYPRE_MEMORY_HOST);
 
          hypre_StructVectorDestroy(smg_data -> tb_l[0]);
          hypre_StructVectorDestroy(smg_data -> tx_l[0]);
@@ -306,6 +308,31 @@ hypre_SMGGetNumPostRelax( void *smg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGSetFuseTransfers( void *smg_vdata,
+                           HYPRE_Int   fuse_transfers )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   (smg_data -> fuse_transfers) = fuse_transfers;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SMGGetFuseTransfers( void *smg_vdata,
+                           HYPRE_Int * fuse_transfers )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   *fuse_transfers = (smg_data -> fuse_transfers);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -36,6 +36,8 @@ typedef struct
 
    HYPRE_Int             cdir;  /* coarsening direction */
 
+   HYPRE_Int             fuse_transfers; /* flag for fused grid transfers */
+
    /* base index space info */
    hypre_Index           base_index;
    hypre_Index           base_stride;
@@ -61,6 +63,7 @@ typedef struct
    void                **residual_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   HYPRE_Int            *fuse_l;  /* flags to fuse grid transfers on level l */
 
    /* log info (always logged) */
    HYPRE_Int             num_iterations;
@@ -27,6 +27,7 @@ hypre_SMGSetup( void               *smg_vdata,
 
    HYPRE_Int             n_pre   = (smg_data -> num_pre_relax);
    HYPRE_Int             n_post  = (smg_data -> num_post_relax);
+   HYPRE_Int             fuse_transfers = (smg_data -> fuse_transfers);
 
    HYPRE_Int             max_iter;
    HYPRE_Int             max_levels;
@@ -69,6 +70,7 @@ hypre_SMGSetup( void               *smg_vdata,
    void                **residual_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   HYPRE_Int            *fuse_l;
 
    hypre_StructGrid     *grid;
 
@@ -440,6 +442,7 @@ hypre_SMGSetup( void               *smg_vdata,
    residual_data_l = hypre_TAlloc(void *,  num_levels, HYPRE_MEMORY_HOST);
    restrict_data_l = hypre_TAlloc(void *,  num_levels, HYPRE_MEMORY_HOST);
    interp_data_l   = hypre_TAlloc(void *,  num_levels, HYPRE_MEMORY_HOST);
+   fuse_l          = hypre_CTAlloc(HYPRE_Int,  num_levels, HYPRE_MEMORY_HOST);
 
    /* temporarily set the data for x_l[0] and b_l[0] to temp data */
    b_data = hypre_StructVectorData(b_l[0]);
@@ -515,6 +518,14 @@ hypre_SMGSetup( void               *smg_vdata,
       hypre_SemiRestrictSetup(restrict_data_l[l], R_l[l], 0, r_l[l], b_l[l+1],
                               cindex, findex, stride);
 
+      /* set up the fused residual and restriction (on all points only) */
+      if (fuse_transfers && hypre_SemiRestrictResidualSupported(A_l[l]) &&
+          (hypre_IndexX(bstride) * hypre_IndexY(bstride) * hypre_IndexZ(bstride) == 1))
+      {
+         hypre_SemiRestrictResidualSetup(restrict_data_l[l], A_l[l], x_l[l]);
+         fuse_l[l] = 1;
+      }
+
       /* set up the coarse grid operator */
       hypre_SMGSetupRAPOp(R_l[l], A_l[l], PT_l[l], A_l[l+1],
                           cindex, stride);
@@ -559,6 +570,7 @@ hypre_SMGSetup( void               *smg_vdata,
    (smg_data -> residual_data_l)   = residual_data_l;
    (smg_data -> restrict_data_l)   = restrict_data_l;
    (smg_data -> interp_data_l)     = interp_data_l;
+   (smg_data -> fuse_l)            = fuse_l;
 
    /*-----------------------------------------------------
     * Allocate space for log info
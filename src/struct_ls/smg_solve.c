@@ -39,6 +39,9 @@
  * - hypre_SemiRestrict restricts the residual to the coarse grid.
  * - hypre_SemiInterp interpolates the coarse error and adds it to the
  *   fine grid solution.
+ * - hypre_SemiRestrictResidual and hypre_SemiInterpCorrect do the same as
+ *   the above routines in fewer passes over the fine grid, when the grid
+ *   transfers are fused.
  *
  *--------------------------------------------------------------------------*/
 
@@ -71,6 +74,7 @@ hypre_SMGSolve( void               *smg_vdata,
    void                **residual_data_l = (smg_data -> residual_data_l);
    void                **restrict_data_l = (smg_data -> restrict_data_l);
    void                **interp_data_l   = (smg_data -> interp_data_l);
+   HYPRE_Int            *fuse_l          = (smg_data -> fuse_l);
    HYPRE_Int             logging         = (smg_data -> logging);
    HYPRE_Real           *norms           = (smg_data -> norms);
    HYPRE_Real           *rel_norms       = (smg_data -> rel_norms);
@@ -79,6 +83,7 @@ hypre_SMGSolve( void               *smg_vdata,
    HYPRE_Real            e_dot_e = 0, x_dot_x = 1;
 
    HYPRE_Int             i, l;
+   HYPRE_Int             fuse_residual, fuse_correction;
 
 #if DEBUG
    char                  filename[255];
@@ -98,6 +103,10 @@ hypre_SMGSolve( void               *smg_vdata,
    b_l[0] = hypre_StructVectorRef(b);
    x_l[0] = hypre_StructVectorRef(x);
 
+   /* the fine grid residual and error are needed by the convergence check */
+   fuse_residual   = (fuse_l[0] && !(tol > 0.0));
+   fuse_correction = (fuse_l[0] && !((tol > 0.0) && (rel_change)));
+
    (smg_data -> num_iterations) = 0;
 
    /* if max_iter is zero, return */
@@ -161,8 +170,11 @@ hypre_SMGSolve( void               *smg_vdata,
       hypre_SMGRelax(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
       zero_guess = 0;
 
-      /* compute fine grid residual (b - Ax) */
-      hypre_SMGResidual(residual_data_l[0], A_l[0], x_l[0], b_l[0], r_l[0]);
+      /* compute fine grid residual (b - Ax), unless fused with restriction */
+      if (!fuse_residual)
+      {
+         hypre_SMGResidual(residual_data_l[0], A_l[0], x_l[0], b_l[0], r_l[0]);
+      }
 
       /* convergence check */
       if (tol > 0.0)
@@ -195,7 +207,15 @@ hypre_SMGSolve( void               *smg_vdata,
       if (num_levels > 1)
       {
          /* restrict fine grid residual */
-         hypre_SemiRestrict(restrict_data_l[0], R_l[0], r_l[0], b_l[1]);
+         if (fuse_residual)
+         {
+            hypre_SemiRestrictResidual(restrict_data_l[0], R_l[0], A_l[0],
+                                       x_l[0], b_l[0], r_l[0], b_l[1]);
+         }
+         else
+         {
+            hypre_SemiRestrict(restrict_data_l[0], R_l[0], r_l[0], b_l[1]);
+         }
 #if DEBUG
          if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
          {
@@ -216,12 +236,21 @@ hypre_SMGSolve( void               *smg_vdata,
             hypre_SMGRelaxSetZeroGuess(relax_data_l[l], 1);
             hypre_SMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
-            /* compute residual (b - Ax) */
-            hypre_SMGResidual(residual_data_l[l],
-                              A_l[l], x_l[l], b_l[l], r_l[l]);
+            if (fuse_l[l])
+            {
+               /* compute residual (b - Ax) and restrict it */
+               hypre_SemiRestrictResidual(restrict_data_l[l], R_l[l], A_l[l],
+                                          x_l[l], b_l[l], r_l[l], b_l[l+1]);
+            }
+            else
+            {
+               /* compute residual (b - Ax) */
+               hypre_SMGResidual(residual_data_l[l],
+                                 A_l[l], x_l[l], b_l[l], r_l[l]);
 
-            /* restrict residual */
-            hypre_SemiRestrict(restrict_data_l[l], R_l[l], r_l[l], b_l[l+1]);
+               /* restrict residual */
+               hypre_SemiRestrict(restrict_data_l[l], R_l[l], r_l[l], b_l[l+1]);
+            }
 #if DEBUG
             if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
             {
@@ -256,8 +285,16 @@ hypre_SMGSolve( void               *smg_vdata,
          for (l = (num_levels - 2); l >= 1; l--)
          {
             /* interpolate error and correct (x = x + Pe_c) */
-            hypre_SemiInterp(interp_data_l[l], PT_l[l], x_l[l+1], e_l[l]);
-            hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            if (fuse_l[l])
+            {
+               hypre_SemiInterpCorrect(interp_data_l[l], PT_l[l], x_l[l+1],
+                                       e_l[l], x_l[l]);
+            }
+            else
+            {
+               hypre_SemiInterp(interp_data_l[l], PT_l[l], x_l[l+1], e_l[l]);
+               hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            }
 #if DEBUG
             if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
             {
@@ -276,8 +313,16 @@ hypre_SMGSolve( void               *smg_vdata,
          }
 
          /* interpolate error and correct on fine grid (x = x + Pe_c) */
-         hypre_SemiInterp(interp_data_l[0], PT_l[0], x_l[1], e_l[0]);
-         hypre_SMGAxpy(1.0, e_l[0], x_l[0], base_index, base_stride);
+         if (fuse_correction)
+         {
+            hypre_SemiInterpCorrect(interp_data_l[0], PT_l[0], x_l[1],
+                                    e_l[0], x_l[0]);
+         }
+         else
+         {
+            hypre_SemiInterp(interp_data_l[0], PT_l[0], x_l[1], e_l[0]);
+            hypre_SMGAxpy(1.0, e_l[0], x_l[0], base_index, base_stride);
+         }
 #if DEBUG
          if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
          {
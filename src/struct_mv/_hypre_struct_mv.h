@@ -1212,6 +1212,19 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent exchange data (set up after the first communication) */
+   HYPRE_Int          persistent;    /* use the data below? */
+   HYPRE_Int          busy;          /* persistent buffers are in use */
+   HYPRE_Int         *send_indices;  /* send_data index of each send buffer value */
+   HYPRE_Int          send_zeros;    /* some send_indices are -1 (zero values) */
+   HYPRE_Int         *recv_indices;  /* recv_data index of each recv buffer value */
+   HYPRE_Int          recv_unique;   /* recv_indices has no repeated values */
+   HYPRE_Complex     *send_buffer;
+   HYPRE_Complex     *recv_buffer;
+   HYPRE_Int          tag;           /* tag the persistent requests were made with */
+   hypre_MPI_Request *requests;      /* persistent recv requests, then send requests */
+   hypre_MPI_Status  *status;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -1237,6 +1250,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* uses the persistent data in comm_pkg */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1328,6 +1344,18 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistent(comm_pkg)      (comm_pkg -> persistent)
+#define hypre_CommPkgBusy(comm_pkg)            (comm_pkg -> busy)
+#define hypre_CommPkgSendIndices(comm_pkg)     (comm_pkg -> send_indices)
+#define hypre_CommPkgSendZeros(comm_pkg)       (comm_pkg -> send_zeros)
+#define hypre_CommPkgRecvIndices(comm_pkg)     (comm_pkg -> recv_indices)
+#define hypre_CommPkgRecvUnique(comm_pkg)      (comm_pkg -> recv_unique)
+#define hypre_CommPkgSendBuffer(comm_pkg)      (comm_pkg -> send_buffer)
+#define hypre_CommPkgRecvBuffer(comm_pkg)      (comm_pkg -> recv_buffer)
+#define hypre_CommPkgTag(comm_pkg)             (comm_pkg -> tag)
+#define hypre_CommPkgRequests(comm_pkg)        (comm_pkg -> requests)
+#define hypre_CommPkgStatus(comm_pkg)          (comm_pkg -> status)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1341,6 +1369,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle) (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle) (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
 
@@ -1789,6 +1818,8 @@ HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha , hypre_StructVector *x , hypre
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info , hypre_BoxArray *send_data_space , hypre_BoxArray *recv_data_space , HYPRE_Int num_values , HYPRE_Int **orders , HYPRE_Int reverse , MPI_Comm comm , hypre_CommPkg **comm_pkg_ptr );
 HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type , HYPRE_Int *boxnums , hypre_Box *boxes , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_BoxArray *data_space , HYPRE_Int *data_offsets );
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_Box *data_box , HYPRE_Int data_box_offset , hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommTypeSetIndices ( hypre_CommType *comm_type , HYPRE_Int ndim , HYPRE_Int num_values , HYPRE_Int use_order , HYPRE_Int *indices );
+HYPRE_Int hypre_CommPkgSetupPersistent ( hypre_CommPkg *comm_pkg );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action , HYPRE_Int tag , hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action );
@@ -1820,6 +1851,7 @@ HYPRE_Int hypre_StructGridGetMaxBoxSize(hypre_StructGrid *grid);
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x , hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x , hypre_StructVector *y );
 
 /* struct_io.c */
@@ -1860,6 +1892,7 @@ void *hypre_StructMatvecCreate ( void );
 HYPRE_Int hypre_StructMatvecSetup ( void *matvec_vdata , hypre_StructMatrix *A , hypre_StructVector *x );
 HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata , HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatrixCCBoxStencil ( hypre_StructMatrix *A , HYPRE_Int box_id , HYPRE_Int skip_rank , HYPRE_Complex scale , hypre_Box *x_data_box , HYPRE_Complex *coefs , HYPRE_Int *xrow );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
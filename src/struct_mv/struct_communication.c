@@ -759,6 +759,223 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Flatten the entries of a CommType into one index per buffer value, in the
+ * same order that the buffer is packed.  Each index is relative to the data
+ * pointer passed to the communication routines.  If 'use_order' is set, the
+ * entry orders are applied, and values that are not communicated (order -1)
+ * get index -1.  Returns the number of indices set.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommTypeSetIndices( hypre_CommType *comm_type,
+                          HYPRE_Int       ndim,
+                          HYPRE_Int       num_values,
+                          HYPRE_Int       use_order,
+                          HYPRE_Int      *indices )
+{
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array;
+   HYPRE_Int           *order;
+   HYPRE_Int            index[HYPRE_MAXDIM];
+   HYPRE_Int            size, start, m, n, i, j, d, ll;
+
+   n = 0;
+   for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+   {
+      comm_entry = hypre_CommTypeEntry(comm_type, j);
+      length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+      stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+      order = hypre_CommEntryTypeOrder(comm_entry);
+
+      size = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         size *= length_array[d];
+      }
+
+      for (ll = 0; ll < num_values; ll++)
+      {
+         if (use_order && (order[ll] < 0))
+         {
+            for (i = 0; i < size; i++)
+            {
+               indices[n++] = -1;
+            }
+            continue;
+         }
+
+         start = hypre_CommEntryTypeOffset(comm_entry);
+         start += (use_order ? order[ll] : ll) * stride_array[ndim];
+
+         /* same traversal as hypre_BasicBoxLoop: dimension 0 runs fastest */
+         for (d = 0; d < ndim; d++)
+         {
+            index[d] = 0;
+         }
+         for (i = 0; i < size; i++)
+         {
+            m = start;
+            for (d = 0; d < ndim; d++)
+            {
+               m += index[d] * stride_array[d];
+            }
+            indices[n++] = m;
+
+            for (d = 0; d < ndim; d++)
+            {
+               if (++index[d] < length_array[d])
+               {
+                  break;
+               }
+               index[d] = 0;
+            }
+         }
+      }
+   }
+
+   return n;
+}
+
+/*--------------------------------------------------------------------------
+ * Set up the persistent exchange data in a CommPkg.  This is called after
+ * the first communication, once the RecvType entries are known.
+ *
+ * Subsequent communications then pack and unpack the buffers through the
+ * flat index lists, reuse the buffers, and restart the same persistent MPI
+ * requests instead of walking the entries and posting new requests.
+ *
+ * This is host-only.  Device builds keep the box loop pack/unpack.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgSetupPersistent( hypre_CommPkg *comm_pkg )
+{
+#if !(defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP))
+   HYPRE_Int            ndim         = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values   = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_sends    = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs    = hypre_CommPkgNumRecvs(comm_pkg);
+   HYPRE_Int            send_bufsize = 0;
+   HYPRE_Int            recv_bufsize = 0;
+
+   hypre_CommType      *comm_type;
+   HYPRE_Int           *send_indices;
+   HYPRE_Int           *recv_indices;
+   HYPRE_Int           *sorted;
+   HYPRE_Int            send_zeros, recv_unique, match;
+   HYPRE_Int            i, n;
+
+   if (hypre_CommPkgPersistent(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   /* the buffers hold the values of the messages only; the CommPkg buffer
+    * sizes also count the values of the local copies */
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      send_bufsize += hypre_CommTypeBufsize(comm_type);
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      recv_bufsize += hypre_CommTypeBufsize(comm_type);
+   }
+
+   /* each message must be described exactly by its entries; this is not the
+    * case for recvs sized by an upper bound (CommInfo boxes do not match) */
+   match = 1;
+   send_indices = hypre_TAlloc(HYPRE_Int, send_bufsize, HYPRE_MEMORY_HOST);
+   n = 0;
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      if (hypre_CommTypeSetIndices(comm_type, ndim, num_values, 1, send_indices + n) !=
+          hypre_CommTypeBufsize(comm_type))
+      {
+         match = 0;
+         break;
+      }
+      n += hypre_CommTypeBufsize(comm_type);
+   }
+   if (!match)
+   {
+      /* keep using the box loop pack/unpack */
+      hypre_TFree(send_indices, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+   send_zeros = 0;
+   for (i = 0; i < send_bufsize; i++)
+   {
+      if (send_indices[i] < 0)
+      {
+         send_zeros = 1;
+         break;
+      }
+   }
+
+   recv_indices = hypre_TAlloc(HYPRE_Int, recv_bufsize, HYPRE_MEMORY_HOST);
+   n = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      if (hypre_CommTypeSetIndices(comm_type, ndim, num_values, 0, recv_indices + n) !=
+          hypre_CommTypeBufsize(comm_type))
+      {
+         match = 0;
+         break;
+      }
+      n += hypre_CommTypeBufsize(comm_type);
+   }
+   if (!match)
+   {
+      hypre_TFree(send_indices, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_indices, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   /* the unpack can only be threaded if no two values go to the same place */
+   sorted = hypre_TAlloc(HYPRE_Int, recv_bufsize, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(sorted, recv_indices, HYPRE_Int, recv_bufsize,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_qsort0(sorted, 0, recv_bufsize - 1);
+   recv_unique = 1;
+   for (i = 1; i < recv_bufsize; i++)
+   {
+      if (sorted[i] == sorted[i-1])
+      {
+         recv_unique = 0;
+         break;
+      }
+   }
+   hypre_TFree(sorted, HYPRE_MEMORY_HOST);
+
+   hypre_CommPkgSendBufsize(comm_pkg) = send_bufsize;
+   hypre_CommPkgRecvBufsize(comm_pkg) = recv_bufsize;
+   hypre_CommPkgSendIndices(comm_pkg) = send_indices;
+   hypre_CommPkgSendZeros(comm_pkg)   = send_zeros;
+   hypre_CommPkgRecvIndices(comm_pkg) = recv_indices;
+   hypre_CommPkgRecvUnique(comm_pkg)  = recv_unique;
+   hypre_CommPkgSendBuffer(comm_pkg)  =
+      hypre_CTAlloc(HYPRE_Complex, send_bufsize, HYPRE_MEMORY_HOST);
+   hypre_CommPkgRecvBuffer(comm_pkg)  =
+      hypre_CTAlloc(HYPRE_Complex, recv_bufsize, HYPRE_MEMORY_HOST);
+
+   /* the requests are created on first use, when the tag is known */
+   hypre_CommPkgRequests(comm_pkg) = NULL;
+   hypre_CommPkgStatus(comm_pkg)   =
+      hypre_CTAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+
+   hypre_CommPkgBusy(comm_pkg)       = 0;
+   hypre_CommPkgPersistent(comm_pkg) = 1;
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
@@ -809,6 +1026,103 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
 
+   /*--------------------------------------------------------------------
+    * persistent exchange: gather into the CommPkg send buffer through the
+    * precomputed index list and restart the persistent requests
+    *--------------------------------------------------------------------*/
+
+   if ( hypre_CommPkgPersistent(comm_pkg) && !hypre_CommPkgBusy(comm_pkg) )
+   {
+      HYPRE_Complex  *send_buffer  = hypre_CommPkgSendBuffer(comm_pkg);
+      HYPRE_Int      *send_indices = hypre_CommPkgSendIndices(comm_pkg);
+
+      num_requests = num_sends + num_recvs;
+      requests     = hypre_CommPkgRequests(comm_pkg);
+
+      size = hypre_CommPkgSendBufsize(comm_pkg);
+      if ( hypre_CommPkgSendZeros(comm_pkg) )
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < size; i++)
+         {
+            send_buffer[i] = (send_indices[i] < 0) ? 0.0 : send_data[send_indices[i]];
+         }
+      }
+      else
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < size; i++)
+         {
+            send_buffer[i] = send_data[send_indices[i]];
+         }
+      }
+
+      /* the requests are bound to a tag, so recreate them if it changes */
+      if ( (requests != NULL) && (hypre_CommPkgTag(comm_pkg) != tag) )
+      {
+         for (j = 0; j < num_requests; j++)
+         {
+            hypre_MPI_Request_free(&requests[j]);
+         }
+         hypre_TFree(requests, HYPRE_MEMORY_HOST);
+      }
+      if ( (requests == NULL) && (num_requests > 0) )
+      {
+         HYPRE_Complex  *recv_buffer = hypre_CommPkgRecvBuffer(comm_pkg);
+
+         requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+         j = 0;
+         for (i = 0; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+            hypre_MPI_Recv_init(recv_buffer,
+                                hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                                hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                                tag, comm, &requests[j++]);
+            recv_buffer += hypre_CommTypeBufsize(comm_type);
+         }
+         for (i = 0; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i);
+            hypre_MPI_Send_init(send_buffer,
+                                hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                                hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                                tag, comm, &requests[j++]);
+            send_buffer += hypre_CommTypeBufsize(comm_type);
+         }
+      }
+      hypre_CommPkgRequests(comm_pkg) = requests;
+      hypre_CommPkgTag(comm_pkg)      = tag;
+
+      if (num_requests > 0)
+      {
+         hypre_MPI_Startall(num_requests, requests);
+      }
+
+      hypre_ExchangeLocalData(comm_pkg, send_data, recv_data, action);
+
+      hypre_CommPkgBusy(comm_pkg) = 1;
+
+      comm_handle = hypre_CTAlloc(hypre_CommHandle, 1, HYPRE_MEMORY_HOST);
+
+      hypre_CommHandleCommPkg(comm_handle)     = comm_pkg;
+      hypre_CommHandleSendData(comm_handle)    = send_data;
+      hypre_CommHandleRecvData(comm_handle)    = recv_data;
+      hypre_CommHandleNumRequests(comm_handle) = num_requests;
+      hypre_CommHandleRequests(comm_handle)    = requests;
+      hypre_CommHandleStatus(comm_handle)      = hypre_CommPkgStatus(comm_pkg);
+      hypre_CommHandleAction(comm_handle)      = action;
+      hypre_CommHandlePersistent(comm_handle)  = 1;
+
+      *comm_handle_ptr = comm_handle;
+
+      return hypre_error_flag;
+   }
+
    /*--------------------------------------------------------------------
     * allocate requests and status
     *--------------------------------------------------------------------*/
@@ -1097,6 +1411,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    hypre_CommHandleAction(comm_handle)      = action;
    hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers_data;
    hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers_data;
+   hypre_CommHandlePersistent(comm_handle)  = 0;
 
    *comm_handle_ptr = comm_handle;
 
@@ -1154,6 +1469,63 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
                         hypre_CommHandleStatus(comm_handle));
    }
 
+   /*--------------------------------------------------------------------
+    * persistent exchange: scatter the CommPkg recv buffer through the
+    * precomputed index list
+    *--------------------------------------------------------------------*/
+
+   if ( hypre_CommHandlePersistent(comm_handle) )
+   {
+      HYPRE_Complex  *recv_data    = hypre_CommHandleRecvData(comm_handle);
+      HYPRE_Complex  *recv_buffer  = hypre_CommPkgRecvBuffer(comm_pkg);
+      HYPRE_Int      *recv_indices = hypre_CommPkgRecvIndices(comm_pkg);
+      HYPRE_Int       size         = hypre_CommPkgRecvBufsize(comm_pkg);
+
+      if ( hypre_CommPkgRecvUnique(comm_pkg) )
+      {
+         if (action > 0)
+         {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < size; i++)
+            {
+               recv_data[recv_indices[i]] += recv_buffer[i];
+            }
+         }
+         else
+         {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < size; i++)
+            {
+               recv_data[recv_indices[i]] = recv_buffer[i];
+            }
+         }
+      }
+      else
+      {
+         /* some values go to the same place, so keep the buffer order */
+         for (i = 0; i < size; i++)
+         {
+            if (action > 0)
+            {
+               recv_data[recv_indices[i]] += recv_buffer[i];
+            }
+            else
+            {
+               recv_data[recv_indices[i]] = recv_buffer[i];
+            }
+         }
+      }
+
+      hypre_CommPkgBusy(comm_pkg) = 0;
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    /*--------------------------------------------------------------------
     * if FirstComm, unpack prefix information and set 'num_entries' and
     * 'entries' for RecvType
@@ -1295,7 +1667,11 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
     * turn off first communication indicator
     *--------------------------------------------------------------------*/
 
-   hypre_CommPkgFirstComm(comm_pkg) = 0;
+   if ( hypre_CommPkgFirstComm(comm_pkg) )
+   {
+      hypre_CommPkgFirstComm(comm_pkg) = 0;
+      hypre_CommPkgSetupPersistent(comm_pkg);
+   }
 
    /*--------------------------------------------------------------------
     * Free up communication handle
@@ -1462,6 +1838,21 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
       hypre_TFree(hypre_CommPkgIdentityOrder(comm_pkg), HYPRE_MEMORY_HOST);
 
+      if (hypre_CommPkgRequests(comm_pkg))
+      {
+         for (i = 0; i < (hypre_CommPkgNumSends(comm_pkg) +
+                          hypre_CommPkgNumRecvs(comm_pkg)); i++)
+         {
+            hypre_MPI_Request_free(&hypre_CommPkgRequests(comm_pkg)[i]);
+         }
+      }
+      hypre_TFree(hypre_CommPkgRequests(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgStatus(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgSendIndices(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgRecvIndices(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgSendBuffer(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgRecvBuffer(comm_pkg), HYPRE_MEMORY_HOST);
+
       hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    }
 
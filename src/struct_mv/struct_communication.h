@@ -113,6 +113,19 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent exchange data (set up after the first communication) */
+   HYPRE_Int          persistent;    /* use the data below? */
+   HYPRE_Int          busy;          /* persistent buffers are in use */
+   HYPRE_Int         *send_indices;  /* send_data index of each send buffer value */
+   HYPRE_Int          send_zeros;    /* some send_indices are -1 (zero values) */
+   HYPRE_Int         *recv_indices;  /* recv_data index of each recv buffer value */
+   HYPRE_Int          recv_unique;   /* recv_indices has no repeated values */
+   HYPRE_Complex     *send_buffer;
+   HYPRE_Complex     *recv_buffer;
+   HYPRE_Int          tag;           /* tag the persistent requests were made with */
+   hypre_MPI_Request *requests;      /* persistent recv requests, then send requests */
+   hypre_MPI_Status  *status;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -138,6 +151,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* uses the persistent data in comm_pkg */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -229,6 +245,18 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistent(comm_pkg)      (comm_pkg -> persistent)
+#define hypre_CommPkgBusy(comm_pkg)            (comm_pkg -> busy)
+#define hypre_CommPkgSendIndices(comm_pkg)     (comm_pkg -> send_indices)
+#define hypre_CommPkgSendZeros(comm_pkg)       (comm_pkg -> send_zeros)
+#define hypre_CommPkgRecvIndices(comm_pkg)     (comm_pkg -> recv_indices)
+#define hypre_CommPkgRecvUnique(comm_pkg)      (comm_pkg -> recv_unique)
+#define hypre_CommPkgSendBuffer(comm_pkg)      (comm_pkg -> send_buffer)
+#define hypre_CommPkgRecvBuffer(comm_pkg)      (comm_pkg -> recv_buffer)
+#define hypre_CommPkgTag(comm_pkg)             (comm_pkg -> tag)
+#define hypre_CommPkgRequests(comm_pkg)        (comm_pkg -> requests)
+#define hypre_CommPkgStatus(comm_pkg)          (comm_pkg -> status)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -242,6 +270,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle) (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle) (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
 
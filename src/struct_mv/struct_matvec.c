@@ -597,6 +597,102 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCCBoxStencil
+ *
+ * Checks whether the constant stencil of A is one of the common stencils
+ * within a 3x3 box in 2D (9 points) or a 3x3x3 box in 3D (19 points without
+ * the corners, or 27 points), for which specialized kernels are used.
+ * Returns 9, 19 or 27 in that case and 0 otherwise.
+ *
+ * On return, coefs[(dx+1) + 3*(dy+1) + 9*(dz+1)] is the coefficient of the
+ * stencil entry (dx,dy,dz) times scale, zero for missing entries and for the
+ * entry skip_rank (use -1 to keep all the entries).  The row offsets
+ * xrow[(dy+1) + 3*(dz+1)] are the offsets of the entries (0,dy,dz) in
+ * x_data_box, so that entry (dx,dy,dz) is at xi + xrow[...] + dx.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixCCBoxStencil( hypre_StructMatrix *A,
+                                HYPRE_Int           box_id,
+                                HYPRE_Int           skip_rank,
+                                HYPRE_Complex       scale,
+                                hypre_Box          *x_data_box,
+                                HYPRE_Complex      *coefs,
+                                HYPRE_Int          *xrow )
+{
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(A);
+   HYPRE_Int            box_stencil, corners, si, d, k, Ai;
+   hypre_Index          index;
+
+   if (ndim == 2 && stencil_size == 9)
+   {
+      box_stencil = 9;
+   }
+   else if (ndim == 3 && (stencil_size == 19 || stencil_size == 27))
+   {
+      box_stencil = 27;
+   }
+   else
+   {
+      return 0;
+   }
+
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(stencil_shape[si], d)) > 1)
+         {
+            return 0;
+         }
+      }
+   }
+
+   Ai = hypre_CCBoxIndexRank_noargs();
+   for (k = 0; k < 27; k++)
+   {
+      coefs[k] = 0.0;
+   }
+   corners = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      k = 13;
+      for (d = 0; d < ndim; d++)
+      {
+         k += hypre_IndexD(stencil_shape[si], d) * ((d == 0) ? 1 : ((d == 1) ? 3 : 9));
+      }
+      if (si != skip_rank)
+      {
+         coefs[k] = hypre_StructMatrixBoxData(A, box_id, si)[Ai] * scale;
+      }
+      if ((k % 3) != 1 && ((k / 3) % 3) != 1 && (k / 9) != 1)
+      {
+         corners++;
+      }
+   }
+   if (box_stencil == 27 && corners == 0)
+   {
+      box_stencil = 19;
+   }
+
+   hypre_SetIndex(index, 0);
+   for (k = 0; k < 9; k++)
+   {
+      hypre_IndexD(index, 1) = (k % 3) - 1;
+      if (ndim > 2)
+      {
+         hypre_IndexD(index, 2) = (k / 3) - 1;
+      }
+      xrow[k] = hypre_BoxOffsetDistance(x_data_box, index);
+   }
+
+   return box_stencil;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC1
  * core of struct matvec computation, for the case constant_coefficient==1
@@ -633,6 +729,10 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
    HYPRE_Int                xoff5;
    HYPRE_Int                xoff6;
    HYPRE_Int                Ai;
+   HYPRE_Complex            AAs[27];
+   HYPRE_Int                xr[9];
+   HYPRE_Int                xr0, xr1, xr2, xr3, xr4, xr5, xr6, xr7, xr8;
+   HYPRE_Int                box_stencil;
 
    hypre_BoxArray          *compute_box_a;
    hypre_Box               *compute_box;
@@ -674,6 +774,113 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
 
          Ai = 0;
 
+         /* Stencils within a 3x3 or 3x3x3 box (9, 19 and 27 points) are
+            applied in a single pass, with kernels specialized for the box
+            shape, so that y is only streamed once */
+         box_stencil = hypre_StructMatrixCCBoxStencil(A, i, -1, alpha, x_data_box, AAs, xr);
+         if (box_stencil)
+         {
+            xr0 = xr[0]; xr1 = xr[1]; xr2 = xr[2];
+            xr3 = xr[3]; xr4 = xr[4]; xr5 = xr[5];
+            xr6 = xr[6]; xr7 = xr[7]; xr8 = xr[8];
+
+            switch (box_stencil)
+            {
+               case 27:
+#define DEVICE_VAR is_device_ptr(yp,xp)
+                  hypre_BoxLoop2Begin(ndim, loop_size,
+                                      x_data_box, start, stride, xi,
+                                      y_data_box, start, stride, yi);
+                  {
+                     yp[yi] +=
+                        AAs[0] * xp[xi + xr0 - 1] +
+                        AAs[1] * xp[xi + xr0] +
+                        AAs[2] * xp[xi + xr0 + 1] +
+                        AAs[3] * xp[xi + xr1 - 1] +
+                        AAs[4] * xp[xi + xr1] +
+                        AAs[5] * xp[xi + xr1 + 1] +
+                        AAs[6] * xp[xi + xr2 - 1] +
+                        AAs[7] * xp[xi + xr2] +
+                        AAs[8] * xp[xi + xr2 + 1] +
+                        AAs[9] * xp[xi + xr3 - 1] +
+                        AAs[10] * xp[xi + xr3] +
+                        AAs[11] * xp[xi + xr3 + 1] +
+                        AAs[12] * xp[xi + xr4 - 1] +
+                        AAs[13] * xp[xi + xr4] +
+                        AAs[14] * xp[xi + xr4 + 1] +
+                        AAs[15] * xp[xi + xr5 - 1] +
+                        AAs[16] * xp[xi + xr5] +
+                        AAs[17] * xp[xi + xr5 + 1] +
+                        AAs[18] * xp[xi + xr6 - 1] +
+                        AAs[19] * xp[xi + xr6] +
+                        AAs[20] * xp[xi + xr6 + 1] +
+                        AAs[21] * xp[xi + xr7 - 1] +
+                        AAs[22] * xp[xi + xr7] +
+                        AAs[23] * xp[xi + xr7 + 1] +
+                        AAs[24] * xp[xi + xr8 - 1] +
+                        AAs[25] * xp[xi + xr8] +
+                        AAs[26] * xp[xi + xr8 + 1];
+                  }
+                  hypre_BoxLoop2End(xi, yi);
+#undef DEVICE_VAR
+                  break;
+
+               case 19:
+#define DEVICE_VAR is_device_ptr(yp,xp)
+                  hypre_BoxLoop2Begin(ndim, loop_size,
+                                      x_data_box, start, stride, xi,
+                                      y_data_box, start, stride, yi);
+                  {
+                     yp[yi] +=
+                        AAs[1] * xp[xi + xr0] +
+                        AAs[3] * xp[xi + xr1 - 1] +
+                        AAs[4] * xp[xi + xr1] +
+                        AAs[5] * xp[xi + xr1 + 1] +
+                        AAs[7] * xp[xi + xr2] +
+                        AAs[9] * xp[xi + xr3 - 1] +
+                        AAs[10] * xp[xi + xr3] +
+                        AAs[11] * xp[xi + xr3 + 1] +
+                        AAs[12] * xp[xi + xr4 - 1] +
+                        AAs[13] * xp[xi + xr4] +
+                        AAs[14] * xp[xi + xr4 + 1] +
+                        AAs[15] * xp[xi + xr5 - 1] +
+                        AAs[16] * xp[xi + xr5] +
+                        AAs[17] * xp[xi + xr5 + 1] +
+                        AAs[19] * xp[xi + xr6] +
+                        AAs[21] * xp[xi + xr7 - 1] +
+                        AAs[22] * xp[xi + xr7] +
+                        AAs[23] * xp[xi + xr7 + 1] +
+                        AAs[25] * xp[xi + xr8];
+                  }
+                  hypre_BoxLoop2End(xi, yi);
+#undef DEVICE_VAR
+                  break;
+
+               case 9:
+#define DEVICE_VAR is_device_ptr(yp,xp)
+                  hypre_BoxLoop2Begin(ndim, loop_size,
+                                      x_data_box, start, stride, xi,
+                                      y_data_box, start, stride, yi);
+                  {
+                     yp[yi] +=
+                        AAs[9] * xp[xi + xr3 - 1] +
+                        AAs[10] * xp[xi + xr3] +
+                        AAs[11] * xp[xi + xr3 + 1] +
+                        AAs[12] * xp[xi + xr4 - 1] +
+                        AAs[13] * xp[xi + xr4] +
+                        AAs[14] * xp[xi + xr4 + 1] +
+                        AAs[15] * xp[xi + xr5 - 1] +
+                        AAs[16] * xp[xi + xr5] +
+                        AAs[17] * xp[xi + xr5 + 1];
+                  }
+                  hypre_BoxLoop2End(xi, yi);
+#undef DEVICE_VAR
+                  break;
+            }
+
+            continue;
+         }
+
          /* unroll up to depth MAX_DEPTH */
          for (si = 0; si < stencil_size; si+= MAX_DEPTH)
          {
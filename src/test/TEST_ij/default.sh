@@ -25,6 +25,11 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+
+tail -17 ${TNAME}.out.3 | head -6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -33,6 +38,7 @@ FILES="\
  ${TNAME}.out.0\
  ${TNAME}.out.1\
  ${TNAME}.out.2\
+ ${TNAME}.out.3\
 "
 
 for i in $FILES
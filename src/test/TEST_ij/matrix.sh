@@ -24,6 +24,37 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+# IJ: bulk (sort and reduce) assembly diffed against the default assembly
+#=============================================================================
+
+tail -3 ${TNAME}.out.5 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.18 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.6 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.19 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# IJ: system read back from the binary (MPI-IO) files of the same run,
+#     and matrix mapped from the binary file
+#=============================================================================
+
+tail -3 ${TNAME}.out.13 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.14 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+tail -3 ${TNAME}.out.16 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# IJ: a truncated binary file must be rejected with an error, not a crash
+#=============================================================================
+
+if [ "`grep -c "^Error: .*ParCSR.trunc.bin" ${TNAME}.out.20`" != "1" ]; then
+   echo "Truncated mapped file was not rejected in ${TNAME}.out.20" >&2
+fi
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -42,6 +73,13 @@ FILES="\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
  ${TNAME}.out.12\
+ ${TNAME}.out.13\
+ ${TNAME}.out.14\
+ ${TNAME}.out.15\
+ ${TNAME}.out.16\
+ ${TNAME}.out.17\
+ ${TNAME}.out.18\
+ ${TNAME}.out.19\
 "
 
 for i in $FILES
@@ -0,0 +1,46 @@
+#!/bin/sh
+# Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+FILES="\
+ ${TNAME}.out.0\
+ ${TNAME}.out.1\
+ ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+"
+
+#=============================================================================
+# every exchange must match the non-persistent one exactly
+#=============================================================================
+
+for i in $FILES
+do
+  if [ `grep "max difference = 0.000000e+00" $i | wc -l` != "1" ]; then
+     echo "CommPkg exchanges differ in $i" >&2
+  fi
+done
+
+#=============================================================================
+# compare with baseline case
+#=============================================================================
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "CommPkg exchanges" $i
+  tail -3 $i
+done > ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
@@ -49,6 +49,13 @@
 
 #include "HYPRE_lobpcg.h"
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 /* max dt */
 #define DT_INF 1.0e30
 HYPRE_Int
@@ -62,6 +69,7 @@ extern "C" {
 
 HYPRE_Int BuildParFromFile (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_ParCSRMatrix *A_ptr );
 HYPRE_Int ReadParVectorFromFile (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_ParVector *b_ptr );
+HYPRE_Int BuildIJFromMappedFile (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_Int nnz_partition , HYPRE_IJMatrix *A_ptr );
 
 HYPRE_Int BuildParLaplacian (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_ParCSRMatrix *A_ptr );
 HYPRE_Int BuildParSysLaplacian (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_ParCSRMatrix *A_ptr );
@@ -108,6 +116,7 @@ main( hypre_int argc,
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
+   HYPRE_Int           bulk_flag = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
    HYPRE_Int           build_rhs_type;
@@ -124,6 +133,8 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           pcg_variant = 0;
+   HYPRE_Int           num_rhs = 1;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           debug_flag;
@@ -152,6 +163,8 @@ main( hypre_int argc,
    HYPRE_ParVector     *interp_vecs = NULL;
    HYPRE_ParVector     residual = NULL;
    HYPRE_ParVector     x0_save = NULL;
+   HYPRE_ParVector     b_mv = NULL;
+   HYPRE_ParVector     x_mv = NULL;
 
    HYPRE_Solver        amg_solver;
    HYPRE_Solver        amgdd_solver;
@@ -251,6 +264,10 @@ main( hypre_int argc,
 #else
    HYPRE_Int    keepTranspose = 0;
 #endif
+   HYPRE_Int    amg_reuse = 0;
+   HYPRE_Int    amg_mixed_prec = 0;
+   HYPRE_Real   async_relax_time = 0.0;
+   HYPRE_Int    amg_resetups = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -300,6 +317,8 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    s_step = 1;
+   HYPRE_Int    s_basis = 1;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -317,6 +336,8 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int    print_system = 0;
+   HYPRE_Int    print_system_binary = 0;
+   HYPRE_Int    mmap_nnz_partition = 0;
    HYPRE_Int    rel_change = 0;
 
    /* begin lobpcg */
@@ -428,6 +449,12 @@ main( hypre_int argc,
 #if defined(HYPRE_USING_GPU)
    HYPRE_Int spgemm_use_cusparse = 1;
 #endif
+   HYPRE_Int spmv_format = 0;
+   HYPRE_Int spmv_simd = -1;
+   HYPRE_Int matvec_overlap = 0;
+   HYPRE_Int comm_neighbor_coll = 0;
+   HYPRE_Int matmul_fused = 0;
+   HYPRE_Int host_pool = 0;
    HYPRE_ExecutionPolicy default_exec_policy = HYPRE_EXEC_HOST;
    HYPRE_MemoryLocation memory_location = HYPRE_MEMORY_DEVICE;
 
@@ -489,6 +516,23 @@ main( hypre_int argc,
          build_matrix_type      = 0;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-fromparcsrmmap") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -2;
+         build_matrix_arg_index = arg_index;
+      }
+      else if ( strcmp(argv[arg_index], "-mmap_nnzpart") == 0 )
+      {
+         arg_index++;
+         mmap_nnz_partition = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-fromparcsrbinfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 8;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-fromonecsrfile") == 0 )
       {
          arg_index++;
@@ -578,6 +622,11 @@ main( hypre_int argc,
          arg_index++;
          omp_flag = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-bulk") == 0 )
+      {
+         arg_index++;
+         bulk_flag = 1;
+      }
       else if ( strcmp(argv[arg_index], "-check_constant") == 0 )
       {
          arg_index++;
@@ -626,6 +675,12 @@ main( hypre_int argc,
          build_rhs_type      = 7;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsparcsrbinfile") == 0 )
+      {
+         arg_index++;
+         build_rhs_type      = 8;
+         build_rhs_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-rhsisone") == 0 )
       {
          arg_index++;
@@ -1113,6 +1168,36 @@ main( hypre_int argc,
          ilu_nsh_droptol = atof(argv[arg_index++]);
       }
       /* end ilu options */
+      else if ( strcmp(argv[arg_index], "-spmv_format") == 0 )
+      {
+         arg_index++;
+         spmv_format = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-spmv_simd") == 0 )
+      {
+         arg_index++;
+         spmv_simd = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-matvec_overlap") == 0 )
+      {
+         arg_index++;
+         matvec_overlap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-comm_neighbor") == 0 )
+      {
+         arg_index++;
+         comm_neighbor_coll = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-matmul_fused") == 0 )
+      {
+         arg_index++;
+         matmul_fused = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-host_pool") == 0 )
+      {
+         arg_index++;
+         host_pool = atoi(argv[arg_index++]);
+      }
 #if defined(HYPRE_USING_GPU)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
       {
@@ -1250,6 +1335,16 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-s_step") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-s_basis") == 0 )
+      {
+         arg_index++;
+         s_basis = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1462,6 +1557,16 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pcg_variant") == 0 )
+      {
+         arg_index++;
+         pcg_variant = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-num_rhs") == 0 )
+      {
+         arg_index++;
+         num_rhs = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1645,6 +1750,26 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-amg_reuse") == 0 )
+      {
+         arg_index++;
+         amg_reuse  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mixed_prec") == 0 )
+      {
+         arg_index++;
+         amg_mixed_prec  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-async_time") == 0 )
+      {
+         arg_index++;
+         async_relax_time  = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_resetups") == 0 )
+      {
+         arg_index++;
+         amg_resetups  = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1667,6 +1792,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printbin") == 0 )
+      {
+         arg_index++;
+         print_system_binary = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1782,6 +1912,12 @@ main( hypre_int argc,
          hypre_printf("matrix read from multiple files (IJ format)\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
+         hypre_printf("  -fromparcsrbinfile <filename> : ");
+         hypre_printf("matrix read from a single binary file (MPI-IO)\n");
+         hypre_printf("  -fromparcsrmmap <filename>    : ");
+         hypre_printf("matrix mapped from a single binary file into IJ\n");
+         hypre_printf("  -mmap_nnzpart               : ");
+         hypre_printf("split the mapped rows across processors by nonzeros\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
          hypre_printf("matrix read from a single file (CSR format)\n");
          hypre_printf("\n");
@@ -1808,6 +1944,8 @@ main( hypre_int argc,
          hypre_printf("rhs read from a single file (CSR format)\n");
          hypre_printf("  -rhsparcsrfile        :  ");
          hypre_printf("rhs read from multiple files (ParCSR format)\n");
+         hypre_printf("  -rhsparcsrbinfile     :  ");
+         hypre_printf("rhs read from a single binary file (MPI-IO)\n");
          hypre_printf("  -Ffromonefile          : ");
          hypre_printf("list of F points from a single file\n");
          hypre_printf("  -SFfromonefile          : ");
@@ -1920,6 +2058,9 @@ main( hypre_int argc,
          hypre_printf("       16=Chebyshev  \n");
          hypre_printf("       17=FCF-Jacobi  \n");
          hypre_printf("       18=L1-Jacobi (may be used with -CF) \n");
+         hypre_printf("       30=asynchronous L1-Gauss-Seidel, -ns sweeps without synchronization \n");
+         hypre_printf("       31=multicolor Gauss-Seidel (colors reversed on the up cycle) \n");
+         hypre_printf("       32=multicolor symmetric Gauss-Seidel \n");
          hypre_printf("       9=Gauss elimination (use for coarsest grid only)  \n");
          hypre_printf("       99=Gauss elimination with pivoting (use for coarsest grid only)  \n");
          hypre_printf("       20= Nodal Weighted Jacobi (for systems only) \n");
@@ -1929,6 +2070,7 @@ main( hypre_int argc,
          hypre_printf("  -rlx_coarse  <val>       : set relaxation type for coarsest grid\n");
          hypre_printf("  -rlx_down    <val>       : set relaxation type for down cycle\n");
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
+         hypre_printf("  -async_time  <val>       : time budget in seconds of the asynchronous smoother (default is 0: none)\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
@@ -1971,6 +2113,10 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -pcg_variant <val>     : PCG variant (0 standard, 1 single reduction, 2 pipelined)\n");
+         hypre_printf("  -num_rhs <val>         : also solve for val right-hand sides at once (solvers 0, 1, 3)\n");
+         hypre_printf("  -s_step <val>          : COGMRES s-step block size (1 = standard)\n");
+         hypre_printf("  -s_basis <val>         : s-step basis (0 monomial, 1 Newton, 2 Chebyshev)\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
@@ -1980,6 +2126,9 @@ main( hypre_int argc,
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
+         hypre_printf("  -amg_reuse  <val>      : 1 = keep the splittings and interpolation in AMG re-setups\n");
+         hypre_printf("  -mixed_prec  <val>     : AMG hierarchy in single precision, 1 = coarse levels, 2 = all levels\n");
+         hypre_printf("  -amg_resetups  <val>   : number of additional AMG setups before the solve\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
          hypre_printf("  -sai_filt <val>        : set ParaSAILS filter = val \n");
@@ -2002,6 +2151,21 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -printbin              : print the system in binary (MPI-IO) format\n");
+         hypre_printf("\n");
+         hypre_printf("  -spmv_format <val>     : host SpMV storage format\n");
+         hypre_printf("       0=CSR (default)  1=SELL-C-sigma  2=CSR with 16/32-bit column offsets\n");
+         hypre_printf("  -spmv_simd <val>       : host SpMV instruction set, capped by the CPU\n");
+         hypre_printf("       -1=best supported (default)  0=scalar  1=AVX2  2=AVX-512\n");
+         hypre_printf("  -matvec_overlap <val>  : compute the interior rows of the ParCSR matvec\n");
+         hypre_printf("                           during the halo exchange, testing it every\n");
+         hypre_printf("                           <val> rows (0=off (default))\n");
+         hypre_printf("  -comm_neighbor <val>   : ParCSR halo exchange with MPI neighborhood\n");
+         hypre_printf("                           collectives (0=off (default), 1=on)\n");
+         hypre_printf("  -matmul_fused <val>    : ParCSR matmul with the fused diag/offd\n");
+         hypre_printf("                           kernel (0=off (default), 1=on)\n");
+         hypre_printf("  -host_pool <val>       : serve small host allocations from the\n");
+         hypre_printf("                           size-class memory pool (0=off (default), 1=on)\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2183,6 +2347,24 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* host SpMV storage format (0: CSR, 1: SELL-C-sigma, 2: short column indices) */
+   HYPRE_CSRMatrixSetSpMVFormat(spmv_format);
+
+   /* host SpMV instruction set (-1: auto, 0: scalar, 1: AVX2, 2: AVX-512) */
+   HYPRE_CSRMatrixSetSpMVSimd(spmv_simd);
+
+   /* interior/boundary split of the ParCSR matvec */
+   HYPRE_SetParCSRMatvecOverlap(matvec_overlap);
+
+   /* neighborhood collectives for the ParCSR halo exchange */
+   HYPRE_SetParCSRCommNeighborColl(comm_neighbor_coll);
+
+   /* fused diag/offd kernel in the ParCSR matmul */
+   HYPRE_SetParMatmulFused(matmul_fused);
+
+   /* size-class pool for small host allocations */
+   HYPRE_SetHostMemoryPool(host_pool);
+
 #if defined(HYPRE_USING_GPU)
    /* use cuSPARSE for SpGEMM */
    HYPRE_CSRMatrixSetSpGemmUseCusparse(spgemm_use_cusparse);
@@ -2210,6 +2392,13 @@ main( hypre_int argc,
          exit(1);
       }
    }
+   else if ( build_matrix_type == -2 )
+   {
+      if (BuildIJFromMappedFile(argc, argv, build_matrix_arg_index, mmap_nnz_partition, &ij_A))
+      {
+         goto final;
+      }
+   }
    else if ( build_matrix_type == 0 )
    {
       BuildParFromFile(argc, argv, build_matrix_arg_index, &parcsr_A);
@@ -2245,6 +2434,14 @@ main( hypre_int argc,
    {
       BuildParRotate7pt(argc, argv, build_matrix_arg_index, &parcsr_A);
    }
+   else if ( build_matrix_type == 8 )
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  FromBinaryFile: %s\n", argv[build_matrix_arg_index]);
+      }
+      HYPRE_ParCSRMatrixReadBinary(hypre_MPI_COMM_WORLD, argv[build_matrix_arg_index], &parcsr_A);
+   }
 
    else
    {
@@ -2425,6 +2622,11 @@ main( hypre_int argc,
          ierr = HYPRE_IJMatrixSetRowSizes ( ij_A, (const HYPRE_Int *) row_sizes );
       }
 
+      if (bulk_flag)
+      {
+         HYPRE_IJMatrixSetBulkAssembly(ij_A, 1);
+      }
+
       ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
 
       if (omp_flag)
@@ -2741,6 +2943,33 @@ main( hypre_int argc,
       ierr = HYPRE_IJVectorGetObject( ij_x, &object );
       x = (HYPRE_ParVector) object;
    }
+   else if (build_rhs_type == 8)
+   {
+      HYPRE_BigInt *partitioning = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+
+      if (myid == 0)
+      {
+         hypre_printf("  RHS vector read from binary file %s\n", argv[build_rhs_arg_index]);
+         hypre_printf("  Initial guess is 0\n");
+      }
+
+      /* distribute b like the rows of A */
+      partitioning[0] = first_local_row;
+      partitioning[1] = last_local_row + 1;
+      ij_b = NULL;
+      b = (HYPRE_ParVector) hypre_ParVectorReadBinary(hypre_MPI_COMM_WORLD,
+                                                      argv[build_rhs_arg_index],
+                                                      partitioning);
+
+      /* initial guess */
+      HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, first_local_col, last_local_col, &ij_x);
+      HYPRE_IJVectorSetObjectType(ij_x, HYPRE_PARCSR);
+      HYPRE_IJVectorInitialize(ij_x);
+      HYPRE_IJVectorAssemble(ij_x);
+
+      ierr = HYPRE_IJVectorGetObject( ij_x, &object );
+      x = (HYPRE_ParVector) object;
+   }
    else if ( build_rhs_type == 2 )
    {
       if (myid == 0)
@@ -3218,6 +3447,11 @@ main( hypre_int argc,
       }
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x0");
    }
+   if (print_system_binary)
+   {
+      HYPRE_ParCSRMatrixPrintBinary(parcsr_A, "ParCSR.out.A.bin");
+      HYPRE_ParVectorPrintBinary(b, "ParVec.out.b.bin");
+   }
 
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
@@ -3231,6 +3465,36 @@ main( hypre_int argc,
    x0_save = hypre_ParVectorCloneDeep_v2(x, hypre_ParVectorMemoryLocation(x));
 #endif
 
+   /* multivector right-hand side: column 0 is b, the others are random */
+   if (num_rhs > 1)
+   {
+      hypre_Vector *b_local = hypre_ParVectorLocalVector(b);
+      HYPRE_Int     local_size = hypre_VectorSize(b_local);
+      HYPRE_Int     idxstride;
+
+      b_mv = hypre_ParMultiVectorCreate(hypre_ParVectorComm(b),
+                                        hypre_ParVectorGlobalSize(b),
+                                        hypre_ParVectorPartitioning(b),
+                                        num_rhs);
+      hypre_ParVectorInitialize_v2(b_mv, hypre_ParVectorMemoryLocation(b));
+      hypre_ParVectorSetPartitioningOwner(b_mv, 0);
+      x_mv = hypre_ParMultiVectorCreate(hypre_ParVectorComm(b),
+                                        hypre_ParVectorGlobalSize(b),
+                                        hypre_ParVectorPartitioning(b),
+                                        num_rhs);
+      hypre_ParVectorInitialize_v2(x_mv, hypre_ParVectorMemoryLocation(b));
+      hypre_ParVectorSetPartitioningOwner(x_mv, 0);
+
+      hypre_ParVectorSetRandomValues(b_mv, 22775);
+      hypre_ParVectorSetConstantValues(x_mv, 0.0);
+      idxstride = hypre_VectorIndexStride(hypre_ParVectorLocalVector(b_mv));
+      for (i = 0; i < local_size; i++)
+      {
+         hypre_VectorData(hypre_ParVectorLocalVector(b_mv))[i * idxstride] =
+            hypre_VectorData(b_local)[i];
+      }
+   }
+
    /*-----------------------------------------------------------
     * Solve the system using the hybrid solver
     *-----------------------------------------------------------*/
@@ -3545,6 +3809,9 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetReuseSetup(amg_solver, amg_reuse);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, amg_mixed_prec);
+      HYPRE_BoomerAMGSetAsyncRelaxTime(amg_solver, async_relax_time);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -3598,6 +3865,22 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (solver_id == 0 && amg_resetups > 0)
+      {
+         time_index = hypre_InitializeTiming("BoomerAMG Re-Setup");
+         hypre_BeginTiming(time_index);
+
+         for (j = 0; j < amg_resetups; j++)
+         {
+            HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Re-setup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+      }
+
       if (solver_id == 0)
       {
          time_index = hypre_InitializeTiming("BoomerAMG Solve");
@@ -3662,6 +3945,29 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (solver_id == 0 && num_rhs > 1)
+      {
+         time_index = hypre_InitializeTiming("BoomerAMG Multi-RHS Solve");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b_mv, x_mv);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("BoomerAMG Multi-RHS (%d) Iterations = %d\n", num_rhs, num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       //HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3929,6 +4235,7 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetVariant(pcg_solver, pcg_variant);
 
       if (solver_id == 1)
       {
@@ -4025,6 +4332,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, amg_mixed_prec);
+         HYPRE_BoomerAMGSetAsyncRelaxTime(pcg_precond, async_relax_time);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4377,6 +4686,53 @@ main( hypre_int argc,
       hypre_ClearTiming();
 #endif
 
+      if (solver_id == 1 && num_rhs > 1)
+      {
+         HYPRE_Solver block_solver;
+         HYPRE_Int    block_num_iterations;
+         HYPRE_Real   block_res_norm;
+
+         time_index = hypre_InitializeTiming("Block PCG Setup");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_ParCSRBlockPCGCreate(hypre_MPI_COMM_WORLD, &block_solver);
+         HYPRE_ParCSRBlockPCGSetMaxIter(block_solver, max_iter);
+         HYPRE_ParCSRBlockPCGSetTol(block_solver, tol);
+         HYPRE_ParCSRBlockPCGSetPrintLevel(block_solver, ioutdat);
+         HYPRE_ParCSRBlockPCGSetPrecond(block_solver,
+                                        (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSolve,
+                                        (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSetup,
+                                        pcg_precond);
+         HYPRE_ParCSRBlockPCGSetup(block_solver, parcsr_A, b_mv, x_mv);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         time_index = hypre_InitializeTiming("Block PCG Solve");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_ParCSRBlockPCGSolve(block_solver, parcsr_A, b_mv, x_mv);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_ParCSRBlockPCGGetNumIterations(block_solver, &block_num_iterations);
+         HYPRE_ParCSRBlockPCGGetFinalRelativeResidualNorm(block_solver, &block_res_norm);
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("Block PCG (%d rhs) Iterations = %d\n", num_rhs, block_num_iterations);
+            hypre_printf("Final Max Relative Residual Norm = %e\n", block_res_norm);
+            hypre_printf("\n");
+         }
+
+         HYPRE_ParCSRBlockPCGDestroy(block_solver);
+      }
+
       HYPRE_ParCSRPCGDestroy(pcg_solver);
 
       if (solver_id == 1)
@@ -5476,6 +5832,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(amg_precond, amg_mixed_prec);
+         HYPRE_BoomerAMGSetAsyncRelaxTime(amg_precond, async_relax_time);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -5792,6 +6150,54 @@ main( hypre_int argc,
                        (HYPRE_Vector)x);
 #endif
 
+      if (solver_id == 3 && num_rhs > 1)
+      {
+         HYPRE_Solver block_solver;
+         HYPRE_Int    block_num_iterations;
+         HYPRE_Real   block_res_norm;
+
+         time_index = hypre_InitializeTiming("Block GMRES Setup");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_ParCSRBlockGMRESCreate(hypre_MPI_COMM_WORLD, &block_solver);
+         HYPRE_ParCSRBlockGMRESSetKDim(block_solver, k_dim);
+         HYPRE_ParCSRBlockGMRESSetMaxIter(block_solver, max_iter);
+         HYPRE_ParCSRBlockGMRESSetTol(block_solver, tol);
+         HYPRE_ParCSRBlockGMRESSetPrintLevel(block_solver, ioutdat);
+         HYPRE_ParCSRBlockGMRESSetPrecond(block_solver,
+                                          (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSolve,
+                                          (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSetup,
+                                          amg_precond);
+         HYPRE_ParCSRBlockGMRESSetup(block_solver, parcsr_A, b_mv, x_mv);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         time_index = hypre_InitializeTiming("Block GMRES Solve");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_ParCSRBlockGMRESSolve(block_solver, parcsr_A, b_mv, x_mv);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_ParCSRBlockGMRESGetNumIterations(block_solver, &block_num_iterations);
+         HYPRE_ParCSRBlockGMRESGetFinalRelativeResidualNorm(block_solver, &block_res_norm);
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("Block GMRES (%d rhs) Iterations = %d\n", num_rhs, block_num_iterations);
+            hypre_printf("Final Max Relative Residual Norm = %e\n", block_res_norm);
+            hypre_printf("\n");
+         }
+
+         HYPRE_ParCSRBlockGMRESDestroy(block_solver);
+      }
+
       HYPRE_ParCSRGMRESDestroy(pcg_solver);
 
       if (solver_id == 3)
@@ -6743,6 +7149,8 @@ main( hypre_int argc,
       HYPRE_COGMRESSetKDim(pcg_solver, k_dim);
       HYPRE_COGMRESSetUnroll(pcg_solver, unroll);
       HYPRE_COGMRESSetCGS(pcg_solver, cgs);
+      HYPRE_COGMRESSetSStep(pcg_solver, s_step);
+      HYPRE_COGMRESSetSStepBasis(pcg_solver, s_basis);
       HYPRE_COGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_COGMRESSetTol(pcg_solver, tol);
       HYPRE_COGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -7146,6 +7554,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, amg_mixed_prec);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7473,6 +7882,10 @@ main( hypre_int argc,
    {
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x");
    }
+   if (print_system_binary)
+   {
+      HYPRE_ParVectorPrintBinary(x, "ParVec.out.x.bin");
+   }
 
    /*-----------------------------------------------------------
     * Finalize things
@@ -7481,8 +7894,10 @@ main( hypre_int argc,
   final:
 
    HYPRE_ParVectorDestroy(x0_save);
+   HYPRE_ParVectorDestroy(b_mv);
+   HYPRE_ParVectorDestroy(x_mv);
 
-   if (test_ij || build_matrix_type == -1)
+   if (test_ij || build_matrix_type < 0)
    {
       HYPRE_IJMatrixDestroy(ij_A);
    }
@@ -7491,8 +7906,9 @@ main( hypre_int argc,
       HYPRE_ParCSRMatrixDestroy(parcsr_A);
    }
 
-   /* for build_rhs_type = 1, 6 or 7, we did not create ij_b  - just b*/
-   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7)
+   /* for build_rhs_type = 1, 6, 7 or 8, we did not create ij_b  - just b*/
+   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7 ||
+       build_rhs_type == 8)
    {
       HYPRE_ParVectorDestroy(b);
    }
@@ -7530,6 +7946,17 @@ main( hypre_int argc,
       hypre_TFree(isolated_fpt_index, HYPRE_MEMORY_HOST);
    }
 
+#ifdef HYPRE_PROFILE
+   if (matvec_overlap && myid == 0)
+   {
+      HYPRE_Real hidden  = hypre_profile_times[HYPRE_TIMER_ID_HALO_OVERLAP];
+      HYPRE_Real exposed = hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE];
+
+      hypre_printf("Halo exchange: %e s hidden, %e s exposed, overlap fraction %.3f\n",
+                   hidden, exposed, (hidden + exposed > 0.0) ? hidden / (hidden + exposed) : 0.0);
+   }
+#endif
+
    /*
       hypre_FinalizeMemoryDebug();
    */
@@ -8445,6 +8872,300 @@ BuildParDifConv( HYPRE_Int                  argc,
    return (0);
 }
 
+/*----------------------------------------------------------------------
+ * Build IJ matrix from a binary ParCSR file (hypre_ParCSRMatrixPrintBinary)
+ * that is mapped into memory.  The local rows are handed to
+ * HYPRE_IJMatrixSetValues straight from the mapped pages; only the column
+ * indices are converted when HYPRE_BigInt is narrower than 64 bits.
+ * Rows are split evenly across the processors, or by number of nonzeros
+ * if nnz_partition is set.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+BuildIJFromMappedFile( HYPRE_Int                  argc,
+                       char                      *argv[],
+                       HYPRE_Int                  arg_index,
+                       HYPRE_Int                  nnz_partition,
+                       HYPRE_IJMatrix            *A_ptr     )
+{
+#if defined(_WIN32)
+   hypre_printf("Error: memory-mapped input is not supported on this platform\n");
+   exit(1);
+   return (0);
+#else
+   char                *filename;
+   HYPRE_IJMatrix       A;
+   HYPRE_Int            myid, num_procs, fd, ierr = 0;
+   HYPRE_Int            num_rows, i, k, size, rest;
+   HYPRE_Int           *ncols, *diag_sizes, *offd_sizes;
+   HYPRE_BigInt        *rows, *cols;
+   HYPRE_BigInt         ilower, iupper, jlower, jupper, global_num_rows, global_num_cols;
+   HYPRE_BigInt         lo, hi, mid;
+   hypre_ulonglongint  *header, *row_ptr, *col_ind, nnz, target, col, j;
+   hypre_ulonglongint   file_words, offset;
+   HYPRE_Complex       *values;
+   struct stat          st;
+   void                *map;
+
+   /*-----------------------------------------------------------
+    * Initialize some stuff
+    *-----------------------------------------------------------*/
+
+   hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs );
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid );
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+
+   if (arg_index < argc)
+   {
+      filename = argv[arg_index];
+   }
+   else
+   {
+      hypre_printf("Error: No filename specified \n");
+      exit(1);
+   }
+
+   /*-----------------------------------------------------------
+    * Print driver parameters
+    *-----------------------------------------------------------*/
+
+   if (myid == 0)
+   {
+      hypre_printf("  FromMappedFile: %s\n", filename);
+      hypre_printf("    rows partitioned by %s\n", nnz_partition ? "nonzeros" : "rows");
+   }
+
+   /*-----------------------------------------------------------
+    * Map the file and locate the arrays
+    *-----------------------------------------------------------*/
+
+   fd = open(filename, O_RDONLY);
+   if (fd < 0 || fstat(fd, &st) != 0)
+   {
+      hypre_printf("Error: can't open input file %s\n", filename);
+      exit(1);
+   }
+   map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if (map == MAP_FAILED)
+   {
+      hypre_printf("Error: can't map input file %s\n", filename);
+      exit(1);
+   }
+
+   /* every access below must stay inside the file, or the mapping faults;
+      the header counts are bounded by the file size first, so the sums cannot wrap */
+   file_words = (hypre_ulonglongint) st.st_size / sizeof(hypre_ulonglongint);
+   header = (hypre_ulonglongint *) map;
+   if (file_words < hypre_BINARY_IO_HEADER_SIZE ||
+       header[0] != hypre_BINARY_IO_MATRIX_MAGIC || header[1] != hypre_BINARY_IO_VERSION ||
+       header[5] != sizeof(HYPRE_Complex))
+   {
+      hypre_printf("Error: %s is not a compatible binary matrix file\n", filename);
+      munmap(map, (size_t) st.st_size);
+      return (1);
+   }
+   nnz    = header[4];
+   offset = hypre_BINARY_IO_HEADER_SIZE + 2 * (header[6] + 1) + (header[2] + 1) + nnz;
+   if (header[2] >= file_words || header[4] >= file_words || header[6] >= file_words ||
+       offset > file_words ||
+       nnz > (file_words - offset) * sizeof(hypre_ulonglongint) / sizeof(HYPRE_Complex) ||
+       (HYPRE_BigInt) header[2] < 0 || (HYPRE_BigInt) header[3] < 0)
+   {
+      hypre_printf("Error: %s is shorter than its header describes\n", filename);
+      munmap(map, (size_t) st.st_size);
+      return (1);
+   }
+   global_num_rows = (HYPRE_BigInt) header[2];
+   global_num_cols = (HYPRE_BigInt) header[3];
+   row_ptr = header + hypre_BINARY_IO_HEADER_SIZE + 2 * (header[6] + 1);
+   col_ind = row_ptr + header[2] + 1;
+   values  = (HYPRE_Complex *) (col_ind + nnz);
+   if (row_ptr[0] != 0 || row_ptr[header[2]] != nnz)
+   {
+      hypre_printf("Error: %s has a corrupt row pointer array\n", filename);
+      munmap(map, (size_t) st.st_size);
+      return (1);
+   }
+
+   /*-----------------------------------------------------------
+    * Local row and column ranges
+    *-----------------------------------------------------------*/
+
+   if (nnz_partition)
+   {
+      /* first row whose entries start at or after myid/num_procs of nnz */
+      target = nnz / num_procs * myid + nnz % num_procs * myid / num_procs;
+      lo = 0;
+      hi = global_num_rows;
+      while (lo < hi)
+      {
+         mid = lo + (hi - lo) / 2;
+         if (row_ptr[mid] < target)
+         {
+            lo = mid + 1;
+         }
+         else
+         {
+            hi = mid;
+         }
+      }
+      ilower = lo;
+
+      target = nnz / num_procs * (myid + 1) + nnz % num_procs * (myid + 1) / num_procs;
+      lo = 0;
+      hi = global_num_rows;
+      while (lo < hi)
+      {
+         mid = lo + (hi - lo) / 2;
+         if (row_ptr[mid] < target)
+         {
+            lo = mid + 1;
+         }
+         else
+         {
+            hi = mid;
+         }
+      }
+      iupper = (myid == num_procs - 1) ? global_num_rows - 1 : lo - 1;
+   }
+   else
+   {
+      size = (HYPRE_Int) (global_num_rows / num_procs);
+      rest = (HYPRE_Int) (global_num_rows - (HYPRE_BigInt) size * num_procs);
+      ilower = (HYPRE_BigInt) size * myid + hypre_min(myid, rest);
+      iupper = (HYPRE_BigInt) size * (myid + 1) + hypre_min(myid + 1, rest) - 1;
+   }
+
+   if (global_num_rows == global_num_cols)
+   {
+      jlower = ilower;
+      jupper = iupper;
+   }
+   else
+   {
+      size = (HYPRE_Int) (global_num_cols / num_procs);
+      rest = (HYPRE_Int) (global_num_cols - (HYPRE_BigInt) size * num_procs);
+      jlower = (HYPRE_BigInt) size * myid + hypre_min(myid, rest);
+      jupper = (HYPRE_BigInt) size * (myid + 1) + hypre_min(myid + 1, rest) - 1;
+   }
+   num_rows = (HYPRE_Int) (iupper - ilower + 1);
+
+   /*-----------------------------------------------------------
+    * Row sizes, so that the IJ matrix is allocated exactly once
+    *-----------------------------------------------------------*/
+
+   ncols      = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   rows       = hypre_CTAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   diag_sizes = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   offd_sizes = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      rows[i]  = ilower + (HYPRE_BigInt) i;
+      if (row_ptr[rows[i] + 1] < row_ptr[rows[i]] || row_ptr[rows[i] + 1] > nnz)
+      {
+         ierr = 1;
+         break;
+      }
+      ncols[i] = (HYPRE_Int) (row_ptr[rows[i] + 1] - row_ptr[rows[i]]);
+      for (j = row_ptr[rows[i]]; j < row_ptr[rows[i] + 1]; j++)
+      {
+         col = col_ind[j];
+         if (col >= (hypre_ulonglongint) jlower && col <= (hypre_ulonglongint) jupper)
+         {
+            diag_sizes[i]++;
+         }
+         else
+         {
+            offd_sizes[i]++;
+         }
+      }
+   }
+
+   /* the header checks agree on every rank, the local rows may not */
+   hypre_MPI_Allreduce(hypre_MPI_IN_PLACE, &ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX,
+                       hypre_MPI_COMM_WORLD);
+   if (ierr)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Error: %s has a corrupt row pointer array\n", filename);
+      }
+      munmap(map, (size_t) st.st_size);
+      hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+      hypre_TFree(rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(diag_sizes, HYPRE_MEMORY_HOST);
+      hypre_TFree(offd_sizes, HYPRE_MEMORY_HOST);
+      return (1);
+   }
+
+   /*-----------------------------------------------------------
+    * Generate the matrix
+    *-----------------------------------------------------------*/
+
+   HYPRE_IJMatrixCreate(hypre_MPI_COMM_WORLD, ilower, iupper, jlower, jupper, &A);
+   HYPRE_IJMatrixSetObjectType(A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetDiagOffdSizes(A, diag_sizes, offd_sizes);
+   HYPRE_IJMatrixInitialize(A);
+
+   if (num_rows)
+   {
+      values += row_ptr[ilower];
+      if (sizeof(HYPRE_BigInt) == sizeof(hypre_ulonglongint))
+      {
+         HYPRE_IJMatrixSetValues(A, num_rows, ncols, rows,
+                                 (HYPRE_BigInt *) (col_ind + row_ptr[ilower]), values);
+      }
+      else
+      {
+         /* narrow the column indices, a block of rows at a time */
+         HYPRE_Int block_rows, block_nnz, max_block_nnz = 1 << 20;
+
+         cols = hypre_TAlloc(HYPRE_BigInt, max_block_nnz, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_rows; i += block_rows)
+         {
+            block_nnz = 0;
+            for (block_rows = 0; i + block_rows < num_rows; block_rows++)
+            {
+               if (block_rows && block_nnz + ncols[i + block_rows] > max_block_nnz)
+               {
+                  break;
+               }
+               block_nnz += ncols[i + block_rows];
+            }
+            if (block_nnz > max_block_nnz)
+            {
+               max_block_nnz = block_nnz;
+               cols = hypre_TReAlloc(cols, HYPRE_BigInt, max_block_nnz, HYPRE_MEMORY_HOST);
+            }
+            for (k = 0; k < block_nnz; k++)
+            {
+               cols[k] = (HYPRE_BigInt) col_ind[row_ptr[rows[i]] + k];
+            }
+            HYPRE_IJMatrixSetValues(A, block_rows, ncols + i, rows + i, cols, values);
+            values += block_nnz;
+         }
+         hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   HYPRE_IJMatrixAssemble(A);
+
+   munmap(map, (size_t) st.st_size);
+   hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(diag_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_sizes, HYPRE_MEMORY_HOST);
+
+   *A_ptr = A;
+
+   return (0);
+#endif
+}
+
 /*----------------------------------------------------------------------
  * Build matrix from one file on Proc. 0. Expects matrix to be in
  * CSR format. Distributes matrix across processors giving each about
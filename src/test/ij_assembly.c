@@ -66,6 +66,12 @@ HYPRE_Int test_SetAddSet(MPI_Comm comm, HYPRE_MemoryLocation memory_location, HY
                          HYPRE_BigInt *rows, HYPRE_BigInt *cols,
                          HYPRE_Real *coefs, HYPRE_IJMatrix *ij_A_ptr);
 
+/* stack and sort the entries at assembly, see HYPRE_IJMatrixSetBulkAssembly */
+static HYPRE_Int bulk_assembly = 0;
+
+HYPRE_Int test_Refill(HYPRE_ParCSRMatrix parcsr_A, HYPRE_Int nchunks, HYPRE_Int nrefills,
+                      HYPRE_IJMatrix *ij_A_ptr);
+
 //#define CUDA_PROFILER
 
 hypre_int
@@ -210,6 +216,11 @@ main( hypre_int  argc,
          arg_index++;
          print_matrix = 1;
       }
+      else if ( strcmp(argv[arg_index], "-bulk") == 0 )
+      {
+         arg_index++;
+         bulk_assembly = 1;
+      }
       else
       {
          print_usage = 1; break;
@@ -248,9 +259,11 @@ main( hypre_int  argc,
          hypre_printf("             4 = SetSet\n");
          hypre_printf("             8 = AddSet\n");
          hypre_printf("            16 = SetAddSet\n");
+         hypre_printf("            32 = Refill (frozen pattern, host only)\n");
          hypre_printf("      -option <val>          : interface option of Set/AddToValues\n");
          hypre_printf("             1 = CSR-like (default)\n");
          hypre_printf("             2 = COO-like\n");
+         hypre_printf("      -bulk                  : bulk (sort and reduce) assembly on the host\n");
          hypre_printf("      -print                 : print matrices\n");
          hypre_printf("\n");
       }
@@ -398,6 +411,19 @@ main( hypre_int  argc,
       HYPRE_IJMatrixDestroy(ij_A);
    }
 
+   /* Test refills of a frozen pattern */
+   if (mode & 32)
+   {
+      test_Refill(parcsr_ref, nchunks, 3, &ij_A);
+
+      checkMatrix(parcsr_ref, ij_A);
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_A, "ij_Refill");
+      }
+      HYPRE_IJMatrixDestroy(ij_A);
+   }
+
    /*-----------------------------------------------------------
     * Free memory
     *-----------------------------------------------------------*/
@@ -651,6 +677,7 @@ test_Set(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetBulkAssembly(ij_A, bulk_assembly);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -798,6 +825,7 @@ test_SetOffProc(HYPRE_ParCSRMatrix    parcsr_A,
    // Create transpose with SetValues
    HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_AT);
    HYPRE_IJMatrixSetObjectType(ij_AT, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetBulkAssembly(ij_AT, bulk_assembly);
    HYPRE_IJMatrixInitialize_v2(ij_AT, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_AT, 1);
 
@@ -895,6 +923,7 @@ test_SetSet(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetBulkAssembly(ij_A, bulk_assembly);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -1010,6 +1039,7 @@ test_AddSet(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetBulkAssembly(ij_A, bulk_assembly);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -1121,6 +1151,7 @@ test_SetAddSet(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetBulkAssembly(ij_A, bulk_assembly);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -1219,3 +1250,87 @@ test_SetAddSet(MPI_Comm             comm,
 
    return hypre_error_flag;
 }
+
+/* Builds A by adding the entries of its transpose, so that most processors
+ * add to rows of others, then freezes the pattern and refills A nrefills
+ * times with the same calls */
+HYPRE_Int
+test_Refill(HYPRE_ParCSRMatrix    parcsr_A,
+            HYPRE_Int             nchunks,
+            HYPRE_Int             nrefills,
+            HYPRE_IJMatrix       *ij_A_ptr)
+{
+   MPI_Comm            comm = hypre_ParCSRMatrixComm(parcsr_A);
+   HYPRE_ParCSRMatrix  parcsr_AT;
+   HYPRE_IJMatrix      ij_A;
+
+   HYPRE_Int           nrows;
+   HYPRE_BigInt        num_nonzeros;
+   HYPRE_BigInt        ilower, iupper;
+
+   HYPRE_Int          *h_nnzrow;
+   HYPRE_BigInt       *h_rows1;
+   HYPRE_BigInt       *h_rows2;
+   HYPRE_BigInt       *h_cols;
+   HYPRE_Real         *h_coefs;
+
+   HYPRE_Int           time_index;
+   HYPRE_Int           chunk_size;
+   HYPRE_Int           chunk;
+   HYPRE_Int           refill;
+
+   ilower = hypre_ParCSRMatrixFirstRowIndex(parcsr_A);
+   iupper = hypre_ParCSRMatrixLastRowIndex(parcsr_A);
+   hypre_ParCSRMatrixTranspose(parcsr_A, &parcsr_AT, 1);
+   getParCSRMatrixData(parcsr_AT, &nrows, &num_nonzeros, &h_nnzrow, &h_rows1, &h_rows2, &h_cols, &h_coefs);
+   HYPRE_ParCSRMatrixDestroy(parcsr_AT);
+
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_A);
+   HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetBulkAssembly(ij_A, bulk_assembly);
+   HYPRE_IJMatrixInitialize_v2(ij_A, HYPRE_MEMORY_HOST);
+
+   /* refill = 0 is the first assembly, refill = 1 records the slots */
+   for (refill = 0; refill <= nrefills; refill++)
+   {
+      if (refill == 1)
+      {
+         HYPRE_IJMatrixSetFreezePattern(ij_A, 1);
+      }
+      if (refill > 0)
+      {
+         HYPRE_IJMatrixSetConstantValues(ij_A, 0.0);
+         HYPRE_IJMatrixInitialize_v2(ij_A, HYPRE_MEMORY_HOST);
+      }
+
+      time_index = hypre_InitializeTiming(refill ? "Test Refill" : "Test Refill (first assembly)");
+      hypre_BeginTiming(time_index);
+
+      /* entry (i, j) of AT is entry (j, i) of A */
+      chunk_size = hypre_max((HYPRE_Int) num_nonzeros / nchunks, 1);
+      for (chunk = 0; chunk < num_nonzeros; chunk += chunk_size)
+      {
+         chunk_size = hypre_min(chunk_size, (HYPRE_Int) num_nonzeros - chunk);
+         HYPRE_IJMatrixAddToValues(ij_A, chunk_size, NULL, &h_cols[chunk],
+                                   &h_rows2[chunk], &h_coefs[chunk]);
+      }
+      HYPRE_IJMatrixAssemble(ij_A);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming(refill ? "Test Refill" : "Test Refill (first assembly)", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+   }
+
+   // Set pointer to output
+   *ij_A_ptr = ij_A;
+
+   // Free memory
+   hypre_TFree(h_nnzrow, HYPRE_MEMORY_HOST);
+   hypre_TFree(h_rows1,  HYPRE_MEMORY_HOST);
+   hypre_TFree(h_rows2,  HYPRE_MEMORY_HOST);
+   hypre_TFree(h_cols,   HYPRE_MEMORY_HOST);
+   hypre_TFree(h_coefs,  HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
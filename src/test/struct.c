@@ -51,6 +51,10 @@ HYPRE_Int AddValuesVector( hypre_StructGrid  *gridvector,
                            HYPRE_Int          *period,
                            HYPRE_Real         value  )  ;
 
+HYPRE_Int TestCommPkgExchanges( hypre_StructMatrix *matrix,
+                                hypre_StructVector *vector,
+                                HYPRE_Int           num_exchanges ) ;
+
 /*--------------------------------------------------------------------------
  * Test driver for structured matrix interface (structured storage)
  *--------------------------------------------------------------------------*/
@@ -75,6 +79,7 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type;
    HYPRE_Int           recompute_res;
+   HYPRE_Int           pcg_variant;
 
    /*HYPRE_Real          dxyz[3];*/
 
@@ -100,6 +105,7 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           fuse;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -138,6 +144,7 @@ main( hypre_int argc,
    HYPRE_Int           sum;
 
    HYPRE_Int           print_system = 0;
+   HYPRE_Int           comm_test = 0;
 
    /* begin lobpcg */
 
@@ -202,6 +209,7 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   fuse = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -234,6 +242,7 @@ main( hypre_int argc,
    solver_id = 0;
    solver_type = 1;
    recompute_res = 0;   /* What should be the default here? */
+   pcg_variant = 0;
 
    istart[0] = -3;
    istart[1] = -3;
@@ -393,6 +402,11 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fuse") == 0 )
+      {
+         arg_index++;
+         fuse = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -408,6 +422,11 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pcg_variant") == 0 )
+      {
+         arg_index++;
+         pcg_variant = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cf") == 0 )
       {
          arg_index++;
@@ -418,6 +437,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-commtest") == 0 )
+      {
+         arg_index++;
+         comm_test = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -579,15 +603,21 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - zebra line Gauss-Seidel (PFMG)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -fuse <f>           : fused grid transfers in PFMG and SMG (0 or 1)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
       hypre_printf("                        1 - PCG (default)\n");
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("  -recompute <bool>   : Recompute residual in PCG?\n");
+      hypre_printf("  -pcg_variant <val>  : PCG variant (0 standard, 1 single reduction,\n");
+      hypre_printf("                        2 pipelined)\n");
       hypre_printf("  -cf <cf>            : convergence factor for Hybrid\n");
+      hypre_printf("  -commtest <n>       : before solving, check n ghost exchanges of x\n");
+      hypre_printf("                        with one CommPkg against new CommPkgs\n");
       hypre_printf("\n");
 
       /* begin lobpcg */
@@ -685,6 +715,7 @@ main( hypre_int argc,
       hypre_printf("  (n_pre, n_post) = (%d, %d)\n", n_pre, n_post);
       hypre_printf("  dim             = %d\n", dim);
       hypre_printf("  skip            = %d\n", skip);
+      hypre_printf("  fuse            = %d\n", fuse);
       hypre_printf("  sym             = %d\n", sym);
       hypre_printf("  rap             = %d\n", rap);
       hypre_printf("  relax           = %d\n", relax);
@@ -701,6 +732,7 @@ main( hypre_int argc,
       hypre_printf("  (n_pre, n_post) = (%d, %d)\n", n_pre, n_post);
       hypre_printf("  dim             = %d\n", dim);
       hypre_printf("  skip            = %d\n", skip);
+      hypre_printf("  fuse            = %d\n", fuse);
       hypre_printf("  sym             = %d\n", sym);
       hypre_printf("  rap             = %d\n", rap);
       hypre_printf("  relax           = %d\n", relax);
@@ -1338,6 +1370,15 @@ main( hypre_int argc,
          HYPRE_StructVectorPrint("struct.out.x0", x, 0);
       }
 
+      /*-----------------------------------------------------------
+       * Check repeated and overlapping exchanges on one CommPkg
+       *-----------------------------------------------------------*/
+
+      if (comm_test > 0)
+      {
+         TestCommPkgExchanges(A, x, comm_test);
+      }
+
       /*-----------------------------------------------------------
        * Solve the system using SMG
        *-----------------------------------------------------------*/
@@ -1356,6 +1397,7 @@ main( hypre_int argc,
          HYPRE_StructSMGSetRelChange(solver, 0);
          HYPRE_StructSMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructSMGSetNumPostRelax(solver, n_post);
+         HYPRE_StructSMGSetFuseTransfers(solver, fuse);
          HYPRE_StructSMGSetPrintLevel(solver, 1);
          HYPRE_StructSMGSetLogging(solver, 1);
 #if defined(HYPRE_USING_CUDA)
@@ -1427,6 +1469,7 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetFuseTransfers(solver, fuse);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1566,6 +1609,7 @@ main( hypre_int argc,
          HYPRE_PCGSetTwoNorm( (HYPRE_Solver)solver, 1 );
          HYPRE_PCGSetRelChange( (HYPRE_Solver)solver, 0 );
          HYPRE_PCGSetPrintLevel( (HYPRE_Solver)solver, 1 );
+         HYPRE_PCGSetVariant( (HYPRE_Solver)solver, pcg_variant );
 
          if (solver_id == 10)
          {
@@ -1577,6 +1621,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetFuseTransfers(precond, fuse);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 
@@ -1605,6 +1650,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFuseTransfers(precond, fuse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1743,6 +1789,7 @@ main( hypre_int argc,
                HYPRE_StructSMGSetZeroGuess(precond);
                HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+               HYPRE_StructSMGSetFuseTransfers(precond, fuse);
                HYPRE_StructSMGSetPrintLevel(precond, 0);
                HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -1770,6 +1817,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetFuseTransfers(precond, fuse);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1976,6 +2024,7 @@ main( hypre_int argc,
                HYPRE_StructSMGSetZeroGuess(precond);
                HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+               HYPRE_StructSMGSetFuseTransfers(precond, fuse);
                HYPRE_StructSMGSetPrintLevel(precond, 0);
                HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2003,6 +2052,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetFuseTransfers(precond, fuse);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2221,6 +2271,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetFuseTransfers(precond, fuse);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2248,6 +2299,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFuseTransfers(precond, fuse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2345,6 +2397,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetFuseTransfers(precond, fuse);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2372,6 +2425,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFuseTransfers(precond, fuse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2496,6 +2550,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetFuseTransfers(precond, fuse);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2523,6 +2578,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFuseTransfers(precond, fuse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2647,6 +2703,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetFuseTransfers(precond, fuse);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2674,6 +2731,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFuseTransfers(precond, fuse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2745,6 +2803,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetFuseTransfers(precond, fuse);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2772,6 +2831,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFuseTransfers(precond, fuse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -3615,3 +3675,109 @@ SetStencilBndry(HYPRE_StructMatrix A,HYPRE_StructGrid gridmatrix,HYPRE_Int* peri
    return ierr;
 }
 
+
+/*--------------------------------------------------------------------------
+ * Checks num_exchanges ghost exchanges of the data of vector, all with one
+ * CommPkg built from the stencil of matrix, against the same exchanges done
+ * with a new CommPkg each.  After its first exchange the shared CommPkg uses
+ * its persistent buffers and requests, while a new CommPkg always takes the
+ * first-communication path.  The exchanges cycle through three tags and
+ * alternate between copying and adding the received values.  Every fourth
+ * step starts a second exchange on the shared CommPkg, with another tag,
+ * before the first one is finalized, and finalizes the two in alternating
+ * order.  Prints the largest difference over all processes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+TestCommPkgExchanges( hypre_StructMatrix *matrix,
+                      hypre_StructVector *vector,
+                      HYPRE_Int           num_exchanges )
+{
+   MPI_Comm          comm       = hypre_StructVectorComm(vector);
+   hypre_BoxArray   *data_space = hypre_StructVectorDataSpace(vector);
+   HYPRE_Int         data_size  = hypre_StructVectorDataSize(vector);
+   hypre_CommInfo   *comm_info;
+   hypre_CommPkg    *comm_pkg, *new_pkg;
+   hypre_CommHandle *comm_handle[2], *new_handle;
+   HYPRE_Complex    *send_data, *recv_data[2], *check_data[2];
+   HYPRE_Int         tag[2], action, num_active;
+   HYPRE_Int         persistent, k, j, i, myid;
+   HYPRE_Real        diff = 0.0;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   hypre_CreateCommInfoFromStencil(hypre_StructVectorGrid(vector),
+                                   hypre_StructMatrixStencil(matrix), &comm_info);
+   hypre_CommPkgCreate(comm_info, data_space, data_space, 1, NULL, 0, comm, &comm_pkg);
+
+   send_data = hypre_CTAlloc(HYPRE_Complex, data_size, HYPRE_MEMORY_HOST);
+   for (j = 0; j < 2; j++)
+   {
+      recv_data[j]  = hypre_CTAlloc(HYPRE_Complex, data_size, HYPRE_MEMORY_HOST);
+      check_data[j] = hypre_CTAlloc(HYPRE_Complex, data_size, HYPRE_MEMORY_HOST);
+   }
+
+   for (k = 0; k < num_exchanges; k++)
+   {
+      for (i = 0; i < data_size; i++)
+      {
+         send_data[i] = (HYPRE_Complex) (myid + 1) + 0.001 * i + 0.5 * k;
+      }
+      action     = k % 2;
+      tag[0]     = 10 + k % 3;
+      tag[1]     = 20 + k % 3;
+      num_active = (k % 4 == 3) ? 2 : 1;
+
+      for (j = 0; j < num_active; j++)
+      {
+         hypre_InitializeCommunication(comm_pkg, send_data, recv_data[j],
+                                       action, tag[j], &comm_handle[j]);
+      }
+      if (num_active == 2 && k % 8 == 7)
+      {
+         hypre_FinalizeCommunication(comm_handle[1]);
+         hypre_FinalizeCommunication(comm_handle[0]);
+      }
+      else
+      {
+         for (j = 0; j < num_active; j++)
+         {
+            hypre_FinalizeCommunication(comm_handle[j]);
+         }
+      }
+
+      for (j = 0; j < num_active; j++)
+      {
+         hypre_CommPkgCreate(comm_info, data_space, data_space, 1, NULL, 0, comm, &new_pkg);
+         hypre_InitializeCommunication(new_pkg, send_data, check_data[j],
+                                       action, tag[j], &new_handle);
+         hypre_FinalizeCommunication(new_handle);
+         hypre_CommPkgDestroy(new_pkg);
+
+         for (i = 0; i < data_size; i++)
+         {
+            diff = hypre_max(diff, hypre_cabs(recv_data[j][i] - check_data[j][i]));
+         }
+      }
+   }
+
+   persistent = hypre_CommPkgPersistent(comm_pkg);
+   hypre_MPI_Allreduce(hypre_MPI_IN_PLACE, &diff, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+   hypre_MPI_Allreduce(hypre_MPI_IN_PLACE, &persistent, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (myid == 0)
+   {
+      hypre_printf("\nCommPkg exchanges = %d, persistent = %d, max difference = %e\n",
+                   num_exchanges, persistent, diff);
+   }
+
+   hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+   for (j = 0; j < 2; j++)
+   {
+      hypre_TFree(recv_data[j], HYPRE_MEMORY_HOST);
+      hypre_TFree(check_data[j], HYPRE_MEMORY_HOST);
+   }
+   hypre_CommPkgDestroy(comm_pkg);
+   hypre_CommInfoDestroy(comm_info);
+
+   return hypre_error_flag;
+}
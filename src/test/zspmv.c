@@ -0,0 +1,311 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "_hypre_utilities.h"
+#include "HYPRE_seq_mv.h"
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * Test driver to time the host CSR matvec kernels (scalar, AVX2, AVX-512,
+ * SELL-C-sigma, short column indices) against each other on a 3D stencil
+ * matrix
+ *--------------------------------------------------------------------------*/
+
+#define NUM_KERNELS 5
+
+static hypre_CSRMatrix *
+BuildStencilMatrix( HYPRE_Int nx,
+                    HYPRE_Int ny,
+                    HYPRE_Int nz,
+                    HYPRE_Int stencil )
+{
+   hypre_CSRMatrix *A;
+   HYPRE_Int       *A_i, *A_j;
+   HYPRE_Complex   *A_data;
+   HYPRE_Int        n = nx * ny * nz;
+   HYPRE_Int        ix, iy, iz, dx, dy, dz, row, nnz, ncoords;
+
+   A = hypre_CSRMatrixCreate(n, n, n * stencil);
+   hypre_CSRMatrixInitialize_v2(A, 0, HYPRE_MEMORY_HOST);
+   A_i    = hypre_CSRMatrixI(A);
+   A_j    = hypre_CSRMatrixJ(A);
+   A_data = hypre_CSRMatrixData(A);
+
+   nnz = 0;
+   for (iz = 0; iz < nz; iz++)
+   {
+      for (iy = 0; iy < ny; iy++)
+      {
+         for (ix = 0; ix < nx; ix++)
+         {
+            row = ix + nx * (iy + ny * iz);
+            A_i[row] = nnz;
+            for (dz = -1; dz <= 1; dz++)
+            {
+               for (dy = -1; dy <= 1; dy++)
+               {
+                  for (dx = -1; dx <= 1; dx++)
+                  {
+                     /* 7pt: faces, 19pt: faces and edges, 27pt: all */
+                     ncoords = (dx != 0) + (dy != 0) + (dz != 0);
+                     if ( (stencil == 7 && ncoords > 1) || (stencil == 19 && ncoords > 2) )
+                     {
+                        continue;
+                     }
+                     if (ix + dx < 0 || ix + dx >= nx ||
+                         iy + dy < 0 || iy + dy >= ny ||
+                         iz + dz < 0 || iz + dz >= nz)
+                     {
+                        continue;
+                     }
+                     A_j[nnz]    = row + dx + nx * (dy + ny * dz);
+                     A_data[nnz] = ncoords ? -1.0 - 0.1 * ncoords : (HYPRE_Complex) stencil;
+                     nnz++;
+                  }
+               }
+            }
+         }
+      }
+   }
+   A_i[n] = nnz;
+   hypre_CSRMatrixNumNonzeros(A) = nnz;
+
+   return A;
+}
+
+hypre_int
+main( hypre_int argc,
+      char *argv[] )
+{
+   HYPRE_Int         arg_index;
+   HYPRE_Int         print_usage;
+   HYPRE_Int         nx, ny, nz, n;
+   HYPRE_Int         stencil;
+   HYPRE_Int         time_index[2*NUM_KERNELS];
+   HYPRE_Int         num_timings;
+   HYPRE_Int         num_procs, myid;
+   HYPRE_Int         rep, reps, i, k;
+   hypre_CSRMatrix  *A;
+   hypre_Vector     *x, *y, *y_ref, *yt, *yt_ref;
+   HYPRE_Real        err, errt;
+
+   const char       *kernel_names[NUM_KERNELS] = { "scalar", "AVX2", "AVX-512", "SELL",
+                                                   "short j" };
+   HYPRE_Int         kernel_simd[NUM_KERNELS]  = { hypre_CSR_SPMV_SIMD_SCALAR,
+                                                   hypre_CSR_SPMV_SIMD_AVX2,
+                                                   hypre_CSR_SPMV_SIMD_AVX512,
+                                                   hypre_CSR_SPMV_SIMD_SCALAR,
+                                                   hypre_CSR_SPMV_SIMD_SCALAR };
+   HYPRE_Int         kernel_fmt[NUM_KERNELS]   = { hypre_CSR_SPMV_FORMAT_CSR,
+                                                   hypre_CSR_SPMV_FORMAT_CSR,
+                                                   hypre_CSR_SPMV_FORMAT_CSR,
+                                                   hypre_CSR_SPMV_FORMAT_SELL,
+                                                   hypre_CSR_SPMV_FORMAT_SHORTJ };
+   char              name[64];
+
+   /*-----------------------------------------------------------
+    * Initialize some stuff
+    *-----------------------------------------------------------*/
+
+   /* Initialize MPI */
+   hypre_MPI_Init(&argc, &argv);
+
+   hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs );
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid );
+
+   /*-----------------------------------------------------------
+    * Set defaults
+    *-----------------------------------------------------------*/
+
+   nx = 50;
+   ny = 50;
+   nz = 50;
+   stencil = 27;
+   reps = 100;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+
+   print_usage = 0;
+   arg_index = 1;
+   while (arg_index < argc)
+   {
+      if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         nx = atoi(argv[arg_index++]);
+         ny = atoi(argv[arg_index++]);
+         nz = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-stencil") == 0 )
+      {
+         arg_index++;
+         stencil = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reps") == 0 )
+      {
+         arg_index++;
+         reps = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-help") == 0 )
+      {
+         print_usage = 1;
+         break;
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Print usage info
+    *-----------------------------------------------------------*/
+
+   if ( (print_usage) && (myid == 0) )
+   {
+      hypre_printf("\n");
+      hypre_printf("Usage: %s [<options>]\n", argv[0]);
+      hypre_printf("\n");
+      hypre_printf("  -n <nx> <ny> <nz>   : problem size per process\n");
+      hypre_printf("  -stencil <val>      : 7, 19 or 27 point stencil\n");
+      hypre_printf("  -reps <val>         : number of matvecs per kernel\n");
+      hypre_printf("\n");
+   }
+
+   if ( print_usage )
+   {
+      exit(1);
+   }
+
+   if (stencil != 7 && stencil != 19 && stencil != 27)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Error: stencil must be 7, 19 or 27\n");
+      }
+      exit(1);
+   }
+
+   /*-----------------------------------------------------------
+    * Set up the matrix and vectors
+    *-----------------------------------------------------------*/
+
+   n = nx * ny * nz;
+   A = BuildStencilMatrix(nx, ny, nz, stencil);
+
+   x      = hypre_SeqVectorCreate(n);
+   y      = hypre_SeqVectorCreate(n);
+   y_ref  = hypre_SeqVectorCreate(n);
+   yt     = hypre_SeqVectorCreate(n);
+   yt_ref = hypre_SeqVectorCreate(n);
+   hypre_SeqVectorInitialize_v2(x,      HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(y,      HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(y_ref,  HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(yt,     HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(yt_ref, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorSetRandomValues(x, 1);
+
+   if (myid == 0)
+   {
+      hypre_printf("Host SpMV kernels: %d x %d x %d, %d-point stencil, supported ISA = %d\n\n",
+                   nx, ny, nz, stencil, hypre_CSRMatrixSpMVSimdISA());
+   }
+
+   /*-----------------------------------------------------------
+    * Time the kernels
+    *-----------------------------------------------------------*/
+
+   num_timings = 0;
+   for (k = 0; k < NUM_KERNELS; k++)
+   {
+      HYPRE_CSRMatrixSetSpMVSimd(kernel_simd[k]);
+      hypre_CSRMatrixSetSpMVFormat(A, kernel_fmt[k]);
+
+      if (kernel_fmt[k] == hypre_CSR_SPMV_FORMAT_CSR &&
+          hypre_CSRMatrixSpMVSimdISA() != kernel_simd[k])
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Skipping %s: not supported by this CPU\n", kernel_names[k]);
+         }
+         continue;
+      }
+
+      /* warm up, and build the SELL or short column indices companion */
+      hypre_CSRMatrixMatvec(1.0, A, x, 0.0, y);
+
+      hypre_sprintf(name, "Matvec %s", kernel_names[k]);
+      time_index[num_timings] = hypre_InitializeTiming(name);
+      hypre_BeginTiming(time_index[num_timings]);
+      for (rep = 0; rep < reps; rep++)
+      {
+         hypre_CSRMatrixMatvec(1.0, A, x, 0.0, y);
+      }
+      hypre_EndTiming(time_index[num_timings]);
+      num_timings++;
+
+      hypre_SeqVectorSetConstantValues(yt, 0.0);
+      hypre_sprintf(name, "MatvecT %s", kernel_names[k]);
+      time_index[num_timings] = hypre_InitializeTiming(name);
+      hypre_BeginTiming(time_index[num_timings]);
+      for (rep = 0; rep < reps; rep++)
+      {
+         hypre_CSRMatrixMatvecT(1.0, A, x, 0.0, yt);
+      }
+      hypre_EndTiming(time_index[num_timings]);
+      num_timings++;
+
+      if (k == 0)
+      {
+         hypre_SeqVectorCopy(y, y_ref);
+         hypre_SeqVectorCopy(yt, yt_ref);
+      }
+      else
+      {
+         err = errt = 0.0;
+         for (i = 0; i < n; i++)
+         {
+            err  = hypre_max(err,  fabs(hypre_VectorData(y)[i]  - hypre_VectorData(y_ref)[i]));
+            errt = hypre_max(errt, fabs(hypre_VectorData(yt)[i] - hypre_VectorData(yt_ref)[i]));
+         }
+         if (myid == 0)
+         {
+            hypre_printf("%-8s max |y - y_scalar| = %e, max |yt - yt_scalar| = %e\n",
+                         kernel_names[k], err, errt);
+         }
+      }
+   }
+
+   hypre_PrintTiming("Host SpMV kernel times", hypre_MPI_COMM_WORLD);
+   for (i = 0; i < num_timings; i++)
+   {
+      hypre_FinalizeTiming(time_index[i]);
+   }
+   hypre_ClearTiming();
+
+   /*-----------------------------------------------------------
+    * Finalize things
+    *-----------------------------------------------------------*/
+
+   hypre_CSRMatrixDestroy(A);
+   hypre_SeqVectorDestroy(x);
+   hypre_SeqVectorDestroy(y);
+   hypre_SeqVectorDestroy(y_ref);
+   hypre_SeqVectorDestroy(yt);
+   hypre_SeqVectorDestroy(yt_ref);
+
+   /* Finalize MPI */
+   hypre_MPI_Finalize();
+
+   return (0);
+}
@@ -216,6 +216,13 @@ HYPRE_Int HYPRE_SetUmpireUMPoolName(const char *pool_name);
 HYPRE_Int HYPRE_SetUmpireHostPoolName(const char *pool_name);
 HYPRE_Int HYPRE_SetUmpirePinnedPoolName(const char *pool_name);
 
+/*--------------------------------------------------------------------------
+ * HYPRE host memory pool
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_SetHostMemoryPool(HYPRE_Int use_pool);
+HYPRE_Int HYPRE_HostMemoryPoolTrim();
+
 /*--------------------------------------------------------------------------
  * HYPRE GPU memory pool
  *--------------------------------------------------------------------------*/
@@ -290,6 +290,8 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef FILE      *hypre_MPI_File;
+typedef hypre_longint hypre_MPI_Offset;
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
@@ -298,6 +300,7 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_COMM_TYPE_SHARED 0
 
 #define  hypre_MPI_BOTTOM  0x0
+#define  hypre_MPI_IN_PLACE ((void *) 1)
 
 #define  hypre_MPI_FLOAT 0
 #define  hypre_MPI_DOUBLE 1
@@ -323,6 +326,10 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+#define  hypre_MPI_MODE_CREATE   1
+#define  hypre_MPI_MODE_RDONLY   2
+#define  hypre_MPI_MODE_WRONLY   4
+
 #else
 
 /******************************************************************************
@@ -337,11 +344,14 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_File     hypre_MPI_File;
+typedef MPI_Offset   hypre_MPI_Offset;
 typedef MPI_User_function    hypre_MPI_User_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
+#define  hypre_MPI_IN_PLACE           MPI_IN_PLACE
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
 
@@ -373,6 +383,9 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_SOURCE          MPI_SOURCE
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
+#define  hypre_MPI_MODE_CREATE     MPI_MODE_CREATE
+#define  hypre_MPI_MODE_RDONLY     MPI_MODE_RDONLY
+#define  hypre_MPI_MODE_WRONLY     MPI_MODE_WRONLY
 
 #endif
 
@@ -438,6 +451,15 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , hypre_MPI_Comm *graph_comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Neighbor_alltoallv_init( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_File_open( hypre_MPI_Comm comm , const char *filename , HYPRE_Int amode , hypre_MPI_Info info , hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_close( hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_set_size( hypre_MPI_File fh , hypre_MPI_Offset size );
+HYPRE_Int hypre_MPI_File_read_at_all( hypre_MPI_File fh , hypre_MPI_Offset offset , void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_write_at_all( hypre_MPI_File fh , hypre_MPI_Offset offset , void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Status *status );
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
@@ -1207,6 +1229,13 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   HYPRE_Int              spmv_format;            /* default host SpMV format of CSR matrices */
+   HYPRE_Int              spmv_sell_chunk_size;
+   HYPRE_Int              spmv_sell_sigma;
+   HYPRE_Int              spmv_simd;              /* instruction set of host SpMV kernels */
+   HYPRE_Int              par_matvec_overlap;     /* rows between halo progress tests in ParCSR matvec (0: off) */
+   HYPRE_Int              comm_neighbor_coll;     /* ParCSR halo exchange with neighborhood collectives */
+   HYPRE_Int              par_matmul_fused;       /* ParCSR matmul with the fused diag/offd kernel */
 #if defined(HYPRE_USING_GPU)
    hypre_CudaData        *cuda_data;
 #endif
@@ -1233,6 +1262,13 @@ typedef struct
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
+#define hypre_HandleSpMVFormat(hypre_handle)                     ((hypre_handle) -> spmv_format)
+#define hypre_HandleSpMVSellChunkSize(hypre_handle)              ((hypre_handle) -> spmv_sell_chunk_size)
+#define hypre_HandleSpMVSellSigma(hypre_handle)                  ((hypre_handle) -> spmv_sell_sigma)
+#define hypre_HandleSpMVSimd(hypre_handle)                       ((hypre_handle) -> spmv_simd)
+#define hypre_HandleParMatvecOverlap(hypre_handle)               ((hypre_handle) -> par_matvec_overlap)
+#define hypre_HandleCommNeighborColl(hypre_handle)               ((hypre_handle) -> comm_neighbor_coll)
+#define hypre_HandleParMatmulFused(hypre_handle)                 ((hypre_handle) -> par_matmul_fused)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
 #define hypre_HandleCublasHandle(hypre_handle)                   hypre_CudaDataCublasHandle(hypre_HandleCudaData(hypre_handle))
@@ -1390,6 +1426,16 @@ HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
 HYPRE_Int hypre_UmpireInit(hypre_Handle *hypre_handle_);
 HYPRE_Int hypre_UmpireFinalize(hypre_Handle *hypre_handle_);
 
+/* hypre_host_pool.c */
+void hypre_HostPoolSetEnabled ( HYPRE_Int enabled );
+HYPRE_Int hypre_HostPoolEnabled ( void );
+HYPRE_Int hypre_HostPoolActive ( void );
+void *hypre_HostPoolMalloc ( size_t size , HYPRE_Int zeroinit );
+void hypre_HostPoolFree ( void *ptr );
+void *hypre_HostPoolRealloc ( void *ptr , size_t size );
+HYPRE_Int hypre_HostPoolTrim ( void );
+HYPRE_Int hypre_HostPoolPrintStats ( void );
+
 /* hypre_qsort.c */
 void hypre_swap ( HYPRE_Int *v , HYPRE_Int i , HYPRE_Int j );
 void hypre_swap2 ( HYPRE_Int *v , HYPRE_Real *w , HYPRE_Int i , HYPRE_Int j );
@@ -54,6 +54,23 @@ hypre_HandleCreate()
 
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
 
+   /* host SpMV: plain CSR unless SELL-C-sigma is requested */
+   hypre_HandleSpMVFormat(hypre_handle_)        = 0;
+   hypre_HandleSpMVSellChunkSize(hypre_handle_) = 8;
+   hypre_HandleSpMVSellSigma(hypre_handle_)     = 256;
+
+   /* host SpMV: use the widest vector instructions the CPU supports */
+   hypre_HandleSpMVSimd(hypre_handle_)          = -1;
+
+   /* ParCSR matvec: no interior/boundary split of the local rows */
+   hypre_HandleParMatvecOverlap(hypre_handle_)  = 0;
+
+   /* ParCSR halo exchange: point-to-point messages per neighbor */
+   hypre_HandleCommNeighborColl(hypre_handle_)  = 0;
+
+   /* ParCSR matmul: one host SpGEMM of the concatenated diag/offd blocks */
+   hypre_HandleParMatmulFused(hypre_handle_)    = 0;
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_HOST;
    hypre_HandleStructExecPolicy(hypre_handle_) = HYPRE_EXEC_DEVICE;
@@ -234,6 +251,8 @@ HYPRE_Finalize()
 
    _hypre_handle = NULL;
 
+   hypre_HostPoolTrim();
+
    /*
 #if defined(HYPRE_USING_KOKKOS)
    Kokkos::finalize ();
@@ -446,6 +465,45 @@ HYPRE_SetUmpirePinnedPoolName(const char *pool_name)
 
 #endif /* #if defined(HYPRE_USING_UMPIRE) */
 
+/******************************************************************************
+ *
+ * HYPRE host memory pool
+ *
+ *****************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetHostMemoryPool
+ *
+ * use_pool = 0: host allocations go to malloc/free (default)
+ * use_pool = 1: small host allocations are served from the size-class pool
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetHostMemoryPool(HYPRE_Int use_pool)
+{
+   if (use_pool < 0 || use_pool > 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HostPoolSetEnabled(use_pool);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_HostMemoryPoolTrim
+ *
+ * Returns the slabs of the host memory pool that hold no live blocks
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_HostMemoryPoolTrim()
+{
+   return hypre_HostPoolTrim();
+}
+
 /******************************************************************************
  *
  * HYPRE memory location
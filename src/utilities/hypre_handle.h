@@ -23,6 +23,13 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   HYPRE_Int              spmv_format;            /* default host SpMV format of CSR matrices */
+   HYPRE_Int              spmv_sell_chunk_size;
+   HYPRE_Int              spmv_sell_sigma;
+   HYPRE_Int              spmv_simd;              /* instruction set of host SpMV kernels */
+   HYPRE_Int              par_matvec_overlap;     /* rows between halo progress tests in ParCSR matvec (0: off) */
+   HYPRE_Int              comm_neighbor_coll;     /* ParCSR halo exchange with neighborhood collectives */
+   HYPRE_Int              par_matmul_fused;       /* ParCSR matmul with the fused diag/offd kernel */
 #if defined(HYPRE_USING_GPU)
    hypre_CudaData        *cuda_data;
 #endif
@@ -49,6 +56,13 @@ typedef struct
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
+#define hypre_HandleSpMVFormat(hypre_handle)                     ((hypre_handle) -> spmv_format)
+#define hypre_HandleSpMVSellChunkSize(hypre_handle)              ((hypre_handle) -> spmv_sell_chunk_size)
+#define hypre_HandleSpMVSellSigma(hypre_handle)                  ((hypre_handle) -> spmv_sell_sigma)
+#define hypre_HandleSpMVSimd(hypre_handle)                       ((hypre_handle) -> spmv_simd)
+#define hypre_HandleParMatvecOverlap(hypre_handle)               ((hypre_handle) -> par_matvec_overlap)
+#define hypre_HandleCommNeighborColl(hypre_handle)               ((hypre_handle) -> comm_neighbor_coll)
+#define hypre_HandleParMatmulFused(hypre_handle)                 ((hypre_handle) -> par_matmul_fused)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
 #define hypre_HandleCublasHandle(hypre_handle)                   hypre_CudaDataCublasHandle(hypre_HandleCudaData(hypre_handle))
@@ -0,0 +1,463 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Size-class pool allocator for HYPRE_MEMORY_HOST
+ *
+ * Small requests (up to HYPRE_HOST_POOL_MAX_BLOCK bytes) are rounded up to a
+ * power-of-two size class and carved out of fixed-size slabs.  Each slab
+ * serves a single class and is aligned to its own size, so the owning slab of
+ * any pointer is found by masking the low bits; a hash set of slab addresses
+ * tells pool pointers apart from those that came from malloc.  Larger requests
+ * go straight to malloc.
+ *
+ * Freed blocks are kept on per-class free lists and are not returned to the
+ * system until hypre_HostPoolTrim, which releases every slab that no longer
+ * holds a live block (e.g., the temporaries of a BoomerAMG setup).
+ *
+ * The pool state lives outside of the hypre handle so that blocks allocated
+ * before HYPRE_Init or freed after HYPRE_Finalize are still handled.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#define HYPRE_HOST_POOL_SLAB_SIZE     (256 * 1024)
+#define HYPRE_HOST_POOL_MIN_SHIFT     4
+#define HYPRE_HOST_POOL_MAX_SHIFT     14
+#define HYPRE_HOST_POOL_NUM_CLASSES   (HYPRE_HOST_POOL_MAX_SHIFT - HYPRE_HOST_POOL_MIN_SHIFT + 1)
+#define HYPRE_HOST_POOL_MAX_BLOCK     ((size_t) 1 << HYPRE_HOST_POOL_MAX_SHIFT)
+#define HYPRE_HOST_POOL_HEADER_SIZE   64
+
+typedef struct hypre_HostPoolSlab_struct
+{
+   struct hypre_HostPoolSlab_struct *next;
+   HYPRE_Int                         cls;
+   HYPRE_Int                         num_live;
+   HYPRE_Int                         num_carved;
+   HYPRE_Int                         num_blocks;
+} hypre_HostPoolSlab;
+
+typedef struct
+{
+   HYPRE_Int            enabled;
+   HYPRE_Int            num_slabs;
+
+   /* all slabs, and the slab currently being carved, per class */
+   hypre_HostPoolSlab  *slabs;
+   hypre_HostPoolSlab  *current[HYPRE_HOST_POOL_NUM_CLASSES];
+   void                *free_list[HYPRE_HOST_POOL_NUM_CLASSES];
+
+   /* open-addressing hash set of slab addresses */
+   HYPRE_Int            table_size;
+   hypre_HostPoolSlab **table;
+
+   /* statistics */
+   size_t               num_pool_allocs;
+   size_t               num_slab_allocs;
+   size_t               num_slabs_released;
+} hypre_HostPool;
+
+static hypre_HostPool hypre_host_pool = { 0 };
+
+#define hypre_HostPoolBlockSize(cls) ((size_t) 1 << ((cls) + HYPRE_HOST_POOL_MIN_SHIFT))
+
+/*--------------------------------------------------------------------------
+ * Helper routines
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_HostPoolSizeClass(size_t size)
+{
+   HYPRE_Int cls = 0;
+
+   while (hypre_HostPoolBlockSize(cls) < size)
+   {
+      cls++;
+   }
+
+   return cls;
+}
+
+static inline size_t
+hypre_HostPoolHash(hypre_HostPoolSlab *slab, HYPRE_Int table_size)
+{
+   size_t key = ((size_t) slab) / HYPRE_HOST_POOL_SLAB_SIZE;
+
+   return (key * 0x9E3779B97F4A7C15ULL) & (size_t) (table_size - 1);
+}
+
+static HYPRE_Int
+hypre_HostPoolTableInsert(hypre_HostPoolSlab *slab)
+{
+   hypre_HostPool *pool = &hypre_host_pool;
+   size_t          h;
+
+   /* keep the load factor below 1/2 */
+   if (2 * (pool->num_slabs + 1) > pool->table_size)
+   {
+      HYPRE_Int            new_size  = pool->table_size ? 2 * pool->table_size : 64;
+      hypre_HostPoolSlab **new_table = (hypre_HostPoolSlab **)
+                                       calloc(new_size, sizeof(hypre_HostPoolSlab *));
+      hypre_HostPoolSlab  *s;
+
+      if (!new_table)
+      {
+         return 1;
+      }
+
+      for (s = pool->slabs; s; s = s->next)
+      {
+         for (h = hypre_HostPoolHash(s, new_size); new_table[h]; h = (h + 1) & (new_size - 1));
+         new_table[h] = s;
+      }
+      free(pool->table);
+      pool->table      = new_table;
+      pool->table_size = new_size;
+   }
+
+   for (h = hypre_HostPoolHash(slab, pool->table_size); pool->table[h];
+        h = (h + 1) & (pool->table_size - 1));
+   pool->table[h] = slab;
+
+   return 0;
+}
+
+static inline hypre_HostPoolSlab *
+hypre_HostPoolFindSlab(void *ptr)
+{
+   hypre_HostPool     *pool = &hypre_host_pool;
+   hypre_HostPoolSlab *slab = (hypre_HostPoolSlab *)
+                              ((size_t) ptr & ~((size_t) HYPRE_HOST_POOL_SLAB_SIZE - 1));
+   size_t              h;
+
+   if (!pool->num_slabs)
+   {
+      return NULL;
+   }
+
+   for (h = hypre_HostPoolHash(slab, pool->table_size); pool->table[h];
+        h = (h + 1) & (pool->table_size - 1))
+   {
+      if (pool->table[h] == slab)
+      {
+         return slab;
+      }
+   }
+
+   return NULL;
+}
+
+static hypre_HostPoolSlab *
+hypre_HostPoolNewSlab(HYPRE_Int cls)
+{
+   hypre_HostPool     *pool = &hypre_host_pool;
+   hypre_HostPoolSlab *slab = NULL;
+
+   if (posix_memalign((void **) &slab, HYPRE_HOST_POOL_SLAB_SIZE, HYPRE_HOST_POOL_SLAB_SIZE))
+   {
+      return NULL;
+   }
+
+   slab->cls        = cls;
+   slab->num_live   = 0;
+   slab->num_carved = 0;
+   slab->num_blocks = (HYPRE_Int) ((HYPRE_HOST_POOL_SLAB_SIZE - HYPRE_HOST_POOL_HEADER_SIZE) /
+                                   hypre_HostPoolBlockSize(cls));
+   slab->next       = pool->slabs;
+
+   if (hypre_HostPoolTableInsert(slab))
+   {
+      free(slab);
+      return NULL;
+   }
+
+   pool->slabs = slab;
+   pool->num_slabs++;
+   pool->num_slab_allocs++;
+
+   return slab;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolSetEnabled
+ *
+ * Pool pointers remain valid (and are recognized by hypre_HostPoolFree)
+ * after the pool is disabled.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_HostPoolSetEnabled(HYPRE_Int enabled)
+{
+   hypre_host_pool.enabled = enabled;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolEnabled
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostPoolEnabled()
+{
+   return hypre_host_pool.enabled;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolActive
+ *
+ * Returns nonzero if the pool is enabled or still owns slabs, i.e., if
+ * frees and reallocs must go through it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostPoolActive()
+{
+   return hypre_host_pool.enabled || hypre_host_pool.num_slabs;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolMalloc
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_HostPoolMalloc(size_t size, HYPRE_Int zeroinit)
+{
+   hypre_HostPool     *pool = &hypre_host_pool;
+   hypre_HostPoolSlab *slab;
+   HYPRE_Int           cls;
+   void               *ptr = NULL;
+
+   if (size > HYPRE_HOST_POOL_MAX_BLOCK)
+   {
+      return zeroinit ? calloc(size, 1) : malloc(size);
+   }
+
+   cls = hypre_HostPoolSizeClass(size);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp critical (hypre_host_pool)
+#endif
+   {
+      if (pool->free_list[cls])
+      {
+         ptr = pool->free_list[cls];
+         pool->free_list[cls] = *((void **) ptr);
+         slab = hypre_HostPoolFindSlab(ptr);
+      }
+      else
+      {
+         slab = pool->current[cls];
+         if (!slab || slab->num_carved == slab->num_blocks)
+         {
+            slab = pool->current[cls] = hypre_HostPoolNewSlab(cls);
+         }
+         if (slab)
+         {
+            ptr = (char *) slab + HYPRE_HOST_POOL_HEADER_SIZE +
+                  (size_t) slab->num_carved * hypre_HostPoolBlockSize(cls);
+            slab->num_carved++;
+         }
+      }
+
+      if (ptr)
+      {
+         slab->num_live++;
+         pool->num_pool_allocs++;
+      }
+   }
+
+   if (!ptr)
+   {
+      /* could not grow the pool; fall back to the system allocator */
+      return zeroinit ? calloc(size, 1) : malloc(size);
+   }
+
+   if (zeroinit)
+   {
+      memset(ptr, 0, size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolFree
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_HostPoolFree(void *ptr)
+{
+   hypre_HostPool     *pool = &hypre_host_pool;
+   hypre_HostPoolSlab *slab;
+
+   if (!ptr)
+   {
+      return;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp critical (hypre_host_pool)
+#endif
+   {
+      slab = hypre_HostPoolFindSlab(ptr);
+      if (slab)
+      {
+         *((void **) ptr) = pool->free_list[slab->cls];
+         pool->free_list[slab->cls] = ptr;
+         slab->num_live--;
+      }
+   }
+
+   if (!slab)
+   {
+      free(ptr);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolRealloc
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_HostPoolRealloc(void *ptr, size_t size)
+{
+   hypre_HostPoolSlab *slab;
+   size_t              old_size;
+   void               *new_ptr;
+
+   if (!ptr)
+   {
+      return hypre_HostPoolMalloc(size, 0);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp critical (hypre_host_pool)
+#endif
+   {
+      slab = hypre_HostPoolFindSlab(ptr);
+   }
+
+   if (!slab)
+   {
+      return realloc(ptr, size);
+   }
+
+   old_size = hypre_HostPoolBlockSize(slab->cls);
+   if (size <= old_size)
+   {
+      return ptr;
+   }
+
+   new_ptr = hypre_HostPoolMalloc(size, 0);
+   if (new_ptr)
+   {
+      memcpy(new_ptr, ptr, old_size);
+      hypre_HostPoolFree(ptr);
+   }
+
+   return new_ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolTrim
+ *
+ * Releases every slab that holds no live blocks back to the system.  This is
+ * the one-shot release of a setup phase: once its temporaries are freed,
+ * their slabs are dropped as a whole instead of block by block.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostPoolTrim()
+{
+   hypre_HostPool      *pool = &hypre_host_pool;
+   hypre_HostPoolSlab  *slab, *next, **prev;
+   void               **link;
+   HYPRE_Int            cls;
+
+   if (!pool->num_slabs)
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp critical (hypre_host_pool)
+#endif
+   {
+      /* unlink the blocks of empty slabs from the free lists */
+      for (cls = 0; cls < HYPRE_HOST_POOL_NUM_CLASSES; cls++)
+      {
+         link = &pool->free_list[cls];
+         while (*link)
+         {
+            slab = hypre_HostPoolFindSlab(*link);
+            if (slab->num_live == 0)
+            {
+               *link = *((void **) *link);
+            }
+            else
+            {
+               link = (void **) *link;
+            }
+         }
+      }
+
+      /* release the empty slabs */
+      prev = &pool->slabs;
+      for (slab = pool->slabs; slab; slab = next)
+      {
+         next = slab->next;
+         if (slab->num_live == 0)
+         {
+            if (pool->current[slab->cls] == slab)
+            {
+               pool->current[slab->cls] = NULL;
+            }
+            *prev = next;
+            free(slab);
+            pool->num_slabs--;
+            pool->num_slabs_released++;
+         }
+         else
+         {
+            prev = &slab->next;
+         }
+      }
+
+      /* rebuild the hash set from the remaining slabs */
+      memset(pool->table, 0, pool->table_size * sizeof(hypre_HostPoolSlab *));
+      for (slab = pool->slabs; slab; slab = slab->next)
+      {
+         size_t h;
+         for (h = hypre_HostPoolHash(slab, pool->table_size); pool->table[h];
+              h = (h + 1) & (pool->table_size - 1));
+         pool->table[h] = slab;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolPrintStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostPoolPrintStats()
+{
+   hypre_HostPool *pool = &hypre_host_pool;
+
+   hypre_printf("Host memory pool: %lu pooled allocations, %lu slabs allocated, "
+                "%lu slabs released, %d slabs (%lu KB) in use\n",
+                (unsigned long) pool->num_pool_allocs,
+                (unsigned long) pool->num_slab_allocs,
+                (unsigned long) pool->num_slabs_released,
+                pool->num_slabs,
+                (unsigned long) pool->num_slabs * (HYPRE_HOST_POOL_SLAB_SIZE / 1024));
+
+   return hypre_error_flag;
+}
@@ -130,7 +130,11 @@ hypre_HostMalloc(size_t size, HYPRE_Int zeroinit)
       memset(ptr, 0, size);
    }
 #else
-   if (zeroinit)
+   if (hypre_HostPoolEnabled())
+   {
+      ptr = hypre_HostPoolMalloc(size, zeroinit);
+   }
+   else if (zeroinit)
    {
       ptr = calloc(size, 1);
    }
@@ -280,7 +284,14 @@ hypre_HostFree(void *ptr)
 #if defined(HYPRE_USING_UMPIRE_HOST)
    hypre_umpire_host_pooled_free(ptr);
 #else
-   free(ptr);
+   if (hypre_HostPoolActive())
+   {
+      hypre_HostPoolFree(ptr);
+   }
+   else
+   {
+      free(ptr);
+   }
 #endif
 }
 
@@ -690,7 +701,14 @@ hypre_ReAlloc(void *ptr, size_t size, HYPRE_MemoryLocation location)
    ptr = hypre_umpire_host_pooled_realloc(ptr, size);
 
 #else
-   ptr = realloc(ptr, size);
+   if (hypre_HostPoolActive())
+   {
+      ptr = hypre_HostPoolRealloc(ptr, size);
+   }
+   else
+   {
+      ptr = realloc(ptr, size);
+   }
 #endif
 
    if (!ptr)
@@ -485,6 +485,12 @@ hypre_MPI_Allreduce( void              *sendbuf,
 {
    HYPRE_Int i;
 
+   /* the result is already in recvbuf */
+   if (sendbuf == hypre_MPI_IN_PLACE)
+   {
+      return(0);
+   }
+
    switch (datatype)
    {
       case hypre_MPI_INT:
@@ -521,6 +527,17 @@ hypre_MPI_Allreduce( void              *sendbuf,
       }
       break;
 
+      case hypre_MPI_LONG:
+      {
+         hypre_longint *crecvbuf = (hypre_longint *)recvbuf;
+         hypre_longint *csendbuf = (hypre_longint *)sendbuf;
+         for (i = 0; i < count; i++)
+         {
+            crecvbuf[i] = csendbuf[i];
+         }
+      }
+      break;
+
       case hypre_MPI_BYTE:
       {
          hypre_Memcpy(recvbuf,  sendbuf,  count, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
@@ -646,6 +663,169 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return(0);
 }
 
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      hypre_MPI_Comm *graph_comm )
+{
+   *graph_comm = comm;
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   if (sendbuf != hypre_MPI_IN_PLACE)
+   {
+      hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+   }
+   *request = hypre_MPI_REQUEST_NULL;
+
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_alltoallv_init( void               *sendbuf,
+                                   hypre_int          *sendcounts,
+                                   hypre_int          *sdispls,
+                                   hypre_MPI_Datatype  sendtype,
+                                   void               *recvbuf,
+                                   hypre_int          *recvcounts,
+                                   hypre_int          *rdispls,
+                                   hypre_MPI_Datatype  recvtype,
+                                   hypre_MPI_Comm      comm,
+                                   hypre_MPI_Request  *request )
+{
+   return(0);
+}
+
+/* The file stubs use stdio.  A transfer that is cut short returns 1, since
+   the status does not carry a count in sequential builds. */
+
+static size_t
+hypre_MPI_TypeSize( hypre_MPI_Datatype datatype )
+{
+   switch (datatype)
+   {
+      case hypre_MPI_FLOAT:
+         return sizeof(float);
+      case hypre_MPI_DOUBLE:
+         return sizeof(double);
+      case hypre_MPI_LONG_DOUBLE:
+         return sizeof(long double);
+      case hypre_MPI_INT:
+         return sizeof(HYPRE_Int);
+      case hypre_MPI_LONG:
+         return sizeof(hypre_longint);
+      case hypre_MPI_REAL:
+         return sizeof(HYPRE_Real);
+      case hypre_MPI_COMPLEX:
+         return sizeof(HYPRE_Complex);
+      default:
+         return 1;
+   }
+}
+
+HYPRE_Int
+hypre_MPI_File_open( hypre_MPI_Comm   comm,
+                     const char      *filename,
+                     HYPRE_Int        amode,
+                     hypre_MPI_Info   info,
+                     hypre_MPI_File  *fh )
+{
+   *fh = fopen(filename, (amode & hypre_MPI_MODE_WRONLY) ? "wb" : "rb");
+
+   return (*fh == NULL);
+}
+
+HYPRE_Int
+hypre_MPI_File_close( hypre_MPI_File *fh )
+{
+   HYPRE_Int ierr = fclose(*fh);
+
+   *fh = NULL;
+
+   return (ierr != 0);
+}
+
+HYPRE_Int
+hypre_MPI_File_set_size( hypre_MPI_File   fh,
+                         hypre_MPI_Offset size )
+{
+   /* stdio cannot resize a stream; this only succeeds if the file already
+      has the requested size, e.g. size 0 right after opening for writing */
+   if (fseek(fh, 0, SEEK_END) || ftell(fh) != size)
+   {
+      return(1);
+   }
+
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_File_read_at_all( hypre_MPI_File      fh,
+                            hypre_MPI_Offset    offset,
+                            void               *buf,
+                            HYPRE_Int           count,
+                            hypre_MPI_Datatype  datatype,
+                            hypre_MPI_Status   *status )
+{
+   if (count > 0)
+   {
+      if (fseek(fh, offset, SEEK_SET) ||
+          fread(buf, hypre_MPI_TypeSize(datatype), count, fh) != (size_t) count)
+      {
+         return(1);
+      }
+   }
+
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at_all( hypre_MPI_File      fh,
+                             hypre_MPI_Offset    offset,
+                             void               *buf,
+                             HYPRE_Int           count,
+                             hypre_MPI_Datatype  datatype,
+                             hypre_MPI_Status   *status )
+{
+   if (count > 0)
+   {
+      if (fseek(fh, offset, SEEK_SET) ||
+          fwrite(buf, hypre_MPI_TypeSize(datatype), count, fh) != (size_t) count)
+      {
+         return(1);
+      }
+   }
+
+   return(0);
+}
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
@@ -1303,6 +1483,159 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+/* graph with unit edge weights and the process ordering kept (no reordering).
+ * The weights are passed explicitly rather than as MPI_UNWEIGHTED, which some
+ * MPI headers define as a fake pointer that compilers flag as an overread. */
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      hypre_MPI_Comm *graph_comm )
+{
+#if MPI_VERSION > 2
+   HYPRE_Int  max_degree       = hypre_max(hypre_max(indegree, outdegree), 1);
+   hypre_int *mpi_sources      = hypre_TAlloc(hypre_int, indegree,   HYPRE_MEMORY_HOST);
+   hypre_int *mpi_destinations = hypre_TAlloc(hypre_int, outdegree,  HYPRE_MEMORY_HOST);
+   hypre_int *mpi_weights      = hypre_TAlloc(hypre_int, max_degree, HYPRE_MEMORY_HOST);
+   HYPRE_Int  i, ierr;
+
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+   }
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+   }
+   for (i = 0; i < max_degree; i++)
+   {
+      mpi_weights[i] = 1;
+   }
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm, (hypre_int)indegree, mpi_sources,
+                                                     mpi_weights, (hypre_int)outdegree,
+                                                     mpi_destinations, mpi_weights,
+                                                     MPI_INFO_NULL, 0, graph_comm);
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_weights, HYPRE_MEMORY_HOST);
+
+   return ierr;
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+/* falls back to a blocking reduction before MPI-3 */
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
+/* the count and displacement arrays must stay valid until the request
+   completes, so they are passed as hypre_int and not converted here */
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                              recvbuf, recvcounts, rdispls, recvtype,
+                                              comm, request);
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_alltoallv_init( void               *sendbuf,
+                                   hypre_int          *sendcounts,
+                                   hypre_int          *sdispls,
+                                   hypre_MPI_Datatype  sendtype,
+                                   void               *recvbuf,
+                                   hypre_int          *recvcounts,
+                                   hypre_int          *rdispls,
+                                   hypre_MPI_Datatype  recvtype,
+                                   hypre_MPI_Comm      comm,
+                                   hypre_MPI_Request  *request )
+{
+#if MPI_VERSION > 3
+   return (HYPRE_Int) MPI_Neighbor_alltoallv_init(sendbuf, sendcounts, sdispls, sendtype,
+                                                  recvbuf, recvcounts, rdispls, recvtype,
+                                                  comm, MPI_INFO_NULL, request);
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+HYPRE_Int
+hypre_MPI_File_open( hypre_MPI_Comm   comm,
+                     const char      *filename,
+                     HYPRE_Int        amode,
+                     hypre_MPI_Info   info,
+                     hypre_MPI_File  *fh )
+{
+   return (HYPRE_Int) MPI_File_open(comm, (char *) filename, (hypre_int) amode, info, fh);
+}
+
+HYPRE_Int
+hypre_MPI_File_close( hypre_MPI_File *fh )
+{
+   return (HYPRE_Int) MPI_File_close(fh);
+}
+
+HYPRE_Int
+hypre_MPI_File_set_size( hypre_MPI_File   fh,
+                         hypre_MPI_Offset size )
+{
+   return (HYPRE_Int) MPI_File_set_size(fh, size);
+}
+
+HYPRE_Int
+hypre_MPI_File_read_at_all( hypre_MPI_File      fh,
+                            hypre_MPI_Offset    offset,
+                            void               *buf,
+                            HYPRE_Int           count,
+                            hypre_MPI_Datatype  datatype,
+                            hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_read_at_all(fh, offset, buf, (hypre_int) count, datatype, status);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at_all( hypre_MPI_File      fh,
+                             hypre_MPI_Offset    offset,
+                             void               *buf,
+                             HYPRE_Int           count,
+                             hypre_MPI_Datatype  datatype,
+                             hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_write_at_all(fh, offset, buf, (hypre_int) count, datatype, status);
+}
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
@@ -150,6 +150,8 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef FILE      *hypre_MPI_File;
+typedef hypre_longint hypre_MPI_Offset;
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
@@ -158,6 +160,7 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_COMM_TYPE_SHARED 0
 
 #define  hypre_MPI_BOTTOM  0x0
+#define  hypre_MPI_IN_PLACE ((void *) 1)
 
 #define  hypre_MPI_FLOAT 0
 #define  hypre_MPI_DOUBLE 1
@@ -183,6 +186,10 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+#define  hypre_MPI_MODE_CREATE   1
+#define  hypre_MPI_MODE_RDONLY   2
+#define  hypre_MPI_MODE_WRONLY   4
+
 #else
 
 /******************************************************************************
@@ -197,11 +204,14 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_File     hypre_MPI_File;
+typedef MPI_Offset   hypre_MPI_Offset;
 typedef MPI_User_function    hypre_MPI_User_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
+#define  hypre_MPI_IN_PLACE           MPI_IN_PLACE
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
 
@@ -233,6 +243,9 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_SOURCE          MPI_SOURCE
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
+#define  hypre_MPI_MODE_CREATE     MPI_MODE_CREATE
+#define  hypre_MPI_MODE_RDONLY     MPI_MODE_RDONLY
+#define  hypre_MPI_MODE_WRONLY     MPI_MODE_WRONLY
 
 #endif
 
@@ -298,6 +311,15 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , hypre_MPI_Comm *graph_comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Neighbor_alltoallv_init( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_File_open( hypre_MPI_Comm comm , const char *filename , HYPRE_Int amode , hypre_MPI_Info info , hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_close( hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_set_size( hypre_MPI_File fh , hypre_MPI_Offset size );
+HYPRE_Int hypre_MPI_File_read_at_all( hypre_MPI_File fh , hypre_MPI_Offset offset , void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_write_at_all( hypre_MPI_File fh , hypre_MPI_Offset offset , void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Status *status );
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
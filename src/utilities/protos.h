@@ -42,6 +42,16 @@ HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
 HYPRE_Int hypre_UmpireInit(hypre_Handle *hypre_handle_);
 HYPRE_Int hypre_UmpireFinalize(hypre_Handle *hypre_handle_);
 
+/* hypre_host_pool.c */
+void hypre_HostPoolSetEnabled ( HYPRE_Int enabled );
+HYPRE_Int hypre_HostPoolEnabled ( void );
+HYPRE_Int hypre_HostPoolActive ( void );
+void *hypre_HostPoolMalloc ( size_t size , HYPRE_Int zeroinit );
+void hypre_HostPoolFree ( void *ptr );
+void *hypre_HostPoolRealloc ( void *ptr , size_t size );
+HYPRE_Int hypre_HostPoolTrim ( void );
+HYPRE_Int hypre_HostPoolPrintStats ( void );
+
 /* hypre_qsort.c */
 void hypre_swap ( HYPRE_Int *v , HYPRE_Int i , HYPRE_Int j );
 void hypre_swap2 ( HYPRE_Int *v , HYPRE_Real *w , HYPRE_Int i , HYPRE_Int j );